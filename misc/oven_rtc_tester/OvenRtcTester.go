@@ -1,6 +1,8 @@
 package main
 
 import (
+	"bytes"
+	"encoding/binary"
 	"encoding/json"
 	"flag"
 	"fmt"
@@ -8,6 +10,8 @@ import (
 	"math"
 	"os"
 	"os/signal"
+	"sort"
+	"strings"
 	"sync"
 	"time"
 	"net/url"
@@ -145,6 +149,11 @@ type sessionStat struct {
 	videoDelay float64
 	audioRtpTimestampElapsedMSec int64
 	audioDelay float64
+
+	// Glass-to-glass latency recovered from the time code of OME SEI
+	latencyMarkers int64
+	lastLatency float64
+	latencySamples []float64
 }
 
 type omeClient struct {
@@ -294,6 +303,7 @@ func reportSummury(clients *[]*omeClient) {
 	var minAvgFPS, maxAvgFPS float64
 	var minAvgBPS, maxAvgBPS int64
 	var minGOP, maxGOP float64
+	var latencySamples []float64
 
 	for _, client := range *clients {
 		stat := client.stat
@@ -321,6 +331,8 @@ func reportSummury(clients *[]*omeClient) {
 
 		gop := float64(stat.totalVideoFrames) / float64(stat.totalVideoKeyframes)
 
+		latencySamples = append(latencySamples, stat.latencySamples...)
+
 		if totalStat.startTime.IsZero() {
 			totalStat = stat
 
@@ -377,6 +389,11 @@ func reportSummury(clients *[]*omeClient) {
 
 	fmt.Printf("Avg Video Delay(%.2f ms) Max Video Delay(%.2f ms) Min Video Delay(%.2f ms)\nAvg Audio Delay(%.2f ms) Max Audio Delay(%.2f ms) Min Audio Delay(%.2f ms)\n", totalStat.videoDelay/float64(connected), maxVideoDelay, minVideoDelay, totalStat.audioDelay/float64(connected), maxAudioDelay, minAudioDelay)
 
+	if len(latencySamples) > 0 {
+		sorted := sortedCopy(latencySamples)
+		fmt.Printf("Glass-to-glass Latency : Samples(%d) P50(%.0f ms) P90(%.0f ms) P99(%.0f ms) Max(%.0f ms)\n", len(sorted), percentile(sorted, 50), percentile(sorted, 90), percentile(sorted, 99), sorted[len(sorted)-1])
+	}
+
 	fmt.Printf("Avg GOP(%.2f) Max GOP(%.2f) Min GOP(%2.f)\n", float64(totalStat.totalVideoFrames) / float64(totalStat.totalVideoKeyframes), maxGOP, minGOP)
 	
 	fmt.Printf("Avg FPS(%.2f) Max FPS(%.2f) Min FPS(%.2f)\nAvg BPS(%sbps) Max BPS(%sbps) Min BPS(%sbps)\n", totalStat.avgFPS/float64(connected), maxAvgFPS, minAvgFPS, CountDecimal(totalStat.avgBPS/connected), CountDecimal(maxAvgBPS), CountDecimal(minAvgBPS))
@@ -404,8 +421,14 @@ func (c *omeClient) report() {
 		audioDelay = math.Abs(float64(time.Since(stat.startTime).Milliseconds() - stat.audioRtpTimestampElapsedMSec))
 	}
 
-	fmt.Printf("%c[32m[%s]%c[0m\n\trunning_time(%s) connection_state(%s) total_packets(%d) packet_loss(%d)\n\tlast_video_delay (%.1f ms) last_audio_delay (%.1f ms)\n\ttotal_bytes(%sbytes) avg_bps(%sbps) min_bps(%sbps) max_bps(%sbps)\n\ttotal_video_frames(%d) total_video_keyframes(%d) avg_gop(%2.f) avg_fps(%.2f) min_fps(%.2f) max_fps(%.2f)\n\n",
-		27, c.name, 27, time.Since(stat.startTime).Round(time.Second), stat.connectionState.String(), stat.totalRtpPackets, stat.packetLoss, videoDelay, audioDelay, CountDecimal(stat.totalBytes), CountDecimal(stat.avgBPS), CountDecimal(stat.minBPS), CountDecimal(stat.maxBPS), stat.totalVideoFrames, stat.totalVideoKeyframes, float64(stat.totalVideoFrames) / float64(stat.totalVideoKeyframes), stat.avgFPS, stat.minFPS, stat.maxFPS)
+	latencyString := "n/a"
+	if stat.latencyMarkers > 0 {
+		sorted := sortedCopy(stat.latencySamples)
+		latencyString = fmt.Sprintf("markers(%d) last(%.0f ms) p50(%.0f ms) p99(%.0f ms)", stat.latencyMarkers, stat.lastLatency, percentile(sorted, 50), percentile(sorted, 99))
+	}
+
+	fmt.Printf("%c[32m[%s]%c[0m\n\tglass_to_glass_latency %s\n\trunning_time(%s) connection_state(%s) total_packets(%d) packet_loss(%d)\n\tlast_video_delay (%.1f ms) last_audio_delay (%.1f ms)\n\ttotal_bytes(%sbytes) avg_bps(%sbps) min_bps(%sbps) max_bps(%sbps)\n\ttotal_video_frames(%d) total_video_keyframes(%d) avg_gop(%2.f) avg_fps(%.2f) min_fps(%.2f) max_fps(%.2f)\n\n",
+		27, c.name, 27, latencyString, time.Since(stat.startTime).Round(time.Second), stat.connectionState.String(), stat.totalRtpPackets, stat.packetLoss, videoDelay, audioDelay, CountDecimal(stat.totalBytes), CountDecimal(stat.avgBPS), CountDecimal(stat.minBPS), CountDecimal(stat.maxBPS), stat.totalVideoFrames, stat.totalVideoKeyframes, float64(stat.totalVideoFrames) / float64(stat.totalVideoKeyframes), stat.avgFPS, stat.minFPS, stat.maxFPS)
 }
 
 func (c *omeClient) run(url string) error {
@@ -544,6 +567,7 @@ func (c *omeClient) run(url string) error {
 
 		prev_seq := uint16(0)
 		startTimestamp := uint32(0)
+		markerParser := latencyMarkerParser{}
 		last_report_time := time.Now().AddDate(0, 0, -1)
 
 		for {
@@ -575,6 +599,16 @@ func (c *omeClient) run(url string) error {
 
 			switch track.Kind() {
 			case webrtc.RTPCodecTypeVideo:
+				if strings.EqualFold(track.Codec().MimeType, webrtc.MimeTypeH264) {
+					if timeCode, ok := markerParser.push(rtp.Payload); ok {
+						latency := float64(time.Now().UnixNano()/int64(time.Millisecond) - int64(timeCode))
+
+						c.stat.latencyMarkers++
+						c.stat.lastLatency = latency
+						c.stat.latencySamples = addLatencySample(c.stat.latencySamples, latency)
+					}
+				}
+
 				if rtp.Marker {
 					c.stat.totalVideoFrames++
 
@@ -692,4 +726,180 @@ func CountDecimal(b int64) string {
 		exp++
 	}
 	return fmt.Sprintf("%.1f %c", float64(b)/float64(div), "kMGTPE"[exp])
-}
\ No newline at end of file
+}
+
+// OvenMediaEngine inserts SEI(user_data_unregistered) with this UUID followed by the epoch time in milliseconds,
+// when the EventGenerator of the application is configured with <EventFormat>sei</EventFormat>.
+// The difference between the time code and the time of reception is the glass-to-glass latency,
+// so OME and this tester must share the same clock (the same host or NTP synchronized hosts).
+var omeSeiType1UUID = []byte{0x46, 0x4D, 0x4C, 0x47, 0x52, 0x41, 0x49, 0x4E, 0x43, 0x4F, 0x4C, 0x4F, 0x55, 0x52, 0x42, 0x01}
+
+const (
+	h264NalTypeSEI   = 6
+	h264NalTypeStapA = 24
+	h264NalTypeFuA   = 28
+
+	seiPayloadTypeUserDataUnregistered = 5
+
+	// Number of latency samples kept per client
+	maxLatencySamples = 1024
+)
+
+// Recovers the time code of OME SEI from H.264 RTP payloads (RFC 6184)
+type latencyMarkerParser struct {
+	fuaBuffer []byte
+	fuaActive bool
+}
+
+// Returns the time code (epoch milliseconds) if the payload completes an OME SEI
+func (p *latencyMarkerParser) push(payload []byte) (uint64, bool) {
+	if len(payload) < 1 {
+		return 0, false
+	}
+
+	switch payload[0] & 0x1F {
+	case h264NalTypeSEI:
+		return parseOmeSei(payload)
+
+	case h264NalTypeStapA:
+		offset := 1
+		for offset+2 <= len(payload) {
+			size := int(binary.BigEndian.Uint16(payload[offset:]))
+			offset += 2
+			if size == 0 || offset+size > len(payload) {
+				break
+			}
+
+			nal := payload[offset : offset+size]
+			offset += size
+
+			if nal[0]&0x1F == h264NalTypeSEI {
+				if timeCode, ok := parseOmeSei(nal); ok {
+					return timeCode, true
+				}
+			}
+		}
+
+	case h264NalTypeFuA:
+		if len(payload) < 2 {
+			return 0, false
+		}
+
+		start := payload[1]&0x80 != 0
+		end := payload[1]&0x40 != 0
+		nalType := payload[1] & 0x1F
+
+		if start {
+			p.fuaActive = nalType == h264NalTypeSEI
+			p.fuaBuffer = p.fuaBuffer[:0]
+			if p.fuaActive {
+				// Rebuild the NAL header from FU indicator and FU header
+				p.fuaBuffer = append(p.fuaBuffer, (payload[0]&0xE0)|nalType)
+			}
+		}
+
+		if p.fuaActive == false {
+			return 0, false
+		}
+
+		p.fuaBuffer = append(p.fuaBuffer, payload[2:]...)
+
+		if end {
+			p.fuaActive = false
+			return parseOmeSei(p.fuaBuffer)
+		}
+	}
+
+	return 0, false
+}
+
+func parseOmeSei(nal []byte) (uint64, bool) {
+	// Remove emulation prevention bytes (0x000003)
+	rbsp := make([]byte, 0, len(nal))
+	zeros := 0
+	for _, b := range nal[1:] {
+		if zeros >= 2 && b == 0x03 {
+			zeros = 0
+			continue
+		}
+
+		if b == 0x00 {
+			zeros++
+		} else {
+			zeros = 0
+		}
+
+		rbsp = append(rbsp, b)
+	}
+
+	offset := 0
+	for offset < len(rbsp) && rbsp[offset] != 0x80 {
+		payloadType := 0
+		for offset < len(rbsp) && rbsp[offset] == 0xFF {
+			payloadType += 0xFF
+			offset++
+		}
+		if offset >= len(rbsp) {
+			break
+		}
+		payloadType += int(rbsp[offset])
+		offset++
+
+		payloadSize := 0
+		for offset < len(rbsp) && rbsp[offset] == 0xFF {
+			payloadSize += 0xFF
+			offset++
+		}
+		if offset >= len(rbsp) {
+			break
+		}
+		payloadSize += int(rbsp[offset])
+		offset++
+
+		if offset+payloadSize > len(rbsp) {
+			break
+		}
+
+		payload := rbsp[offset : offset+payloadSize]
+		offset += payloadSize
+
+		if payloadType != seiPayloadTypeUserDataUnregistered || len(payload) < len(omeSeiType1UUID)+8 {
+			continue
+		}
+
+		if bytes.Equal(payload[:len(omeSeiType1UUID)], omeSeiType1UUID) == false {
+			continue
+		}
+
+		return binary.BigEndian.Uint64(payload[len(omeSeiType1UUID):]), true
+	}
+
+	return 0, false
+}
+
+func addLatencySample(samples []float64, latency float64) []float64 {
+	if len(samples) >= maxLatencySamples {
+		samples = samples[1:]
+	}
+
+	return append(samples, latency)
+}
+
+// samples must be sorted
+func percentile(samples []float64, p float64) float64 {
+	if len(samples) == 0 {
+		return 0
+	}
+
+	index := int(float64(len(samples)-1) * p / 100.0)
+
+	return samples[index]
+}
+
+func sortedCopy(samples []float64) []float64 {
+	sorted := make([]float64, len(samples))
+	copy(sorted, samples)
+	sort.Float64s(sorted)
+
+	return sorted
+}
@@ -18,6 +18,7 @@ namespace api
 			{
 				RegisterGet(R"()", &InternalsController::OnGetInternals);
 				RegisterGet(R"(\/queues)", &InternalsController::OnGetQueues);
+				RegisterGet(R"(\/tlsSessions)", &InternalsController::OnGetTlsSessions);
 			};
 
 			ApiResponse InternalsController::OnGetInternals(const std::shared_ptr<http::svr::HttpExchange> &client)
@@ -25,6 +26,7 @@ namespace api
 				Json::Value response(Json::ValueType::arrayValue);
 
 				response.append("/v1/stats/current/internals/queues");
+				response.append("/v1/stats/current/internals/tlsSessions");
 
 				return response;
 			}
@@ -47,6 +49,25 @@ namespace api
 
 				return response;
 			}
+
+			ApiResponse InternalsController::OnGetTlsSessions(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				Json::Value response(Json::ValueType::arrayValue);
+
+				auto serverMetric = MonitorInstance->GetServerMetrics();
+
+				for (auto &[address, metrics] : serverMetric->GetTlsSessionMetricsList())
+				{
+					Json::Value obj = serdes::JsonFromTlsSessionMetrics(metrics);
+
+					if (obj.isNull())
+						continue;
+
+					response.append(obj);
+				}
+
+				return response;
+			}
 		}  // namespace stats
 	}  // namespace v1
 }  // namespace api
\ No newline at end of file
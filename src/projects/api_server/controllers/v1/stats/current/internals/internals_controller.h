@@ -24,6 +24,7 @@ namespace api
 			protected:
 				ApiResponse OnGetInternals(const std::shared_ptr<http::svr::HttpExchange> &client);
 				ApiResponse OnGetQueues(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetTlsSessions(const std::shared_ptr<http::svr::HttpExchange> &client);
 			};
 		}  // namespace stats
 	}  // namespace v1
@@ -17,6 +17,8 @@ namespace api
 			void StreamsController::PrepareHandlers()
 			{
 				RegisterGet(R"(\/(?<stream_name>[^\/]*))", &StreamsController::OnGetStream);
+				RegisterGet(R"(\/(?<stream_name>[^\/]*)\/latency)", &StreamsController::OnGetLatency);
+				RegisterGet(R"(\/(?<stream_name>[^\/]*)\/latency\/trace)", &StreamsController::OnGetLatencyTrace);
 			};
 
 			ApiResponse StreamsController::OnGetStream(const std::shared_ptr<http::svr::HttpExchange> &client,
@@ -25,7 +27,43 @@ namespace api
 													   const std::shared_ptr<mon::StreamMetrics> &stream,
 													   const std::vector<std::shared_ptr<mon::StreamMetrics>> &output_streams)
 			{
-				return ::serdes::JsonFromMetrics(stream);
+				return ::serdes::JsonFromStreamMetrics(stream);
+			}
+
+			ApiResponse StreamsController::OnGetLatency(const std::shared_ptr<http::svr::HttpExchange> &client,
+														const std::shared_ptr<mon::HostMetrics> &vhost,
+														const std::shared_ptr<mon::ApplicationMetrics> &app,
+														const std::shared_ptr<mon::StreamMetrics> &stream,
+														const std::vector<std::shared_ptr<mon::StreamMetrics>> &output_streams)
+			{
+				Json::Value response = Json::arrayValue;
+
+				for (const auto &output_stream : output_streams)
+				{
+					Json::Value item;
+					item["name"] = output_stream->GetName().CStr();
+
+					Json::Value &publishers = item["publishers"];
+					publishers = Json::arrayValue;
+
+					for (const auto &latency_metrics : output_stream->GetLatencyMetricsList())
+					{
+						publishers.append(::serdes::JsonFromLatencyMetrics(latency_metrics));
+					}
+
+					response.append(item);
+				}
+
+				return response;
+			}
+
+			ApiResponse StreamsController::OnGetLatencyTrace(const std::shared_ptr<http::svr::HttpExchange> &client,
+															 const std::shared_ptr<mon::HostMetrics> &vhost,
+															 const std::shared_ptr<mon::ApplicationMetrics> &app,
+															 const std::shared_ptr<mon::StreamMetrics> &stream,
+															 const std::vector<std::shared_ptr<mon::StreamMetrics>> &output_streams)
+			{
+				return ::serdes::JsonFromLatencySamples(output_streams);
 			}
 		}  // namespace stats
 	}  // namespace v1
@@ -27,6 +27,20 @@ namespace api
 										const std::shared_ptr<mon::ApplicationMetrics> &app,
 										const std::shared_ptr<mon::StreamMetrics> &stream,
 										const std::vector<std::shared_ptr<mon::StreamMetrics>> &output_streams);
+
+				// Latency from ingest to each stage of the hot path, per output stream and publisher
+				ApiResponse OnGetLatency(const std::shared_ptr<http::svr::HttpExchange> &client,
+										 const std::shared_ptr<mon::HostMetrics> &vhost,
+										 const std::shared_ptr<mon::ApplicationMetrics> &app,
+										 const std::shared_ptr<mon::StreamMetrics> &stream,
+										 const std::vector<std::shared_ptr<mon::StreamMetrics>> &output_streams);
+
+				// Recently sampled traces in the Chrome trace event format
+				ApiResponse OnGetLatencyTrace(const std::shared_ptr<http::svr::HttpExchange> &client,
+											  const std::shared_ptr<mon::HostMetrics> &vhost,
+											  const std::shared_ptr<mon::ApplicationMetrics> &app,
+											  const std::shared_ptr<mon::StreamMetrics> &stream,
+											  const std::vector<std::shared_ptr<mon::StreamMetrics>> &output_streams);
 			};
 		}  // namespace stats
 	}  // namespace v1
@@ -14,6 +14,7 @@
 #include <stdint.h>
 #include <map>
 
+#include "media_trace.h"
 #include "media_type.h"
 
 
@@ -54,6 +55,7 @@ public:
 		  _bitstream_format(bitstream_format),
 		  _packet_type(packet_type)
 	{
+		_trace.Mark(MediaTraceStage::Ingest);
 	}
 
 	MediaPacket(uint32_t msid, cmn::MediaType media_type, uint32_t track_id,
@@ -228,6 +230,7 @@ public:
 		packet->_frag_hdr = _frag_hdr;
 		packet->_high_priority = _high_priority;
 		packet->_is_internal_created = _is_internal_created;
+		packet->_trace = _trace;
 
 		return packet;
 	}
@@ -255,6 +258,21 @@ public:
 		return _creation_time;
 	}
 
+	MediaTrace &GetTrace()
+	{
+		return _trace;
+	}
+
+	const MediaTrace &GetTrace() const
+	{
+		return _trace;
+	}
+
+	void SetTrace(const MediaTrace &trace)
+	{
+		_trace = trace;
+	}
+
 protected:
 	uint32_t _msid = 0;
 	cmn::MediaType _media_type = cmn::MediaType::Unknown;
@@ -279,5 +297,8 @@ protected:
 
 	// creation timepoint
 	std::chrono::time_point<std::chrono::system_clock> _creation_time = std::chrono::system_clock::now();
+
+	// Time at which this packet passed each stage of the hot path
+	MediaTrace _trace;
 };
 
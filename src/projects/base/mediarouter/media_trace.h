@@ -0,0 +1,199 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#pragma once
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <mutex>
+
+// Points of the hot path at which a media packet(or frame) is timestamped
+enum class MediaTraceStage : uint8_t
+{
+	// The provider created the packet
+	Ingest = 0,
+	// MediaRouter normalized the packet of the input stream
+	InboundRoute,
+	// Transcoder
+	Decode,
+	Filter,
+	Encode,
+	// MediaRouter normalized the packet of the output stream
+	OutboundRoute,
+	// pub::ApplicationWorker dequeued the packet
+	PublisherQueue,
+	// The publisher stream finished packetizing the packet
+	Packetize,
+	// The packetized data was handed over to the sessions
+	Send,
+
+	// End Marker
+	Count
+};
+
+static inline const char *GetMediaTraceStageString(MediaTraceStage stage)
+{
+	switch (stage)
+	{
+		case MediaTraceStage::Ingest:
+			return "ingest";
+		case MediaTraceStage::InboundRoute:
+			return "inboundRoute";
+		case MediaTraceStage::Decode:
+			return "decode";
+		case MediaTraceStage::Filter:
+			return "filter";
+		case MediaTraceStage::Encode:
+			return "encode";
+		case MediaTraceStage::OutboundRoute:
+			return "outboundRoute";
+		case MediaTraceStage::PublisherQueue:
+			return "publisherQueue";
+		case MediaTraceStage::Packetize:
+			return "packetize";
+		case MediaTraceStage::Send:
+			return "send";
+		default:
+			return "unknown";
+	}
+}
+
+// Fixed-size slot that holds the time at which a packet passed each stage.
+// It is copied along with the packet, so it must be kept small and trivially copyable.
+class MediaTrace
+{
+public:
+	static constexpr size_t StageCount = static_cast<size_t>(MediaTraceStage::Count);
+
+	// Monotonic time in microseconds
+	static int64_t NowUs()
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	void Mark(MediaTraceStage stage)
+	{
+		Mark(stage, NowUs());
+	}
+
+	void Mark(MediaTraceStage stage, int64_t time_us)
+	{
+		_timestamps[static_cast<size_t>(stage)] = time_us;
+	}
+
+	bool IsMarked(MediaTraceStage stage) const
+	{
+		return _timestamps[static_cast<size_t>(stage)] > 0;
+	}
+
+	int64_t GetTime(MediaTraceStage stage) const
+	{
+		return _timestamps[static_cast<size_t>(stage)];
+	}
+
+	// Elapsed time from ingest to the stage, -1 if one of them is not marked
+	int64_t GetElapsedUs(MediaTraceStage stage) const
+	{
+		if (IsMarked(MediaTraceStage::Ingest) == false || IsMarked(stage) == false)
+		{
+			return -1LL;
+		}
+
+		return GetTime(stage) - GetTime(MediaTraceStage::Ingest);
+	}
+
+	void Reset()
+	{
+		_timestamps.fill(0);
+	}
+
+private:
+	std::array<int64_t, StageCount> _timestamps = {};
+};
+
+// The decoder, filters and encoders create a new buffer for their output, so the trace of the input is lost.
+// MediaTraceHistory remembers the traces of the recent inputs by timestamp,
+// so that the output can take over the trace of the input it was made from.
+// The timestamps of the inputs and outputs must be in the same unit.
+class MediaTraceHistory
+{
+public:
+	static constexpr size_t Capacity = 32;
+
+	void Push(int64_t timestamp, const MediaTrace &trace)
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		auto &entry = _entries[_next];
+		entry.timestamp = timestamp;
+		entry.trace = trace;
+
+		_next = (_next + 1) % Capacity;
+		_count = std::min(_count + 1, Capacity);
+	}
+
+	// Finds the trace of the input with the same timestamp.
+	// If there is no such input (e.g. audio is re-chunked, frame rate is converted),
+	// the closest preceding input is used instead.
+	bool Find(int64_t timestamp, MediaTrace &trace) const
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		const Entry *found = nullptr;
+
+		for (size_t i = 0; i < _count; i++)
+		{
+			auto &entry = _entries[i];
+
+			if (entry.timestamp == timestamp)
+			{
+				found = &entry;
+				break;
+			}
+
+			if ((entry.timestamp < timestamp) &&
+				((found == nullptr) || (entry.timestamp > found->timestamp)))
+			{
+				found = &entry;
+			}
+		}
+
+		if (found == nullptr)
+		{
+			return false;
+		}
+
+		trace = found->trace;
+
+		return true;
+	}
+
+	void Clear()
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		_next = 0;
+		_count = 0;
+	}
+
+private:
+	struct Entry
+	{
+		int64_t timestamp = 0;
+		MediaTrace trace;
+	};
+
+	mutable std::mutex _mutex;
+	std::array<Entry, Capacity> _entries;
+	size_t _next = 0;
+	size_t _count = 0;
+};
@@ -37,6 +37,19 @@ namespace base
 			
 			// Segment must be independent
 			bool IsIndependent() const override { return true; }
+
+			// The data of the segment as a list of buffers (e.g. partial segments).
+			// Use this instead of GetData() to avoid concatenating the buffers.
+			virtual std::vector<std::shared_ptr<const ov::Data>> GetDataList() const
+			{
+				auto data = GetData();
+				if (data == nullptr)
+				{
+					return {};
+				}
+
+				return {data};
+			}
 		};
 
 		class SegmentStorage
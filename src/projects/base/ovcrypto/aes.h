@@ -16,6 +16,19 @@ namespace ov
 	class AES
 	{
 	public:
+		AES() = default;
+		AES(const AES &) = delete;
+		AES &operator=(const AES &) = delete;
+
+		~AES()
+		{
+			if (_ctx != nullptr)
+			{
+				EVP_CIPHER_CTX_free(_ctx);
+				_ctx = nullptr;
+			}
+		}
+
         // output must be allocated with input_length + AES_BLOCK_SIZE
 		static bool EncryptWith128Cbc(const void *input, size_t input_length, void *output, const uint8_t *key, size_t key_length, const uint8_t *iv, size_t iv_length)
 		{
@@ -101,6 +114,11 @@ namespace ov
 
 		bool Initialize(const EVP_CIPHER *cipher, const uint8_t *key, size_t key_length, const uint8_t *iv, size_t iv_length, bool padding)
 		{
+			if (_ctx != nullptr)
+			{
+				EVP_CIPHER_CTX_free(_ctx);
+			}
+
 			_ctx = EVP_CIPHER_CTX_new();
 			if (_ctx == nullptr)
 			{
@@ -110,6 +128,7 @@ namespace ov
 			if (EVP_EncryptInit_ex(_ctx, cipher, nullptr, (const unsigned char *)key, (const unsigned char *)iv) != 1)
 			{
 				EVP_CIPHER_CTX_free(_ctx);
+				_ctx = nullptr;
 				return false;
 			}
 
@@ -120,6 +139,25 @@ namespace ov
 			return true;
 		}
 
+		// Restarts the cipher with a new IV (or counter block in CTR mode) while keeping the key schedule,
+		// which is much cheaper than creating a new context for every sample
+		bool ResetIv(const uint8_t *iv, size_t iv_length)
+		{
+			if ((_ctx == nullptr) || (iv_length != static_cast<size_t>(EVP_CIPHER_CTX_iv_length(_ctx))))
+			{
+				return false;
+			}
+
+			if (EVP_EncryptInit_ex(_ctx, nullptr, nullptr, nullptr, (const unsigned char *)iv) != 1)
+			{
+				return false;
+			}
+
+			_output_length = 0;
+
+			return true;
+		}
+
 		bool Update(const void *input, size_t input_length, void *output)
 		{
 			int output_length_actual = 0;
@@ -637,6 +637,11 @@ namespace ov
 		return ov::String(reinterpret_cast<const char *>(data), len);
 	}
 
+	bool Tls::IsSessionReused() const
+	{
+		return (_ssl != nullptr) && (::SSL_session_reused(_ssl) == 1);
+	}
+
 	long Tls::GetVersion() const
 	{
 		// Holds _peer_certificate to prevent referencing nullptr
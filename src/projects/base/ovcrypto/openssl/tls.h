@@ -58,6 +58,8 @@ namespace ov
 
 		ov::String GetServerName() const;
 		ov::String GetSelectedAlpnName() const;
+		// Whether the handshake resumed a previous session (session ticket or session ID)
+		bool IsSessionReused() const;
 
 		// Obtains a string in the BIO which allocated using BIO_new(BIO_s_mem())
 		static ov::String StringFromX509Name(const X509_NAME *name);
@@ -344,6 +344,17 @@ namespace ov
 		::SSL_CTX_set_verify(_ssl_ctx, mode, nullptr);
 	}
 
+	void TlsContext::SetSessionResumption(const std::shared_ptr<TlsSessionResumption> &session_resumption)
+	{
+		if (session_resumption == nullptr)
+		{
+			return;
+		}
+
+		session_resumption->Apply(_ssl_ctx);
+		_session_resumption = session_resumption;
+	}
+
 	int TlsContext::TlsVerify(X509_STORE_CTX *store, void *arg)
 	{
 		bool result = DO_CALLBACK_IF_AVAILABLE(bool, false, arg, verify_callback, store);
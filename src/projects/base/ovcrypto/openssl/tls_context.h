@@ -12,6 +12,7 @@
 #include "./ocsp_handler.h"
 #include "./openssl_error.h"
 #include "./tls_context_callback.h"
+#include "./tls_session_resumption.h"
 
 namespace ov
 {
@@ -57,6 +58,9 @@ namespace ov
 
 		void SetVerify(int mode);
 
+		MAY_THROWS(ov::OpensslError)
+		void SetSessionResumption(const std::shared_ptr<TlsSessionResumption> &session_resumption);
+
 	protected:
 		MAY_THROWS(ov::OpensslError)
 		void Prepare(
@@ -109,5 +113,8 @@ namespace ov
 		TlsContextCallback _callback;
 
 		OcspHandler _ocsp_handler;
+
+		// Referenced by the callbacks of _ssl_ctx, so it must live as long as this context
+		std::shared_ptr<TlsSessionResumption> _session_resumption;
 	};
 }  // namespace ov
@@ -0,0 +1,476 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "./tls_session_resumption.h"
+
+#include <openssl/core_names.h>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+
+#include "./openssl_private.h"
+
+namespace ov
+{
+	TlsSessionResumption::TlsSessionResumption(const ov::String &name, const TlsSessionResumptionOptions &options)
+		: _name(name),
+		  _options(options)
+	{
+		_cache_size_per_shard = std::max<size_t>(_options.cache_size / OV_TLS_SESSION_CACHE_SHARD_COUNT, 1);
+
+		if (_options.ticket_enabled)
+		{
+			RotateTicketKeys();
+		}
+
+		auto interval = std::min<int64_t>(static_cast<int64_t>(_options.ticket_key_rotation_interval) * 1000, OV_TLS_SESSION_MAINTENANCE_INTERVAL_MS);
+
+		_timer.Push(std::bind(&TlsSessionResumption::OnMaintenance, this, std::placeholders::_1), static_cast<int>(interval));
+		_timer.Start();
+	}
+
+	TlsSessionResumption::~TlsSessionResumption()
+	{
+		_timer.Stop();
+		_timer.Clear();
+
+		for (auto &shard : _shards)
+		{
+			std::lock_guard lock_guard(shard.mutex);
+
+			for (auto &item : shard.lru_list)
+			{
+				::SSL_SESSION_free(item.second);
+			}
+
+			shard.lru_list.clear();
+			shard.map.clear();
+		}
+
+		// Clear the keys from the memory
+		std::lock_guard lock_guard(_ticket_key_mutex);
+		for (auto &key : _ticket_keys)
+		{
+			::OPENSSL_cleanse(&key, sizeof(key));
+		}
+		_ticket_keys.clear();
+	}
+
+	int TlsSessionResumption::GetExDataIndex()
+	{
+		static int index = ::SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+		return index;
+	}
+
+	TlsSessionResumption *TlsSessionResumption::FromSslContext(const SSL_CTX *ssl_ctx)
+	{
+		if (ssl_ctx == nullptr)
+		{
+			return nullptr;
+		}
+
+		return static_cast<TlsSessionResumption *>(::SSL_CTX_get_ex_data(ssl_ctx, GetExDataIndex()));
+	}
+
+	void TlsSessionResumption::Apply(SSL_CTX *ssl_ctx)
+	{
+		if (ssl_ctx == nullptr)
+		{
+			throw OpensslError("Invalid SSL context");
+		}
+
+		if (::SSL_CTX_set_ex_data(ssl_ctx, GetExDataIndex(), this) != 1)
+		{
+			throw OpensslError("Could not set the session resumption to SSL context");
+		}
+
+		// All SSL_CTXs of the server share the session ID context, so the sessions can be resumed after the SNI callback switches SSL_CTX
+		auto sid_context_length = std::min<size_t>(_name.GetLength(), SSL_MAX_SID_CTX_LENGTH);
+		if (::SSL_CTX_set_session_id_context(ssl_ctx, reinterpret_cast<const unsigned char *>(_name.CStr()), sid_context_length) != 1)
+		{
+			throw OpensslError("Could not set the session ID context: %s", OpensslError().What());
+		}
+
+		::SSL_CTX_set_timeout(ssl_ctx, _options.session_timeout);
+
+		if (_options.cache_enabled)
+		{
+			// OpenSSL's internal cache is per SSL_CTX and is cleaned up while handling the handshakes, so use our own cache instead
+			::SSL_CTX_set_session_cache_mode(ssl_ctx, SSL_SESS_CACHE_SERVER | SSL_SESS_CACHE_NO_INTERNAL | SSL_SESS_CACHE_NO_AUTO_CLEAR);
+			::SSL_CTX_sess_set_new_cb(ssl_ctx, OnNewSessionCallback);
+			::SSL_CTX_sess_set_get_cb(ssl_ctx, OnGetSessionCallback);
+			::SSL_CTX_sess_set_remove_cb(ssl_ctx, OnRemoveSessionCallback);
+		}
+		else
+		{
+			::SSL_CTX_set_session_cache_mode(ssl_ctx, SSL_SESS_CACHE_OFF);
+		}
+
+		if (_options.ticket_enabled)
+		{
+			::SSL_CTX_clear_options(ssl_ctx, SSL_OP_NO_TICKET);
+
+			if (::SSL_CTX_set_tlsext_ticket_key_evp_cb(ssl_ctx, OnTicketKeyCallback) != 1)
+			{
+				throw OpensslError("Could not set the session ticket callback: %s", OpensslError().What());
+			}
+		}
+		else
+		{
+			::SSL_CTX_set_options(ssl_ctx, SSL_OP_NO_TICKET);
+
+			if (_options.cache_enabled == false)
+			{
+				// Do not send the TLS 1.3 tickets that can never be used
+				::SSL_CTX_set_num_tickets(ssl_ctx, 0);
+			}
+		}
+	}
+
+	void TlsSessionResumption::RotateTicketKeys()
+	{
+		TicketKey key;
+
+		if ((::RAND_bytes(key.name, sizeof(key.name)) != 1) ||
+			(::RAND_bytes(key.aes_key, sizeof(key.aes_key)) != 1) ||
+			(::RAND_bytes(key.hmac_key, sizeof(key.hmac_key)) != 1))
+		{
+			logte("[%s] Could not generate a session ticket key: %s", _name.CStr(), OpensslError().What());
+			return;
+		}
+
+		// The tickets issued with the previous keys are accepted until they expire
+		size_t max_key_count = 1 + ((_options.session_timeout + _options.ticket_key_rotation_interval - 1) / _options.ticket_key_rotation_interval);
+
+		std::lock_guard lock_guard(_ticket_key_mutex);
+
+		_ticket_keys.push_front(key);
+
+		while (_ticket_keys.size() > max_key_count)
+		{
+			::OPENSSL_cleanse(&_ticket_keys.back(), sizeof(TicketKey));
+			_ticket_keys.pop_back();
+		}
+
+		_last_rotation_time = ov::Clock::NowMSec();
+
+		::OPENSSL_cleanse(&key, sizeof(key));
+
+		logtd("[%s] Session ticket key is rotated (%zu keys)", _name.CStr(), _ticket_keys.size());
+	}
+
+	ov::DelayQueueAction TlsSessionResumption::OnMaintenance(void *parameter)
+	{
+		if (_options.ticket_enabled)
+		{
+			int64_t elapsed;
+
+			{
+				std::shared_lock lock_guard(_ticket_key_mutex);
+				elapsed = ov::Clock::NowMSec() - _last_rotation_time;
+			}
+
+			if (elapsed >= (static_cast<int64_t>(_options.ticket_key_rotation_interval) * 1000))
+			{
+				RotateTicketKeys();
+			}
+		}
+
+		if (_options.cache_enabled)
+		{
+			RemoveExpiredSessions();
+		}
+
+		return ov::DelayQueueAction::Repeat;
+	}
+
+	int TlsSessionResumption::OnTicketKeyCallback(SSL *ssl, unsigned char key_name[16], unsigned char *iv, EVP_CIPHER_CTX *cipher_ctx, EVP_MAC_CTX *mac_ctx, int enc)
+	{
+		auto resumption = FromSslContext(::SSL_get_SSL_CTX(ssl));
+
+		if (resumption == nullptr)
+		{
+			// Full handshake
+			return 0;
+		}
+
+		return resumption->OnTicketKey(key_name, iv, cipher_ctx, mac_ctx, enc);
+	}
+
+	// https://www.openssl.org/docs/man3.0/man3/SSL_CTX_set_tlsext_ticket_key_evp_cb.html
+	int TlsSessionResumption::OnTicketKey(unsigned char key_name[16], unsigned char *iv, EVP_CIPHER_CTX *cipher_ctx, EVP_MAC_CTX *mac_ctx, int enc)
+	{
+		std::shared_lock lock_guard(_ticket_key_mutex);
+
+		if (_ticket_keys.empty())
+		{
+			return (enc == 1) ? -1 : 0;
+		}
+
+		const TicketKey *key = nullptr;
+		bool is_current_key = false;
+
+		if (enc == 1)
+		{
+			// Issue a new ticket with the current key
+			key = &(_ticket_keys.front());
+			is_current_key = true;
+
+			if (::RAND_bytes(iv, EVP_MAX_IV_LENGTH) != 1)
+			{
+				return -1;
+			}
+
+			::memcpy(key_name, key->name, sizeof(key->name));
+
+			if (::EVP_EncryptInit_ex(cipher_ctx, ::EVP_aes_256_cbc(), nullptr, key->aes_key, iv) != 1)
+			{
+				return -1;
+			}
+		}
+		else
+		{
+			for (const auto &ticket_key : _ticket_keys)
+			{
+				if (::memcmp(key_name, ticket_key.name, sizeof(ticket_key.name)) == 0)
+				{
+					key = &ticket_key;
+					break;
+				}
+			}
+
+			if (key == nullptr)
+			{
+				// The key has expired or the ticket was issued by another server - do a full handshake
+				return 0;
+			}
+
+			is_current_key = (key == &(_ticket_keys.front()));
+
+			if (::EVP_DecryptInit_ex(cipher_ctx, ::EVP_aes_256_cbc(), nullptr, key->aes_key, iv) != 1)
+			{
+				return -1;
+			}
+		}
+
+		OSSL_PARAM params[] = {
+			::OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, const_cast<uint8_t *>(key->hmac_key), sizeof(key->hmac_key)),
+			::OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, const_cast<char *>("sha256"), 0),
+			::OSSL_PARAM_construct_end()};
+
+		if (::EVP_MAC_CTX_set_params(mac_ctx, params) != 1)
+		{
+			return -1;
+		}
+
+		// 2: The ticket is valid, but should be renewed with the current key
+		return is_current_key ? 1 : 2;
+	}
+
+	int TlsSessionResumption::OnNewSessionCallback(SSL *ssl, SSL_SESSION *session)
+	{
+		auto resumption = FromSslContext(::SSL_get_SSL_CTX(ssl));
+
+		if (resumption == nullptr)
+		{
+			return 0;
+		}
+
+		// 1: The cache holds the reference of the session
+		return resumption->AddSession(session) ? 1 : 0;
+	}
+
+	SSL_SESSION *TlsSessionResumption::OnGetSessionCallback(SSL *ssl, const unsigned char *id, int id_length, int *copy)
+	{
+		// The reference count is increased by FindSession()
+		*copy = 0;
+
+		auto resumption = FromSslContext(::SSL_get_SSL_CTX(ssl));
+
+		if (resumption == nullptr)
+		{
+			return nullptr;
+		}
+
+		return resumption->FindSession(id, id_length);
+	}
+
+	void TlsSessionResumption::OnRemoveSessionCallback(SSL_CTX *ssl_ctx, SSL_SESSION *session)
+	{
+		auto resumption = FromSslContext(ssl_ctx);
+
+		if (resumption != nullptr)
+		{
+			resumption->RemoveSession(session);
+		}
+	}
+
+	TlsSessionResumption::CacheShard &TlsSessionResumption::GetShard(const std::string &id)
+	{
+		return _shards[std::hash<std::string>()(id) % OV_TLS_SESSION_CACHE_SHARD_COUNT];
+	}
+
+	bool TlsSessionResumption::AddSession(SSL_SESSION *session)
+	{
+		unsigned int id_length = 0;
+		auto id = ::SSL_SESSION_get_id(session, &id_length);
+
+		if ((id == nullptr) || (id_length == 0))
+		{
+			return false;
+		}
+
+		std::string key(reinterpret_cast<const char *>(id), id_length);
+		auto &shard = GetShard(key);
+		SSL_SESSION *evicted_session = nullptr;
+
+		{
+			std::lock_guard lock_guard(shard.mutex);
+
+			auto item = shard.map.find(key);
+			if (item != shard.map.end())
+			{
+				// Replace the old session with the same ID
+				::SSL_SESSION_free(item->second->second);
+				shard.lru_list.erase(item->second);
+				shard.map.erase(item);
+			}
+
+			shard.lru_list.emplace_front(key, session);
+			shard.map.emplace(std::move(key), shard.lru_list.begin());
+
+			if (shard.lru_list.size() > _cache_size_per_shard)
+			{
+				auto &oldest = shard.lru_list.back();
+
+				evicted_session = oldest.second;
+				shard.map.erase(oldest.first);
+				shard.lru_list.pop_back();
+			}
+		}
+
+		OV_SAFE_FUNC(evicted_session, nullptr, ::SSL_SESSION_free, );
+
+		return true;
+	}
+
+	SSL_SESSION *TlsSessionResumption::FindSession(const unsigned char *id, int id_length)
+	{
+		if ((id == nullptr) || (id_length <= 0))
+		{
+			return nullptr;
+		}
+
+		std::string key(reinterpret_cast<const char *>(id), id_length);
+		auto &shard = GetShard(key);
+
+		std::lock_guard lock_guard(shard.mutex);
+
+		auto item = shard.map.find(key);
+		if (item == shard.map.end())
+		{
+			return nullptr;
+		}
+
+		// Move to the front of the LRU list
+		shard.lru_list.splice(shard.lru_list.begin(), shard.lru_list, item->second);
+
+		auto session = item->second->second;
+
+		// The session must not be freed by the eviction while OpenSSL is using it
+		::SSL_SESSION_up_ref(session);
+
+		return session;
+	}
+
+	void TlsSessionResumption::RemoveSession(SSL_SESSION *session)
+	{
+		unsigned int id_length = 0;
+		auto id = ::SSL_SESSION_get_id(session, &id_length);
+
+		if ((id == nullptr) || (id_length == 0))
+		{
+			return;
+		}
+
+		std::string key(reinterpret_cast<const char *>(id), id_length);
+		auto &shard = GetShard(key);
+		SSL_SESSION *removed_session = nullptr;
+
+		{
+			std::lock_guard lock_guard(shard.mutex);
+
+			auto item = shard.map.find(key);
+			if (item == shard.map.end())
+			{
+				return;
+			}
+
+			removed_session = item->second->second;
+			shard.lru_list.erase(item->second);
+			shard.map.erase(item);
+		}
+
+		::SSL_SESSION_free(removed_session);
+	}
+
+	void TlsSessionResumption::RemoveExpiredSessions()
+	{
+		auto now = static_cast<int64_t>(::time(nullptr));
+		size_t removed_count = 0;
+
+		for (auto &shard : _shards)
+		{
+			std::vector<SSL_SESSION *> expired_sessions;
+
+			{
+				std::lock_guard lock_guard(shard.mutex);
+
+				for (auto item = shard.lru_list.begin(); item != shard.lru_list.end();)
+				{
+					auto session = item->second;
+
+					if ((static_cast<int64_t>(::SSL_SESSION_get_time(session)) + ::SSL_SESSION_get_timeout(session)) <= now)
+					{
+						expired_sessions.push_back(session);
+						shard.map.erase(item->first);
+						item = shard.lru_list.erase(item);
+					}
+					else
+					{
+						++item;
+					}
+				}
+			}
+
+			for (auto session : expired_sessions)
+			{
+				::SSL_SESSION_free(session);
+			}
+
+			removed_count += expired_sessions.size();
+		}
+
+		if (removed_count > 0)
+		{
+			logtd("[%s] %zu expired sessions are removed from the cache", _name.CStr(), removed_count);
+		}
+	}
+
+	size_t TlsSessionResumption::GetCachedSessionCount() const
+	{
+		size_t count = 0;
+
+		for (const auto &shard : _shards)
+		{
+			std::lock_guard lock_guard(shard.mutex);
+			count += shard.lru_list.size();
+		}
+
+		return count;
+	}
+}  // namespace ov
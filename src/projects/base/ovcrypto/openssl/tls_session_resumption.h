@@ -0,0 +1,119 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+#include <openssl/ssl.h>
+
+#include <deque>
+#include <list>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#include "./openssl_error.h"
+
+// Number of the shards of the session ID cache, to reduce lock contention between the socket threads
+#define OV_TLS_SESSION_CACHE_SHARD_COUNT 16
+// Interval to check the ticket key rotation and to remove the expired sessions
+#define OV_TLS_SESSION_MAINTENANCE_INTERVAL_MS (60 * 1000)
+
+namespace ov
+{
+	struct TlsSessionResumptionOptions
+	{
+		bool ticket_enabled = true;
+		// in seconds
+		int ticket_key_rotation_interval = 3600;
+
+		bool cache_enabled = true;
+		size_t cache_size = 20480;
+
+		// in seconds
+		int session_timeout = 7200;
+	};
+
+	// Provides the TLS session resumption to the SSL_CTXs of a server (port):
+	//
+	// - Stateless session tickets encrypted with keys that are held only in memory and rotated periodically.
+	//   The previous keys are kept until the tickets issued with them expire.
+	// - A sharded in-process session ID cache as a fallback for the clients that do not support the tickets.
+	//
+	// The same instance should be applied to all SSL_CTXs of a server,
+	// so that a session can be resumed even if the SNI callback switches the SSL_CTX.
+	class TlsSessionResumption
+	{
+	public:
+		TlsSessionResumption(const ov::String &name, const TlsSessionResumptionOptions &options);
+		~TlsSessionResumption();
+
+		MAY_THROWS(ov::OpensslError)
+		void Apply(SSL_CTX *ssl_ctx);
+
+		const TlsSessionResumptionOptions &GetOptions() const
+		{
+			return _options;
+		}
+
+		void RotateTicketKeys();
+		void RemoveExpiredSessions();
+
+		size_t GetCachedSessionCount() const;
+
+	protected:
+		struct TicketKey
+		{
+			uint8_t name[16];
+			uint8_t aes_key[32];
+			uint8_t hmac_key[32];
+		};
+
+		struct CacheShard
+		{
+			using Item = std::pair<std::string, SSL_SESSION *>;
+
+			mutable std::mutex mutex;
+			// The most recently used session is at the front
+			std::list<Item> lru_list;
+			std::unordered_map<std::string, std::list<Item>::iterator> map;
+		};
+
+		static int GetExDataIndex();
+		static TlsSessionResumption *FromSslContext(const SSL_CTX *ssl_ctx);
+
+		static int OnTicketKeyCallback(SSL *ssl, unsigned char key_name[16], unsigned char *iv, EVP_CIPHER_CTX *cipher_ctx, EVP_MAC_CTX *mac_ctx, int enc);
+		int OnTicketKey(unsigned char key_name[16], unsigned char *iv, EVP_CIPHER_CTX *cipher_ctx, EVP_MAC_CTX *mac_ctx, int enc);
+
+		static int OnNewSessionCallback(SSL *ssl, SSL_SESSION *session);
+		static SSL_SESSION *OnGetSessionCallback(SSL *ssl, const unsigned char *id, int id_length, int *copy);
+		static void OnRemoveSessionCallback(SSL_CTX *ssl_ctx, SSL_SESSION *session);
+
+		bool AddSession(SSL_SESSION *session);
+		SSL_SESSION *FindSession(const unsigned char *id, int id_length);
+		void RemoveSession(SSL_SESSION *session);
+
+		CacheShard &GetShard(const std::string &id);
+
+		ov::DelayQueueAction OnMaintenance(void *parameter);
+
+	protected:
+		ov::String _name;
+		TlsSessionResumptionOptions _options;
+
+		// The current key is at the front
+		mutable std::shared_mutex _ticket_key_mutex;
+		std::deque<TicketKey> _ticket_keys;
+		int64_t _last_rotation_time = 0;
+
+		size_t _cache_size_per_shard = 0;
+		CacheShard _shards[OV_TLS_SESSION_CACHE_SHARD_COUNT];
+
+		ov::DelayQueue _timer{"TLSResume"};
+	};
+}  // namespace ov
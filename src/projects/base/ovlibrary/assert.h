@@ -26,6 +26,7 @@
 				## __VA_ARGS__, \
 				ov::StackTrace::GetStackTrace().CStr() \
 				); \
+			::ov_log_flush_on_fatal(); \
 			::abort(); \
 		} \
 	} \
@@ -8,22 +8,28 @@
 //==============================================================================
 #include "./delay_queue.h"
 
+#include <pthread.h>
 #include <unistd.h>
 
 #include <thread>
+#include <vector>
 
 #include "./log.h"
-#include "./logger/thread_helper.h"
 #include "./ovlibrary_private.h"
 
 namespace ov
 {
-	DelayQueue::DelayQueue(const char *queue_name)
+	DelayQueue::DelayQueue(const char *queue_name, DelayQueueThreadMode thread_mode)
 		: _queue_name(queue_name),
+		  _thread_mode(thread_mode),
+
+		  _timer_wheel(TimerWheel::GetInstance()),
 
 		  _index(0L),
 
-		  _stop(true)
+		  _stop(true),
+
+		  _dispatching(false)
 	{
 	}
 
@@ -39,12 +45,15 @@ namespace ov
 		int64_t index = _index;
 		_index++;
 
-		logtd("Pushing new item: %p (after %d ms)", parameter, after_msec);
+		logtd("[%s] Pushing new item: %p (after %d ms)", _queue_name.CStr(), parameter, after_msec);
 
-		_queue.emplace(index, func, parameter, after_msec);
+		auto item = std::make_shared<DelayQueueItem>(index, func, parameter, after_msec);
+		_items.emplace(index, item);
 
-		logtd("Notifying...");
-		_event.SetEvent();
+		if (_stop == false)
+		{
+			ScheduleItem(item);
+		}
 	}
 
 	void DelayQueue::Push(const DelayQueueFunction &func, int after_msec)
@@ -56,19 +65,44 @@ namespace ov
 	{
 		std::lock_guard<std::mutex> lock(_mutex);
 
-		return _queue.size();
+		return _items.size();
 	}
 
 	void DelayQueue::Clear()
 	{
 		std::lock_guard<std::mutex> lock(_mutex);
 
-		// empty _queue
-		std::priority_queue<DelayQueueItem>().swap(_queue);
+		for (auto &item : _items)
+		{
+			// An item that is running now is not repeated, since it is not found in _items after it returns
+			_timer_wheel->Cancel(item.second->timer);
+		}
+
+		_items.clear();
+		_ready_items.clear();
+	}
+
+	void DelayQueue::ScheduleItem(const std::shared_ptr<DelayQueueItem> &item)
+	{
+		// A repeated item schedules its timer again
+		if ((item->timer != nullptr) && _timer_wheel->RescheduleAt(item->timer, item->expire_msec))
+		{
+			return;
+		}
+
+		auto index = item->index;
+
+		item->timer = _timer_wheel->ScheduleAt(
+			[this, index]() {
+				OnTimer(index);
+			},
+			item->expire_msec);
 	}
 
 	bool DelayQueue::Start()
 	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
 		if (_stop == false)
 		{
 			// Already running
@@ -76,94 +110,176 @@ namespace ov
 		}
 
 		_stop = false;
-		_thread = std::thread(std::bind(&DelayQueue::DispatchThreadProc, this));
 
-		String name;
+		if (_thread_mode == DelayQueueThreadMode::Dedicated)
+		{
+			_dedicated_thread = std::thread(&DelayQueue::DedicatedThreadProc, this);
+			::pthread_setname_np(_dedicated_thread.native_handle(), _queue_name.Left(15).CStr());
+		}
 
-		if (_queue_name.IsEmpty())
+		// Items pushed while stopped keep their time points, so expired ones are run immediately
+		for (auto &item : _items)
 		{
-			name = "DQ";
+			ScheduleItem(item.second);
 		}
-		else
+
+		return true;
+	}
+
+	bool DelayQueue::Stop()
+	{
+		std::vector<std::shared_ptr<TimerWheel::Timer>> timers;
+
 		{
-			name.Format("DQ%s", _queue_name.CStr());
+			std::lock_guard<std::mutex> lock(_mutex);
+
+			if (_stop)
+			{
+				// Already stopped
+				return false;
+			}
+
+			_stop = true;
+
+			for (auto &item : _items)
+			{
+				if (item.second->timer != nullptr)
+				{
+					timers.push_back(std::move(item.second->timer));
+				}
+			}
+
+			_ready_items.clear();
 		}
 
-		::pthread_setname_np(_thread.native_handle(), name);
+		_ready_condition.notify_all();
+
+		// OnTimer() must not be running after Stop() returns, since it uses this.
+		// _mutex must not be held here, since OnTimer() locks it.
+		for (auto &timer : timers)
+		{
+			_timer_wheel->Cancel(timer, true);
+		}
+
+		if (_dedicated_thread.joinable())
+		{
+			if (_dedicated_thread.get_id() == std::this_thread::get_id())
+			{
+				// Called from a function of this queue, the thread ends after the function returns
+				_dedicated_thread.detach();
+			}
+			else
+			{
+				_dedicated_thread.join();
+			}
+		}
+
+		std::unique_lock<std::mutex> lock(_mutex);
+
+		if (_dispatcher_thread_id != std::this_thread::get_id())
+		{
+			_dispatch_condition.wait(lock, [this]() -> bool {
+				return _dispatching == false;
+			});
+		}
 
 		return true;
 	}
 
-	bool DelayQueue::Stop()
+	void DelayQueue::OnTimer(int64_t index)
 	{
+		std::unique_lock<std::mutex> lock(_mutex);
+
 		if (_stop)
 		{
-			// Already stopped
-			return false;
+			return;
 		}
 
-		_stop = true;
-		_event.SetEvent();
+		_ready_items.push_back(index);
 
-		if (_thread.joinable())
+		if (_thread_mode == DelayQueueThreadMode::Dedicated)
 		{
-			_thread.join();
+			_ready_condition.notify_one();
+			return;
 		}
 
-		return true;
+		if (_dispatching)
+		{
+			// Another worker is running an item of this queue, and it will run this item next
+			return;
+		}
+
+		DispatchReadyItems(lock);
 	}
 
-	void DelayQueue::DispatchThreadProc()
+	void DelayQueue::DedicatedThreadProc()
 	{
-		logger::ThreadHelper thread_helper;
+		std::unique_lock<std::mutex> lock(_mutex);
 
-		std::unique_lock<std::mutex> lock(_mutex, std::defer_lock);
-		while (_stop == false)
+		while (true)
 		{
-			lock.lock();
-			if (_queue.empty())
+			_ready_condition.wait(lock, [this]() -> bool {
+				return _stop || (_ready_items.empty() == false);
+			});
+
+			if (_stop)
+			{
+				break;
+			}
+
+			DispatchReadyItems(lock);
+		}
+	}
+
+	void DelayQueue::DispatchReadyItems(std::unique_lock<std::mutex> &lock)
+	{
+		_dispatching = true;
+		_dispatcher_thread_id = std::this_thread::get_id();
+
+		while ((_stop == false) && (_ready_items.empty() == false))
+		{
+			auto item_index = _ready_items.front();
+			_ready_items.pop_front();
+
+			auto item_iterator = _items.find(item_index);
+
+			if (item_iterator == _items.end())
 			{
-				logtd("Queue is empty. Waiting for new item...");
-				lock.unlock();
+				// Cleared
+				continue;
+			}
+
+			auto item = item_iterator->second;
+
+			lock.unlock();
+			DelayQueueAction action = item->function(item->parameter);
+			lock.lock();
 
-				_event.Wait();
+			// Clear() may be called while running the function
+			item_iterator = _items.find(item_index);
 
-				logtd("An item is pushed. Processing...");
+			if ((item_iterator == _items.end()) || (item_iterator->second != item))
+			{
+				continue;
 			}
-			else
+
+			if (action == DelayQueueAction::Repeat)
 			{
-				// Handle the first enqueued item
-				auto first_item = _queue.top();
-				lock.unlock();
+				item->RecalculateTimePoint();
 
-				if (_event.Wait(first_item.time_point) == false)
-				{
-					// No other items pushed until waiting for first_item.time_point
-					DelayQueueAction action = first_item.function(first_item.parameter);
-
-					lock.lock();
-					// If we enter this step immediately after Clear(), there will be a problem
-					if (_queue.empty() == false)
-					{
-						_queue.pop();
-
-						if (action == DelayQueueAction::Repeat)
-						{
-							first_item.RecalculateTimePoint();
-							_queue.push(first_item);
-						}
-					}
-					lock.unlock();
-				}
-				else
+				if (_stop == false)
 				{
-					// Another item was pushed while waiting for first_item.time_point
-
-					// Newly pushed items may be pointing to a time_point smaller than first_item.time_point,
-					// which needs to be recalculated
-					logtd("Another item is pushed while waiting the condition");
+					ScheduleItem(item);
 				}
 			}
+			else
+			{
+				_items.erase(item_iterator);
+			}
 		}
+
+		_dispatching = false;
+		_dispatcher_thread_id = std::thread::id();
+		_dispatch_condition.notify_all();
 	}
-}  // namespace ov
\ No newline at end of file
+}  // namespace ov
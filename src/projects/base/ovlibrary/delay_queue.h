@@ -9,16 +9,19 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstdio>
+#include <deque>
 #include <functional>
+#include <map>
+#include <memory>
 #include <mutex>
-#include <queue>
 #include <thread>
 #include <utility>
-#include <atomic>
 
-#include "./event.h"
 #include "./string.h"
+#include "./timer_wheel.h"
 
 namespace ov
 {
@@ -28,13 +31,24 @@ namespace ov
 		Repeat
 	};
 
+	enum class DelayQueueThreadMode : char
+	{
+		// The functions are called from the worker threads of the TimerWheel, so they must not block
+		Shared,
+		// The functions are called from a thread of the queue, for the functions that may block (e.g. network I/O)
+		Dedicated
+	};
+
 	// Return false if need to stop when using repeat mode
 	typedef std::function<DelayQueueAction(void *parameter)> DelayQueueFunction;
 
+	// The functions of a DelayQueue are called one at a time. By default they are called from the worker threads of
+	// the process-wide TimerWheel, so a DelayQueue costs no thread. A queue whose functions block uses
+	// DelayQueueThreadMode::Dedicated not to delay the timers of the other queues.
 	class DelayQueue
 	{
 	public:
-		DelayQueue(const char *queue_name);
+		DelayQueue(const char *queue_name, DelayQueueThreadMode thread_mode = DelayQueueThreadMode::Shared);
 		virtual ~DelayQueue();
 
 		void Push(const DelayQueueFunction &func, void *parameter, int after_msec);
@@ -57,7 +71,11 @@ namespace ov
 
 			int after_msec;
 
-			std::chrono::time_point<std::chrono::system_clock> time_point;
+			// Based on TimerWheel::GetNowMSec()
+			int64_t expire_msec;
+
+			// Kept while the item is repeated, so the timer is scheduled again instead of allocating a new one
+			std::shared_ptr<TimerWheel::Timer> timer;
 
 			DelayQueueItem(int64_t index, DelayQueueFunction function, void *parameter, int after_msec)
 				: index(index),
@@ -72,32 +90,43 @@ namespace ov
 
 			void RecalculateTimePoint()
 			{
-				time_point = std::chrono::system_clock::now() + std::chrono::milliseconds(after_msec);
-			}
-
-			bool operator<(const DelayQueueItem &item) const
-			{
-				// item.interval has a high priority, followed by item.index
-				return (time_point == item.time_point) ? (index > item.index) : (time_point > item.time_point);
+				expire_msec = TimerWheel::GetInstance()->GetExpireMSec(after_msec);
 			}
 		};
 
 	protected:
-		void DispatchThreadProc();
+		// _mutex must be held
+		void ScheduleItem(const std::shared_ptr<DelayQueueItem> &item);
+
+		// Called from a worker thread of the TimerWheel when the timer of an item expires
+		void OnTimer(int64_t index);
+		// Runs the expired items until _ready_items is empty. _mutex must be held.
+		void DispatchReadyItems(std::unique_lock<std::mutex> &lock);
+
+		void DedicatedThreadProc();
 
 		ov::String _queue_name;
+		DelayQueueThreadMode _thread_mode;
+
+		// DelayQueue may be a static object, so the TimerWheel is obtained in the constructor to be destroyed after this
+		TimerWheel *_timer_wheel;
 
 		int64_t _index;
 
-		std::thread _thread;
 		std::atomic<bool> _stop;
 
-		// A queue where the items to be executed are stored
 		mutable std::mutex _mutex;
-		std::priority_queue<DelayQueueItem> _queue;
-
-		// If Push() is called while DelayQueue is waiting, the priority must be recalculated.
-		// _event is used to notice this.
-		Event _event;
+		// Items that are not finished yet (they are kept while the queue is stopped)
+		std::map<int64_t, std::shared_ptr<DelayQueueItem>> _items;
+
+		// Expired items are run in order by one thread at a time (the dispatcher)
+		std::deque<int64_t> _ready_items;
+		bool _dispatching;
+		std::thread::id _dispatcher_thread_id;
+		std::condition_variable _dispatch_condition;
+
+		// Used if _thread_mode is Dedicated
+		std::thread _dedicated_thread;
+		std::condition_variable _ready_condition;
 	};
 }  // namespace ov
@@ -14,6 +14,8 @@
 #define __STDC_FORMAT_MACROS
 
 #include <cxxabi.h>
+#include <limits.h>
+#include <sys/uio.h>
 
 #include <cctype>
 #include <cinttypes>
@@ -243,6 +245,70 @@ namespace ov
 		return DumpToFile(file_name, data->GetData(), data->GetLength(), offset, append);
 	}
 
+	std::shared_ptr<FILE> DumpToFile(const char *file_name, const std::vector<std::shared_ptr<const Data>> &data_list, bool append) noexcept
+	{
+		FILE *file = ::fopen(file_name, append ? "ab" : "wb");
+
+		if (file == nullptr)
+		{
+			return nullptr;
+		}
+
+		std::shared_ptr<FILE> file_ptr(file, [](FILE *file) {
+			if (file != nullptr)
+			{
+				::fclose(file);
+			}
+		});
+
+		const int fd = ::fileno(file);
+		std::vector<struct iovec> iov_list;
+		iov_list.reserve(data_list.size());
+
+		for (const auto &data : data_list)
+		{
+			if ((data != nullptr) && (data->IsEmpty() == false))
+			{
+				iov_list.push_back({const_cast<void *>(data->GetData()), data->GetLength()});
+			}
+		}
+
+		auto iov = iov_list.data();
+		auto iov_count = iov_list.size();
+
+		while (iov_count > 0)
+		{
+			auto written = ::writev(fd, iov, static_cast<int>(std::min<size_t>(iov_count, IOV_MAX)));
+
+			if (written < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				return nullptr;
+			}
+
+			// Skip the buffers that have been written
+			while ((iov_count > 0) && (static_cast<size_t>(written) >= iov->iov_len))
+			{
+				written -= iov->iov_len;
+				iov++;
+				iov_count--;
+			}
+
+			if (written > 0)
+			{
+				// Partially written
+				iov->iov_base = static_cast<uint8_t *>(iov->iov_base) + written;
+				iov->iov_len -= written;
+			}
+		}
+
+		return file_ptr;
+	}
+
 	std::shared_ptr<Data> LoadFromFile(const char *file_name) noexcept
 	{
 		FILE *file = ::fopen(file_name, "rb");
@@ -0,0 +1,68 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "./futex.h"
+
+#include <errno.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <climits>
+#include <ctime>
+
+namespace ov
+{
+	namespace
+	{
+		long SysFutex(std::atomic<uint32_t> *address, int operation, uint32_t value, const struct timespec *timeout)
+		{
+			return ::syscall(SYS_futex, reinterpret_cast<uint32_t *>(address), operation, value, timeout, nullptr, 0);
+		}
+	}  // namespace
+
+	bool Futex::Wait(uint32_t sequence, std::chrono::system_clock::time_point expire)
+	{
+		while (_sequence.load(std::memory_order_seq_cst) == sequence)
+		{
+			struct timespec timeout;
+			struct timespec *timeout_pointer = nullptr;
+
+			if (expire != std::chrono::system_clock::time_point::max())
+			{
+				auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(expire - std::chrono::system_clock::now()).count();
+
+				if (remaining <= 0)
+				{
+					return false;
+				}
+
+				timeout.tv_sec = static_cast<time_t>(remaining / 1000000000LL);
+				timeout.tv_nsec = static_cast<long>(remaining % 1000000000LL);
+				timeout_pointer = &timeout;
+			}
+
+			// The relative timeout of FUTEX_WAIT is measured with CLOCK_MONOTONIC
+			if ((SysFutex(&_sequence, FUTEX_WAIT_PRIVATE, sequence, timeout_pointer) == -1) && (errno == ETIMEDOUT))
+			{
+				return false;
+			}
+
+			// EAGAIN (the sequence has changed), EINTR or a wake-up: check the sequence again
+		}
+
+		return true;
+	}
+
+	void Futex::WakeAll()
+	{
+		_sequence.fetch_add(1, std::memory_order_seq_cst);
+
+		SysFutex(&_sequence, FUTEX_WAKE_PRIVATE, INT_MAX, nullptr);
+	}
+}  // namespace ov
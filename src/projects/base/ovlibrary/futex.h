@@ -0,0 +1,43 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace ov
+{
+	// A wake-up sequence that threads sleep on with futex(2), without a mutex.
+	//
+	// The waiter reads the sequence, checks its condition, and then calls Wait() with the sequence it read.
+	// If WakeAll() is called in between, the sequence has changed and Wait() returns immediately,
+	// so a wake-up is never lost. WakeAll() does not need a lock, so a producer can wake up a consumer
+	// without contending on the consumer's mutex.
+	class Futex
+	{
+	public:
+		uint32_t GetSequence() const
+		{
+			return _sequence.load(std::memory_order_seq_cst);
+		}
+
+		// Sleeps while the sequence is still `sequence`, until `expire` (system_clock::time_point::max() for infinite).
+		// Returns false if it timed out.
+		bool Wait(uint32_t sequence, std::chrono::system_clock::time_point expire);
+
+		// Increments the sequence and wakes up all the waiters
+		void WakeAll();
+
+	private:
+		static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "The futex word must be a plain 32-bit integer");
+
+		std::atomic<uint32_t> _sequence{0};
+	};
+}  // namespace ov
@@ -133,6 +133,11 @@ extern "C"
 	void ov_log_internal(OVLogLevel level, const char *tag, const char *file, int line, const char *method, const char *format, ...);
 	void ov_log_set_path(const char *log_path);
 	const char *ov_log_get_path();
+	/// Writes all logs that are queued in the background writer
+	void ov_log_flush();
+	/// ov_log_flush() for the signal handlers and the assertions (must be called before the process is aborted).
+	/// It doesn't allocate memory or wait for the locks held by the crashed thread, so some logs may not be written.
+	void ov_log_flush_on_fatal();
 
 	void ov_stat_log_internal(StatLogType type, OVLogLevel level, const char *tag, const char *file, int line, const char *method, const char *format, ...);
 	void ov_stat_log_set_path(StatLogType type, const char *log_path);
@@ -0,0 +1,621 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "./log_async_writer.h"
+
+#include <pthread.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <ctime>
+
+#include "./log_write.h"
+
+#define OV_LOG_COLOR_RESET "\x1B[0m"
+
+#define OV_LOG_COLOR_FG_BLUE "\x1B[34m"
+#define OV_LOG_COLOR_FG_CYAN "\x1B[36m"
+#define OV_LOG_COLOR_FG_WHITE "\x1B[37m"
+#define OV_LOG_COLOR_FG_YELLOW "\x1B[33m"
+#define OV_LOG_COLOR_FG_BR_RED "\x1B[91m"
+#define OV_LOG_COLOR_FG_BR_WHITE "\x1B[97m"
+#define OV_LOG_COLOR_BG_RED "\x1B[41m"
+
+namespace ov
+{
+	// Set when the instance is destroyed while the process is terminating, the logs are written synchronously after that
+	static std::atomic<bool> g_log_async_writer_destroyed{false};
+
+	constexpr const char *LOG_COLOR_PREFIX[] = {
+		OV_LOG_COLOR_FG_BLUE,
+		OV_LOG_COLOR_FG_CYAN,
+		OV_LOG_COLOR_FG_WHITE,
+		OV_LOG_COLOR_FG_YELLOW,
+		OV_LOG_COLOR_FG_BR_RED,
+		OV_LOG_COLOR_FG_BR_WHITE OV_LOG_COLOR_BG_RED};
+
+	constexpr const char LOG_COLOR_SUFFIX[] = OV_LOG_COLOR_RESET "\n";
+
+	static int GetConsoleFd(OVLogLevel level)
+	{
+		return (level < OVLogLevelWarning) ? STDOUT_FILENO : STDERR_FILENO;
+	}
+
+	static void SetConsoleIov(struct iovec *iov, OVLogLevel level, const char *log, size_t length)
+	{
+		iov[0].iov_base = const_cast<char *>(LOG_COLOR_PREFIX[level]);
+		iov[0].iov_len = ::strlen(LOG_COLOR_PREFIX[level]);
+		iov[1].iov_base = const_cast<char *>(log);
+		iov[1].iov_len = length;
+		iov[2].iov_base = const_cast<char *>(LOG_COLOR_SUFFIX);
+		iov[2].iov_len = sizeof(LOG_COLOR_SUFFIX) - 1;
+	}
+
+	static void SetFileIov(struct iovec *iov, const char *log, size_t length)
+	{
+		iov[0].iov_base = const_cast<char *>(log);
+		iov[0].iov_len = length;
+		iov[1].iov_base = const_cast<char *>("\n");
+		iov[1].iov_len = 1;
+	}
+
+	// Single-producer/single-consumer ring of the records of a thread.
+	// The records are 8-byte aligned and never wrap around, the space at the end of the buffer is skipped with a padding record.
+	class LogAsyncWriter::Ring
+	{
+	public:
+		enum Flag : uint8_t
+		{
+			Padding = 0x01,
+			Console = 0x02,
+		};
+
+		struct Record
+		{
+			// The first 8 bytes must be valid for the padding record
+			uint32_t size;
+			uint8_t flags;
+			uint8_t level;
+			uint16_t reserved;
+
+			uint32_t length;
+			uint32_t reserved2;
+			uint64_t sequence;
+			LogWrite *file;
+
+			const char *GetLog() const
+			{
+				return reinterpret_cast<const char *>(this + 1);
+			}
+		};
+
+		static_assert((OV_LOG_ASYNC_RING_SIZE & (OV_LOG_ASYNC_RING_SIZE - 1)) == 0, "OV_LOG_ASYNC_RING_SIZE must be a power of 2");
+
+		Ring()
+			: _buffer(new uint8_t[OV_LOG_ASYNC_RING_SIZE])
+		{
+		}
+
+		// Producer
+		bool Push(uint64_t sequence, LogWrite *file, bool to_console, OVLogLevel level, const char *log, size_t length)
+		{
+			const size_t size = (sizeof(Record) + length + 7) & ~static_cast<size_t>(7);
+
+			size_t head = _head.load(std::memory_order_relaxed);
+			const size_t tail = _tail.load(std::memory_order_acquire);
+
+			const size_t offset = head & (OV_LOG_ASYNC_RING_SIZE - 1);
+			const size_t contiguous = OV_LOG_ASYNC_RING_SIZE - offset;
+			const size_t padding = (contiguous < size) ? contiguous : 0;
+
+			if ((head + padding + size - tail) > OV_LOG_ASYNC_RING_SIZE)
+			{
+				return false;
+			}
+
+			if (padding > 0)
+			{
+				auto record = reinterpret_cast<Record *>(_buffer.get() + offset);
+				record->size = static_cast<uint32_t>(padding);
+				record->flags = Flag::Padding;
+
+				head += padding;
+			}
+
+			auto record = reinterpret_cast<Record *>(_buffer.get() + (head & (OV_LOG_ASYNC_RING_SIZE - 1)));
+			record->size = static_cast<uint32_t>(size);
+			record->flags = to_console ? Flag::Console : 0;
+			record->level = static_cast<uint8_t>(level);
+			record->length = static_cast<uint32_t>(length);
+			record->sequence = sequence;
+			record->file = file;
+			::memcpy(record + 1, log, length);
+
+			_head.store(head + size, std::memory_order_release);
+
+			return true;
+		}
+
+		// Producer, used to wake up the writer early
+		bool IsHalfFull() const
+		{
+			return (_head.load(std::memory_order_relaxed) - _tail.load(std::memory_order_relaxed)) > (OV_LOG_ASYNC_RING_SIZE / 2);
+		}
+
+		// Consumer, returns the position after the collected records
+		size_t Collect(std::vector<const Record *> &records) const
+		{
+			size_t tail = _tail.load(std::memory_order_relaxed);
+			const size_t head = _head.load(std::memory_order_acquire);
+
+			while (tail < head)
+			{
+				auto record = reinterpret_cast<const Record *>(_buffer.get() + (tail & (OV_LOG_ASYNC_RING_SIZE - 1)));
+
+				if ((record->flags & Flag::Padding) == 0)
+				{
+					records.push_back(record);
+				}
+
+				tail += record->size;
+			}
+
+			return tail;
+		}
+
+		// Consumer
+		void Release(size_t position)
+		{
+			_tail.store(position, std::memory_order_release);
+		}
+
+		bool IsEmpty() const
+		{
+			return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_relaxed);
+		}
+
+		// Consumer, used by FlushOnFatal() to write one record at a time: the next record (padding records are skipped)
+		const Record *Front()
+		{
+			size_t tail = _tail.load(std::memory_order_relaxed);
+			const size_t head = _head.load(std::memory_order_acquire);
+
+			while (tail < head)
+			{
+				auto record = reinterpret_cast<const Record *>(_buffer.get() + (tail & (OV_LOG_ASYNC_RING_SIZE - 1)));
+
+				if ((record->flags & Flag::Padding) == 0)
+				{
+					return record;
+				}
+
+				tail += record->size;
+				_tail.store(tail, std::memory_order_release);
+			}
+
+			return nullptr;
+		}
+
+		// Consumer, releases the record returned by Front()
+		void PopFront()
+		{
+			const size_t tail = _tail.load(std::memory_order_relaxed);
+			auto record = reinterpret_cast<const Record *>(_buffer.get() + (tail & (OV_LOG_ASYNC_RING_SIZE - 1)));
+
+			_tail.store(tail + record->size, std::memory_order_release);
+		}
+
+		// The thread that owns the ring has exited
+		void SetOrphan()
+		{
+			_orphan = true;
+		}
+
+		bool IsOrphan() const
+		{
+			return _orphan;
+		}
+
+		// The ring is given to a new thread (must be called while holding _rings_mutex)
+		void Adopt()
+		{
+			_orphan = false;
+		}
+
+	private:
+		std::unique_ptr<uint8_t[]> _buffer;
+
+		// Written by the producer
+		alignas(64) std::atomic<size_t> _head{0};
+		// Written by the consumer
+		alignas(64) std::atomic<size_t> _tail{0};
+
+		std::atomic<bool> _orphan{false};
+	};
+
+	LogAsyncWriter::RingHolder::~RingHolder()
+	{
+		if (ring != nullptr)
+		{
+			ring->SetOrphan();
+		}
+	}
+
+	LogAsyncWriter *LogAsyncWriter::GetInstance()
+	{
+		if (g_log_async_writer_destroyed.load(std::memory_order_relaxed))
+		{
+			return nullptr;
+		}
+
+		static LogAsyncWriter instance;
+		return &instance;
+	}
+
+	LogAsyncWriter::LogAsyncWriter()
+	{
+	}
+
+	LogAsyncWriter::~LogAsyncWriter()
+	{
+		{
+			std::lock_guard<std::mutex> lock(_thread_mutex);
+			_stop = true;
+		}
+		_condition.notify_all();
+
+		if (_thread.joinable())
+		{
+			_thread.join();
+		}
+
+		Flush();
+
+		g_log_async_writer_destroyed = true;
+	}
+
+	LogAsyncWriter::Ring *LogAsyncWriter::GetRingOfCurrentThread()
+	{
+		thread_local RingHolder holder;
+
+		if (holder.ring == nullptr)
+		{
+			std::lock_guard<std::mutex> lock(_rings_mutex);
+
+			// The ring of an exited thread is reused once it has been drained
+			auto item = std::find_if(_rings.begin(), _rings.end(), [](const std::shared_ptr<Ring> &ring) -> bool {
+				return ring->IsOrphan() && ring->IsEmpty();
+			});
+
+			if (item != _rings.end())
+			{
+				(*item)->Adopt();
+				holder.ring = *item;
+			}
+			else if (_rings.size() < OV_LOG_ASYNC_MAX_RING_COUNT)
+			{
+				holder.ring = std::make_shared<Ring>();
+				_rings.push_back(holder.ring);
+			}
+			else
+			{
+				return nullptr;
+			}
+		}
+
+		return holder.ring.get();
+	}
+
+	void LogAsyncWriter::StartIfNeeded()
+	{
+		std::lock_guard<std::mutex> lock(_thread_mutex);
+
+		if (_started || _stop)
+		{
+			return;
+		}
+
+		_started = true;
+
+		try
+		{
+			_thread = std::thread(&LogAsyncWriter::WriterThread, this);
+			::pthread_setname_np(_thread.native_handle(), "LogWriter");
+		}
+		catch (const std::system_error &e)
+		{
+			// The records are written by Flush() of the fatal paths only, so stop queueing
+			_stop = true;
+		}
+	}
+
+	bool LogAsyncWriter::Push(LogWrite *file, bool to_console, OVLogLevel level, const char *log, size_t length)
+	{
+		if ((length > OV_LOG_ASYNC_MAX_RECORD_SIZE) || (level >= OVLogLevelCritical))
+		{
+			return false;
+		}
+
+		if (_started == false)
+		{
+			StartIfNeeded();
+		}
+
+		if (_stop)
+		{
+			return false;
+		}
+
+		auto ring = GetRingOfCurrentThread();
+
+		if (ring == nullptr)
+		{
+			// Too many threads are logging, this thread writes synchronously
+			return false;
+		}
+
+		if (ring->Push(_sequence.fetch_add(1, std::memory_order_relaxed), file, to_console, level, log, length) == false)
+		{
+			_condition.notify_one();
+
+			if (level < OVLogLevelWarning)
+			{
+				// Overloaded, the less important records are dropped
+				_dropped_count.fetch_add(1, std::memory_order_relaxed);
+				return true;
+			}
+
+			return false;
+		}
+
+		if (ring->IsHalfFull())
+		{
+			_condition.notify_one();
+		}
+
+		return true;
+	}
+
+	void LogAsyncWriter::WriteSync(LogWrite *file, bool to_console, OVLogLevel level, const char *log, size_t length)
+	{
+		std::lock_guard<std::mutex> lock(_drain_mutex);
+
+		// Keep the order of the records of this thread
+		DrainInternal();
+
+		if (to_console)
+		{
+			WriteToConsole(level, log, length);
+		}
+
+		if (file != nullptr)
+		{
+			struct iovec iov[2];
+			SetFileIov(iov, log, length);
+			file->Write(iov, 2);
+		}
+	}
+
+	void LogAsyncWriter::Flush()
+	{
+		std::lock_guard<std::mutex> lock(_drain_mutex);
+
+		DrainInternal();
+	}
+
+	void LogAsyncWriter::FlushOnFatal()
+	{
+		// The writer thread may be draining the rings, so wait for it for a while.
+		// If the lock is held by the crashed thread it is never released, and the records are not written.
+		std::unique_lock<std::mutex> drain_lock(_drain_mutex, std::defer_lock);
+
+		for (int retry = 0; (drain_lock.try_lock() == false); retry++)
+		{
+			if (retry >= OV_LOG_ASYNC_FATAL_LOCK_RETRY_COUNT)
+			{
+				return;
+			}
+
+			struct timespec interval = {0, 1000000};
+			::nanosleep(&interval, nullptr);
+		}
+
+		std::unique_lock<std::mutex> rings_lock(_rings_mutex, std::try_to_lock);
+
+		if (rings_lock.owns_lock() == false)
+		{
+			return;
+		}
+
+		// The records of the threads are merged in the order in which they are logged, one record at a time
+		while (true)
+		{
+			Ring *next_ring = nullptr;
+			const Ring::Record *next_record = nullptr;
+
+			for (auto &ring : _rings)
+			{
+				auto record = ring->Front();
+
+				if ((record != nullptr) && ((next_record == nullptr) || (record->sequence < next_record->sequence)))
+				{
+					next_ring = ring.get();
+					next_record = record;
+				}
+			}
+
+			if (next_record == nullptr)
+			{
+				break;
+			}
+
+			auto level = static_cast<OVLogLevel>(next_record->level);
+
+			if (next_record->flags & Ring::Flag::Console)
+			{
+				struct iovec iov[3];
+				SetConsoleIov(iov, level, next_record->GetLog(), next_record->length);
+				LogWrite::WriteFullyOnFatal(GetConsoleFd(level), iov, 3);
+			}
+
+			if (next_record->file != nullptr)
+			{
+				struct iovec iov[2];
+				SetFileIov(iov, next_record->GetLog(), next_record->length);
+				next_record->file->WriteOnFatal(iov, 2);
+			}
+
+			next_ring->PopFront();
+		}
+	}
+
+	void LogAsyncWriter::WriteToConsole(OVLogLevel level, const char *log, size_t length)
+	{
+		struct iovec iov[3];
+		SetConsoleIov(iov, level, log, length);
+		LogWrite::WriteFully(GetConsoleFd(level), iov, 3);
+	}
+
+	void LogAsyncWriter::WriterThread()
+	{
+		while (true)
+		{
+			{
+				std::unique_lock<std::mutex> lock(_thread_mutex);
+
+				if (_stop)
+				{
+					break;
+				}
+
+				_condition.wait_for(lock, std::chrono::milliseconds(OV_LOG_ASYNC_FLUSH_INTERVAL_MS));
+			}
+
+			Flush();
+		}
+	}
+
+	void LogAsyncWriter::DrainInternal()
+	{
+		std::vector<std::shared_ptr<Ring>> rings;
+		{
+			std::lock_guard<std::mutex> lock(_rings_mutex);
+
+			// Rings of the exited threads are freed after they are drained, except a few that are kept to be reused
+			size_t spare_count = 0;
+			_rings.erase(std::remove_if(_rings.begin(), _rings.end(), [&spare_count](const std::shared_ptr<Ring> &ring) -> bool {
+							 return ring->IsOrphan() && ring->IsEmpty() && (++spare_count > OV_LOG_ASYNC_SPARE_RING_COUNT);
+						 }),
+						 _rings.end());
+
+			rings = _rings;
+		}
+
+		std::vector<const Ring::Record *> records;
+		std::vector<size_t> positions(rings.size());
+
+		for (size_t index = 0; index < rings.size(); index++)
+		{
+			positions[index] = rings[index]->Collect(records);
+		}
+
+		if (records.empty() == false)
+		{
+			// Records of the threads are merged in the order in which they are logged
+			std::sort(records.begin(), records.end(), [](const Ring::Record *a, const Ring::Record *b) -> bool {
+				return a->sequence < b->sequence;
+			});
+
+			std::vector<struct iovec> iov;
+			iov.reserve(records.size() * 3);
+
+			// Console: consecutive records for the same fd (stdout/stderr) are written at once
+			int last_fd = -1;
+			for (auto record : records)
+			{
+				if ((record->flags & Ring::Flag::Console) == 0)
+				{
+					continue;
+				}
+
+				auto level = static_cast<OVLogLevel>(record->level);
+				auto fd = GetConsoleFd(level);
+
+				if ((fd != last_fd) && (iov.empty() == false))
+				{
+					LogWrite::WriteFully(last_fd, iov.data(), static_cast<int>(iov.size()));
+					iov.clear();
+				}
+
+				last_fd = fd;
+				iov.resize(iov.size() + 3);
+				SetConsoleIov(&iov[iov.size() - 3], level, record->GetLog(), record->length);
+			}
+
+			if (iov.empty() == false)
+			{
+				LogWrite::WriteFully(last_fd, iov.data(), static_cast<int>(iov.size()));
+				iov.clear();
+			}
+
+			// Files: consecutive records for the same file are written at once
+			LogWrite *last_file = nullptr;
+			for (auto record : records)
+			{
+				if (record->file == nullptr)
+				{
+					continue;
+				}
+
+				if ((record->file != last_file) && (iov.empty() == false))
+				{
+					last_file->Write(iov.data(), static_cast<int>(iov.size()));
+					iov.clear();
+				}
+
+				last_file = record->file;
+				iov.resize(iov.size() + 2);
+				SetFileIov(&iov[iov.size() - 2], record->GetLog(), record->length);
+			}
+
+			if (iov.empty() == false)
+			{
+				last_file->Write(iov.data(), static_cast<int>(iov.size()));
+			}
+
+			if (last_file != nullptr)
+			{
+				_last_file = last_file;
+			}
+		}
+
+		for (size_t index = 0; index < rings.size(); index++)
+		{
+			rings[index]->Release(positions[index]);
+		}
+
+		auto dropped_count = _dropped_count.exchange(0, std::memory_order_relaxed);
+		if (dropped_count > 0)
+		{
+			char log[128];
+			auto length = ::snprintf(log, sizeof(log), "[LogAsyncWriter] %lu logs were dropped because the log buffer was full", static_cast<unsigned long>(dropped_count));
+			length = std::min(length, static_cast<int>(sizeof(log) - 1));
+
+			WriteToConsole(OVLogLevelWarning, log, length);
+
+			if (_last_file != nullptr)
+			{
+				struct iovec iov[2];
+				SetFileIov(iov, log, length);
+				_last_file->Write(iov, 2);
+			}
+		}
+	}
+}  // namespace ov
@@ -0,0 +1,105 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "./log.h"
+
+// Size of the ring buffer of each thread that writes logs
+#define OV_LOG_ASYNC_RING_SIZE (128 * 1024)
+// Maximum number of the rings (OV_LOG_ASYNC_RING_SIZE each), the threads that log after that write synchronously
+#define OV_LOG_ASYNC_MAX_RING_COUNT 256
+// Drained rings of the exited threads that are kept to be reused by new threads, the rest are freed
+#define OV_LOG_ASYNC_SPARE_RING_COUNT 16
+// Longer records are written synchronously
+#define OV_LOG_ASYNC_MAX_RECORD_SIZE (16 * 1024)
+// The writer thread wakes up at least at this interval
+#define OV_LOG_ASYNC_FLUSH_INTERVAL_MS 10
+// FlushOnFatal() tries to lock the rings this many times at 1 ms intervals
+#define OV_LOG_ASYNC_FATAL_LOCK_RETRY_COUNT 100
+
+namespace ov
+{
+	class LogWrite;
+
+	// Writes the preformatted log records in a background thread.
+	//
+	// Each thread appends records to its own single-producer/single-consumer ring buffer without any lock,
+	// and the writer thread collects the records of all threads in order and writes them with a few writev() calls.
+	// If the ring of a thread is full, the trace/debug/information records are dropped (and counted),
+	// and the more important records are written synchronously.
+	// The ring of an exited thread is given to the next thread that starts logging.
+	class LogAsyncWriter
+	{
+	public:
+		static LogAsyncWriter *GetInstance();
+
+		~LogAsyncWriter();
+
+		// Returns false if the record could not be queued (the caller should write it synchronously)
+		bool Push(LogWrite *file, bool to_console, OVLogLevel level, const char *log, size_t length);
+
+		// Writes the record synchronously after all queued records (used for critical logs and fatal paths)
+		void WriteSync(LogWrite *file, bool to_console, OVLogLevel level, const char *log, size_t length);
+
+		// Writes all queued records in the caller's thread
+		void Flush();
+
+		// Flush() for the signal handlers and the assertions: the crashed thread may hold the locks or be inside malloc(),
+		// so the locks are only tried (nothing is written if they are not released in time) and nothing is allocated
+		void FlushOnFatal();
+
+		static void WriteToConsole(OVLogLevel level, const char *log, size_t length);
+
+	private:
+		class Ring;
+
+		struct RingHolder
+		{
+			~RingHolder();
+			std::shared_ptr<Ring> ring;
+		};
+
+		LogAsyncWriter();
+
+		// Returns nullptr if there are OV_LOG_ASYNC_MAX_RING_COUNT rings already
+		Ring *GetRingOfCurrentThread();
+
+		void StartIfNeeded();
+		void WriterThread();
+
+		// Must be called while holding _drain_mutex
+		void DrainInternal();
+
+		std::atomic<uint64_t> _sequence{0};
+		std::atomic<uint64_t> _dropped_count{0};
+
+		// Protects _rings (including the rings of the exited threads until they are drained and freed, or reused)
+		std::mutex _rings_mutex;
+		std::vector<std::shared_ptr<Ring>> _rings;
+
+		// Only one thread consumes the rings at a time
+		std::mutex _drain_mutex;
+		// The file to which the last record was written, used to report the dropped records
+		LogWrite *_last_file = nullptr;
+
+		std::mutex _thread_mutex;
+		std::condition_variable _condition;
+		std::atomic<bool> _started{false};
+		std::atomic<bool> _stop{false};
+		std::thread _thread;
+	};
+}  // namespace ov
@@ -12,44 +12,6 @@
 
 #include "platform.h"
 
-#define OV_LOG_COLOR_RESET "\x1B[0m"
-
-#define OV_LOG_COLOR_FG_BLACK "\x1B[30m"
-#define OV_LOG_COLOR_FG_RED "\x1B[31m"
-#define OV_LOG_COLOR_FG_GREEN "\x1B[32m"
-#define OV_LOG_COLOR_FG_YELLOW "\x1B[33m"
-#define OV_LOG_COLOR_FG_BLUE "\x1B[34m"
-#define OV_LOG_COLOR_FG_MAGENTA "\x1B[35m"
-#define OV_LOG_COLOR_FG_CYAN "\x1B[36m"
-#define OV_LOG_COLOR_FG_WHITE "\x1B[37m"
-
-#define OV_LOG_COLOR_FG_BR_BLACK "\x1B[90m"
-#define OV_LOG_COLOR_FG_BR_RED "\x1B[91m"
-#define OV_LOG_COLOR_FG_BR_GREEN "\x1B[92m"
-#define OV_LOG_COLOR_FG_BR_YELLOW "\x1B[93m"
-#define OV_LOG_COLOR_FG_BR_BLUE "\x1B[94m"
-#define OV_LOG_COLOR_FG_BR_MAGENTA "\x1B[95m"
-#define OV_LOG_COLOR_FG_BR_CYAN "\x1B[96m"
-#define OV_LOG_COLOR_FG_BR_WHITE "\x1B[97m"
-
-#define OV_LOG_COLOR_BG_BLACK "\x1B[40m"
-#define OV_LOG_COLOR_BG_RED "\x1B[41m"
-#define OV_LOG_COLOR_BG_GREEN "\x1B[42m"
-#define OV_LOG_COLOR_BG_YELLOW "\x1B[43m"
-#define OV_LOG_COLOR_BG_BLUE "\x1B[44m"
-#define OV_LOG_COLOR_BG_MAGENTA "\x1B[45m"
-#define OV_LOG_COLOR_BG_CYAN "\x1B[46m"
-#define OV_LOG_COLOR_BG_WHITE "\x1B[47m"
-
-#define OV_LOG_COLOR_BG_BR_BLACK "\x1B[100m"
-#define OV_LOG_COLOR_BG_BR_RED "\x1B[101m"
-#define OV_LOG_COLOR_BG_BR_GREEN "\x1B[102m"
-#define OV_LOG_COLOR_BG_BR_YELLOW "\x1B[103m"
-#define OV_LOG_COLOR_BG_BR_BLUE "\x1B[104m"
-#define OV_LOG_COLOR_BG_BR_MAGENTA "\x1B[105m"
-#define OV_LOG_COLOR_BG_BR_CYAN "\x1B[106m"
-#define OV_LOG_COLOR_BG_BR_WHITE "\x1B[107m"
-
 namespace ov
 {
 	LogInternal::LogInternal(std::string log_file_name) noexcept
@@ -79,6 +41,8 @@ namespace ov
 
 		_enable_map.clear();
 		_enable_list.clear();
+
+		_enable_generation++;
 	}
 
 	bool LogInternal::IsEnabled(const char *tag, OVLogLevel level)
@@ -88,6 +52,53 @@ namespace ov
 			return false;
 		}
 
+		// Most of the tags are string literals, so the rules are cached by the address of the tag for each thread.
+		// The content is compared too, because the tag may be a temporary string.
+		struct CachedItem
+		{
+			ov::String tag;
+			OVLogLevel level;
+			bool is_enabled;
+		};
+
+		thread_local const LogInternal *cache_owner = nullptr;
+		thread_local uint64_t cache_generation = 0;
+		thread_local std::unordered_map<const char *, CachedItem> cache;
+
+		const auto generation = _enable_generation.load(std::memory_order_acquire);
+
+		if ((cache_owner != this) || (cache_generation != generation))
+		{
+			cache.clear();
+			cache_owner = this;
+			cache_generation = generation;
+		}
+
+		auto item = cache.find(tag);
+
+		if ((item == cache.end()) || (item->second.tag != tag))
+		{
+			auto enable_item = FindEnableItem(tag);
+
+			item = cache.insert_or_assign(tag, (CachedItem){
+												   .tag = tag,
+												   .level = enable_item.level,
+												   .is_enabled = enable_item.is_enabled})
+					   .first;
+		}
+
+		if (level >= item->second.level)
+		{
+			// Returns whether the log level for the tag is activated
+			return item->second.is_enabled;
+		}
+
+		// Levels below level behave as opposed to being activated
+		return (item->second.is_enabled == false);
+	}
+
+	LogInternal::EnableItem LogInternal::FindEnableItem(const char *tag)
+	{
 		std::lock_guard<std::mutex> lock(_mutex);
 
 		auto item = _enable_map.find(tag);
@@ -122,18 +133,14 @@ namespace ov
 			{
 				// Item must be added
 				OV_ASSERT2(false);
-				return false;
+				return (EnableItem){
+					.regex		= nullptr,
+					.level		= OVLogLevelInformation,
+					.is_enabled = false};
 			}
 		}
 
-		if (level >= item->second.level)
-		{
-			// Returns whether the log level for the tag is activated
-			return item->second.is_enabled;
-		}
-
-		// Levels below level behave as opposed to being activated
-		return (item->second.is_enabled == false);
+		return item->second;
 	}
 
 	bool LogInternal::SetEnable(const char *tag_regex, OVLogLevel level, bool is_enabled)
@@ -146,6 +153,7 @@ namespace ov
 		std::lock_guard<std::mutex> lock(_mutex);
 
 		_enable_map.clear();
+		_enable_generation++;
 
 		try
 		{
@@ -210,89 +218,79 @@ namespace ov
 			"E",
 			"C"};
 
-		constexpr const char *color_prefix[] = {
-			OV_LOG_COLOR_FG_BLUE,
-			OV_LOG_COLOR_FG_CYAN,
-			OV_LOG_COLOR_FG_WHITE,
-			OV_LOG_COLOR_FG_YELLOW,
-			OV_LOG_COLOR_FG_BR_RED,
-			OV_LOG_COLOR_FG_BR_WHITE OV_LOG_COLOR_BG_RED};
-
-		constexpr const char *color_suffix[] = {
-			OV_LOG_COLOR_RESET,
-			OV_LOG_COLOR_RESET,
-			OV_LOG_COLOR_RESET,
-			OV_LOG_COLOR_RESET,
-			OV_LOG_COLOR_RESET,
-			OV_LOG_COLOR_RESET};
-
-		// Obtain current time in milliseconds
-		auto current	 = std::chrono::system_clock::now();
-		auto mseconds	 = std::chrono::duration_cast<std::chrono::milliseconds>(current.time_since_epoch()).count() % 1000;
-
-		// Obtain current hours/minutes/seconds
-		std::time_t time = std::time(nullptr);
-		std::tm local_time{};
-		::localtime_r(&time, &local_time);
-
-		ov::String log;
-
-#if OV_LOG_SHOW_FILE_NAME
-		ov::String fileName = file;
+		// The records are formatted in this buffer, longer records are formatted with ov::String
+		constexpr size_t LOG_BUFFER_SIZE = 4096;
+		thread_local char buffer[LOG_BUFFER_SIZE];
+		size_t length = 0;
 
+		if (show_format)
 		{
-			ssize_t position = fileName.IndexOfRev('/');
-
-			if (position >= 0)
+			// The date and time part of the prefix is formatted only when the second changes
+			thread_local std::time_t cached_second = -1;
+			thread_local char cached_time[32];
+			thread_local int cached_time_length = 0;
+			thread_local uint64_t tid = ov::Platform::GetThreadId();
+
+			// Obtain current time in milliseconds
+			auto current = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+			std::time_t second = current / 1000;
+			int mseconds = current % 1000;
+
+			if (second != cached_second)
 			{
-				fileName = fileName.Substring(position + 1);
+				// Obtain current hours/minutes/seconds
+				std::tm local_time{};
+				::localtime_r(&second, &local_time);
+
+				cached_time_length = ::snprintf(
+					cached_time, sizeof(cached_time),
+#if DEBUG
+					// In DEBUG mode, the year is not displayed
+					"[%02d-%02d %02d:%02d:%02d",
+#else	// DEBUG
+					// date, time ([yyyy-mm-dd hh:mm:ss)
+					"[%04d-%02d-%02d %02d:%02d:%02d",
+					1900 + local_time.tm_year,
+#endif	// DEBUG
+					local_time.tm_mon + 1, local_time.tm_mday,
+					local_time.tm_hour, local_time.tm_min, local_time.tm_sec);
+
+				cached_second = second;
 			}
-		}
+
+#if OV_LOG_SHOW_FILE_NAME
+			const char *file_name = ::strrchr(file, '/');
+			file_name = (file_name != nullptr) ? (file_name + 1) : file;
 #endif	// OV_LOG_SHOW_FILE_NAME
 
 #if OV_LOG_SHOW_FUNCTION_NAME
-		ov::String func = method;
-
-		{
-			int position = func.IndexOf('(');
+			ov::String func = method;
 
-			if (position >= 0)
 			{
-				func = func.Left(position);
-			}
+				int position = func.IndexOf('(');
+
+				if (position >= 0)
+				{
+					func = func.Left(position);
+				}
 
-			position = func.IndexOfRev(' ');
+				position = func.IndexOfRev(' ');
 
-			if (position >= 0)
-			{
-				func = func.Substring(position + 1);
+				if (position >= 0)
+				{
+					func = func.Substring(position + 1);
+				}
 			}
-		}
 #endif	// OV_LOG_SHOW_FUNCTION_NAME
 
-		if (show_format)
-		{
-			auto tid  = ov::Platform::GetThreadId();
-			auto name = ov::Platform::GetThreadName();
-
 			// log format
 			//  [<date> <time>] <tag> <log level> <thread id> | <message>
-			log.Format(
-				""
-				// color
-				"%s"
-#if DEBUG
-				// In DEBUG mode, the year is not displayed
-				"["
-#else	// DEBUG
-
-				// date,
-				"[%04d-"
-#endif	// DEBUG
-
-				// time ([mm-dd hh:mm:ss.sss])
-				"%02d-%02d %02d:%02d:%02d.%03d]"
-
+			auto result = ::snprintf(
+				buffer, sizeof(buffer),
+				// date, time
+				"%.*s"
+				// .sss]
+				".%03d]"
 				// <log level>
 				" %s"
 				// <thread id>
@@ -310,46 +308,93 @@ namespace ov
 				"%s() | "
 #endif	// OV_LOG_SHOW_FUNCTION_NAME
 				,
-				"",
-#if DEBUG
-				local_time.tm_mon + 1, local_time.tm_mday,
-#else	// DEBUG
-				1900 + local_time.tm_year, local_time.tm_mon + 1, local_time.tm_mday,
-#endif	// DEBUG
-				local_time.tm_hour, local_time.tm_min, local_time.tm_sec, mseconds,
+				cached_time_length, cached_time,
+				mseconds,
 				log_level[level],
-				name,
+				ov::Platform::GetThreadName(),
 				tid,
 				(tag[0] == '\0') ? "" : " ", tag
-
 #if OV_LOG_SHOW_FILE_NAME
 				,
-				fileName.CStr(), line
+				file_name, line
 #endif	// OV_LOG_SHOW_FILE_NAME
 #if OV_LOG_SHOW_FUNCTION_NAME
 				,
 				func.CStr()
 #endif	// OV_LOG_SHOW_FUNCTION_NAME
 			);
+
+			length = std::min(static_cast<size_t>(std::max(result, 0)), LOG_BUFFER_SIZE - 1);
 		}
 
 		// Append messages
-		log.AppendVFormat(format, arg_list);
-		if (show_format)
+		va_list arg_list_copy;
+		va_copy(arg_list_copy, arg_list);
+		auto result = ::vsnprintf(buffer + length, LOG_BUFFER_SIZE - length, format, arg_list_copy);
+		va_end(arg_list_copy);
+
+		if ((result >= 0) && (static_cast<size_t>(result) < (LOG_BUFFER_SIZE - length)))
 		{
-			if (level < OVLogLevelWarning)
-			{
-				::fprintf(stdout, "%s%s%s\n", color_prefix[level], log.CStr(), color_suffix[level]);
-				::fflush(stdout);
-			}
-			else
+			Write(show_format, level, buffer, length + result);
+		}
+		else
+		{
+			ov::String log(buffer, length);
+			log.AppendVFormat(format, arg_list);
+
+			Write(show_format, level, log.CStr(), log.GetLength());
+		}
+	}
+
+	void LogInternal::Write(bool to_console, OVLogLevel level, const char *log, size_t length)
+	{
+#if OV_LOG_ASYNC
+		auto writer = LogAsyncWriter::GetInstance();
+
+		if (writer != nullptr)
+		{
+			if (writer->Push(&_log_file, to_console, level, log, length) == false)
 			{
-				::fprintf(stderr, "%s%s%s\n", color_prefix[level], log.CStr(), color_suffix[level]);
-				::fflush(stderr);
+				// Critical, too long, or the buffer is full
+				writer->WriteSync(&_log_file, to_console, level, log, length);
 			}
+
+			return;
+		}
+#endif	// OV_LOG_ASYNC
+
+		// The writer is not available (the process is terminating)
+		if (to_console)
+		{
+			LogAsyncWriter::WriteToConsole(level, log, length);
 		}
 
-		_log_file.Write(log.CStr());
+		struct iovec iov[2];
+		iov[0].iov_base = const_cast<char *>(log);
+		iov[0].iov_len = length;
+		iov[1].iov_base = const_cast<char *>("\n");
+		iov[1].iov_len = 1;
+		_log_file.Write(iov, 2);
+	}
+
+	void LogInternal::Flush()
+	{
+		auto writer = LogAsyncWriter::GetInstance();
+
+		if (writer != nullptr)
+		{
+			writer->Flush();
+		}
+	}
+
+	void LogInternal::FlushOnFatal()
+	{
+		auto writer = LogAsyncWriter::GetInstance();
+
+		if (writer != nullptr)
+		{
+			writer->FlushOnFatal();
+		}
 	}
 
 	void LogInternal::SetLogPath(const char *log_path)
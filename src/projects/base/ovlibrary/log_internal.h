@@ -12,6 +12,7 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <atomic>
 #include <chrono>
 #include <cstdio>
 #include <ctime>
@@ -21,6 +22,7 @@
 
 #include "./assert.h"
 #include "./log.h"
+#include "./log_async_writer.h"
 #include "./log_write.h"
 #include "./string.h"
 
@@ -32,6 +34,9 @@
 #	define OV_LOG_SHOW_FUNCTION_NAME 0
 #endif	// DEBUG
 
+// Write the logs in the background (LogAsyncWriter), critical logs are always written synchronously
+#define OV_LOG_ASYNC 1
+
 namespace ov
 {
 	class LogInternal
@@ -68,7 +73,17 @@ namespace ov
 		void SetLogPath(const char *log_path);
 		const char *GetLogPath() const;
 
+		void Flush();
+		void FlushOnFatal();
+
 	protected:
+		struct EnableItem;
+
+		// Finds the rule for the tag (slow path, the result is cached per thread)
+		EnableItem FindEnableItem(const char *tag);
+
+		void Write(bool to_console, OVLogLevel level, const char *log, size_t length);
+
 		// This variable is used to avoid the problem of referencing incorrect heap if the log is written after LogInternal instance is released.
 		// This situation occurs when the LogInternal instance declared static is disabled just before the OME is terminated and then logs are written by another module.
 		bool _released = false;
@@ -76,6 +91,8 @@ namespace ov
 		OVLogLevel _level;
 
 		std::mutex _mutex;
+		// Increased whenever the rules are changed to invalidate the caches of the threads
+		std::atomic<uint64_t> _enable_generation{1};
 
 		LogWrite _log_file;
 
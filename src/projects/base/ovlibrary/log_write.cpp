@@ -9,12 +9,17 @@
 
 #include "log_write.h"
 
+#include <fcntl.h>
+#include <limits.h>
 #include <sys/stat.h>
+#include <unistd.h>
 
+#include <algorithm>
+#include <cstring>
 #include <iomanip>
-#include <iostream>
 #include <memory>
 #include <sstream>
+#include <vector>
 
 namespace ov
 {
@@ -48,6 +53,20 @@ namespace ov
 		return _log_path.c_str();
 	}
 
+	LogWrite::~LogWrite()
+	{
+		CloseFile();
+	}
+
+	void LogWrite::CloseFile()
+	{
+		if (_log_fd >= 0)
+		{
+			::close(_log_fd);
+			_log_fd = -1;
+		}
+	}
+
 	void LogWrite::OpenNewFile(std::time_t time)
 	{
 		if (_start_service)
@@ -63,9 +82,9 @@ namespace ov
 			return;
 		}
 
-		std::lock_guard<std::mutex> lock_guard(_log_stream_mutex);
-		_log_stream.close();
-		_log_stream.clear();
+		CloseFile();
+
+		std::string log_file = _log_file;
 
 		if (_include_date_in_filename == true)
 		{
@@ -73,12 +92,10 @@ namespace ov
 			::localtime_r(&time, &local_time);
 			std::ostringstream logfile;
 			logfile << _log_file << "." << std::put_time(&local_time, "%Y%m%d");
-			_log_stream.open(logfile.str().c_str(), std::ofstream::out | std::ofstream::app);
-		}
-		else
-		{
-			_log_stream.open(_log_file, std::ofstream::out | std::ofstream::app);
+			log_file = logfile.str();
 		}
+
+		_log_fd = ::open(log_file.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
 	}
 
 	void LogWrite::SetAsService(bool start_service)
@@ -87,6 +104,18 @@ namespace ov
 	}
 
 	void LogWrite::Write(const char *log, std::time_t time)
+	{
+		struct iovec iov[2];
+
+		iov[0].iov_base = const_cast<char *>(log);
+		iov[0].iov_len = ::strlen(log);
+		iov[1].iov_base = const_cast<char *>("\n");
+		iov[1].iov_len = 1;
+
+		Write(iov, 2, time);
+	}
+
+	void LogWrite::Write(const struct iovec *iov, int iov_count, std::time_t time)
 	{
 		if (time == 0)
 		{
@@ -95,7 +124,9 @@ namespace ov
 		std::tm local_time{};
 		::localtime_r(&time, &local_time);
 
-		if (!_log_stream.is_open() || _log_stream.fail())
+		std::lock_guard<std::mutex> lock_guard(_log_stream_mutex);
+
+		if (_log_fd < 0)
 		{
 			OpenNewFile(time);
 		}
@@ -120,8 +151,118 @@ namespace ov
 			_last_day = local_time.tm_mday;
 		}
 
-		std::lock_guard<std::mutex> lock_guard(_log_stream_mutex);
-		_log_stream << log << std::endl;
-		_log_stream.flush();
+		if (_log_fd < 0)
+		{
+			return;
+		}
+
+		if (WriteFully(_log_fd, iov, iov_count) == false)
+		{
+			// Reopen the file at the next write
+			CloseFile();
+		}
+	}
+
+	bool LogWrite::WriteFully(int fd, const struct iovec *iov, int iov_count)
+	{
+		// writev() accepts up to IOV_MAX buffers and may write partially
+		std::vector<struct iovec> remained;
+
+		while (iov_count > 0)
+		{
+			int count = std::min(iov_count, IOV_MAX);
+			ssize_t written = ::writev(fd, iov, count);
+
+			if (written <= 0)
+			{
+				if ((written < 0) && (errno == EINTR))
+				{
+					continue;
+				}
+
+				return false;
+			}
+
+			// Skip the written buffers
+			while ((count > 0) && (static_cast<size_t>(written) >= iov->iov_len))
+			{
+				written -= iov->iov_len;
+				iov++;
+				iov_count--;
+				count--;
+			}
+
+			if ((count > 0) && (written > 0))
+			{
+				// Partially written buffer
+				std::vector<struct iovec> next(iov, iov + iov_count);
+				next[0].iov_base = static_cast<uint8_t *>(next[0].iov_base) + written;
+				next[0].iov_len -= written;
+
+				remained.swap(next);
+				iov = remained.data();
+			}
+		}
+
+		return true;
+	}
+
+	bool LogWrite::WriteOnFatal(const struct iovec *iov, int iov_count)
+	{
+		std::unique_lock<std::mutex> lock(_log_stream_mutex, std::try_to_lock);
+
+		if ((lock.owns_lock() == false) || (_log_fd < 0))
+		{
+			return false;
+		}
+
+		return WriteFullyOnFatal(_log_fd, iov, iov_count);
+	}
+
+	bool LogWrite::WriteFullyOnFatal(int fd, const struct iovec *iov, int iov_count)
+	{
+		if ((iov_count <= 0) || (iov_count > OV_LOG_WRITE_FATAL_MAX_IOV))
+		{
+			return false;
+		}
+
+		// A copy on the stack that is advanced on partial writes
+		struct iovec remained[OV_LOG_WRITE_FATAL_MAX_IOV];
+		for (int index = 0; index < iov_count; index++)
+		{
+			remained[index] = iov[index];
+		}
+
+		struct iovec *current = remained;
+
+		while (iov_count > 0)
+		{
+			ssize_t written = ::writev(fd, current, iov_count);
+
+			if (written <= 0)
+			{
+				if ((written < 0) && (errno == EINTR))
+				{
+					continue;
+				}
+
+				return false;
+			}
+
+			while ((iov_count > 0) && (static_cast<size_t>(written) >= current->iov_len))
+			{
+				written -= current->iov_len;
+				current++;
+				iov_count--;
+			}
+
+			if (iov_count > 0)
+			{
+				current->iov_base = static_cast<uint8_t *>(current->iov_base) + written;
+				current->iov_len -= written;
+			}
+		}
+
+		return true;
 	}
-}  // namespace ov
\ No newline at end of file
+}  // namespace ov
@@ -8,12 +8,16 @@
 //==============================================================================
 #pragma once
 
-#include <fstream>
+#include <sys/uio.h>
+
+#include <ctime>
 #include <mutex>
+#include <string>
 
 #define OV_LOG_DIR "logs"
 #define OV_LOG_DIR_SVC "/var/log/ovenmediaengine"
 #define OV_DEFAULT_LOG_FILE "ovenmediaengine.log"
+#define OV_LOG_WRITE_FATAL_MAX_IOV 4
 
 namespace ov
 {
@@ -21,18 +25,31 @@ namespace ov
 	{
 	public:
 		LogWrite(std::string log_file_name, bool include_date_in_filename = false);
-		virtual ~LogWrite() = default;
+		virtual ~LogWrite();
 		void Write(const char *log, std::time_t time = 0);
+		// Writes the buffers at once, each buffer must contain the line feed if needed
+		void Write(const struct iovec *iov, int iov_count, std::time_t time = 0);
 		void SetLogPath(const char *log_path);
 		const char *GetLogPath() const;
 
 		static void SetAsService(bool start_service);
 
+		// Writes all buffers to the fd (handles IOV_MAX and partial writes)
+		static bool WriteFully(int fd, const struct iovec *iov, int iov_count);
+
+		// Used on the fatal paths (signal handlers and assertions), where the crashed thread may hold a lock or be inside malloc():
+		// nothing is allocated, and nothing is written if the file is locked or not opened yet.
+		// iov_count must not exceed OV_LOG_WRITE_FATAL_MAX_IOV.
+		bool WriteOnFatal(const struct iovec *iov, int iov_count);
+		static bool WriteFullyOnFatal(int fd, const struct iovec *iov, int iov_count);
+
 	private:
+		// These must be called while holding _log_stream_mutex
 		void OpenNewFile(std::time_t time = 0);
+		void CloseFile();
 
 		std::mutex _log_stream_mutex;
-		std::ofstream _log_stream;
+		int _log_fd = -1;
 		int _last_day;
 		std::string _log_path;
 		std::string _log_file_name;
@@ -137,4 +137,27 @@ namespace ov
 
 		return node->OnDataReceivedFromPrevNode(node_type, data);
 	}
-}  // namespace pub
\ No newline at end of file
+
+	bool Node::SendDataListToNextNode(NodeType node_type, const std::vector<std::shared_ptr<ov::Data>> &data_list)
+	{
+		auto node = GetNextNode();
+		if(node == nullptr)
+		{
+			return false;
+		}
+
+		return node->OnDataListReceivedFromPrevNode(node_type, data_list);
+	}
+
+	bool Node::OnDataListReceivedFromPrevNode(NodeType from_node, const std::vector<std::shared_ptr<ov::Data>> &data_list)
+	{
+		bool result = true;
+
+		for (const auto &data : data_list)
+		{
+			result = OnDataReceivedFromPrevNode(from_node, data) && result;
+		}
+
+		return result;
+	}
+}  // namespace pub
@@ -43,6 +43,11 @@ namespace ov
 		virtual bool OnDataReceivedFromPrevNode(NodeType from_node, const std::shared_ptr<ov::Data> &data) = 0;
 		virtual bool OnDataReceivedFromNextNode(NodeType from_node, const std::shared_ptr<const ov::Data> &data) = 0;
 
+		// Receives a burst of packets at once.
+		// By default, each packet is passed to OnDataReceivedFromPrevNode() one by one,
+		// and a node that can process packets in a batch (e.g. SRTP) overrides this.
+		virtual bool OnDataListReceivedFromPrevNode(NodeType from_node, const std::vector<std::shared_ptr<ov::Data>> &data_list);
+
 	protected:
 		bool SendDataToPrevNode(NodeType node_type, const std::shared_ptr<const ov::Data> &data);
 		bool SendDataToNextNode(NodeType node_type, const std::shared_ptr<ov::Data> &data);
@@ -50,6 +55,8 @@ namespace ov
 		bool SendDataToPrevNode(const std::shared_ptr<const ov::Data> &data);
 		bool SendDataToNextNode(const std::shared_ptr<ov::Data> &data);
 
+		bool SendDataListToNextNode(NodeType node_type, const std::vector<std::shared_ptr<ov::Data>> &data_list);
+
 		std::shared_ptr<Node> GetPrevNode();
 		std::shared_ptr<Node> GetNextNode();
 
@@ -22,6 +22,7 @@
 #include "./dump_utilities.h"
 #include "./enable_shared_from_this.h"
 #include "./error.h"
+#include "./event.h"
 #include "./json.h"
 #include "./log.h"
 #include "./memory_utilities.h"
@@ -44,6 +45,7 @@
 #include "./string.h"
 #include "./constexpr_utilities.h"
 #include "./time.h"
+#include "./timer_wheel.h"
 #include "./type.h"
 #include "./unique.h"
 #include "./url.h"
@@ -45,6 +45,13 @@ namespace ov
 		  _length(string._length),
 		  _capacity(string._capacity)
 	{
+		if (string.IsInline())
+		{
+			// Inline storage cannot be taken over
+			::memcpy(_inline_buffer, string._inline_buffer, sizeof(char) * (_length + 1L));
+			_buffer = _inline_buffer;
+		}
+
 		string._buffer = nullptr;
 
 		string._length = 0;
@@ -99,6 +106,42 @@ namespace ov
 		return *this;
 	}
 
+	String &String::operator=(String &&buffer) noexcept
+	{
+		if (this == &buffer)
+		{
+			return *this;
+		}
+
+		if (buffer.IsInline())
+		{
+			// Inline storage cannot be taken over, but fits in the buffer of this object
+			if (_buffer == nullptr)
+			{
+				_buffer = _inline_buffer;
+				_capacity = InlineCapacity;
+			}
+
+			::memcpy(_buffer, buffer._inline_buffer, sizeof(char) * (buffer._length + 1L));
+			_length = buffer._length;
+		}
+		else
+		{
+			Release();
+
+			_buffer = buffer._buffer;
+			_length = buffer._length;
+			_capacity = buffer._capacity;
+		}
+
+		buffer._buffer = nullptr;
+
+		buffer._length = 0;
+		buffer._capacity = 0;
+
+		return *this;
+	}
+
 	String &String::operator=(const char *buffer) noexcept
 	{
 		if (_buffer != nullptr)
@@ -263,34 +306,45 @@ namespace ov
 
 	size_t String::AppendVFormat(const char *format, va_list list)
 	{
-		va_list list_for_count;
+		va_list list_for_retry;
 
-		va_copy(list_for_count, list);
+		// If the formatted string does not fit in the remaining space, it is formatted again after allocation
+		va_copy(list_for_retry, list);
 
-		int result = ::vsnprintf(nullptr, 0, format, list_for_count);
+		if (_buffer == nullptr)
+		{
+			// Try with the inline buffer first
+			Alloc(InlineCapacity);
+		}
+
+		size_t remained = _capacity - _length;
+		int result = ::vsnprintf(_buffer + _length, remained + 1L, format, list);
 
 		if (result < 0)
 		{
+			_buffer[_length] = '\0';
+			va_end(list_for_retry);
 			return 0L;
 		}
 
 		size_t length = static_cast<size_t>(result);
 
-		if (Alloc(_length + length) == false)
+		if (length > remained)
 		{
-			return 0;
-		}
+			if (Alloc(_length + length) == false)
+			{
+				_buffer[_length] = '\0';
+				va_end(list_for_retry);
+				return 0L;
+			}
 
-		if (_buffer != nullptr)
-		{
-			::vsnprintf(_buffer + _length, length + 1, format, list);
-			_length += length;
+			::vsnprintf(_buffer + _length, length + 1L, format, list_for_retry);
 		}
 
-		if (_buffer != nullptr)
-		{
-			_buffer[_length] = '\0';
-		}
+		va_end(list_for_retry);
+
+		_length += length;
+		_buffer[_length] = '\0';
 
 		return length;
 	}
@@ -310,28 +364,15 @@ namespace ov
 
 	size_t String::VFormat(const char *format, va_list list)
 	{
-		va_list list_for_count;
-
-		// vsnprintf로 길이를 얻어오면 list가 가장 마지막 파라미터를 가리키게 되므로
-		// 현재 상태를 미리 백업함
-		va_copy(list_for_count, list);
-
-		int result = ::vsnprintf(nullptr, 0, format, list);
+		// Keep the allocated buffer to format in place
+		_length = 0L;
 
-		if (result <= 0L)
+		if (_buffer != nullptr)
 		{
-			return 0L;
+			_buffer[0] = '\0';
 		}
 
-		size_t length = static_cast<size_t>(result);
-
-		if (Alloc(length))
-		{
-			va_copy(list, list_for_count);
-
-			::vsnprintf(_buffer, length + 1, format, list);
-			_length = length;
-		}
+		AppendVFormat(format, list);
 
 		return _length;
 	}
@@ -843,55 +884,13 @@ namespace ov
 
 	bool String::operator<(const String &str) const
 	{
-		if (_buffer == nullptr)
-		{
-			if (str._buffer != nullptr)
-			{
-				// _buffer == nullptr && str != nullptr
-				return true;
-			}
-
-			// _buffer == nullptr && str == nullptr
-			return false;
-		}
-
-		if (str._buffer == nullptr)
-		{
-			// _buffer != nullptr && str == nullptr
-			return false;
-		}
-
-		// _buffer != nullptr && str != nullptr
-		if (::strcmp(_buffer, str._buffer) < 0)
-		{
-			return true;
-		}
-
-		return false;
+		// A string that is not allocated yet is the same as an empty string
+		return ::strcmp(CStr(), str.CStr()) < 0;
 	}
 
 	bool String::operator>(const String &str) const
 	{
-		if (_buffer == nullptr)
-		{
-			// _buffer == nullptr && str != nullptr
-			// _buffer == nullptr && str == nullptr
-			return false;
-		}
-
-		if (str._buffer == nullptr)
-		{
-			// _buffer != nullptr && str == null
-			return true;
-		}
-
-		// _buffer != nullptr && str != nullptr
-		if (::strcmp(_buffer, str._buffer) > 0)
-		{
-			return true;
-		}
-
-		return false;
+		return ::strcmp(CStr(), str.CStr()) > 0;
 	}
 
 	size_t String::GetCapacity() const noexcept
@@ -994,6 +993,30 @@ namespace ov
 
 	bool String::Alloc(size_t length, bool alloc_exactly) noexcept
 	{
+		if (length <= InlineCapacity)
+		{
+			if ((_buffer == nullptr) || (alloc_exactly && (IsInline() == false)))
+			{
+				// Small strings are stored in the inline buffer
+				size_t old_length = std::min(_length, length);
+
+				if (old_length > 0L)
+				{
+					::memmove(_inline_buffer, _buffer, sizeof(char) * old_length);
+				}
+
+				::memset(_inline_buffer + old_length, 0, sizeof(char) * (InlineCapacity + 1L - old_length));
+
+				Release();
+
+				_buffer = _inline_buffer;
+				_capacity = InlineCapacity;
+				_length = old_length;
+			}
+
+			return true;
+		}
+
 		if (
 			// 기존에 할당된 버퍼가 충분 하지 않거나
 			(_capacity < length) ||
@@ -1006,15 +1029,15 @@ namespace ov
 
 			if (alloc_exactly == false)
 			{
-				allocated_length = 1L;
+				allocated_length = InlineCapacity + 1L;
 
 				// 2의 거듭 제곱 크기로 계산
 				while (allocated_length < length)
 				{
 					if (allocated_length >= 1024L * 1024L)
 					{
-						// 1MB를 넘어가면 지수 형태로 증가 하지 않음
-						allocated_length += 1024L * 1024L;
+						// 1MB를 넘어가면 1.5배씩 증가
+						allocated_length += allocated_length / 2L;
 					}
 					else
 					{
@@ -1033,14 +1056,17 @@ namespace ov
 				return false;
 			}
 
-			::memset(buffer, 0, sizeof(char) * (allocated_length + 1L));
-
 			// 기존에 데이터가 있다면 복사
-			if (_length > 0L)
+			size_t copied_length = std::min(allocated_length, _length);
+
+			if (copied_length > 0L)
 			{
-				::memcpy(buffer, _buffer, sizeof(char) * std::min(allocated_length, _length));
+				::memcpy(buffer, _buffer, sizeof(char) * copied_length);
 			}
 
+			// 나머지 공간은 0으로 채움 (SetLength()로 늘어난 영역)
+			::memset(buffer + copied_length, 0, sizeof(char) * (allocated_length + 1L - copied_length));
+
 			// 기존 버퍼 해제
 			size_t old_length = _length;
 
@@ -1052,7 +1078,7 @@ namespace ov
 			_buffer = buffer;
 
 			// Release()에 의해 길이 정보가 초기화 되었으므로 다시 대입해줌
-			_length = old_length;
+			_length = std::min(old_length, allocated_length);
 		}
 
 		return true;
@@ -1060,7 +1086,14 @@ namespace ov
 
 	bool String::Release() noexcept
 	{
-		OV_SAFE_FREE(_buffer);
+		if (IsInline())
+		{
+			_buffer = nullptr;
+		}
+		else
+		{
+			OV_SAFE_FREE(_buffer);
+		}
 
 		_capacity = 0L;
 		_length = 0L;
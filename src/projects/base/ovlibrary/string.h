@@ -27,6 +27,9 @@ namespace ov
 	class String
 	{
 	public:
+		// Strings up to this length are stored in the object itself without heap allocation
+		static constexpr size_t InlineCapacity = 23;
+
 		String() = default;
 		String(const char *string);	 // NOLINT
 		String(const char *string, size_t length);
@@ -48,6 +51,7 @@ namespace ov
 
 		// String manipulation API
 		String &operator=(const String &buffer) noexcept;
+		String &operator=(String &&buffer) noexcept;
 		String &operator=(const char *buffer) noexcept;
 		const String &operator+=(const char *buffer) noexcept;
 		String operator+(const String &other) const noexcept;
@@ -159,6 +163,12 @@ namespace ov
 		bool Release() noexcept;
 
 	private:
+		bool IsInline() const noexcept
+		{
+			return _buffer == _inline_buffer;
+		}
+
+		// Points to nullptr (not allocated yet), _inline_buffer or a heap memory
 		char *_buffer = nullptr;
 
 		// Actual string length
@@ -166,6 +176,8 @@ namespace ov
 
 		// Allocated memory size (Exponentially increasing)
 		size_t _capacity = 0;
+
+		char _inline_buffer[InlineCapacity + 1];
 	};
 
 	struct CaseInsensitiveHash
@@ -0,0 +1,717 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "./timer_wheel.h"
+
+#include <pthread.h>
+
+#include <algorithm>
+
+#include "./log.h"
+#include "./logger/thread_helper.h"
+#include "./ovlibrary_private.h"
+#include "./string.h"
+
+namespace ov
+{
+	class TimerWheel::Timer : public TimerWheel::TimerLink
+	{
+	public:
+		enum class State : uint8_t
+		{
+			// Linked to a slot of the wheel
+			Pending,
+			// Waiting for a worker
+			Expired,
+			Running,
+			Done,
+			Cancelled
+		};
+
+		Shard *shard = nullptr;
+
+		TimerFunction function;
+		int64_t expire_tick = 0;
+
+		State state = State::Pending;
+		int level = -1;
+		int slot = -1;
+
+		std::thread::id running_thread_id;
+		// RescheduleAt() is called while the function is running, so it is linked again when the function returns
+		bool reschedule_requested = false;
+
+		// The wheel only has raw pointers to the linked timers, so a pending timer keeps itself alive
+		std::shared_ptr<Timer> self;
+	};
+
+	TimerWheel::TimerWheel()
+		: _epoch(std::chrono::steady_clock::now())
+	{
+		for (int index = 0; index < TIMER_WHEEL_SHARD_COUNT; index++)
+		{
+			_shards[index] = std::make_unique<Shard>(this, index);
+		}
+	}
+
+	TimerWheel::~TimerWheel()
+	{
+		for (auto &shard : _shards)
+		{
+			shard->Stop();
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(_worker_mutex);
+			_stop = true;
+		}
+
+		_worker_condition.notify_all();
+
+		for (auto &thread : _worker_threads)
+		{
+			if (thread.joinable())
+			{
+				thread.join();
+			}
+		}
+
+		_expired_timers.clear();
+
+		// Release the pending timers
+		for (auto &shard : _shards)
+		{
+			shard.reset();
+		}
+	}
+
+	int64_t TimerWheel::GetNowTick() const
+	{
+		return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _epoch).count();
+	}
+
+	int64_t TimerWheel::GetNowMSec() const
+	{
+		return GetNowTick();
+	}
+
+	int64_t TimerWheel::GetExpireMSec(int64_t after_msec) const
+	{
+		// Round up to the next tick, so that the timer never expires earlier than after_msec
+		auto now_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - _epoch).count();
+
+		return ((now_us + 999) / 1000) + std::max<int64_t>(after_msec, 0);
+	}
+
+	void TimerWheel::StartIfNeeded()
+	{
+		std::call_once(_start_flag, [this]() {
+			for (auto &shard : _shards)
+			{
+				shard->Start();
+			}
+
+			for (int index = 0; index < TIMER_WHEEL_WORKER_COUNT; index++)
+			{
+				auto thread = std::thread(&TimerWheel::WorkerThreadProc, this);
+				::pthread_setname_np(thread.native_handle(), String::FormatString("TimerWorker%d", index));
+
+				_worker_threads.push_back(std::move(thread));
+			}
+		});
+	}
+
+	std::shared_ptr<TimerWheel::Timer> TimerWheel::Schedule(TimerFunction function, int64_t after_msec)
+	{
+		return ScheduleAt(std::move(function), GetExpireMSec(after_msec));
+	}
+
+	std::shared_ptr<TimerWheel::Timer> TimerWheel::ScheduleAt(TimerFunction function, int64_t expire_msec)
+	{
+		StartIfNeeded();
+
+		auto timer = std::make_shared<Timer>();
+
+		timer->shard = _shards[_next_shard_index.fetch_add(1, std::memory_order_relaxed) % TIMER_WHEEL_SHARD_COUNT].get();
+		timer->function = std::move(function);
+		timer->expire_tick = expire_msec;
+
+		timer->shard->ScheduleTimer(timer);
+
+		return timer;
+	}
+
+	bool TimerWheel::RescheduleAt(const std::shared_ptr<Timer> &timer, int64_t expire_msec)
+	{
+		if (timer == nullptr)
+		{
+			return false;
+		}
+
+		return timer->shard->RescheduleTimer(timer, expire_msec);
+	}
+
+	bool TimerWheel::Cancel(const std::shared_ptr<Timer> &timer, bool wait_for_running)
+	{
+		if (timer == nullptr)
+		{
+			return false;
+		}
+
+		return timer->shard->CancelTimer(timer, wait_for_running);
+	}
+
+	size_t TimerWheel::GetCount() const
+	{
+		size_t count = 0;
+
+		for (auto &shard : _shards)
+		{
+			count += shard->GetCount();
+		}
+
+		return count;
+	}
+
+	void TimerWheel::PushExpiredTimers(std::vector<std::shared_ptr<Timer>> &expired_timers)
+	{
+		auto count = expired_timers.size();
+
+		{
+			std::lock_guard<std::mutex> lock(_worker_mutex);
+
+			for (auto &timer : expired_timers)
+			{
+				_expired_timers.push_back(std::move(timer));
+			}
+		}
+
+		expired_timers.clear();
+
+		if (count == 1)
+		{
+			_worker_condition.notify_one();
+		}
+		else
+		{
+			_worker_condition.notify_all();
+		}
+	}
+
+	void TimerWheel::WorkerThreadProc()
+	{
+		logger::ThreadHelper thread_helper;
+
+		while (true)
+		{
+			std::shared_ptr<Timer> timer;
+
+			{
+				std::unique_lock<std::mutex> lock(_worker_mutex);
+
+				_worker_condition.wait(lock, [this]() -> bool {
+					return _stop || (_expired_timers.empty() == false);
+				});
+
+				if (_stop)
+				{
+					break;
+				}
+
+				timer = std::move(_expired_timers.front());
+				_expired_timers.pop_front();
+			}
+
+			// The timer is released here without any lock, since its function may own objects that use TimerWheel in their destructors
+			timer->shard->RunTimer(timer);
+		}
+	}
+
+	TimerWheel::Shard::Shard(TimerWheel *wheel, int index)
+		: _wheel(wheel),
+		  _index(index)
+	{
+		for (auto &head : _level0)
+		{
+			head.prev = &head;
+			head.next = &head;
+		}
+
+		for (auto &level : _level_n)
+		{
+			for (auto &head : level)
+			{
+				head.prev = &head;
+				head.next = &head;
+			}
+		}
+
+		std::fill(std::begin(_level0_bitmap), std::end(_level0_bitmap), 0ULL);
+		std::fill(std::begin(_level_counts), std::end(_level_counts), 0);
+	}
+
+	TimerWheel::Shard::~Shard()
+	{
+		Stop();
+
+		std::vector<std::shared_ptr<Timer>> timers;
+
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+
+			for (int level = 0; level < LevelCount; level++)
+			{
+				int slot_count = (level == 0) ? Level0Size : LevelNSize;
+
+				for (int slot = 0; slot < slot_count; slot++)
+				{
+					auto head = GetSlot(level, slot);
+
+					while (head->next != head)
+					{
+						auto timer = static_cast<Timer *>(head->next);
+						UnlinkTimer(timer);
+
+						timer->state = Timer::State::Cancelled;
+						timers.push_back(std::move(timer->self));
+					}
+				}
+			}
+		}
+
+		// The pending timers are released without the lock
+		timers.clear();
+	}
+
+	void TimerWheel::Shard::Start()
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		_current_tick = std::max(_current_tick, _wheel->GetNowTick());
+
+		_thread = std::thread(&Shard::ThreadProc, this);
+		::pthread_setname_np(_thread.native_handle(), String::FormatString("TimerWheel%d", _index));
+	}
+
+	void TimerWheel::Shard::Stop()
+	{
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_stop = true;
+		}
+
+		_wheel_condition.notify_all();
+
+		if (_thread.joinable())
+		{
+			_thread.join();
+		}
+	}
+
+	void TimerWheel::Shard::ScheduleTimer(const std::shared_ptr<Timer> &timer)
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		SchedulePendingTimer(timer);
+	}
+
+	void TimerWheel::Shard::SchedulePendingTimer(const std::shared_ptr<Timer> &timer)
+	{
+		if (_count == 0)
+		{
+			// Nothing to cascade, so the ticks that have passed while the wheel is empty can be skipped
+			_current_tick = std::max(_current_tick, _wheel->GetNowTick());
+		}
+
+		timer->state = Timer::State::Pending;
+		timer->self = timer;
+
+		AddTimer(timer.get());
+
+		if (timer->expire_tick < _wakeup_tick)
+		{
+			_wheel_condition.notify_one();
+		}
+	}
+
+	bool TimerWheel::Shard::RescheduleTimer(const std::shared_ptr<Timer> &timer, int64_t expire_msec)
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		switch (timer->state)
+		{
+			case Timer::State::Pending:
+				UnlinkTimer(timer.get());
+				timer->expire_tick = expire_msec;
+				AddTimer(timer.get());
+
+				if (timer->expire_tick < _wakeup_tick)
+				{
+					_wheel_condition.notify_one();
+				}
+				return true;
+
+			case Timer::State::Running:
+				// RunTimer() links it again when the function returns
+				timer->expire_tick = expire_msec;
+				timer->reschedule_requested = true;
+				return true;
+
+			case Timer::State::Done:
+				timer->expire_tick = expire_msec;
+				SchedulePendingTimer(timer);
+				return true;
+
+			case Timer::State::Expired:
+			case Timer::State::Cancelled:
+				break;
+		}
+
+		return false;
+	}
+
+	bool TimerWheel::Shard::CancelTimer(const std::shared_ptr<Timer> &timer, bool wait_for_running)
+	{
+		// The function is released after unlocking, since it may own objects that use TimerWheel in their destructors
+		TimerFunction function;
+
+		std::unique_lock<std::mutex> lock(_mutex);
+
+		bool was_running = false;
+
+		while (true)
+		{
+			switch (timer->state)
+			{
+				case Timer::State::Pending:
+					UnlinkTimer(timer.get());
+					timer->state = Timer::State::Cancelled;
+					timer->self.reset();
+					function = std::move(timer->function);
+					// If the function has rescheduled it while waiting, the function has been called
+					return (was_running == false);
+
+				case Timer::State::Expired:
+					// The worker will skip it
+					timer->state = Timer::State::Cancelled;
+					function = std::move(timer->function);
+					return (was_running == false);
+
+				case Timer::State::Running:
+					timer->reschedule_requested = false;
+
+					if ((wait_for_running == false) || (timer->running_thread_id == std::this_thread::get_id()))
+					{
+						return false;
+					}
+
+					_done_condition.wait(lock, [&timer]() -> bool {
+						return timer->state != Timer::State::Running;
+					});
+
+					// The function may have rescheduled the timer again, so check the state again
+					was_running = true;
+					break;
+
+				case Timer::State::Done:
+				case Timer::State::Cancelled:
+					return false;
+			}
+		}
+	}
+
+	void TimerWheel::Shard::RunTimer(const std::shared_ptr<Timer> &timer)
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+
+		if (timer->state != Timer::State::Expired)
+		{
+			// Cancelled
+			return;
+		}
+
+		timer->state = Timer::State::Running;
+		timer->running_thread_id = std::this_thread::get_id();
+
+		lock.unlock();
+
+		// Only the worker accesses the function while it is running
+		if (timer->function != nullptr)
+		{
+			timer->function();
+		}
+
+		lock.lock();
+
+		if (timer->reschedule_requested)
+		{
+			timer->reschedule_requested = false;
+			SchedulePendingTimer(timer);
+		}
+		else
+		{
+			timer->state = Timer::State::Done;
+		}
+
+		_done_condition.notify_all();
+	}
+
+	size_t TimerWheel::Shard::GetCount() const
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		return _count;
+	}
+
+	TimerWheel::TimerLink *TimerWheel::Shard::GetSlot(int level, int slot)
+	{
+		return (level == 0) ? &_level0[slot] : &_level_n[level - 1][slot];
+	}
+
+	void TimerWheel::Shard::AddTimer(Timer *timer)
+	{
+		auto expire_tick = timer->expire_tick;
+		auto interval = expire_tick - _current_tick;
+
+		int level = 0;
+		int slot = 0;
+
+		if (interval < 0)
+		{
+			// Already expired, it will be processed with the current tick
+			slot = static_cast<int>(_current_tick & Level0Mask);
+		}
+		else if (interval < Level0Size)
+		{
+			slot = static_cast<int>(expire_tick & Level0Mask);
+		}
+		else
+		{
+			if (interval > MaxInterval)
+			{
+				// It is cascaded again and again until it comes into range
+				expire_tick = _current_tick + MaxInterval;
+				interval = MaxInterval;
+			}
+
+			level = 1;
+			while ((level < (LevelCount - 1)) && (interval >= (1LL << (Level0Bits + level * LevelNBits))))
+			{
+				level++;
+			}
+
+			slot = static_cast<int>((expire_tick >> (Level0Bits + (level - 1) * LevelNBits)) & LevelNMask);
+		}
+
+		timer->level = level;
+		timer->slot = slot;
+
+		LinkTimer(GetSlot(level, slot), timer);
+
+		if (level == 0)
+		{
+			_level0_bitmap[slot >> 6] |= (1ULL << (slot & 63));
+		}
+
+		_level_counts[level]++;
+		_count++;
+	}
+
+	void TimerWheel::Shard::LinkTimer(TimerLink *head, Timer *timer)
+	{
+		// Append to the tail to keep the order of the timers of the same tick
+		timer->prev = head->prev;
+		timer->next = head;
+		head->prev->next = timer;
+		head->prev = timer;
+	}
+
+	void TimerWheel::Shard::UnlinkTimer(Timer *timer)
+	{
+		timer->prev->next = timer->next;
+		timer->next->prev = timer->prev;
+		timer->prev = nullptr;
+		timer->next = nullptr;
+
+		if (timer->level == 0)
+		{
+			auto head = &_level0[timer->slot];
+
+			if (head->next == head)
+			{
+				_level0_bitmap[timer->slot >> 6] &= ~(1ULL << (timer->slot & 63));
+			}
+		}
+
+		_level_counts[timer->level]--;
+		_count--;
+	}
+
+	int TimerWheel::Shard::CascadeTimers(int level)
+	{
+		int slot = static_cast<int>((_current_tick >> (Level0Bits + (level - 1) * LevelNBits)) & LevelNMask);
+		auto head = GetSlot(level, slot);
+
+		if (head->next != head)
+		{
+			// Detach the list first, since a timer that is out of range may be linked to the same slot again
+			TimerLink list;
+			list.next = head->next;
+			list.prev = head->prev;
+			list.next->prev = &list;
+			list.prev->next = &list;
+
+			head->next = head;
+			head->prev = head;
+
+			while (list.next != &list)
+			{
+				auto timer = static_cast<Timer *>(list.next);
+
+				list.next = timer->next;
+				timer->next->prev = &list;
+
+				_level_counts[level]--;
+				_count--;
+
+				AddTimer(timer);
+			}
+		}
+
+		return slot;
+	}
+
+	void TimerWheel::Shard::ProcessTick(std::vector<std::shared_ptr<Timer>> &expired_timers)
+	{
+		int slot = static_cast<int>(_current_tick & Level0Mask);
+
+		if (slot == 0)
+		{
+			// Level 0 wrapped around, so bring down the timers of the next range.
+			// The upper level is cascaded only when the lower level also wrapped around.
+			for (int level = 1; level < LevelCount; level++)
+			{
+				if (CascadeTimers(level) != 0)
+				{
+					break;
+				}
+			}
+		}
+
+		_current_tick++;
+
+		auto head = &_level0[slot];
+
+		while (head->next != head)
+		{
+			auto timer = static_cast<Timer *>(head->next);
+			UnlinkTimer(timer);
+
+			timer->state = Timer::State::Expired;
+			expired_timers.push_back(std::move(timer->self));
+		}
+	}
+
+	int TimerWheel::Shard::FindNextLevel0Slot(int start) const
+	{
+		int offset = 0;
+
+		while (offset < Level0Size)
+		{
+			int slot = (start + offset) & Level0Mask;
+			int bit = slot & 63;
+
+			auto bits = _level0_bitmap[slot >> 6] >> bit;
+
+			if (bits != 0ULL)
+			{
+				return offset + __builtin_ctzll(bits);
+			}
+
+			offset += 64 - bit;
+		}
+
+		return -1;
+	}
+
+	int64_t TimerWheel::Shard::GetNextWakeupTick() const
+	{
+		if (_count == 0)
+		{
+			return INT64_MAX;
+		}
+
+		int64_t wakeup_tick = INT64_MAX;
+
+		if (_level_counts[0] > 0)
+		{
+			auto offset = FindNextLevel0Slot(static_cast<int>(_current_tick & Level0Mask));
+
+			if (offset >= 0)
+			{
+				wakeup_tick = _current_tick + offset;
+			}
+		}
+
+		if (_count > _level_counts[0])
+		{
+			// The upper levels must be cascaded when the level 0 wraps around
+			wakeup_tick = std::min(wakeup_tick, (_current_tick + Level0Mask) & ~Level0Mask);
+		}
+
+		return wakeup_tick;
+	}
+
+	void TimerWheel::Shard::ThreadProc()
+	{
+		logger::ThreadHelper thread_helper;
+
+		std::vector<std::shared_ptr<Timer>> expired_timers;
+
+		std::unique_lock<std::mutex> lock(_mutex);
+
+		while (_stop == false)
+		{
+			auto now_tick = _wheel->GetNowTick();
+
+			if (_count == 0)
+			{
+				_current_tick = std::max(_current_tick, now_tick + 1);
+			}
+
+			while (_current_tick <= now_tick)
+			{
+				ProcessTick(expired_timers);
+			}
+
+			if (expired_timers.empty() == false)
+			{
+				// The workers take _mutex to run the timers, so they are handed over without it
+				lock.unlock();
+				_wheel->PushExpiredTimers(expired_timers);
+				lock.lock();
+
+				// Timers may have been scheduled in the meantime
+				continue;
+			}
+
+			_wakeup_tick = GetNextWakeupTick();
+
+			if (_wakeup_tick == INT64_MAX)
+			{
+				_wheel_condition.wait(lock);
+			}
+			else
+			{
+				_wheel_condition.wait_until(lock, _wheel->_epoch + std::chrono::milliseconds(_wakeup_tick));
+			}
+
+			_wakeup_tick = INT64_MAX;
+		}
+	}
+}  // namespace ov
@@ -0,0 +1,182 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "./singleton.h"
+
+// Number of threads that run the functions of the expired timers.
+// The functions should not block for a long time, or the other timers will be delayed.
+// (A DelayQueue whose functions block should use DelayQueueThreadMode::Dedicated)
+#define TIMER_WHEEL_WORKER_COUNT 8
+// Number of the wheels that the timers are spread over. Each wheel has its own mutex and thread,
+// so the threads that schedule and cancel timers do not contend on a single mutex.
+#define TIMER_WHEEL_SHARD_COUNT 4
+
+namespace ov
+{
+	// Process-wide hierarchical timing wheel with a resolution of 1 ms (like the classic timer wheel of the Linux kernel).
+	//
+	// Level 0 has 256 slots of 1 ms and each of the upper 4 levels has 64 slots that cover the whole range of the level below it,
+	// so Schedule() and Cancel() are O(1) and timers up to about 49 days can be scheduled.
+	// Timers of the upper levels are moved down (cascaded) when the level 0 wraps around.
+	//
+	// The timers are spread over TIMER_WHEEL_SHARD_COUNT wheels (shards). Only one thread drives each shard, and it sleeps
+	// until the next non-empty slot (or the next cascade), so idle timers do not wake up any thread.
+	// The functions of the expired timers are called from a small fixed thread pool shared by the shards.
+	class TimerWheel : public Singleton<TimerWheel>
+	{
+		friend class Singleton<TimerWheel>;
+
+	public:
+		typedef std::function<void()> TimerFunction;
+
+		// Handle of a scheduled timer. The function is kept until the handle is released, so the timer can be scheduled again.
+		class Timer;
+
+		~TimerWheel() override;
+
+		// Milliseconds of the monotonic clock that the wheel uses
+		int64_t GetNowMSec() const;
+		// Time at which a timer that is scheduled now with after_msec expires (never earlier than after_msec)
+		int64_t GetExpireMSec(int64_t after_msec) const;
+
+		std::shared_ptr<Timer> Schedule(TimerFunction function, int64_t after_msec);
+		// expire_msec is based on GetNowMSec()
+		std::shared_ptr<Timer> ScheduleAt(TimerFunction function, int64_t expire_msec);
+
+		// Schedules the timer again at expire_msec with its function, without allocating a new timer.
+		// A pending timer is moved, a running timer is scheduled again when its function returns,
+		// and a timer whose function has returned is scheduled again.
+		// Returns false if the timer is cancelled or waiting for a worker.
+		bool RescheduleAt(const std::shared_ptr<Timer> &timer, int64_t expire_msec);
+
+		// Returns true if the timer is cancelled before its function is called.
+		// If the function is running and wait_for_running is true, it waits until the function returns
+		// (except when it is called from the function itself).
+		bool Cancel(const std::shared_ptr<Timer> &timer, bool wait_for_running = false);
+
+		// Number of timers that are not expired yet
+		size_t GetCount() const;
+
+	protected:
+		static constexpr int Level0Bits = 8;
+		static constexpr int Level0Size = 1 << Level0Bits;
+		static constexpr int64_t Level0Mask = Level0Size - 1;
+
+		static constexpr int LevelNBits = 6;
+		static constexpr int LevelNSize = 1 << LevelNBits;
+		static constexpr int64_t LevelNMask = LevelNSize - 1;
+
+		static constexpr int LevelCount = 5;
+		static constexpr int64_t MaxInterval = (1LL << (Level0Bits + (LevelCount - 1) * LevelNBits)) - 1;
+
+		// Node of the intrusive doubly linked list of a slot.
+		// The head of each slot is a sentinel, so a timer can be unlinked without knowing its slot.
+		struct TimerLink
+		{
+			TimerLink *prev = nullptr;
+			TimerLink *next = nullptr;
+		};
+
+		// One wheel. The states of its timers are protected by its mutex.
+		class Shard
+		{
+		public:
+			Shard(TimerWheel *wheel, int index);
+			~Shard();
+
+			void Start();
+			void Stop();
+
+			// Links a timer to the wheel and wakes up the thread of the shard if it expires earlier than the current wakeup
+			void ScheduleTimer(const std::shared_ptr<Timer> &timer);
+			bool RescheduleTimer(const std::shared_ptr<Timer> &timer, int64_t expire_msec);
+			bool CancelTimer(const std::shared_ptr<Timer> &timer, bool wait_for_running);
+			// Called from a worker thread
+			void RunTimer(const std::shared_ptr<Timer> &timer);
+
+			size_t GetCount() const;
+
+		protected:
+			// These must be called while holding _mutex
+			void SchedulePendingTimer(const std::shared_ptr<Timer> &timer);
+			TimerLink *GetSlot(int level, int slot);
+			void AddTimer(Timer *timer);
+			void LinkTimer(TimerLink *head, Timer *timer);
+			void UnlinkTimer(Timer *timer);
+			int CascadeTimers(int level);
+			// Moves the expired timers of the current tick to expired_timers
+			void ProcessTick(std::vector<std::shared_ptr<Timer>> &expired_timers);
+			int FindNextLevel0Slot(int start) const;
+			int64_t GetNextWakeupTick() const;
+
+			void ThreadProc();
+
+			TimerWheel *_wheel;
+			int _index;
+
+			mutable std::mutex _mutex;
+			// Wakes up the thread when a timer that expires earlier than the current wakeup is scheduled
+			std::condition_variable _wheel_condition;
+			// Notified whenever a function returns (used by Cancel(wait_for_running = true))
+			std::condition_variable _done_condition;
+
+			TimerLink _level0[Level0Size];
+			TimerLink _level_n[LevelCount - 1][LevelNSize];
+			// Non-empty slots of the level 0, used to find the next wakeup quickly
+			uint64_t _level0_bitmap[Level0Size / 64];
+			size_t _level_counts[LevelCount];
+			size_t _count = 0;
+
+			// The next tick to be processed
+			int64_t _current_tick = 0;
+			// The tick the thread is sleeping until
+			int64_t _wakeup_tick = INT64_MAX;
+
+			bool _stop = false;
+			std::thread _thread;
+		};
+
+		TimerWheel();
+
+		int64_t GetNowTick() const;
+
+		void StartIfNeeded();
+
+		// Called from the threads of the shards
+		void PushExpiredTimers(std::vector<std::shared_ptr<Timer>> &expired_timers);
+		void WorkerThreadProc();
+
+		const std::chrono::steady_clock::time_point _epoch;
+
+		std::unique_ptr<Shard> _shards[TIMER_WHEEL_SHARD_COUNT];
+		std::atomic<uint32_t> _next_shard_index{0};
+
+		// Threads are created on the first use, since TimerWheel may be created during static initialization
+		std::once_flag _start_flag;
+
+		// Expired timers waiting for a worker
+		std::mutex _worker_mutex;
+		std::condition_variable _worker_condition;
+		std::deque<std::shared_ptr<Timer>> _expired_timers;
+		bool _stop = false;
+		std::vector<std::thread> _worker_threads;
+	};
+}  // namespace ov
@@ -12,6 +12,8 @@
 #include <errno.h>
 #include <sys/fcntl.h>
 #include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include <algorithm>
@@ -270,6 +272,43 @@ namespace ov
 		return true;
 	}
 
+	bool Socket::AppendCommands(std::vector<DispatchCommand> commands, bool dispatch_immediately)
+	{
+		SOCKET_PROFILER_INIT();
+		std::lock_guard lock_guard(_dispatch_queue_lock);
+		SOCKET_PROFILER_AFTER_LOCK();
+
+		SOCKET_PROFILER_POST_HANDLER([&](int64_t lock_elapsed, int64_t total_elapsed) {
+			if ((lock_elapsed > 100) || (_dispatch_queue.size() > 10))
+			{
+				logtw("[SockProfiler] AppendCommands() - %s, Queue: %zu, Lock: %dms, Total: %dms", ToString().CStr(), _dispatch_queue.size(), lock_elapsed, total_elapsed);
+			}
+		});
+
+		for (auto &command : commands)
+		{
+			_dispatch_queue.push_back(std::move(command));
+		}
+
+		if (dispatch_immediately)
+		{
+			switch (DispatchEvents())
+			{
+				case DispatchResult::Dispatched:
+					return true;
+
+				case DispatchResult::PartialDispatched:
+					_worker->EnqueueToDispatchLater(GetSharedPtr());
+					return true;
+
+				case DispatchResult::Error:
+					break;
+			}
+		}
+
+		return true;
+	}
+
 	bool Socket::AddToWorker(bool need_to_wait_first_epoll_event)
 	{
 		{
@@ -921,6 +960,86 @@ namespace ov
 		return DispatchResult::PartialDispatched;
 	}
 
+	bool Socket::CanGatherSendCommands() const
+	{
+		if ((GetType() != SocketType::Tcp) || (GetState() == SocketState::Closed) || (_dispatch_queue.size() < 2))
+		{
+			return false;
+		}
+
+		return (_dispatch_queue[0].type == DispatchCommand::Type::Send) &&
+			   (_dispatch_queue[1].type == DispatchCommand::Type::Send);
+	}
+
+	Socket::DispatchResult Socket::DispatchGatheredSendCommands()
+	{
+		struct iovec iov[OV_SOCKET_MAX_GATHER_COUNT];
+		size_t iov_count = 0;
+		size_t total_bytes = 0;
+
+		for (const auto &command : _dispatch_queue)
+		{
+			if ((command.type != DispatchCommand::Type::Send) || (iov_count >= OV_SOCKET_MAX_GATHER_COUNT))
+			{
+				break;
+			}
+
+			iov[iov_count].iov_base = const_cast<void *>(command.data->GetData());
+			iov[iov_count].iov_len = command.data->GetLength();
+
+			total_bytes += iov[iov_count].iov_len;
+			iov_count++;
+		}
+
+		logat("Trying to send %zu buffers (%zu bytes)...", iov_count, total_bytes);
+
+		struct msghdr message = {};
+		message.msg_iov = iov;
+		message.msg_iovlen = iov_count;
+
+		// Use sendmsg() instead of writev() to pass MSG_NOSIGNAL
+		ssize_t sent_bytes = ::sendmsg(GetNativeHandle(), &message, MSG_NOSIGNAL | MSG_DONTWAIT);
+
+		if (sent_bytes < 0L)
+		{
+			sent_bytes = HandleSendError(sent_bytes, 0);
+
+			if (sent_bytes < 0L)
+			{
+				return DispatchResult::Error;
+			}
+		}
+		else
+		{
+			STATS_COUNTER_INCREASE_PPS();
+			UpdateLastSentTime();
+		}
+
+		// Remove the commands that have been sent
+		auto remaining_bytes = static_cast<size_t>(sent_bytes);
+
+		while (remaining_bytes > 0)
+		{
+			auto &front = _dispatch_queue.front();
+			auto length = front.data->GetLength();
+
+			if (remaining_bytes < length)
+			{
+				// Since some data has been sent, the time needs to be updated.
+				front.UpdateTime();
+				front.data = front.data->Subdata(remaining_bytes);
+
+				logad("Part of the data has been sent: %zu bytes, left: %zu bytes (%s)", remaining_bytes, front.data->GetLength(), front.ToString().CStr());
+				break;
+			}
+
+			remaining_bytes -= length;
+			_dispatch_queue.pop_front();
+		}
+
+		return (static_cast<size_t>(sent_bytes) == total_bytes) ? DispatchResult::Dispatched : DispatchResult::PartialDispatched;
+	}
+
 	Socket::DispatchResult Socket::DispatchEventsInternal()
 	{
 		SOCKET_PROFILER_INIT();
@@ -947,6 +1066,20 @@ namespace ov
 
 				while (_dispatch_queue.empty() == false)
 				{
+					if (CanGatherSendCommands())
+					{
+						result = DispatchGatheredSendCommands();
+
+						if (result == DispatchResult::Dispatched)
+						{
+							// Dispatches the next item
+							continue;
+						}
+
+						// The commands which are not sent are remained in the queue
+						break;
+					}
+
 					auto front = _dispatch_queue.front();
 					_dispatch_queue.pop_front();
 
@@ -1238,6 +1371,46 @@ namespace ov
 		return Send((data == nullptr) ? nullptr : std::make_shared<Data>(data, length));
 	}
 
+	bool Socket::Send(const std::vector<std::shared_ptr<const Data>> &data_list)
+	{
+		switch (_blocking_mode)
+		{
+			case BlockingMode::Blocking:
+				for (const auto &data : data_list)
+				{
+					if ((data == nullptr) || (SendInternal(data) != static_cast<ssize_t>(data->GetLength())))
+					{
+						return false;
+					}
+				}
+
+				return true;
+
+			case BlockingMode::NonBlocking:
+				if (IsSendable())
+				{
+					std::vector<DispatchCommand> commands;
+					commands.reserve(data_list.size());
+
+					for (const auto &data : data_list)
+					{
+						if (data == nullptr)
+						{
+							OV_ASSERT2(data != nullptr);
+							return false;
+						}
+
+						commands.emplace_back(data->Clone());
+					}
+
+					return AppendCommands(std::move(commands), true);
+				}
+				break;
+		}
+
+		return false;
+	}
+
 	ssize_t Socket::SendToInternal(const SocketAddress &address, const std::shared_ptr<const Data> &data)
 	{
 		if (GetType() != SocketType::Udp)
@@ -31,6 +31,9 @@
 // For example, it can occur when EAGAIN continues to occur for a period of time, or when the peer's TCP window is full and no longer receives data.
 #define OV_SOCKET_EXPIRE_TIMEOUT (10 * 1000)
 
+// Maximum number of queued buffers to be sent by one sendmsg() call (TCP only)
+#define OV_SOCKET_MAX_GATHER_COUNT 64
+
 namespace ov
 {
 	// Forward declaration
@@ -178,6 +181,8 @@ namespace ov
 
 		bool Send(const std::shared_ptr<const Data> &data);
 		bool Send(const void *data, size_t length);
+		// Sends the buffers in order. For TCP, the buffers are written with scatter-gather I/O without being concatenated.
+		bool Send(const std::vector<std::shared_ptr<const Data>> &data_list);
 
 		bool SendTo(const SocketAddress &address, const std::shared_ptr<const Data> &data);
 		bool SendTo(const SocketAddress &address, const void *data, size_t length);
@@ -424,6 +429,7 @@ namespace ov
 		bool SetBlockingInternal(BlockingMode mode);
 
 		bool AppendCommand(DispatchCommand command, bool dispatch_immediately);
+		bool AppendCommands(std::vector<DispatchCommand> commands, bool dispatch_immediately);
 
 		//--------------------------------------------------------------------
 		// Implementation of SocketPoolEventInterface
@@ -434,6 +440,10 @@ namespace ov
 		//--------------------------------------------------------------------
 
 		DispatchResult DispatchEventInternal(DispatchCommand &command);
+		// Sends the consecutive Send commands at the front of the queue with one sendmsg() call
+		// Must be called with _dispatch_queue_lock locked
+		bool CanGatherSendCommands() const;
+		DispatchResult DispatchGatheredSendCommands();
 
 		bool IsSendable() const;
 		ssize_t HandleSendError(const ssize_t result, const size_t total_sent);
@@ -5,6 +5,7 @@
 #include "publisher.h"
 #include "publisher_private.h"
 #include <base/event/media_event.h>
+#include <monitoring/monitoring.h>
 
 namespace pub
 {
@@ -137,11 +138,15 @@ namespace pub
 
 			if (media_packet->GetMediaType() == cmn::MediaType::Video)
 			{
+				stream->BeginPacketTrace(media_packet);
 				stream->SendVideoFrame(stream_data->_media_packet);
+				stream->EndPacketTrace(media_packet);
 			}
 			else if (media_packet->GetMediaType() == cmn::MediaType::Audio)
 			{
+				stream->BeginPacketTrace(media_packet);
 				stream->SendAudioFrame(stream_data->_media_packet);
+				stream->EndPacketTrace(media_packet);
 			}
 			else if (media_packet->GetMediaType() == cmn::MediaType::Data || 
 						media_packet->GetMediaType() == cmn::MediaType::Subtitle)
@@ -284,10 +289,23 @@ namespace pub
 			return false;
 		}
 
+		// Set before the stream is mapped so that the first packet is traced too.
+		// The packets are not traced at all if nothing can report the latency.
+		auto stream_metrics = StreamMetrics(*info);
+		if ((stream_metrics != nullptr) && (_publisher != nullptr) && MonitorInstance->IsLatencyMetricsOn())
+		{
+			stream->SetLatencyMetrics(stream_metrics->GetLatencyMetrics(_publisher->GetPublisherType()));
+		}
+
 		MapStreamToWorker(info);
 
-		std::lock_guard<std::shared_mutex> lock(_stream_map_mutex);
-		_streams[info->GetId()] = stream;
+		{
+			std::lock_guard<std::shared_mutex> lock(_stream_map_mutex);
+			_streams[info->GetId()] = stream;
+		}
+
+		// Release the requests which are waiting for the stream to be pulled
+		_publisher->OnStreamReady(GetVHostAppName(), stream);
 
 		return true;
 	}
@@ -0,0 +1,185 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "gop_cache.h"
+
+#include <algorithm>
+
+#include "publisher_private.h"
+
+namespace pub
+{
+	void GopCache::SetMaxBytes(size_t max_bytes)
+	{
+		_max_bytes = max_bytes;
+	}
+
+	uint64_t GopCache::Push(const std::any &packet, const PacketInfo &info)
+	{
+		auto sequence = ++_last_sequence;
+		auto &gop = _gops[info.key];
+		bool new_gop = false;
+
+		if (info.is_video)
+		{
+			gop.is_video = true;
+
+			if (info.is_key_frame_start)
+			{
+				ClearGop(gop);
+				gop.available = true;
+				gop.start_sequence = sequence;
+				new_gop = true;
+			}
+			else if (gop.available == false)
+			{
+				// Waiting for a keyframe
+				return sequence;
+			}
+		}
+		else if (GetOldestVideoStartSequence() == 0)
+		{
+			// There is no video GOP to start from
+			return sequence;
+		}
+
+		gop.packets.push_back(Packet{packet, info.bytes, sequence});
+		gop.bytes += info.bytes;
+		_total_bytes += info.bytes;
+
+		if (new_gop)
+		{
+			TrimNonVideoGops();
+		}
+
+		if ((_max_bytes > 0) && (_total_bytes > _max_bytes))
+		{
+			// A GOP cannot be served partially, so the cache is rebuilt from the next keyframes
+			logtd("GOP cache exceeded the limit (%zu > %zu bytes), it will be rebuilt from the next keyframe", _total_bytes, _max_bytes);
+			Clear();
+		}
+
+		return sequence;
+	}
+
+	bool GopCache::GetPackets(std::vector<Packet> &packets) const
+	{
+		auto oldest_start_sequence = GetOldestVideoStartSequence();
+
+		if (oldest_start_sequence == 0)
+		{
+			return false;
+		}
+
+		size_t count = 0;
+		for (const auto &[key, gop] : _gops)
+		{
+			count += gop.packets.size();
+		}
+
+		packets.clear();
+		packets.reserve(count);
+
+		for (const auto &[key, gop] : _gops)
+		{
+			if (gop.is_video)
+			{
+				if (gop.available)
+				{
+					packets.insert(packets.end(), gop.packets.begin(), gop.packets.end());
+				}
+
+				continue;
+			}
+
+			for (const auto &packet : gop.packets)
+			{
+				if (packet.sequence >= oldest_start_sequence)
+				{
+					packets.push_back(packet);
+				}
+			}
+		}
+
+		std::sort(packets.begin(), packets.end(), [](const Packet &a, const Packet &b) {
+			return a.sequence < b.sequence;
+		});
+
+		return packets.empty() == false;
+	}
+
+	void GopCache::Clear()
+	{
+		for (auto &[key, gop] : _gops)
+		{
+			ClearGop(gop);
+			gop.available = false;
+		}
+
+		_total_bytes = 0;
+	}
+
+	void GopCache::Erase(uint64_t key)
+	{
+		auto item = _gops.find(key);
+
+		if (item == _gops.end())
+		{
+			return;
+		}
+
+		ClearGop(item->second);
+		_gops.erase(item);
+	}
+
+	void GopCache::ClearGop(Gop &gop)
+	{
+		_total_bytes -= gop.bytes;
+
+		gop.packets.clear();
+		gop.bytes = 0;
+	}
+
+	void GopCache::TrimNonVideoGops()
+	{
+		auto oldest_start_sequence = GetOldestVideoStartSequence();
+
+		for (auto &[key, gop] : _gops)
+		{
+			if (gop.is_video)
+			{
+				continue;
+			}
+
+			while ((gop.packets.empty() == false) && (gop.packets.front().sequence < oldest_start_sequence))
+			{
+				gop.bytes -= gop.packets.front().bytes;
+				_total_bytes -= gop.packets.front().bytes;
+				gop.packets.pop_front();
+			}
+		}
+	}
+
+	uint64_t GopCache::GetOldestVideoStartSequence() const
+	{
+		uint64_t oldest_start_sequence = 0;
+
+		for (const auto &[key, gop] : _gops)
+		{
+			if (gop.is_video && gop.available)
+			{
+				if ((oldest_start_sequence == 0) || (gop.start_sequence < oldest_start_sequence))
+				{
+					oldest_start_sequence = gop.start_sequence;
+				}
+			}
+		}
+
+		return oldest_start_sequence;
+	}
+}  // namespace pub
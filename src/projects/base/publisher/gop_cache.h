@@ -0,0 +1,112 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <any>
+#include <deque>
+#include <unordered_map>
+
+namespace pub
+{
+	struct GopCacheOptions
+	{
+		bool enabled = false;
+
+		// Upper bound of the cached packets of a stream (bytes)
+		size_t max_bytes = 16 * 1024 * 1024;
+
+		// Bitrate (bps) to send the cached packets to a new session, 0 means as fast as possible
+		int64_t burst_bitrate = 0;
+	};
+
+	// Keeps the packetized packets (shared with the sessions) of each GOP since its last keyframe,
+	// so that a new session can start from the keyframe instead of waiting for the next one.
+	//
+	// A GOP is identified by a key (e.g. track ID). The packets of a non-video GOP (audio) are kept
+	// only from the oldest keyframe of the video GOPs, so that they can be sent together.
+	//
+	// GopCache IS NOT thread safe, the stream locks it.
+	class GopCache
+	{
+	public:
+		struct PacketInfo
+		{
+			PacketInfo(uint64_t key, bool is_video, bool is_key_frame_start, size_t bytes)
+				: key(key),
+				  is_video(is_video),
+				  is_key_frame_start(is_key_frame_start),
+				  bytes(bytes)
+			{
+			}
+
+			uint64_t key;
+			bool is_video;
+			// The packet is the first packet of a keyframe
+			bool is_key_frame_start;
+			size_t bytes;
+		};
+
+		struct Packet
+		{
+			std::any packet;
+			size_t bytes = 0;
+			// Order of the packet in the stream, starting from 1
+			uint64_t sequence = 0;
+		};
+
+		void SetMaxBytes(size_t max_bytes);
+
+		// Returns the sequence given to the packet (whether it is cached or not)
+		uint64_t Push(const std::any &packet, const PacketInfo &info);
+
+		// Copies the cached packets in the order they were pushed.
+		// Returns false if there is no video GOP to start from.
+		bool GetPackets(std::vector<Packet> &packets) const;
+
+		uint64_t GetLastSequence() const
+		{
+			return _last_sequence;
+		}
+
+		size_t GetTotalBytes() const
+		{
+			return _total_bytes;
+		}
+
+		void Clear();
+		// Drops the GOP of the key (e.g. the key is no longer used)
+		void Erase(uint64_t key);
+
+	private:
+		struct Gop
+		{
+			bool is_video = false;
+			// A video GOP is available only after its keyframe is received
+			bool available = false;
+			uint64_t start_sequence = 0;
+
+			std::deque<Packet> packets;
+			size_t bytes = 0;
+		};
+
+		void ClearGop(Gop &gop);
+		// Drops the non-video packets older than the oldest video GOP
+		void TrimNonVideoGops();
+		uint64_t GetOldestVideoStartSequence() const;
+
+		std::unordered_map<uint64_t, Gop> _gops;
+
+		size_t _max_bytes = 0;
+		size_t _total_bytes = 0;
+
+		uint64_t _last_sequence = 0;
+	};
+}  // namespace pub
@@ -0,0 +1,123 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace pub
+{
+	// Pulls which are in progress, by <vhost_app_name>/<stream_name>.
+	// The first request for a key pulls the stream, and the requests that arrive while it is pulling
+	// wait for it and get the same result (nullptr if the pull failed) instead of pulling again.
+	template <typename Tstream>
+	class PendingPullMap
+	{
+	public:
+		using PullFunction = std::function<std::shared_ptr<Tstream>()>;
+
+		// Calls pull() if the key is not being pulled, otherwise waits for the pull in progress
+		std::shared_ptr<Tstream> Pull(const ov::String &key, const PullFunction &pull)
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+
+			auto pending_it = _pending_pulls.find(key);
+			if (pending_it != _pending_pulls.end())
+			{
+				// Another request is already pulling the stream
+				auto pending_pull = pending_it->second;
+
+				pending_pull->cond.wait(lock, [&pending_pull]() { return pending_pull->completed; });
+
+				return pending_pull->stream;
+			}
+
+			auto pending_pull = std::make_shared<PendingPull>();
+			_pending_pulls.emplace(key, pending_pull);
+
+			lock.unlock();
+
+			auto stream = pull();
+
+			lock.lock();
+
+			pending_pull->completed = true;
+			pending_pull->stream = stream;
+			_pending_pulls.erase(key);
+
+			lock.unlock();
+
+			pending_pull->cond.notify_all();
+
+			return stream;
+		}
+
+		// Called by pull() when the stream may be created a little later than the pull request returns.
+		// Waits until SetStream() is called for the key, or until the timeout.
+		std::shared_ptr<Tstream> WaitForStream(const ov::String &key, std::chrono::milliseconds timeout)
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+
+			auto pending_it = _pending_pulls.find(key);
+			if (pending_it == _pending_pulls.end())
+			{
+				return nullptr;
+			}
+
+			auto pending_pull = pending_it->second;
+
+			pending_pull->cond.wait_for(lock, timeout, [&pending_pull]() { return pending_pull->stream != nullptr; });
+
+			return pending_pull->stream;
+		}
+
+		// Releases WaitForStream() when the stream of the key is ready. Does nothing if the key is not being pulled.
+		void SetStream(const ov::String &key, const std::shared_ptr<Tstream> &stream)
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+
+			auto pending_it = _pending_pulls.find(key);
+			if (pending_it == _pending_pulls.end())
+			{
+				return;
+			}
+
+			auto pending_pull = pending_it->second;
+			pending_pull->stream = stream;
+
+			lock.unlock();
+
+			pending_pull->cond.notify_all();
+		}
+
+		bool IsPulling(const ov::String &key) const
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			return _pending_pulls.find(key) != _pending_pulls.end();
+		}
+
+	private:
+		struct PendingPull
+		{
+			std::condition_variable cond;
+			// The pull request has been finished (whether it succeeded or not)
+			bool completed = false;
+			std::shared_ptr<Tstream> stream = nullptr;
+		};
+
+		std::map<ov::String, std::shared_ptr<PendingPull>> _pending_pulls;
+		mutable std::mutex _mutex;
+	};
+}  // namespace pub
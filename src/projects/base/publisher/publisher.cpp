@@ -172,36 +172,66 @@ namespace pub
 			return stream;
 		}
 
-		auto orchestrator = ocst::Orchestrator::GetInstance();
-		auto &vapp_name = vhost_app_name.ToString();
+		auto key = ov::String::FormatString("%s/%s", vhost_app_name.CStr(), stream_name.CStr());
 
-		// Pull stream with the local origin map
-		logti("Try to pull stream from local origin map: [%s/%s]", vapp_name.CStr(), stream_name.CStr());
-		if (orchestrator->RequestPullStreamWithOriginMap(request_from, vhost_app_name, stream_name) == false)
+		if (_pending_pulls.IsPulling(key))
 		{
-			// Pull stream with the origin map store
-			logti("Try to pull stream from origin map store: [%s/%s]", vapp_name.CStr(), stream_name.CStr());
-			auto origin_url = orchestrator->GetOriginUrlFromOriginMapStore(vhost_app_name, stream_name);
-			if (origin_url == nullptr)
+			logtd("Wait for the pending pull: [%s]", key.CStr());
+		}
+
+		return _pending_pulls.Pull(key, [&]() -> std::shared_ptr<Stream> {
+			if (RequestPullStream(request_from, vhost_app_name, stream_name) == false)
 			{
 				return nullptr;
 			}
 
-			auto properties = std::make_shared<pvd::PullStreamProperties>();
-			properties->EnableFromOriginMapStore(true);
-			if (origin_url->Scheme().UpperCaseString() == "OVT")
-			{
-				properties->EnableRelay(true);
-			}
+			auto pulled_stream = GetStream(vhost_app_name, stream_name);
 
-			if (orchestrator->RequestPullStreamWithUrls(request_from, vhost_app_name, stream_name, {origin_url->ToUrlString()}, 0, properties) == false)
+			// The stream of this publisher may be created a little later than the provider stream
+			if ((pulled_stream == nullptr) && (GetApplicationByName(vhost_app_name) != nullptr))
 			{
-				return nullptr;
+				pulled_stream = _pending_pulls.WaitForStream(key, std::chrono::milliseconds(PULL_STREAM_READY_TIMEOUT_MS));
 			}
+
+			return pulled_stream;
+		});
+	}
+
+	bool Publisher::RequestPullStream(const std::shared_ptr<const ov::Url> &request_from, const info::VHostAppName &vhost_app_name, const ov::String &stream_name)
+	{
+		auto orchestrator = ocst::Orchestrator::GetInstance();
+		auto &vapp_name = vhost_app_name.ToString();
+
+		// Pull stream with the local origin map
+		logti("Try to pull stream from local origin map: [%s/%s]", vapp_name.CStr(), stream_name.CStr());
+		if (orchestrator->RequestPullStreamWithOriginMap(request_from, vhost_app_name, stream_name) == true)
+		{
+			return true;
+		}
+
+		// Pull stream with the origin map store
+		logti("Try to pull stream from origin map store: [%s/%s]", vapp_name.CStr(), stream_name.CStr());
+		auto origin_url = orchestrator->GetOriginUrlFromOriginMapStore(vhost_app_name, stream_name);
+		if (origin_url == nullptr)
+		{
+			return false;
 		}
 
-		// try one more after pulling stream
-		return GetStream(vhost_app_name, stream_name);
+		auto properties = std::make_shared<pvd::PullStreamProperties>();
+		properties->EnableFromOriginMapStore(true);
+		if (origin_url->Scheme().UpperCaseString() == "OVT")
+		{
+			properties->EnableRelay(true);
+		}
+
+		return orchestrator->RequestPullStreamWithUrls(request_from, vhost_app_name, stream_name, {origin_url->ToUrlString()}, 0, properties);
+	}
+
+	void Publisher::OnStreamReady(const info::VHostAppName &vhost_app_name, const std::shared_ptr<Stream> &stream)
+	{
+		auto key = ov::String::FormatString("%s/%s", vhost_app_name.CStr(), stream->GetName().CStr());
+
+		_pending_pulls.SetStream(key, stream);
 	}
 
 	std::shared_ptr<Stream> Publisher::GetStream(const info::VHostAppName &vhost_app_name, const ov::String &stream_name)
@@ -13,6 +13,7 @@
 #include <base/mediarouter/mediarouter_application_observer.h>
 #include <base/ovcrypto/ovcrypto.h>
 #include <base/publisher/application.h>
+#include <base/publisher/pending_pull_map.h>
 #include <base/publisher/stream.h>
 
 #include <modules/ice/ice_port_manager.h>
@@ -24,6 +25,9 @@
 
 #include <chrono>
 
+// How long PullStream() waits for the stream of the publisher after the provider stream is pulled
+#define PULL_STREAM_READY_TIMEOUT_MS 3000
+
 namespace pub
 {
 	//====================================================================================================
@@ -100,6 +104,7 @@ namespace pub
 
 		// First GetStream(vhost_app_name, stream_name) and if it fails pull stream by the orchetrator
 		// If an url is set, the url is higher priority than OriginMap
+		// Concurrent requests for the same stream are coalesced into one pull, and the others wait until the stream is ready
 		std::shared_ptr<Stream> PullStream(const std::shared_ptr<const ov::Url> &request_from, const info::VHostAppName &vhost_app_name, const ov::String &host_name, const ov::String &stream_name);
 		std::shared_ptr<Stream> GetStream(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
 		template <typename T>
@@ -108,6 +113,9 @@ namespace pub
 			return std::static_pointer_cast<T>(GetStream(vhost_app_name, stream_name));
 		}
 
+		// Called by the application when a stream is created to release the requests waiting for the stream
+		void OnStreamReady(const info::VHostAppName &vhost_app_name, const std::shared_ptr<Stream> &stream);
+
 		uint32_t GetApplicationCount();
 		std::shared_ptr<Application> GetApplicationById(info::application_id_t application_id);
 		std::shared_ptr<Stream> GetStream(info::application_id_t application_id, uint32_t stream_id);
@@ -155,6 +163,11 @@ namespace pub
 		std::shared_ptr<MediaRouterInterface> _router;
 
 	private:
+		bool RequestPullStream(const std::shared_ptr<const ov::Url> &request_from, const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
+
 		std::shared_ptr<AccessController> _access_controller = nullptr;
+
+		// Pulls which are in progress. Requests for the same stream wait for it instead of pulling again.
+		PendingPullMap<Stream> _pending_pulls;
 	};
 }  // namespace pub
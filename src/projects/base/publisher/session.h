@@ -36,6 +36,8 @@ namespace pub
 		virtual bool Stop();
 
 		virtual void SendOutgoingData(const std::any &packet) {};
+		// Called by the stream worker before the cached GOP is sent through SendOutgoingData()
+		virtual void OnGopCacheBurstStarted() {};
 		virtual void OnMessageReceived(const std::any &message) {};
 
 		enum class SessionState : int8_t
@@ -2,6 +2,7 @@
 #include "application.h"
 #include "publisher_private.h"
 #include <base/event/command/commands.h>
+#include <monitoring/latency_metrics.h>
 
 namespace pub
 {
@@ -62,6 +63,13 @@ namespace pub
 
 		logtd("StreamWorker thread of %s has been stopped successfully", worker_name.CStr());
 
+		{
+			std::lock_guard<std::mutex> gop_burst_lock(_gop_burst_mutex);
+			_pending_gop_bursts.clear();
+			_has_pending_gop_bursts = false;
+		}
+		_gop_bursts.clear();
+
 		std::lock_guard<std::shared_mutex> lock(_session_map_mutex);
 
 		logtd("Try to stop all sessions of %s", worker_name.CStr());
@@ -76,7 +84,7 @@ namespace pub
 		return true;
 	}
 
-	bool StreamWorker::AddSession(const std::shared_ptr<Session> &session)
+	bool StreamWorker::AddSession(const std::shared_ptr<Session> &session, bool wait_for_gop_cache)
 	{
 		// Cannot add session after StreamWorker is stopped
 		if (_stop_thread_flag)
@@ -84,6 +92,15 @@ namespace pub
 			return true;
 		}
 
+		if (wait_for_gop_cache)
+		{
+			// It must be queued before the session is visible to the worker thread,
+			// otherwise the session may receive the live packets that will be in the cache
+			auto burst = std::make_shared<GopBurst>();
+			burst->session = session;
+			QueueGopBurst(burst);
+		}
+
 		std::lock_guard<std::shared_mutex> lock(_session_map_mutex);
 		_sessions[session->GetId()] = session;
 
@@ -126,12 +143,155 @@ namespace pub
 		return _sessions[id];
 	}
 
-	void StreamWorker::SendPacket(const std::any &packet)
+	void StreamWorker::SendPacket(const std::any &packet, const std::shared_ptr<SendTrace> &send_trace, uint64_t gop_sequence, size_t bytes)
+	{
+		_packet_queue.Enqueue(StreamPacket{packet, send_trace, gop_sequence, bytes});
+		_queue_event.Notify();
+	}
+
+	void StreamWorker::SendGopCache(const std::shared_ptr<Session> &session, std::vector<GopCache::Packet> &&packets, uint64_t last_sequence)
+	{
+		auto burst = std::make_shared<GopBurst>();
+
+		burst->session = session;
+		burst->waiting = false;
+		burst->packets.assign(std::make_move_iterator(packets.begin()), std::make_move_iterator(packets.end()));
+		burst->last_sequence = last_sequence;
+
+		QueueGopBurst(burst);
+	}
+
+	void StreamWorker::QueueGopBurst(const std::shared_ptr<GopBurst> &burst)
 	{
-		_packet_queue.Enqueue(packet);
+		{
+			std::lock_guard<std::mutex> lock(_gop_burst_mutex);
+			_pending_gop_bursts.push_back(burst);
+			_has_pending_gop_bursts = true;
+		}
+
 		_queue_event.Notify();
 	}
 
+	void StreamWorker::TakePendingGopBursts()
+	{
+		std::vector<std::shared_ptr<GopBurst>> bursts;
+
+		{
+			std::lock_guard<std::mutex> lock(_gop_burst_mutex);
+			bursts.swap(_pending_gop_bursts);
+			_has_pending_gop_bursts = false;
+		}
+
+		// A later one replaces the earlier one of the same session (e.g. the cached packets replace the waiting one)
+		for (auto &burst : bursts)
+		{
+			_gop_bursts[burst->session->GetId()] = std::move(burst);
+		}
+	}
+
+	bool StreamWorker::HandleGopBurstLivePacket(session_id_t session_id, const StreamPacket &packet)
+	{
+		auto burst_iterator = _gop_bursts.find(session_id);
+		if (burst_iterator == _gop_bursts.end())
+		{
+			return false;
+		}
+
+		auto &burst = burst_iterator->second;
+
+		if (burst->waiting)
+		{
+			// This packet will be in the cache (or is older than it)
+			return true;
+		}
+
+		if ((packet.gop_sequence != 0) && (packet.gop_sequence <= burst->last_sequence))
+		{
+			// Already in the cache (or older than it)
+			return true;
+		}
+
+		if (burst->packets.empty() == false)
+		{
+			// Sent after the cached packets
+			burst->packets.push_back(GopCache::Packet{packet.packet, packet.bytes, packet.gop_sequence});
+			return true;
+		}
+
+		// The session has caught up with the live packets
+		_gop_bursts.erase(burst_iterator);
+
+		return false;
+	}
+
+	bool StreamWorker::SendGopBursts()
+	{
+		auto burst_bitrate = _parent->GetGopCacheOptions().burst_bitrate;
+		auto bytes_per_ms = static_cast<double>(burst_bitrate) / 8.0 / 1000.0;
+		auto now_ms = ov::Clock::NowMSec();
+		bool remaining = false;
+
+		for (auto burst_iterator = _gop_bursts.begin(); burst_iterator != _gop_bursts.end();)
+		{
+			auto &burst = burst_iterator->second;
+
+			if (burst->waiting)
+			{
+				++burst_iterator;
+				continue;
+			}
+
+			if (_sessions.find(burst_iterator->first) == _sessions.end())
+			{
+				// The session has been removed
+				burst_iterator = _gop_bursts.erase(burst_iterator);
+				continue;
+			}
+
+			if (burst->started == false)
+			{
+				if (burst->packets.empty())
+				{
+					// Nothing was cached, the session just starts from the live packets after last_sequence
+					++burst_iterator;
+					continue;
+				}
+
+				burst->started = true;
+				burst->budget_bytes = bytes_per_ms * STREAM_WORKER_GOP_BURST_INTERVAL_MS;
+				burst->last_refill_time_ms = now_ms;
+
+				logtd("Sending the cached GOP (%zu packets) to session %u", burst->packets.size(), burst_iterator->first);
+				burst->session->OnGopCacheBurstStarted();
+			}
+			else if (burst_bitrate > 0)
+			{
+				burst->budget_bytes += bytes_per_ms * (now_ms - burst->last_refill_time_ms);
+				burst->budget_bytes = std::min(burst->budget_bytes, bytes_per_ms * STREAM_WORKER_GOP_BURST_MAX_BUDGET_MS);
+				burst->last_refill_time_ms = now_ms;
+			}
+
+			while ((burst->packets.empty() == false) && ((burst_bitrate <= 0) || (burst->budget_bytes > 0.0)))
+			{
+				auto &packet = burst->packets.front();
+
+				burst->session->SendOutgoingData(packet.packet);
+				burst->budget_bytes -= packet.bytes;
+
+				burst->packets.pop_front();
+			}
+
+			if (burst->packets.empty() == false)
+			{
+				remaining = true;
+			}
+
+			++burst_iterator;
+		}
+
+		return remaining;
+	}
+
 	// Send to a specific session
 	void StreamWorker::SendMessage(const std::shared_ptr<Session> &session, const std::any &message)
 	{
@@ -139,14 +299,16 @@ namespace pub
 		_queue_event.Notify();
 	}
 
-	std::optional<std::any> StreamWorker::PopStreamPacket()
+	bool StreamWorker::PopStreamPackets(std::vector<StreamPacket> &packets)
 	{
+		packets.clear();
+
 		if (_packet_queue.IsEmpty())
 		{
-			return std::nullopt;
+			return false;
 		}
 
-		return _packet_queue.Dequeue();
+		return _packet_queue.DequeueBatch(packets, STREAM_WORKER_MAX_BATCH_PACKETS, 0) > 0;
 	}
 
 	std::shared_ptr<StreamWorker::SessionMessage> StreamWorker::PopSessionMessage()
@@ -171,9 +333,23 @@ namespace pub
 
 		std::shared_lock<std::shared_mutex> session_lock(_session_map_mutex, std::defer_lock);
 
+		std::vector<StreamPacket> packets;
+		packets.reserve(STREAM_WORKER_MAX_BATCH_PACKETS);
+
+		bool gop_burst_remaining = false;
+
 		while (!_stop_thread_flag)
 		{
-			_queue_event.Wait();
+			// The semaphore is notified per packet, so it may wake up after the packets are already dequeued as a batch
+			if (gop_burst_remaining)
+			{
+				// Wake up to send the paced GOP bursts
+				_queue_event.WaitFor(STREAM_WORKER_GOP_BURST_INTERVAL_MS);
+			}
+			else
+			{
+				_queue_event.Wait();
+			}
 
 			auto session_message = PopSessionMessage();
 			if (session_message != nullptr && session_message->_session != nullptr && session_message->_message.has_value())
@@ -181,17 +357,54 @@ namespace pub
 				session_message->_session->OnMessageReceived(session_message->_message);
 			}
 
-			auto packet = PopStreamPacket();
-			if (packet.has_value())
-			{		
-				session_lock.lock();
+			bool has_packets = PopStreamPackets(packets);
+
+			// The GOP bursts are taken after the packets are dequeued (and before each packet),
+			// so that the live packets newer than a GOP cache are never sent before it
+			if ((has_packets == false) && (_has_pending_gop_bursts == false) && _gop_bursts.empty())
+			{
+				continue;
+			}
+
+			session_lock.lock();
+			if (_has_pending_gop_bursts)
+			{
+				TakePendingGopBursts();
+			}
+
+			for (auto const &packet : packets)
+			{
+				// A session may request its GOP cache while receiving a packet
+				if (_has_pending_gop_bursts)
+				{
+					TakePendingGopBursts();
+				}
+
 				for (auto const &x : _sessions)
 				{
+					if ((_gop_bursts.empty() == false) && HandleGopBurstLivePacket(x.first, packet))
+					{
+						continue;
+					}
+
 					auto session = x.second;
-					session->SendOutgoingData(packet.value());
+					session->SendOutgoingData(packet.packet);
 				}
-				session_lock.unlock();
 			}
+
+			gop_burst_remaining = (_gop_bursts.empty() == false) ? SendGopBursts() : false;
+			bool has_sessions = _sessions.empty() == false;
+			session_lock.unlock();
+
+			for (auto const &packet : packets)
+			{
+				if (packet.send_trace != nullptr)
+				{
+					_parent->OnTracedPacketSent(packet.send_trace, has_sessions);
+				}
+			}
+
+			packets.clear();
 		}
 	}
 
@@ -337,6 +550,90 @@ namespace pub
 		return _started_time;
 	}
 
+	void Stream::SetLatencyMetrics(const std::shared_ptr<mon::LatencyMetrics> &latency_metrics)
+	{
+		_latency_metrics = latency_metrics;
+	}
+
+	void Stream::BeginPacketTrace(const std::shared_ptr<MediaPacket> &media_packet)
+	{
+		if (_latency_metrics == nullptr)
+		{
+			return;
+		}
+
+		_packet_trace = media_packet->GetTrace();
+		_packet_trace.Mark(MediaTraceStage::PublisherQueue);
+
+		if (_packet_trace.IsMarked(MediaTraceStage::Ingest))
+		{
+			_broadcast_trace_ingest_time_us = _packet_trace.GetTime(MediaTraceStage::Ingest);
+		}
+	}
+
+	void Stream::EndPacketTrace(const std::shared_ptr<MediaPacket> &media_packet)
+	{
+		if (_latency_metrics == nullptr)
+		{
+			return;
+		}
+
+		// If the publisher did not broadcast anything for this packet, it must not be attributed to the next one
+		_broadcast_trace_ingest_time_us = 0;
+
+		_packet_trace.Mark(MediaTraceStage::Packetize);
+		_latency_metrics->Record(media_packet->GetMediaType(), media_packet->GetTrackId(), media_packet->GetPts(), _packet_trace);
+	}
+
+	void Stream::OnTracedPacketSent(const std::shared_ptr<SendTrace> &send_trace, bool has_sessions)
+	{
+		if (has_sessions)
+		{
+			send_trace->has_sessions = true;
+		}
+
+		// Only the last worker records the send stage
+		if (send_trace->remaining_workers.fetch_sub(1) != 1)
+		{
+			return;
+		}
+
+		if (send_trace->has_sessions)
+		{
+			RecordSendLatency(send_trace->ingest_time_us);
+		}
+	}
+
+	void Stream::RecordSendLatency(int64_t trace_ingest_time_us)
+	{
+		if (_latency_metrics == nullptr)
+		{
+			return;
+		}
+
+		_latency_metrics->RecordStage(MediaTraceStage::Send, MediaTrace::NowUs() - trace_ingest_time_us);
+	}
+
+	std::shared_ptr<SendTrace> Stream::MakeSendTrace(int64_t trace_ingest_time_us, uint32_t worker_count) const
+	{
+		if ((trace_ingest_time_us <= 0) || (worker_count == 0))
+		{
+			return nullptr;
+		}
+
+		return std::make_shared<SendTrace>(trace_ingest_time_us, worker_count);
+	}
+
+	void Stream::RecordPacerQueueDelay(int64_t delay_us)
+	{
+		if (_latency_metrics == nullptr)
+		{
+			return;
+		}
+
+		_latency_metrics->RecordPacerQueueDelay(delay_us);
+	}
+
 	std::shared_ptr<Application> Stream::GetApplication() const
 	{
 		return _application;
@@ -370,9 +667,9 @@ namespace pub
 		return _stream_workers[worker_id];
 	}
 
-	bool Stream::AddSession(std::shared_ptr<Session> session)
+	bool Stream::AddSession(std::shared_ptr<Session> session, bool send_gop_cache)
 	{
-		std::lock_guard<std::shared_mutex> session_lock(_session_map_mutex);
+		std::unique_lock<std::shared_mutex> session_lock(_session_map_mutex);
 		// For getting session, all sessions
 		_sessions[session->GetId()] = session;
 
@@ -385,7 +682,21 @@ namespace pub
 				return false;
 			}
 
-			return worker->AddSession(session);
+			send_gop_cache = send_gop_cache && IsGopCacheEnabled();
+
+			// The worker holds the live packets of the session until the cached GOP is given
+			if (worker->AddSession(session, send_gop_cache) == false)
+			{
+				return false;
+			}
+
+			session_lock.unlock();
+
+			if (send_gop_cache)
+			{
+				std::shared_lock<std::shared_mutex> worker_lock(_stream_worker_lock);
+				SendGopCache(worker, session, true);
+			}
 		}
 
 		return true;
@@ -444,12 +755,17 @@ namespace pub
 
 	bool Stream::BroadcastPacket(const std::any &packet)
 	{
+		// Only the first packet made from a traced packet carries the ingest time
+		auto trace_ingest_time_us = _broadcast_trace_ingest_time_us.exchange(0);
+
 		if(_worker_count > 0)
 		{
 			std::shared_lock<std::shared_mutex> worker_lock(_stream_worker_lock);
+			auto send_trace = MakeSendTrace(trace_ingest_time_us, _stream_workers.size());
+
 			for (uint32_t i = 0; i < _stream_workers.size(); i++)
 			{
-				_stream_workers[i]->SendPacket(packet);
+				_stream_workers[i]->SendPacket(packet, send_trace);
 			}
 		}
 		else
@@ -460,11 +776,136 @@ namespace pub
 				auto session = std::static_pointer_cast<Session>(x.second);
 				session->SendOutgoingData(packet);
 			}
+			bool has_sessions = _sessions.empty() == false;
+			session_lock.unlock();
+
+			if ((trace_ingest_time_us > 0) && has_sessions)
+			{
+				RecordSendLatency(trace_ingest_time_us);
+			}
 		}
 	
 		return true;
 	}
 
+	bool Stream::BroadcastPacket(const std::any &packet, const GopCache::PacketInfo &info)
+	{
+		if (IsGopCacheEnabled() == false)
+		{
+			return BroadcastPacket(packet);
+		}
+
+		// Only the first packet made from a traced packet carries the ingest time
+		auto trace_ingest_time_us = _broadcast_trace_ingest_time_us.exchange(0);
+
+		std::shared_lock<std::shared_mutex> worker_lock(_stream_worker_lock);
+		std::lock_guard<std::mutex> gop_cache_lock(_gop_cache_lock);
+
+		auto sequence = _gop_cache.Push(packet, info);
+		auto send_trace = MakeSendTrace(trace_ingest_time_us, _stream_workers.size());
+
+		for (const auto &worker : _stream_workers)
+		{
+			worker->SendPacket(packet, send_trace, sequence, info.bytes);
+		}
+
+		return true;
+	}
+
+	void Stream::SetGopCacheOptions(const GopCacheOptions &options)
+	{
+		std::lock_guard<std::mutex> gop_cache_lock(_gop_cache_lock);
+
+		_gop_cache_options = options;
+		_gop_cache.SetMaxBytes(options.max_bytes);
+
+		if (options.enabled == false)
+		{
+			_gop_cache.Clear();
+		}
+	}
+
+	void Stream::SetGopCacheOptions(const cfg::vhost::app::pub::GopCache &config)
+	{
+		GopCacheOptions options;
+
+		options.enabled = config.IsEnabled();
+		options.max_bytes = static_cast<size_t>(std::max<int64_t>(config.GetMaxBytes(), 0));
+		options.burst_bitrate = config.GetBurstBitrate();
+
+		if (options.enabled)
+		{
+			logti("[%s/%s(%u)] %s GOP cache is enabled (max: %zu bytes, burst bitrate: %lld bps)",
+				  GetApplicationName(), GetName().CStr(), GetId(), GetApplicationTypeName(), options.max_bytes, options.burst_bitrate);
+		}
+
+		SetGopCacheOptions(options);
+	}
+
+	void Stream::EraseGopCache(uint64_t key)
+	{
+		std::lock_guard<std::mutex> gop_cache_lock(_gop_cache_lock);
+
+		_gop_cache.Erase(key);
+	}
+
+	const GopCacheOptions &Stream::GetGopCacheOptions() const
+	{
+		return _gop_cache_options;
+	}
+
+	bool Stream::IsGopCacheEnabled() const
+	{
+		// The cached packets are sent by the stream workers
+		return _gop_cache_options.enabled && (_worker_count > 0);
+	}
+
+	bool Stream::SendGopCache(const std::shared_ptr<Session> &session)
+	{
+		if (IsGopCacheEnabled() == false)
+		{
+			return false;
+		}
+
+		// This may be called by a StreamWorker thread (in Session::SendOutgoingData()), which must not wait for Stop() that joins it
+		std::shared_lock<std::shared_mutex> worker_lock(_stream_worker_lock, std::try_to_lock);
+		if (worker_lock.owns_lock() == false)
+		{
+			return false;
+		}
+
+		size_t worker_id = session->GetId() % _worker_count;
+		if (worker_id >= _stream_workers.size())
+		{
+			return false;
+		}
+
+		auto worker = _stream_workers[worker_id];
+
+		return SendGopCache(worker, session, false);
+	}
+
+	bool Stream::SendGopCache(const std::shared_ptr<StreamWorker> &worker, const std::shared_ptr<Session> &session, bool send_if_empty)
+	{
+		std::vector<GopCache::Packet> packets;
+
+		// The cached packets and the last sequence must be taken with the same lock as BroadcastPacket()
+		std::lock_guard<std::mutex> gop_cache_lock(_gop_cache_lock);
+
+		bool has_packets = _gop_cache.GetPackets(packets);
+		if ((has_packets == false) && (send_if_empty == false))
+		{
+			return false;
+		}
+
+		logtd("[%s/%s(%u)] Send the cached GOP to session %u - %zu packets (%zu bytes cached)",
+			  GetApplicationName(), GetName().CStr(), GetId(), session->GetId(), packets.size(), _gop_cache.GetTotalBytes());
+
+		worker->SendGopCache(session, std::move(packets), _gop_cache.GetLastSequence());
+
+		return has_packets;
+	}
+
 	bool Stream::SendMessage(const std::shared_ptr<Session> &session, const std::any &message)
 	{
 		if(_worker_count > 0)
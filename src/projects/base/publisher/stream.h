@@ -7,12 +7,39 @@
 #include "base/mediarouter/media_buffer.h"
 #include "base/event/media_event.h"
 #include "modules/managed_queue/managed_queue.h"
+#include "gop_cache.h"
 #include "session.h"
 
 #define MAX_STREAM_WORKER_THREAD_COUNT 72
+// Maximum number of the packets that a stream worker sends at once
+#define STREAM_WORKER_MAX_BATCH_PACKETS 32
+// Interval to send the cached GOP to the new sessions when it is paced
+#define STREAM_WORKER_GOP_BURST_INTERVAL_MS 5
+// Maximum amount of the paced GOP burst that can be sent at once, so that it does not become a burst again after a stall
+#define STREAM_WORKER_GOP_BURST_MAX_BUDGET_MS 50
+
+namespace mon
+{
+	class LatencyMetrics;
+}
 
 namespace pub
 {
+	// The traced packet that is broadcast to the stream workers.
+	// The send stage is recorded once for it, when the last worker has handed it over to its sessions.
+	struct SendTrace
+	{
+		SendTrace(int64_t ingest_time_us, uint32_t worker_count)
+			: ingest_time_us(ingest_time_us),
+			  remaining_workers(worker_count)
+		{
+		}
+
+		const int64_t ingest_time_us;
+		std::atomic<uint32_t> remaining_workers;
+		std::atomic<bool> has_sessions{false};
+	};
+
 	class StreamWorker
 	{
 	public:
@@ -22,7 +49,8 @@ namespace pub
 		bool Start();
 		bool Stop();
 
-		bool AddSession(const std::shared_ptr<Session> &session);
+		// If wait_for_gop_cache is true, the live packets are not sent to the session until SendGopCache() is called for it
+		bool AddSession(const std::shared_ptr<Session> &session, bool wait_for_gop_cache = false);
 		bool RemoveSession(session_id_t id);
 		std::shared_ptr<Session> GetSession(session_id_t id);
 
@@ -30,18 +58,57 @@ namespace pub
 		void SendMessage(const std::shared_ptr<Session> &session, const std::any &message);
 
 		// Send to all sessions
-		void SendPacket(const std::any &packet);
+		// send_trace is shared by the workers if the packet is the first one made from a traced packet (nullptr if not traced)
+		// gop_sequence is the sequence given by the GOP cache (0 if not cached)
+		void SendPacket(const std::any &packet, const std::shared_ptr<SendTrace> &send_trace = nullptr, uint64_t gop_sequence = 0, size_t bytes = 0);
+
+		// Send the cached packets to the session before the live packets.
+		// The live packets up to last_sequence are dropped for the session because they are in the cache (or older).
+		void SendGopCache(const std::shared_ptr<Session> &session, std::vector<GopCache::Packet> &&packets, uint64_t last_sequence);
 
 	private:
+		struct StreamPacket
+		{
+			std::any packet;
+			std::shared_ptr<SendTrace> send_trace;
+			uint64_t gop_sequence = 0;
+			size_t bytes = 0;
+		};
+
+		struct GopBurst
+		{
+			std::shared_ptr<Session> session;
+
+			// The cached packets have not been given yet, the live packets are dropped until then
+			bool waiting = true;
+			bool started = false;
+
+			// The cached packets, followed by the live packets that arrived while sending them
+			std::deque<GopCache::Packet> packets;
+			uint64_t last_sequence = 0;
+
+			double budget_bytes = 0.0;
+			int64_t last_refill_time_ms = 0;
+		};
+
 		void WorkerThread();
 
+		void QueueGopBurst(const std::shared_ptr<GopBurst> &burst);
+		// The following functions are called by the worker thread with the session map locked
+		void TakePendingGopBursts();
+		// Returns true if the packet has been consumed by the GOP burst of the session (dropped or deferred)
+		bool HandleGopBurstLivePacket(session_id_t session_id, const StreamPacket &packet);
+		// Returns true if there are packets to be sent later (paced)
+		bool SendGopBursts();
+
 		std::map<session_id_t, std::shared_ptr<Session>> _sessions;
 		std::shared_mutex _session_map_mutex;
 		
 		ov::Semaphore _queue_event;
 
-		std::optional<std::any> PopStreamPacket();
-		ov::ManagedQueue<std::any> _packet_queue;
+		// Dequeues the packets at once, so that the session map is locked once for them
+		bool PopStreamPackets(std::vector<StreamPacket> &packets);
+		ov::ManagedQueue<StreamPacket> _packet_queue;
 
 		struct SessionMessage
 		{
@@ -61,6 +128,13 @@ namespace pub
 		std::atomic<bool> _stop_thread_flag;
 		std::thread _worker_thread;
 
+		// GOP bursts requested by the other threads
+		std::mutex _gop_burst_mutex;
+		std::vector<std::shared_ptr<GopBurst>> _pending_gop_bursts;
+		std::atomic<bool> _has_pending_gop_bursts{false};
+		// Only accessed by the worker thread
+		std::map<session_id_t, std::shared_ptr<GopBurst>> _gop_bursts;
+
 		std::shared_ptr<Stream> _parent;
 	};
 
@@ -115,7 +189,8 @@ namespace pub
 		std::shared_ptr<const info::Playlist> GetDefaultPlaylist() const;
 
 		// Session을 추가한다.
-		bool AddSession(std::shared_ptr<Session> session);
+		// If send_gop_cache is true, the session starts from the cached GOP (if the GOP cache is enabled)
+		bool AddSession(std::shared_ptr<Session> session, bool send_gop_cache = false);
 		bool RemoveSession(session_id_t id);
 		std::shared_ptr<Session> GetSession(session_id_t id);
 		const std::map<session_id_t, std::shared_ptr<Session>> GetAllSessions();
@@ -126,6 +201,19 @@ namespace pub
 
 		// A child call this function to delivery packet to all sessions
 		bool BroadcastPacket(const std::any &packet);
+		// A child calls this function instead to keep the packet in the GOP cache
+		bool BroadcastPacket(const std::any &packet, const GopCache::PacketInfo &info);
+
+		// The GOP cache needs the stream workers, a child sets the options before Start()
+		void SetGopCacheOptions(const GopCacheOptions &options);
+		void SetGopCacheOptions(const cfg::vhost::app::pub::GopCache &config);
+		const GopCacheOptions &GetGopCacheOptions() const;
+		bool IsGopCacheEnabled() const;
+		// Sends the cached GOP to a session that has already been added, before the live packets.
+		// Returns false if there is nothing to send, then the session receives the live packets as before.
+		bool SendGopCache(const std::shared_ptr<Session> &session);
+		// Drops the cached GOP of the key, a child calls this when the source of the GOP is removed
+		void EraseGopCache(uint64_t key);
 
 		bool SendMessage(const std::shared_ptr<Session> &session, const std::any &message);
 
@@ -163,12 +251,26 @@ namespace pub
 
 		const std::chrono::system_clock::time_point &GetStartedTime() const;
 
+		// Latency tracing of the hot path, called by Application and ApplicationWorker
+		void SetLatencyMetrics(const std::shared_ptr<mon::LatencyMetrics> &latency_metrics);
+		void BeginPacketTrace(const std::shared_ptr<MediaPacket> &media_packet);
+		void EndPacketTrace(const std::shared_ptr<MediaPacket> &media_packet);
+		// Called by each StreamWorker when the packet of the traced packet has been handed over to its sessions
+		void OnTracedPacketSent(const std::shared_ptr<SendTrace> &send_trace, bool has_sessions);
+		// Called by sessions that pace the packets (WebRTC) when the queued packets are sent
+		void RecordPacerQueueDelay(int64_t delay_us);
+
 	protected:
 		Stream(const std::shared_ptr<Application> application, const info::Stream &info);
 		virtual ~Stream();
 
 	private:
 		std::shared_ptr<StreamWorker> GetWorkerBySessionID(session_id_t session_id);
+		// nullptr if the packet is not traced
+		std::shared_ptr<SendTrace> MakeSendTrace(int64_t trace_ingest_time_us, uint32_t worker_count) const;
+		void RecordSendLatency(int64_t trace_ingest_time_us);
+		// _stream_worker_lock must be locked by the caller
+		bool SendGopCache(const std::shared_ptr<StreamWorker> &worker, const std::shared_ptr<Session> &session, bool send_if_empty);
 		std::map<session_id_t, std::shared_ptr<Session>> _sessions;
 		std::shared_mutex _session_map_mutex;
 
@@ -183,5 +285,18 @@ namespace pub
 		std::chrono::system_clock::time_point _started_time;
 
 		State _state = State::CREATED;
+
+		std::shared_ptr<mon::LatencyMetrics> _latency_metrics;
+		// The packet is shared by all publishers, so the stages of this publisher are marked on a copy of the trace.
+		// It is only accessed by the ApplicationWorker thread of this stream.
+		MediaTrace _packet_trace;
+		// Ingest time of the packet that is being packetized, handed over to StreamWorker with the first broadcast packet
+		std::atomic<int64_t> _broadcast_trace_ingest_time_us = 0;
+
+		GopCacheOptions _gop_cache_options;
+		// Locked after _stream_worker_lock. A packet is cached and queued to the workers at once,
+		// so that the workers can tell the live packets that are already in the cache sent to a session.
+		std::mutex _gop_cache_lock;
+		GopCache _gop_cache;
 	};
 }  // namespace pub
\ No newline at end of file
@@ -0,0 +1,88 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		struct TlsSessionResumption : public ModuleTemplate
+		{
+		protected:
+			// Stateless session tickets (RFC 5077)
+			bool _session_ticket = true;
+			// The ticket encryption key is replaced at this interval (in seconds)
+			int _ticket_key_rotation_interval = 3600;
+			// Session ID cache, used by the clients that do not support the tickets
+			bool _session_cache = true;
+			int _session_cache_size = 20480;
+			// Lifetime of a session (in seconds)
+			int _session_timeout = 7200;
+			// Comma separated list of the TLS ports to which the resumption applies (all TLS ports if empty)
+			ov::String _ports;
+
+		public:
+			TlsSessionResumption(bool enable)
+				: ModuleTemplate(enable)
+			{
+			}
+
+			CFG_DECLARE_CONST_REF_GETTER_OF(IsSessionTicketEnabled, _session_ticket)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetTicketKeyRotationInterval, _ticket_key_rotation_interval)
+			CFG_DECLARE_CONST_REF_GETTER_OF(IsSessionCacheEnabled, _session_cache)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetSessionCacheSize, _session_cache_size)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetSessionTimeout, _session_timeout)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetPorts, _ports)
+
+			bool IsEnabledForPort(uint16_t port) const
+			{
+				if (IsEnabled() == false)
+				{
+					return false;
+				}
+
+				if (_ports.IsEmpty())
+				{
+					return true;
+				}
+
+				for (const auto &item : _ports.Split(","))
+				{
+					if (ov::Converter::ToUInt32(item.Trim()) == port)
+					{
+						return true;
+					}
+				}
+
+				return false;
+			}
+
+		protected:
+			void MakeList() override
+			{
+				ModuleTemplate::MakeList();
+
+				Register<Optional>("SessionTicket", &_session_ticket);
+				Register<Optional>("TicketKeyRotationInterval", &_ticket_key_rotation_interval, nullptr,
+								   [=]() -> std::shared_ptr<ConfigError> {
+									   return (_ticket_key_rotation_interval > 0) ? nullptr : CreateConfigErrorPtr("TicketKeyRotationInterval must be greater than 0");
+								   });
+				Register<Optional>("SessionCache", &_session_cache);
+				Register<Optional>("SessionCacheSize", &_session_cache_size);
+				Register<Optional>("SessionTimeout", &_session_timeout, nullptr,
+								   [=]() -> std::shared_ptr<ConfigError> {
+									   return (_session_timeout > 0) ? nullptr : CreateConfigErrorPtr("SessionTimeout must be greater than 0");
+								   });
+				Register<Optional>("Ports", &_ports);
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
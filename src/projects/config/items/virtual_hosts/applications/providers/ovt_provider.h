@@ -24,6 +24,20 @@ namespace cfg
 					{
 						return ProviderType::Ovt;
 					}
+
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsMultiplex, _is_multiplex)
+
+				protected:
+					void MakeList() override
+					{
+						Provider::MakeList();
+
+						Register<Optional>("Multiplex", &_is_multiplex);
+					}
+
+					// true: streams pulled from the same origin share one TCP connection (one channel per stream)
+					// false: each stream has its own TCP connection
+					bool _is_multiplex = false;
 				};
 			}  // namespace pvd
 		}  // namespace app
@@ -0,0 +1,46 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+namespace cfg
+{
+	namespace vhost
+	{
+		namespace app
+		{
+			namespace pub
+			{
+				// Keeps the packets since the last keyframe so that a new session can start without waiting for the next keyframe
+				// (Used by WebRTC, OVT and SRT publishers)
+				struct GopCache : public Item
+				{
+				protected:
+					bool _enabled = false;
+					// Upper bound of the cached packets of a stream
+					int64_t _max_bytes = 16 * 1024 * 1024;
+					// Bitrate (bps) to send the cached packets to a new session, 0 means as fast as possible
+					int64_t _burst_bitrate = 0;
+
+				public:
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsEnabled, _enabled)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxBytes, _max_bytes)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetBurstBitrate, _burst_bitrate)
+
+				protected:
+					void MakeList() override
+					{
+						Register<Optional>("Enable", &_enabled);
+						Register<Optional>("MaxBytes", &_max_bytes);
+						Register<Optional>("BurstBitrate", &_burst_bitrate);
+					}
+				};
+			}  // namespace pub
+		}  // namespace app
+	}  // namespace vhost
+}  // namespace cfg
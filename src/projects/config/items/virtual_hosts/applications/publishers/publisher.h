@@ -8,6 +8,8 @@
 //==============================================================================
 #pragma once
 
+#include "gop_cache.h"
+
 namespace cfg
 {
 	namespace vhost
@@ -20,14 +22,17 @@ namespace cfg
 				{
 					virtual PublisherType GetType() const = 0;
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxConnection, _max_connection)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetGopCache, _gop_cache)
 
 				protected:
 					void MakeList() override
 					{
 						Register<Optional>("MaxConnection", &_max_connection);
+						Register<Optional>("GopCache", &_gop_cache);
 					}
 
 					int _max_connection = 0;
+					GopCache _gop_cache;
 				};
 			}  // namespace pub
 		}  // namespace app
@@ -0,0 +1,50 @@
+//=============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+namespace cfg
+{
+	namespace vhost
+	{
+		namespace app
+		{
+			namespace pub
+			{
+				// When enabled, the Thumbnail Publisher keeps only the latest keyframe of the video track
+				// and decodes/encodes it when a thumbnail is requested.
+				// Image encodes (JPEG/PNG/WebP) are not required in the OutputProfile.
+				struct ThumbnailOnDemand : public Item
+				{
+				protected:
+					bool _enabled = false;
+					// How long an encoded image is reused (milliseconds)
+					int _cache_ttl = 1000;
+					// 0 means the resolution of the source
+					int _width	= 0;
+					int _height = 0;
+
+				public:
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsEnabled, _enabled)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetCacheTTL, _cache_ttl)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetWidth, _width)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetHeight, _height)
+
+				protected:
+					void MakeList() override
+					{
+						Register<Optional>("Enable", &_enabled);
+						Register<Optional>("CacheTTL", &_cache_ttl);
+						Register<Optional>("Width", &_width);
+						Register<Optional>("Height", &_height);
+					}
+				};
+			}  // namespace pub
+		}  // namespace app
+	}  // namespace vhost
+}  // namespace cfg
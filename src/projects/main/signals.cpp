@@ -254,6 +254,9 @@ static void AbortHandler(int signum, siginfo_t *si, void *context)
 		// need not call fstream::close() explicitly to close the file
 	}
 
+	// Write the logs queued in the background before terminating
+	::ov_log_flush_on_fatal();
+
 	::exit(signum);
 }
 
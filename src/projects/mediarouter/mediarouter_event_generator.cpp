@@ -12,7 +12,9 @@
 #include <base/ovlibrary/ovlibrary.h>
 #include <modules/bitstream/h264/h264_sei.h>
 #include <base/modules/data_format/amf_event/amf_event.h>
+#include <config/config_manager.h>
 #include <orchestrator/orchestrator.h>
+#include <sys/stat.h>
 
 #include "mediarouter_private.h"
 
@@ -45,7 +47,56 @@ MediaRouterEventGenerator::~MediaRouterEventGenerator()
 
 void MediaRouterEventGenerator::Init(const std::shared_ptr<info::Stream> &stream_info)
 {
-	
+	_cfg_enabled		= false;
+	_last_modified_time = 0;
+	_events.clear();
+
+	if (stream_info == nullptr)
+	{
+		return;
+	}
+
+	auto &cfg_event_generator = stream_info->GetApplicationInfo().GetConfig().GetEventGenerator();
+	if (cfg_event_generator.IsEnable() == false || cfg_event_generator.GetPath().IsEmpty())
+	{
+		return;
+	}
+
+	_cfg_enabled = true;
+	_cfg_path	 = ov::GetFilePath(cfg_event_generator.GetPath(), cfg::ConfigManager::GetInstance()->GetConfigPath());
+
+	logti("%s | Event generator is enabled. path(%s)", stream_info->GetUri().CStr(), _cfg_path.CStr());
+
+	ReloadEventsIfModified(stream_info);
+}
+
+// The event file can be modified while the stream is running (e.g. to start or stop latency probes),
+// so it is reloaded when the modification time is changed.
+void MediaRouterEventGenerator::ReloadEventsIfModified(const std::shared_ptr<info::Stream> &stream_info)
+{
+	struct stat file_stat;
+	if (stat(_cfg_path.CStr(), &file_stat) != 0)
+	{
+		if (_last_modified_time != 0)
+		{
+			logtw("%s | Event file is removed. path(%s)", stream_info->GetUri().CStr(), _cfg_path.CStr());
+
+			_last_modified_time = 0;
+			_events.clear();
+		}
+
+		return;
+	}
+
+	if (file_stat.st_mtime == _last_modified_time)
+	{
+		return;
+	}
+
+	_last_modified_time = file_stat.st_mtime;
+	_events				= ParseMatchedEvents(stream_info);
+
+	logti("%s | Event file is loaded. path(%s) matched events(%zu)", stream_info->GetUri().CStr(), _cfg_path.CStr(), _events.size());
 }
 
 void MediaRouterEventGenerator::Update(
@@ -53,7 +104,22 @@ void MediaRouterEventGenerator::Update(
 	const std::shared_ptr<MediaTrack> &media_track,
 	const std::shared_ptr<MediaPacket> &media_packet)
 {
+	if (_cfg_enabled == false)
+	{
+		return;
+	}
+
+	if (_stop_watch.IsElapsed(MEDIA_ROUTER_EVENT_FILE_CHECK_INTERVAL_MS) && _stop_watch.Update())
+	{
+		ReloadEventsIfModified(stream_info);
+	}
+
+	if (_events.empty())
+	{
+		return;
+	}
 
+	MakeEvents(stream_info);
 }
 
 const std::shared_ptr<pvd::Stream> MediaRouterEventGenerator::GetSourceStream(const std::shared_ptr<info::Stream> &stream_info)
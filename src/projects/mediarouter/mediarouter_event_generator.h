@@ -20,6 +20,9 @@
 #include "base/mediarouter/media_type.h"
 #include "events/mediarouter_event_info.h"
 
+// Interval at which the modification of the event file is checked
+#define MEDIA_ROUTER_EVENT_FILE_CHECK_INTERVAL_MS 1000
+
 class MediaRouterEventGenerator
 {
 public:
@@ -34,9 +37,11 @@ public:
 		const std::shared_ptr<MediaPacket> &media_packet);
 
 private:
-	bool _cfg_enabled;
+	bool _cfg_enabled = false;
 	ov::String _cfg_path;
-	time_t _last_modified_time;
+	time_t _last_modified_time = 0;
+
+	void ReloadEventsIfModified(const std::shared_ptr<info::Stream> &stream_info);
 
 	static const std::shared_ptr<pvd::Stream> GetSourceStream(const std::shared_ptr<info::Stream> &stream_info);
 
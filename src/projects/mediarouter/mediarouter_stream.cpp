@@ -43,6 +43,11 @@ MediaRouteStream::MediaRouteStream(const std::shared_ptr<info::Stream> &stream,
 
 	MediaRouterStats::Init(stream);
 	MediaRouterAlert::Init(stream);
+
+	if (IsInbound())
+	{
+		MediaRouterEventGenerator::Init(stream);
+	}
 }
 
 MediaRouteStream::~MediaRouteStream()
@@ -328,6 +333,14 @@ std::shared_ptr<MediaPacket> MediaRouteStream::PopAndNormalize()
 	// Update statistics
 	MediaRouterStats::Update(static_cast<uint8_t>(_type), IsStreamPrepared(), _packets_queue, GetStream(), media_track, pop_media_packet);
 
+	pop_media_packet->GetTrace().Mark(IsOutbound() ? MediaTraceStage::OutboundRoute : MediaTraceStage::InboundRoute);
+
+	// Generate events(e.g. SEI with wallclock time code used as a latency probe) into the source stream
+	if (IsInbound() && IsStreamPrepared())
+	{
+		MediaRouterEventGenerator::Update(GetStream(), media_track, pop_media_packet);
+	}
+
 	// Mirror Buffer
 	_mirror_buffer.emplace_back(std::make_shared<MirrorBufferItem>(pop_media_packet));
 
@@ -251,7 +251,10 @@ namespace bmff
         if (sub_samples.empty())
         {
             // Full sample encryption
-            _encrypt_func(clear_data_ptr, clear_data_length, encrypted_data_ptr, true);
+            if (_encrypt_func(clear_data_ptr, clear_data_length, encrypted_data_ptr, true) == false)
+            {
+                return false;
+            }
         }
         else
         {
@@ -267,7 +270,10 @@ namespace bmff
 
                 if (sub_sample.cipher_bytes > 0)
                 {
-                    _encrypt_func(clear_data_ptr + offset, sub_sample.cipher_bytes, encrypted_data_ptr + offset, true);
+                    if (_encrypt_func(clear_data_ptr + offset, sub_sample.cipher_bytes, encrypted_data_ptr + offset, true) == false)
+                    {
+                        return false;
+                    }
                     offset += sub_sample.cipher_bytes;
                 }
 
@@ -283,53 +289,62 @@ namespace bmff
     {
         logtd("EncryptPattern - Source Size : %u, Last Block : %s", source_size, last_block ? "true" : "false");
 
-        // Crypt Bytes Block - Skip Bytes Block
-        while (source_size > 0)
+        const size_t crypt_byte_size = _cenc_property.crypt_bytes_block * AES_BLOCK_SIZE;
+        const size_t skip_byte_size = _cenc_property.skip_bytes_block * AES_BLOCK_SIZE;
+
+        if (crypt_byte_size == 0)
         {
-            const size_t crypt_byte_size = _cenc_property.crypt_bytes_block * AES_BLOCK_SIZE;
+            return false;
+        }
 
-            // If the source size is less than the crypt_byte_size, partial encryption is performed.
-            if (source_size <= crypt_byte_size)
+        // Calls func(offset, length) for each Crypt Bytes Block of the pattern (Crypt Bytes Block - Skip Bytes Block)
+        auto for_each_crypt_block = [&](const std::function<void(size_t, size_t)> &func) {
+            size_t offset = 0;
+            while (offset < source_size)
             {
-                if (source_size >= AES_BLOCK_SIZE)
-                {
-                    const size_t clear_data_length_aligned = source_size / AES_BLOCK_SIZE * AES_BLOCK_SIZE;
+                const size_t remained = source_size - offset;
 
-                    if (encrypt_func(source, clear_data_length_aligned, dest, last_block) == false)
+                // If the remained size is less than the crypt_byte_size, partial encryption is performed.
+                if (remained <= crypt_byte_size)
+                {
+                    const size_t aligned_size = remained / AES_BLOCK_SIZE * AES_BLOCK_SIZE;
+                    if (aligned_size > 0)
                     {
-                        return false;
+                        func(offset, aligned_size);
                     }
-
-                    source += clear_data_length_aligned;
-                    dest += clear_data_length_aligned;
-                    source_size -= clear_data_length_aligned;
+                    break;
                 }
 
-                memcpy(dest, source, source_size);
-
-                return true;
+                func(offset, crypt_byte_size);
+                offset += crypt_byte_size + skip_byte_size;
             }
+        };
 
-            // check this is the last cipher block
-            bool last = last_block && source_size <= (AES_BLOCK_SIZE - 1) + crypt_byte_size + (_cenc_property.skip_bytes_block * AES_BLOCK_SIZE);
-            if (encrypt_func(source, crypt_byte_size, dest, last) == false)
-            {
-                return false;
-            }
+        // Skip Bytes Blocks and the unaligned tail are left in clear
+        memcpy(dest, source, source_size);
 
-            source += crypt_byte_size;
-            dest += crypt_byte_size;
-            source_size -= crypt_byte_size;
+        // The crypt blocks of a sub-sample form one CBC chain, so they are gathered and encrypted with a single call
+        _pattern_buffer.clear();
+        for_each_crypt_block([&](size_t offset, size_t length) {
+            _pattern_buffer.insert(_pattern_buffer.end(), source + offset, source + offset + length);
+        });
 
-            // Skip Bytes Block
-            const size_t skip_byte_size = std::min(static_cast<size_t>(_cenc_property.skip_bytes_block * AES_BLOCK_SIZE), source_size);
-            memcpy(dest, source, skip_byte_size);
+        if (_pattern_buffer.empty())
+        {
+            return true;
+        }
 
-            source += skip_byte_size;
-            dest += skip_byte_size;
-            source_size -= skip_byte_size;
+        if (encrypt_func(_pattern_buffer.data(), _pattern_buffer.size(), _pattern_buffer.data(), last_block) == false)
+        {
+            return false;
         }
-        
+
+        size_t gathered_offset = 0;
+        for_each_crypt_block([&](size_t offset, size_t length) {
+            memcpy(dest + offset, _pattern_buffer.data() + gathered_offset, length);
+            gathered_offset += length;
+        });
+
         return true;
     }
 
@@ -337,12 +352,13 @@ namespace bmff
     {
         logtd("EncryptCbc - Source Size : %u, Last Block : %s", source_size, last_block ? "true" : "false");
 
+        auto iv = _cenc_property.iv->GetDataAs<uint8_t>();
+        auto iv_len = _cenc_property.iv->GetLength();
+
         if (_aes.IsInitialized() == false)
         {
             auto key = _cenc_property.key->GetDataAs<uint8_t>();
             auto key_len = _cenc_property.key->GetLength();
-            auto iv = _cenc_property.iv->GetDataAs<uint8_t>();
-            auto iv_len = _cenc_property.iv->GetLength();
 
             // No Padding
             if (_aes.Initialize(EVP_aes_128_cbc(), key, key_len, iv, iv_len, false) == false)
@@ -352,11 +368,24 @@ namespace bmff
 
             logtd("AES Initialized");
         }
+        else if (_cbc_chain_finished)
+        {
+            // The CBC chain restarts with the constant IV, the key schedule of the context is reused
+            if (_aes.ResetIv(iv, iv_len) == false)
+            {
+                return false;
+            }
+        }
+
+        _cbc_chain_finished = false;
 
         const size_t residual_size = source_size % AES_BLOCK_SIZE;
         const size_t cbc_size = source_size - residual_size;
 
-        _aes.Update(source, cbc_size, dest);
+        if ((cbc_size > 0) && (_aes.Update(source, cbc_size, dest) == false))
+        {
+            return false;
+        }
 
         if (residual_size > 0)
         {
@@ -366,7 +395,7 @@ namespace bmff
 
         if (last_block == true)
         {
-            _aes.Finalize(dest + cbc_size + residual_size);
+            _cbc_chain_finished = true;
         }
         
         return true;   
@@ -376,32 +405,77 @@ namespace bmff
     {
         logtd("EncryptCtr - Source Size : %u, Last Block : %s", source_size, last_block ? "true" : "false");
 
-        for (size_t i=0; i<source_size; i++)
+        if (_aes.IsInitialized() == false)
         {
-            if (_block_offset == 0)
+            auto key = _cenc_property.key->GetDataAs<uint8_t>();
+            auto key_len = _cenc_property.key->GetLength();
+
+            if (_aes.Initialize(EVP_aes_128_ctr(), key, key_len, _counter, AES_BLOCK_SIZE, false) == false)
             {
-                auto key = _cenc_property.key->GetDataAs<uint8_t>();
-                auto key_len = _cenc_property.key->GetLength();
+                logte("Failed to initialize AES-CTR");
+                return false;
+            }
+        }
 
-                if (ov::AES::EncryptWith128Ecb(_counter, AES_BLOCK_SIZE, _encrypted_counter, key, key_len) == false)
+        // The context keeps the keystream of the current block, so the counter continues across sub-samples.
+        // _counter and _block_offset mirror the state of the context to count the cipher blocks and
+        // to wrap the counter around like the spec (only bytes 8 to 15 are incremented, OpenSSL carries into bytes 0 to 7).
+        while (source_size > 0)
+        {
+            const size_t remained_in_block = (_block_offset == 0) ? 0 : (AES_BLOCK_SIZE - _block_offset);
+
+            if (_counter_wrapped && (remained_in_block == 0))
+            {
+                if (_aes.ResetIv(_counter, AES_BLOCK_SIZE) == false)
                 {
-                    logte("Failed to encrypt IV with AES-ECB");
                     return false;
                 }
 
-                // logtw("_counter(%s) _encrypted_counter(%s) key(%s)", 
-                //             ov::Data(_counter, AES_BLOCK_SIZE).ToHexString().CStr(), 
-                //             ov::Data(_encrypted_counter, AES_BLOCK_SIZE).ToHexString().CStr(),
-                //             ov::Data(key, key_len).ToHexString().CStr());
+                _counter_wrapped = false;
+            }
+
+            size_t chunk_size = source_size;
+
+            if (_counter_wrapped)
+            {
+                // Use up the keystream generated before the wrap around
+                chunk_size = std::min(chunk_size, remained_in_block);
+            }
+            else
+            {
+                uint64_t blocks_before_wrap = ~GetCounterLow() + 1ULL;
+                if ((blocks_before_wrap != 0) && (blocks_before_wrap <= (source_size / AES_BLOCK_SIZE) + 1))
+                {
+                    chunk_size = std::min(chunk_size, remained_in_block + static_cast<size_t>(blocks_before_wrap) * AES_BLOCK_SIZE);
+                }
+            }
+
+            if (_aes.Update(source, chunk_size, dest) == false)
+            {
+                logte("Failed to encrypt with AES-CTR");
+                return false;
+            }
 
-                // Increment the counter
-                IncrementCounter();
+            // Number of the keystream blocks that the context generated for this chunk
+            uint64_t new_blocks = 0;
+            if (chunk_size > remained_in_block)
+            {
+                new_blocks = (chunk_size - remained_in_block + AES_BLOCK_SIZE - 1) / AES_BLOCK_SIZE;
+            }
 
-                _sample_cipher_block_count ++;
+            if (new_blocks > 0)
+            {
+                uint64_t counter_low = GetCounterLow() + new_blocks;
+                SetCounterLow(counter_low);
+                _counter_wrapped = (counter_low == 0);
+                _sample_cipher_block_count += new_blocks;
             }
 
-            dest[i] = source[i] ^ _encrypted_counter[_block_offset];
-            _block_offset = (_block_offset + 1) % AES_BLOCK_SIZE;
+            _block_offset = (_block_offset + chunk_size) % AES_BLOCK_SIZE;
+
+            source += chunk_size;
+            dest += chunk_size;
+            source_size -= chunk_size;
         }
 
         return true;
@@ -420,25 +494,39 @@ namespace bmff
 
         memcpy(_counter, iv, iv_len);
         _block_offset = 0;
+        _counter_wrapped = false;
+
+        // The context is created at the first encryption, after that only the counter block is changed
+        if (_aes.IsInitialized() && (_aes.ResetIv(_counter, AES_BLOCK_SIZE) == false))
+        {
+            logte("Failed to reset the counter of AES-CTR");
+            return false;
+        }
 
         // logtc("Counter is set to %s", ov::Data(_counter, AES_BLOCK_SIZE).ToHexString().CStr());
 
         return true;
     }
 
-    bool Encryptor::IncrementCounter()
+    uint64_t Encryptor::GetCounterLow() const
     {
-        // least significant of the IV (bytes 8 to 15) are incremented
-        for (int i=AES_BLOCK_SIZE-1; i>=8; i--)
+        // least significant of the IV (bytes 8 to 15)
+        uint64_t value = 0;
+        for (int i = 8; i < AES_BLOCK_SIZE; i++)
         {
-            _counter[i] ++;
-            if (_counter[i] != 0)
-            {
-                return false;
-            }
+            value = (value << 8) | _counter[i];
         }
 
-        return true;
+        return value;
+    }
+
+    void Encryptor::SetCounterLow(uint64_t value)
+    {
+        for (int i = AES_BLOCK_SIZE - 1; i >= 8; i--)
+        {
+            _counter[i] = value & 0xFF;
+            value >>= 8;
+        }
     }
 
     bool Encryptor::UpdateIv()
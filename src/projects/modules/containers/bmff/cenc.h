@@ -250,19 +250,29 @@ namespace bmff
 
         bool UpdateIv();
         bool SetCounter();
-        bool IncrementCounter();
+        uint64_t GetCounterLow() const;
+        void SetCounterLow(uint64_t value);
 
         CencProperty _cenc_property;
         std::shared_ptr<const MediaTrack> _media_track = nullptr;
 
         std::function<bool(const uint8_t*, size_t, uint8_t*, bool)> _encrypt_func = nullptr;
 
+        // Long-lived cipher context of the track (AES-128-CTR for cenc, AES-128-CBC for cbcs)
         ov::AES _aes;
 
+        // For CBC mode
+        // The chain of the previous sub-sample is finished, the IV has to be reset before the next one
+        bool _cbc_chain_finished = false;
+        // Crypt blocks of the pattern gathered to be encrypted at once
+        std::vector<uint8_t> _pattern_buffer;
+
         // For CTR mode
         uint32_t _block_offset = 0;
         uint32_t _sample_cipher_block_count = 0;
+        // Counter block of the next keystream block
         uint8_t _counter[AES_BLOCK_SIZE] = { 0, };
-        uint8_t _encrypted_counter[AES_BLOCK_SIZE] = { 0, };
+        // bytes 8 to 15 of the counter have wrapped around, the context must be reset before generating the next block
+        bool _counter_wrapped = false;
     };
 }
\ No newline at end of file
@@ -219,7 +219,7 @@ namespace bmff
 		}
 
 		// Save to file
-		if (ov::DumpToFile(file_path, segment->GetData()) == nullptr)
+		if (ov::DumpToFile(file_path, segment->GetDataList()) == nullptr)
 		{
 			logte("Could not save segment to file: %s", file_path.CStr());
 			return false;
@@ -287,7 +287,7 @@ namespace bmff
 	std::shared_ptr<FMP4Segment> FMP4Storage::CreateNextSegment()
 	{
 		// Create next segment
-		auto segment = std::make_shared<FMP4Segment>(GetLastSegmentNumber() + 1, _config.segment_duration_ms);
+		auto segment = std::make_shared<FMP4Segment>(GetLastSegmentNumber() + 1);
 		{
 			std::lock_guard<std::shared_mutex> lock(_segments_lock);
 			_segments.emplace(segment->GetNumber(), segment);
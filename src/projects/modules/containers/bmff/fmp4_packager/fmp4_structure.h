@@ -68,19 +68,18 @@ namespace bmff
 	class FMP4Segment : public base::modules::Segment
 	{
 	public:
-		FMP4Segment(uint64_t number, uint64_t target_duration)
+		explicit FMP4Segment(uint64_t number)
 		{
 			_number = number;
-
-			// For performance, reserve memory for 4Mbps * target_duration (sec)
-			_data = std::make_shared<ov::Data>(((1000.0 * 1000.0 * 4.0)/8.0) * (static_cast<double>(target_duration) / 1000.0));
 		}
 
+		// Segment loaded from a file
 		FMP4Segment(uint64_t number, double duration_ms, const std::shared_ptr<ov::Data> &data)
 		{
 			_number = number;
 			_duration_ms = duration_ms;
 			_data = data;
+			_data_length = (data != nullptr) ? data->GetLength() : 0;
 
 			SetCompleted();
 		}
@@ -110,27 +109,62 @@ namespace bmff
 				_start_timestamp = start_timestamp;
 			}
 
+			// The segment refers to the data of the partial segments instead of copying it
 			_partials.emplace_back(std::make_shared<FMP4Partial>(partial_data, partial_count, start_timestamp, duration_ms, independent));
 			_last_partial_number = partial_count;
+			_data_length += partial_data->GetLength();
 
 			lock.unlock();
-			
-			// Append data
+
 			_duration_ms += duration_ms;
-			_data->Append(partial_data);
 
 			return true;
 		}
 
 		// Get Data
+		// The data of the partial segments are concatenated into a new buffer, so use GetDataList() if possible
 		const std::shared_ptr<ov::Data> GetData() const override
 		{
-			return _data;
+			if (_data != nullptr)
+			{
+				return _data;
+			}
+
+			std::shared_lock<std::shared_mutex> lock(_partials_lock);
+
+			auto data = std::make_shared<ov::Data>(_data_length);
+			for (const auto &partial : _partials)
+			{
+				data->Append(partial->GetData());
+			}
+
+			return data;
+		}
+
+		std::vector<std::shared_ptr<const ov::Data>> GetDataList() const override
+		{
+			if (_data != nullptr)
+			{
+				return {_data};
+			}
+
+			std::shared_lock<std::shared_mutex> lock(_partials_lock);
+
+			std::vector<std::shared_ptr<const ov::Data>> data_list;
+			data_list.reserve(_partials.size());
+
+			for (const auto &partial : _partials)
+			{
+				data_list.push_back(partial->GetData());
+			}
+
+			return data_list;
 		}
 
 		size_t GetDataLength() const override
 		{
-			return _data == nullptr ? 0 : _data->GetLength();
+			std::shared_lock<std::shared_mutex> lock(_partials_lock);
+			return _data_length;
 		}
 
 		// Get Number
@@ -209,7 +243,9 @@ namespace bmff
 
 		int64_t _last_partial_number = -1;
 
-		// Segment Data
+		// Total length of the partial segments
+		size_t _data_length = 0;
+		// Only used for the segment loaded from a file (it has no partial segments)
 		std::shared_ptr<ov::Data> _data;
 
 		std::vector<std::shared_ptr<Marker>> _markers;
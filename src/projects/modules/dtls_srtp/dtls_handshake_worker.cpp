@@ -0,0 +1,139 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "dtls_handshake_worker.h"
+
+#include <algorithm>
+
+#define OV_LOG_TAG "DTLS"
+
+DtlsHandshakeWorker *DtlsHandshakeWorker::GetInstance()
+{
+	static DtlsHandshakeWorker instance;
+	return &instance;
+}
+
+DtlsHandshakeWorker::DtlsHandshakeWorker()
+{
+}
+
+DtlsHandshakeWorker::~DtlsHandshakeWorker()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_stop = true;
+		_tasks.clear();
+	}
+
+	_condition.notify_all();
+
+	for (auto &thread : _threads)
+	{
+		if (thread.joinable())
+		{
+			thread.join();
+		}
+	}
+}
+
+void DtlsHandshakeWorker::StartIfNeeded()
+{
+	// Must be called while holding _mutex
+	if (_started)
+	{
+		return;
+	}
+
+	_started = true;
+
+	// Leave the rest of the cores to the media threads
+	auto worker_count = std::clamp<uint32_t>(std::thread::hardware_concurrency() / 2, 1, DTLS_HANDSHAKE_MAX_WORKER_COUNT);
+
+	for (uint32_t index = 0; index < worker_count; index++)
+	{
+		try
+		{
+			auto thread = std::thread(&DtlsHandshakeWorker::WorkerThread, this);
+			pthread_setname_np(thread.native_handle(), "DtlsHandshake");
+			_threads.push_back(std::move(thread));
+		}
+		catch (const std::system_error &e)
+		{
+			logte("Could not start the DTLS handshake worker #%u: %s", index, e.what());
+			break;
+		}
+	}
+
+	logti("%zu DTLS handshake workers have been started", _threads.size());
+}
+
+bool DtlsHandshakeWorker::Post(Task task)
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		if (_stop)
+		{
+			return false;
+		}
+
+		StartIfNeeded();
+
+		if (_threads.empty() || (_tasks.size() >= DTLS_HANDSHAKE_MAX_QUEUE_SIZE))
+		{
+			_rejected_count++;
+
+			// Report only once per 1000 rejections to avoid flooding the log during a burst
+			if ((_rejected_count % 1000) == 1)
+			{
+				logtw("DTLS handshake queue is full (%zu tasks), the handshake will be continued on retransmission (total rejected: %" PRIu64 ")",
+					  _tasks.size(), _rejected_count);
+			}
+
+			return false;
+		}
+
+		_tasks.push_back(std::move(task));
+	}
+
+	_condition.notify_one();
+
+	return true;
+}
+
+size_t DtlsHandshakeWorker::GetQueueSize() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _tasks.size();
+}
+
+void DtlsHandshakeWorker::WorkerThread()
+{
+	while (true)
+	{
+		Task task;
+
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+
+			_condition.wait(lock, [this]() -> bool {
+				return _stop || (_tasks.empty() == false);
+			});
+
+			if (_stop)
+			{
+				break;
+			}
+
+			task = std::move(_tasks.front());
+			_tasks.pop_front();
+		}
+
+		task();
+	}
+}
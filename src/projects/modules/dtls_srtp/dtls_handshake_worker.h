@@ -0,0 +1,57 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Maximum number of threads that process the DTLS handshakes
+#define DTLS_HANDSHAKE_MAX_WORKER_COUNT 4
+// Maximum number of pending handshake tasks. If exceeded, the new tasks are rejected
+// and the peers retransmit their flights later.
+#define DTLS_HANDSHAKE_MAX_QUEUE_SIZE 4096
+
+// Runs the CPU-intensive part of the DTLS handshake (ECDHE, signing) outside of the socket/application threads,
+// so a burst of new sessions does not delay the media of the sessions that are already playing.
+class DtlsHandshakeWorker
+{
+public:
+	using Task = std::function<void()>;
+
+	static DtlsHandshakeWorker *GetInstance();
+
+	~DtlsHandshakeWorker();
+
+	// Returns false if the queue is full
+	bool Post(Task task);
+
+	size_t GetQueueSize() const;
+
+private:
+	DtlsHandshakeWorker();
+
+	void StartIfNeeded();
+	void WorkerThread();
+
+	mutable std::mutex _mutex;
+	std::condition_variable _condition;
+	std::deque<Task> _tasks;
+
+	bool _started = false;
+	bool _stop = false;
+	std::vector<std::thread> _threads;
+
+	uint64_t _rejected_count = 0;
+};
@@ -1,5 +1,7 @@
 #include "dtls_transport.h"
 
+#include "dtls_handshake_worker.h"
+
 #include <algorithm>
 #include <utility>
 
@@ -20,16 +22,15 @@ bool DtlsTransport::Stop()
 {
 	std::lock_guard<std::mutex> lock(_tls_lock);
 
+	_state = SSL_CLOSED;
+	_packet_buffer.clear();
 	_tls.Uninitialize();
 
 	return ov::Node::Stop();
 }
 
-// Set Local Certificate
-void DtlsTransport::SetLocalCertificate(const std::shared_ptr<::Certificate> &certificate)
+std::shared_ptr<ov::TlsContext> DtlsTransport::CreateTlsContext(const std::shared_ptr<::Certificate> &certificate)
 {
-	_local_certificate = certificate;
-
 	ov::TlsContextCallback tls_context_callback = {
 		.create_callback = [](ov::TlsContext *tls_context, SSL_CTX *context) -> bool {
 			tls_context->SetVerify(SSL_VERIFY_PEER | SSL_VERIFY_FAIL_IF_NO_PEER_CERT);
@@ -49,9 +50,9 @@ void DtlsTransport::SetLocalCertificate(const std::shared_ptr<::Certificate> &ce
 		}};
 
 	std::shared_ptr<const ov::Error> error;
-	_tls_context = ov::TlsContext::CreateServerContext(
+	auto tls_context = ov::TlsContext::CreateServerContext(
 		ov::TlsMethod::DTls,
-		_local_certificate,
+		certificate,
 		"DEFAULT:!NULL:!aNULL:!SHA256:!SHA384:!aECDH:!AESGCM+AES256:!aPSK",
 		false,
 		false,
@@ -62,6 +63,20 @@ void DtlsTransport::SetLocalCertificate(const std::shared_ptr<::Certificate> &ce
 	{
 		logte("Could not append certificate: %s", error->What());
 	}
+
+	return tls_context;
+}
+
+// Set Local Certificate
+void DtlsTransport::SetLocalCertificate(const std::shared_ptr<::Certificate> &certificate)
+{
+	_local_certificate = certificate;
+	_tls_context = CreateTlsContext(_local_certificate);
+}
+
+void DtlsTransport::SetTlsContext(const std::shared_ptr<ov::TlsContext> &tls_context)
+{
+	_tls_context = tls_context;
 }
 
 // Set Peer Fingerprint for verification
@@ -125,29 +140,87 @@ bool DtlsTransport::ContinueSSL()
 
 	if (error == SSL_ERROR_NONE)
 	{
-		_state = SSL_CONNECTED;
-
 		_peer_certificate = _tls.GetPeerCertificate();
 
 		if (_peer_certificate == nullptr)
 		{
+			_state = SSL_CONNECTED;
 			return false;
 		}
 
 		if (VerifyPeerCertificate() == false)
 		{
 			logte("Session could not verify peer certificate");
+			_state = SSL_CONNECTED;
 			return false;
 		}
 
 		_peer_certificate->Print();
 
-		return MakeSrtpKey();
+		// The handshake may be finished in the worker thread, so the keys are set before
+		// the sending thread sees SSL_CONNECTED and starts to send SRTP packets
+		auto result = MakeSrtpKey();
+		_state = SSL_CONNECTED;
+
+		return result;
 	}
 
 	return false;
 }
 
+bool DtlsTransport::ScheduleHandshake()
+{
+	if (_handshake_scheduled)
+	{
+		// The packet will be processed by the task that is already posted
+		return true;
+	}
+
+	auto transport = GetSharedPtrAs<DtlsTransport>();
+	if (transport == nullptr)
+	{
+		return false;
+	}
+
+	std::weak_ptr<DtlsTransport> weak_transport = transport;
+	_handshake_scheduled = DtlsHandshakeWorker::GetInstance()->Post([weak_transport]() {
+		auto transport = weak_transport.lock();
+		if (transport != nullptr)
+		{
+			transport->ProcessHandshake();
+		}
+	});
+
+	return _handshake_scheduled;
+}
+
+void DtlsTransport::ProcessHandshake()
+{
+	std::lock_guard<std::mutex> lock(_tls_lock);
+
+	_handshake_scheduled = false;
+
+	if ((GetNodeState() != ov::Node::NodeState::Started) || (_state != SSL_CONNECTING))
+	{
+		_packet_buffer.clear();
+		return;
+	}
+
+	// A flight of the peer may consist of several datagrams
+	while ((_packet_buffer.empty() == false) && (_state == SSL_CONNECTING))
+	{
+		auto pending_count = _packet_buffer.size();
+
+		ContinueSSL();
+
+		if (_packet_buffer.size() >= pending_count)
+		{
+			// OpenSSL did not consume any packet
+			break;
+		}
+	}
+}
+
 bool DtlsTransport::MakeSrtpKey()
 {
 	if (_peer_certificate_verified == false)
@@ -252,18 +325,34 @@ bool DtlsTransport::OnDataReceivedFromNextNode(NodeType from_node, const std::sh
 				std::lock_guard<std::mutex> lock(_tls_lock);
 				logtd("Receive DTLS packet");
 				// Packet을 Queue에 쌓는다.
-				SaveDtlsPacket(data);
+				if (SaveDtlsPacket(data) == false)
+				{
+					// The peer will retransmit the flight
+					return false;
+				}
 
 				if (_state == SSL_CONNECTING)
 				{
-					ContinueSSL();
+					// The handshake is processed by DtlsHandshakeWorker to keep this thread for the media
+					if (ScheduleHandshake() == false)
+					{
+						// Back-pressure: the workers are busy, drop the packet and let the peer retransmit it
+						_packet_buffer.pop_back();
+						return false;
+					}
 				}
 				else
 				{
 					char buffer[MAX_DTLS_PACKET_LEN];
+					[[maybe_unused]] int ssl_error = SSL_ERROR_NONE;
 
 					// SSL -> Read() -> TakeDtlsPacket() -> Decrypt -> buffer
-					[[maybe_unused]] int ssl_error = _tls.Read(buffer, sizeof(buffer), nullptr);
+					// (including the packets that arrived while the handshake was being finished)
+					for (auto count = _packet_buffer.size(); (count > 0) && (_packet_buffer.empty() == false); count--)
+					{
+						ssl_error = _tls.Read(buffer, sizeof(buffer), nullptr);
+					}
+					_packet_buffer.clear();
 
 					int pending = _tls.Pending();
 					if (pending >= 0)
@@ -346,11 +435,11 @@ bool DtlsTransport::IsRtpPacket(const std::shared_ptr<const ov::Data> data)
 
 bool DtlsTransport::SaveDtlsPacket(const std::shared_ptr<const ov::Data> data)
 {
-	// 이미 하나가 저장되어 있는데 또 저장하려는 것은 잘못된 것이다.
-	// 구조상 저장하자마자 사용해야 한다.
-	if (_packet_buffer.size() == 1)
+	// While connecting, the packets wait for the handshake worker.
+	// Otherwise, they are consumed as soon as they are saved.
+	if (_packet_buffer.size() >= MAX_DTLS_PENDING_PACKETS)
 	{
-		logte("Ssl buffer is full");
+		logtw("Ssl buffer is full");
 		return false;
 	}
 
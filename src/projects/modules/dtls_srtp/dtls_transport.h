@@ -4,12 +4,20 @@
 #include <base/ovcrypto/ovcrypto.h>
 #include <base/common_types.h>
 
-#include "modules/ice/ice_port.h"
 #include "srtp_transport.h"
 
 #define DTLS_RECORD_HEADER_LEN                  13
 #define MAX_DTLS_PACKET_LEN                     2048
 #define MIN_RTP_PACKET_LEN                      12
+// Maximum number of DTLS packets waiting for the handshake worker
+#define MAX_DTLS_PENDING_PACKETS                32
+
+namespace info
+{
+	class Session;
+}
+
+class IcePort;
 
 class DtlsTransport : public ov::Node
 {
@@ -19,9 +27,15 @@ public:
 	explicit DtlsTransport();
 	virtual ~DtlsTransport();
 
-	// Set Local Certificate
+	// Create a DTLS server context that can be shared by all sessions using the certificate
+	static std::shared_ptr<ov::TlsContext> CreateTlsContext(const std::shared_ptr<Certificate> &certificate);
+
+	// Set Local Certificate (creates a context only for this transport, prefer SetTlsContext())
 	void SetLocalCertificate(const std::shared_ptr<Certificate> &certificate);
 
+	// Set the shared context created by CreateTlsContext()
+	void SetTlsContext(const std::shared_ptr<ov::TlsContext> &tls_context);
+
 	// Set Peer Fingerprint for verification
 	void SetPeerFingerprint(ov::String algorithm, ov::String fingerprint);
 
@@ -56,6 +70,10 @@ protected:
 
 private:
 	bool ContinueSSL();
+	// Post the handshake to DtlsHandshakeWorker (must be called while holding _tls_lock)
+	bool ScheduleHandshake();
+	// Called by DtlsHandshakeWorker
+	void ProcessHandshake();
 	bool IsDtlsPacket(const std::shared_ptr<const ov::Data> data);
 	bool IsRtpPacket(const std::shared_ptr<const ov::Data> data);
 	bool SaveDtlsPacket(const std::shared_ptr<const ov::Data> data);
@@ -73,7 +91,7 @@ private:
 		SSL_CLOSED
 	};
 
-	SSLState _state;
+	std::atomic<SSLState> _state;
 	bool _peer_certificate_verified;
 	std::shared_ptr<info::Session> _session_info;
 	std::shared_ptr<IcePort> _ice_port;
@@ -84,8 +102,11 @@ private:
 	ov::String _peer_fingerprint_algorithm;
 	ov::String _peer_fingerprint_value;
 
-	// SSL이 가져갈 패킷을 임시로 보관하는 버퍼, 동시에 1개만 저장한다.
+	// SSL이 가져갈 패킷을 임시로 보관하는 버퍼
+	// While connecting, the packets are kept until the handshake worker processes them.
 	std::deque<std::shared_ptr<const ov::Data>> _packet_buffer;
+	// Whether a handshake task has been posted and not yet processed (protected by _tls_lock)
+	bool _handshake_scheduled = false;
 
 	// SSL *_ssl;
 	// SSL_CTX *_ssl_ctx;
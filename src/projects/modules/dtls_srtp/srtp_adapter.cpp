@@ -31,6 +31,7 @@ bool SrtpAdapter::Release()
 	if(_session != nullptr)
 	{
 		srtp_dealloc(_session);
+		_session = nullptr;
 	}
 	return true;
 }
@@ -59,6 +60,8 @@ bool SrtpAdapter::SetKey(srtp_ssrc_type_t type, uint64_t crypto_suite, std::shar
 			return false;
 	}
 
+	_crypto_suite = crypto_suite;
+
 	policy.ssrc.type = type;
 	policy.ssrc.value = 0;
 	policy.key = key->GetWritableDataAs<uint8_t>();
@@ -85,13 +88,8 @@ bool SrtpAdapter::SetKey(srtp_ssrc_type_t type, uint64_t crypto_suite, std::shar
 	return true;
 }
 
-bool SrtpAdapter::ProtectRtp(std::shared_ptr<ov::Data> data)
+bool SrtpAdapter::ProtectRtpInternal(const std::shared_ptr<ov::Data> &data)
 {
-	if(!_session)
-	{
-		return false;
-	}
-
 	uint32_t need_len = data->GetLength() + _rtp_auth_tag_len;
 
 	if(need_len > data->GetCapacity())
@@ -104,24 +102,79 @@ bool SrtpAdapter::ProtectRtp(std::shared_ptr<ov::Data> data)
 	int out_len = static_cast<int>(data->GetLength());
 	data->SetLength(need_len);
 
-	// FOR DEBUG
-	auto byte_buffer = data->GetDataAs<uint8_t>();
-	uint8_t payload_type = byte_buffer[1] & 0x7F;
-	uint8_t red_payload_type = byte_buffer[12];
-	uint16_t seq = ByteReader<uint16_t>::ReadBigEndian(&byte_buffer[2]);
-
-	std::lock_guard<std::mutex> lock(_session_lock);
 	int err = srtp_protect(_session, buffer, &out_len);
 	if(err != srtp_err_status_ok)
 	{
+		// The RTP header is not encrypted, so it can be parsed for debugging only when it fails
+		auto byte_buffer = data->GetDataAs<uint8_t>();
+		uint8_t payload_type = byte_buffer[1] & 0x7F;
+		uint8_t red_payload_type = byte_buffer[12];
+		uint16_t seq = ByteReader<uint16_t>::ReadBigEndian(&byte_buffer[2]);
+
 		logte("Failed to protect SRTP packet, err=%d, len=%d, seq=%u, payload_type=%d, red_payload_type=%d", err, out_len, seq, payload_type, red_payload_type);
 		return false;
 	}
 
+	_protect_stats.packets++;
+	_protect_stats.bytes += out_len;
+
 	return true;
 }
 
-bool SrtpAdapter::ProtectRtcp(std::shared_ptr<ov::Data> data)
+bool SrtpAdapter::ProtectRtp(const std::shared_ptr<ov::Data> &data)
+{
+	std::lock_guard<std::mutex> lock(_session_lock);
+
+	if(!_session)
+	{
+		return false;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	auto result = ProtectRtpInternal(data);
+
+	_protect_stats.calls++;
+	_protect_stats.elapsed += std::chrono::steady_clock::now() - start;
+
+	return result;
+}
+
+bool SrtpAdapter::ProtectRtp(const std::vector<std::shared_ptr<ov::Data>> &data_list)
+{
+	std::lock_guard<std::mutex> lock(_session_lock);
+
+	if(!_session)
+	{
+		return false;
+	}
+
+	bool result = true;
+
+	auto start = std::chrono::steady_clock::now();
+
+	for(const auto &data : data_list)
+	{
+		if(ProtectRtpInternal(data) == false)
+		{
+			// Do not send the plain packet
+			data->SetLength(0);
+			result = false;
+		}
+	}
+
+	_protect_stats.calls++;
+	_protect_stats.elapsed += std::chrono::steady_clock::now() - start;
+
+	return result;
+}
+
+SrtpAdapter::ProtectStats SrtpAdapter::GetProtectStats()
+{
+	std::lock_guard<std::mutex> lock(_session_lock);
+	return _protect_stats;
+}
+
+bool SrtpAdapter::ProtectRtcp(const std::shared_ptr<ov::Data> &data)
 {
     if(!_session)
     {
@@ -142,13 +195,19 @@ bool SrtpAdapter::ProtectRtcp(std::shared_ptr<ov::Data> data)
     data->SetLength(need_len);
 
 	std::lock_guard<std::mutex> lock(_session_lock);
+	auto start = std::chrono::steady_clock::now();
     int err = srtp_protect_rtcp(_session, buffer, &out_len);
+    _protect_stats.elapsed += std::chrono::steady_clock::now() - start;
+    _protect_stats.calls++;
     if(err != srtp_err_status_ok)
     {
         logte("Failed to protect SRTCP packet, err=%d, len=%d", err, out_len);
         return false;
     }
 
+    _protect_stats.packets++;
+    _protect_stats.bytes += out_len;
+
     return true;
 }
 
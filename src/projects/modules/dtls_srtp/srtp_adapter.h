@@ -16,20 +16,54 @@
 class SrtpAdapter
 {
 public:
+	struct ProtectStats
+	{
+		uint64_t packets = 0;
+		uint64_t bytes = 0;
+		// Number of ProtectRtp/ProtectRtcp calls (a burst is counted once)
+		uint64_t calls = 0;
+		// Total time spent in srtp_protect*()
+		std::chrono::nanoseconds elapsed{0};
+
+		// Protected bytes per second of CPU time
+		double GetThroughput() const
+		{
+			return (elapsed.count() > 0) ? (static_cast<double>(bytes) * 1000000000.0 / elapsed.count()) : 0.0;
+		}
+	};
+
 	SrtpAdapter();
 	virtual ~SrtpAdapter();	
 	bool	Release();
 	bool	SetKey(srtp_ssrc_type_t type, uint64_t crypto_suite, std::shared_ptr<ov::Data> key);
 
-	bool	ProtectRtp(std::shared_ptr<ov::Data> data);
-    bool	ProtectRtcp(std::shared_ptr<ov::Data> data);
+	bool	ProtectRtp(const std::shared_ptr<ov::Data> &data);
+	// Protects a burst of RTP packets with a single lock acquisition.
+	// Returns false if any of the packets could not be protected, the failed packets are emptied (length 0)
+	bool	ProtectRtp(const std::vector<std::shared_ptr<ov::Data>> &data_list);
+	bool	ProtectRtcp(const std::shared_ptr<ov::Data> &data);
 	bool	UnprotectRtp(const std::shared_ptr<ov::Data> &data);
-    bool	UnprotectRtcp(const std::shared_ptr<ov::Data> &data);
+	bool	UnprotectRtcp(const std::shared_ptr<ov::Data> &data);
+
+	uint64_t GetCryptoSuite() const
+	{
+		return _crypto_suite;
+	}
+
+	ProtectStats GetProtectStats();
 
 private:
+	// Must be called with _session_lock locked
+	bool	ProtectRtpInternal(const std::shared_ptr<ov::Data> &data);
+
+	// The context is shared by the threads that send media and retransmissions (NACK),
+	// so it is still guarded, but the lock is taken once per burst.
 	std::mutex		_session_lock;
 	srtp_ctx_t_* 	_session;
+	uint64_t		_crypto_suite = 0;
 	
 	uint32_t 		_rtp_auth_tag_len;
-    uint32_t 		_rtcp_auth_tag_len;
+	uint32_t 		_rtcp_auth_tag_len;
+
+	ProtectStats	_protect_stats;
 };
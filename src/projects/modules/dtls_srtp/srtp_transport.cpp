@@ -25,9 +25,23 @@ bool SrtpTransport::Stop()
 {
 	if(_send_session != nullptr)
 	{
+		auto stats = _send_session->GetProtectStats();
+		if(stats.packets > 0)
+		{
+			logtd("SRTP protect stats - crypto suite(%llu) packets(%llu) bytes(%llu) calls(%llu) elapsed(%lld us) throughput(%.2f MB/s)",
+				  _send_session->GetCryptoSuite(), stats.packets, stats.bytes, stats.calls,
+				  std::chrono::duration_cast<std::chrono::microseconds>(stats.elapsed).count(),
+				  stats.GetThroughput() / (1024.0 * 1024.0));
+		}
+
 		_send_session->Release();
 	}
 
+	if(_send_rtcp_session != nullptr)
+	{
+		_send_rtcp_session->Release();
+	}
+
 	if(_recv_session != nullptr)
 	{
 		_recv_session->Release();
@@ -36,6 +50,17 @@ bool SrtpTransport::Stop()
 	return Node::Stop();
 }
 
+SrtpAdapter::ProtectStats SrtpTransport::GetProtectStats() const
+{
+	// _send_session is set by the DTLS handshake worker before _key_ready
+	if(_key_ready == false)
+	{
+		return {};
+	}
+
+	return _send_session->GetProtectStats();
+}
+
 bool SrtpTransport::OnDataReceivedFromPrevNode(NodeType from_node, const std::shared_ptr<ov::Data> &data)
 {
 	if(GetNodeState() != ov::Node::NodeState::Started)
@@ -44,7 +69,7 @@ bool SrtpTransport::OnDataReceivedFromPrevNode(NodeType from_node, const std::sh
 		return false;
 	}
 
-	if(!_send_session)
+	if(!_send_session || !_send_rtcp_session)
 	{
 		return false;
 	}
@@ -58,7 +83,7 @@ bool SrtpTransport::OnDataReceivedFromPrevNode(NodeType from_node, const std::sh
 	}
 	else if(from_node == NodeType::Rtcp)
 	{
-		 if(!_send_session->ProtectRtcp(data))
+		 if(!_send_rtcp_session->ProtectRtcp(data))
 		 {
 			return false;
 		 }
@@ -72,6 +97,43 @@ bool SrtpTransport::OnDataReceivedFromPrevNode(NodeType from_node, const std::sh
 	return SendDataToNextNode(data);
 }
 
+bool SrtpTransport::OnDataListReceivedFromPrevNode(NodeType from_node, const std::vector<std::shared_ptr<ov::Data>> &data_list)
+{
+	if(from_node != NodeType::Rtp)
+	{
+		return ov::Node::OnDataListReceivedFromPrevNode(from_node, data_list);
+	}
+
+	if(GetNodeState() != ov::Node::NodeState::Started)
+	{
+		logtd("Node has not started, so the received data has been canceled.");
+		return false;
+	}
+
+	if(!_send_session)
+	{
+		return false;
+	}
+
+	// Packets that failed to be protected are emptied, so they are skipped
+	_send_session->ProtectRtp(data_list);
+
+	bool result = true;
+	for(const auto &data : data_list)
+	{
+		if(data->GetLength() == 0)
+		{
+			result = false;
+			continue;
+		}
+
+		// To DTLS transport
+		result = SendDataToNextNode(data) && result;
+	}
+
+	return result;
+}
+
 bool SrtpTransport::OnDataReceivedFromNextNode(NodeType from_node, const std::shared_ptr<const ov::Data> &data)
 {
 	if(GetNodeState() != ov::Node::NodeState::Started)
@@ -128,7 +190,7 @@ bool SrtpTransport::OnDataReceivedFromNextNode(NodeType from_node, const std::sh
 // Initialize SRTP
 bool SrtpTransport::SetKeyMaterial(uint64_t crypto_suite, std::shared_ptr<ov::Data> server_key, std::shared_ptr<ov::Data> client_key)
 {
-	if(_send_session || _recv_session)
+	if(_send_session || _send_rtcp_session || _recv_session)
 	{
 		return false;
 	}
@@ -147,6 +209,12 @@ bool SrtpTransport::SetKeyMaterial(uint64_t crypto_suite, std::shared_ptr<ov::Da
 		return false;
 	}
 
+	_send_rtcp_session = std::make_shared<SrtpAdapter>();
+	if(!_send_rtcp_session->SetKey(ssrc_any_outbound, crypto_suite, server_key))
+	{
+		return false;
+	}
+
 	_recv_session = std::make_shared<SrtpAdapter>();
 	if(_recv_session == nullptr)
 	{
@@ -160,5 +228,7 @@ bool SrtpTransport::SetKeyMaterial(uint64_t crypto_suite, std::shared_ptr<ov::Da
 		return false;
 	}
 
+	_key_ready = true;
+
 	return true;
 }
\ No newline at end of file
@@ -24,10 +24,25 @@ public:
 
 	bool OnDataReceivedFromPrevNode(NodeType from_node, const std::shared_ptr<ov::Data> &data) override;
 	bool OnDataReceivedFromNextNode(NodeType from_node, const std::shared_ptr<const ov::Data> &data) override;
+	bool OnDataListReceivedFromPrevNode(NodeType from_node, const std::vector<std::shared_ptr<ov::Data>> &data_list) override;
 
 	bool SetKeyMaterial(uint64_t crypto_suite, std::shared_ptr<ov::Data> server_key, std::shared_ptr<ov::Data> client_key);
+	// Whether the packets can be protected (the key material has been set by DTLS)
+	bool IsKeyReady() const
+	{
+		return _key_ready;
+	}
+
+	// Statistics of the RTP packets protected so far
+	SrtpAdapter::ProtectStats GetProtectStats() const;
 
 private:
+	// RTP and RTCP are protected with separate contexts so that RTCP (SR, feedback) does not contend with media.
+	// Both contexts are created with the same key, the SRTCP index is independent of the RTP ROC.
 	std::shared_ptr<SrtpAdapter>		_send_session = nullptr;
+	std::shared_ptr<SrtpAdapter>		_send_rtcp_session = nullptr;
 	std::shared_ptr<SrtpAdapter>		_recv_session = nullptr;
+
+	// Set by the DTLS handshake worker, read by the stream worker
+	std::atomic<bool>					_key_ready{false};
 };
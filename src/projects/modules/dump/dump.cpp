@@ -42,6 +42,22 @@ namespace mdl
 			return false;
 		}
 
+		return UpdateDumpInfo();
+	}
+
+	bool Dump::DumpData(const ov::String &file_name, const std::vector<std::shared_ptr<const ov::Data>> &data_list, bool append)
+	{
+		if (DumpToFile(GetOutputPath(), file_name, data_list, true, append) == false)
+		{
+			logw("DEBUG", "Could not dump data to file: %s/%s", GetOutputPath().CStr(), file_name.CStr());
+			return false;
+		}
+
+		return UpdateDumpInfo();
+	}
+
+	bool Dump::UpdateDumpInfo()
+	{
 		// Write DumpInfo
 		if (GetInfoFileUrl().IsEmpty() == false)
 		{
@@ -163,4 +179,28 @@ namespace mdl
 
 		return true;
 	}
+
+	bool Dump::DumpToFile(const ov::String &path, const ov::String &file_name, const std::vector<std::shared_ptr<const ov::Data>> &data_list, bool add_history, bool append)
+	{
+		if (ov::CreateDirectories(path) == false)
+		{
+			logw("DEBUG", "Could not create directories: %s", path.CStr());
+			return false;
+		}
+
+		auto file_path_name = ov::PathManager::Combine(path, file_name);
+
+		if (ov::DumpToFile(file_path_name, data_list, append) == nullptr)
+		{
+			logw("DEBUG", "Could not dump data to file: %s", file_path_name.CStr());
+			return false;
+		}
+
+		if (add_history == true)
+		{
+			_dump_history_map.emplace_back(file_path_name);
+		}
+
+		return true;
+	}
 }  // namespace mdl
\ No newline at end of file
@@ -20,6 +20,8 @@ namespace mdl
 		Dump(const info::Dump &info);
 		Dump(const std::shared_ptr<info::Dump> &info);
 		bool DumpData(const ov::String &file_name, const std::shared_ptr<const ov::Data> &data, bool append = false);
+		// Dump the buffers to a file in order without concatenating them
+		bool DumpData(const ov::String &file_name, const std::vector<std::shared_ptr<const ov::Data>> &data_list, bool append = false);
 		bool CompleteDump();
 
 		bool HasExtraData(const int32_t &id)
@@ -39,6 +41,8 @@ namespace mdl
 
 	private:
 		bool DumpToFile(const ov::String &path, const ov::String &file_name, const std::shared_ptr<const ov::Data> &data, bool add_history = true, bool append = false);
+		bool DumpToFile(const ov::String &path, const ov::String &file_name, const std::vector<std::shared_ptr<const ov::Data>> &data_list, bool add_history = true, bool append = false);
+		bool UpdateDumpInfo();
 		bool MakeDumpInfo(ov::String &dump_info);
 
 		struct DumpHistory
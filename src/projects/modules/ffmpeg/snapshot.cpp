@@ -0,0 +1,283 @@
+#include "snapshot.h"
+
+#include <modules/bitstream/h265/h265_decoder_configuration_record.h>
+#include <modules/ffmpeg/compat.h>
+
+#define OV_LOG_TAG "FFmpegSnapshot"
+
+namespace ffmpeg
+{
+	bool Snapshot::IsSupportedImageCodec(cmn::MediaCodecId codec_id)
+	{
+		return (codec_id == cmn::MediaCodecId::Jpeg) ||
+			   (codec_id == cmn::MediaCodecId::Png) ||
+			   (codec_id == cmn::MediaCodecId::Webp);
+	}
+
+	bool Snapshot::IsSupportedVideoCodec(cmn::MediaCodecId codec_id)
+	{
+		return (codec_id == cmn::MediaCodecId::H264) ||
+			   (codec_id == cmn::MediaCodecId::H265) ||
+			   (codec_id == cmn::MediaCodecId::Vp8);
+	}
+
+	std::shared_ptr<ov::Data> Snapshot::Encode(const std::shared_ptr<MediaTrack>& track,
+											   const std::shared_ptr<const MediaPacket>& keyframe,
+											   cmn::MediaCodecId image_codec_id,
+											   int32_t width, int32_t height)
+	{
+		if ((track == nullptr) || (keyframe == nullptr) || (keyframe->GetData() == nullptr))
+		{
+			return nullptr;
+		}
+
+		if (IsSupportedImageCodec(image_codec_id) == false)
+		{
+			logtw("Unsupported image codec: %s", cmn::GetCodecIdString(image_codec_id));
+			return nullptr;
+		}
+
+		AVFrame* decoded_frame = Decode(track, keyframe);
+		if (decoded_frame == nullptr)
+		{
+			return nullptr;
+		}
+
+		// Calculate the output size by keeping the aspect ratio
+		if ((width <= 0) && (height <= 0))
+		{
+			width  = decoded_frame->width;
+			height = decoded_frame->height;
+		}
+		else if (width <= 0)
+		{
+			width = static_cast<int32_t>(static_cast<int64_t>(decoded_frame->width) * height / decoded_frame->height);
+		}
+		else if (height <= 0)
+		{
+			height = static_cast<int32_t>(static_cast<int64_t>(decoded_frame->height) * width / decoded_frame->width);
+		}
+
+		// Ensure even width/height for YUV 4:2:0 formats
+		width += (width % 2);
+		height += (height % 2);
+
+		AVPixelFormat output_format = AV_PIX_FMT_YUV420P;
+		switch (image_codec_id)
+		{
+			case cmn::MediaCodecId::Jpeg:
+				output_format = AV_PIX_FMT_YUVJ420P;
+				break;
+			case cmn::MediaCodecId::Png:
+				output_format = AV_PIX_FMT_RGBA;
+				break;
+			default:
+				output_format = AV_PIX_FMT_YUV420P;
+				break;
+		}
+
+		AVFrame* output_frame = Convert(decoded_frame, output_format, width, height);
+		av_frame_free(&decoded_frame);
+
+		if (output_frame == nullptr)
+		{
+			logtw("Could not convert the decoded frame to %s", cmn::GetCodecIdString(image_codec_id));
+			return nullptr;
+		}
+
+		auto image = EncodeImage(output_frame, image_codec_id);
+		av_frame_free(&output_frame);
+
+		return image;
+	}
+
+	AVFrame* Snapshot::Decode(const std::shared_ptr<MediaTrack>& track, const std::shared_ptr<const MediaPacket>& keyframe)
+	{
+		const AVCodec* decoder = avcodec_find_decoder(ffmpeg::compat::ToAVCodecId(track->GetCodecId()));
+		if (decoder == nullptr)
+		{
+			logtw("Decoder not found: %s", cmn::GetCodecIdString(track->GetCodecId()));
+			return nullptr;
+		}
+
+		AVCodecContext* codec_context = avcodec_alloc_context3(decoder);
+		if (codec_context == nullptr)
+		{
+			return nullptr;
+		}
+
+		// Only one frame is decoded, so there is no benefit from frame threading
+		codec_context->thread_count = 1;
+
+		if (avcodec_open2(codec_context, decoder, nullptr) < 0)
+		{
+			logtw("Could not open decoder: %s", cmn::GetCodecIdString(track->GetCodecId()));
+			avcodec_free_context(&codec_context);
+			return nullptr;
+		}
+
+		auto bitstream = keyframe->GetData();
+
+		// The MediaRouter does not insert VPS/SPS/PPS in front of H.265 IDR frames yet,
+		// so the parameter sets of the decoder configuration record are prepended.
+		std::shared_ptr<ov::Data> parameter_sets = nullptr;
+		if (track->GetCodecId() == cmn::MediaCodecId::H265)
+		{
+			auto hevc_config = track->GetDecoderConfigurationRecordAs<HEVCDecoderConfigurationRecord>();
+			if (hevc_config != nullptr)
+			{
+				std::tie(parameter_sets, std::ignore) = hevc_config->GetVpsSpsPpsAsAnnexB();
+			}
+		}
+
+		size_t parameter_sets_size = (parameter_sets != nullptr) ? parameter_sets->GetLength() : 0;
+
+		AVPacket* packet = av_packet_alloc();
+		AVFrame* frame	 = av_frame_alloc();
+
+		if ((packet == nullptr) || (frame == nullptr) ||
+			(av_new_packet(packet, static_cast<int>(parameter_sets_size + bitstream->GetLength())) < 0))
+		{
+			av_packet_free(&packet);
+			av_frame_free(&frame);
+			avcodec_free_context(&codec_context);
+			return nullptr;
+		}
+
+		if (parameter_sets_size > 0)
+		{
+			::memcpy(packet->data, parameter_sets->GetData(), parameter_sets_size);
+		}
+		::memcpy(packet->data + parameter_sets_size, bitstream->GetData(), bitstream->GetLength());
+
+		packet->pts	  = keyframe->GetPts();
+		packet->dts	  = keyframe->GetDts();
+		packet->flags = AV_PKT_FLAG_KEY;
+
+		bool decoded = false;
+
+		// Send the keyframe and flush the decoder right away to get the frame without waiting for the next packets
+		if ((avcodec_send_packet(codec_context, packet) == 0) &&
+			(avcodec_send_packet(codec_context, nullptr) == 0))
+		{
+			int ret = avcodec_receive_frame(codec_context, frame);
+			if (ret == 0)
+			{
+				decoded = true;
+			}
+			else
+			{
+				logtd("Could not receive a frame from the decoder: %s", ffmpeg::compat::AVErrorToString(ret).CStr());
+			}
+		}
+
+		av_packet_free(&packet);
+		avcodec_free_context(&codec_context);
+
+		if (decoded == false)
+		{
+			logtw("Could not decode the keyframe of track %u (%s)", track->GetId(), cmn::GetCodecIdString(track->GetCodecId()));
+			av_frame_free(&frame);
+			return nullptr;
+		}
+
+		return frame;
+	}
+
+	AVFrame* Snapshot::Convert(const AVFrame* frame, AVPixelFormat output_format, int32_t output_width, int32_t output_height)
+	{
+		SwsContext* sws_context = sws_getContext(frame->width, frame->height, static_cast<AVPixelFormat>(frame->format),
+												 output_width, output_height, output_format,
+												 SWS_BILINEAR, nullptr, nullptr, nullptr);
+		if (sws_context == nullptr)
+		{
+			return nullptr;
+		}
+
+		AVFrame* output_frame = av_frame_alloc();
+		if (output_frame == nullptr)
+		{
+			sws_freeContext(sws_context);
+			return nullptr;
+		}
+
+		output_frame->format = output_format;
+		output_frame->width	 = output_width;
+		output_frame->height = output_height;
+
+		if ((av_frame_get_buffer(output_frame, 0) < 0) ||
+			(sws_scale(sws_context, frame->data, frame->linesize, 0, frame->height, output_frame->data, output_frame->linesize) < 0))
+		{
+			sws_freeContext(sws_context);
+			av_frame_free(&output_frame);
+			return nullptr;
+		}
+
+		sws_freeContext(sws_context);
+
+		return output_frame;
+	}
+
+	std::shared_ptr<ov::Data> Snapshot::EncodeImage(const AVFrame* frame, cmn::MediaCodecId image_codec_id)
+	{
+		const AVCodec* encoder = avcodec_find_encoder(ffmpeg::compat::ToAVCodecId(image_codec_id));
+		if (encoder == nullptr)
+		{
+			logtw("Encoder not found: %s", cmn::GetCodecIdString(image_codec_id));
+			return nullptr;
+		}
+
+		AVCodecContext* codec_context = avcodec_alloc_context3(encoder);
+		if (codec_context == nullptr)
+		{
+			return nullptr;
+		}
+
+		codec_context->codec_type = AVMEDIA_TYPE_VIDEO;
+		codec_context->pix_fmt	  = static_cast<AVPixelFormat>(frame->format);
+		codec_context->width	  = frame->width;
+		codec_context->height	  = frame->height;
+		codec_context->time_base  = AVRational{1, 1000};
+
+		// Use the same parameters as the image encoders of the transcoder
+		if (image_codec_id == cmn::MediaCodecId::Jpeg)
+		{
+			codec_context->flags				 = AV_CODEC_FLAG_QSCALE;
+			codec_context->global_quality		 = codec_context->qmin * FF_QP2LAMBDA;
+			codec_context->color_range			 = AVCOL_RANGE_JPEG;
+			codec_context->strict_std_compliance = FF_COMPLIANCE_STRICT;
+		}
+		else if (image_codec_id == cmn::MediaCodecId::Webp)
+		{
+			codec_context->compression_level = 1;
+			::av_opt_set(codec_context->priv_data, "preset", "default", 0);
+		}
+
+		if (avcodec_open2(codec_context, encoder, nullptr) < 0)
+		{
+			logtw("Could not open encoder: %s", cmn::GetCodecIdString(image_codec_id));
+			avcodec_free_context(&codec_context);
+			return nullptr;
+		}
+
+		std::shared_ptr<ov::Data> image = nullptr;
+		AVPacket* packet				= av_packet_alloc();
+
+		if ((packet != nullptr) &&
+			(avcodec_send_frame(codec_context, frame) == 0) &&
+			(avcodec_send_frame(codec_context, nullptr) == 0) &&
+			(avcodec_receive_packet(codec_context, packet) == 0))
+		{
+			image = std::make_shared<ov::Data>(packet->data, packet->size);
+		}
+		else
+		{
+			logtw("Could not encode the frame to %s", cmn::GetCodecIdString(image_codec_id));
+		}
+
+		av_packet_free(&packet);
+		avcodec_free_context(&codec_context);
+
+		return image;
+	}
+}  // namespace ffmpeg
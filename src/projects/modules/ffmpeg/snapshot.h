@@ -0,0 +1,35 @@
+#pragma once
+
+#include <base/info/media_track.h>
+#include <base/mediarouter/media_buffer.h>
+#include <base/ovlibrary/ovlibrary.h>
+
+extern "C"
+{
+#include <libavcodec/avcodec.h>
+#include <libswscale/swscale.h>
+};
+
+namespace ffmpeg
+{
+	// Decodes a single keyframe and encodes it into a still image (JPEG/PNG/WebP).
+	// Used to generate thumbnails on demand instead of running an image encoder for every stream.
+	class Snapshot
+	{
+	public:
+		// If width/height is 0, the size of the decoded frame is used.
+		// If only one of them is set, the other is calculated by keeping the aspect ratio.
+		static std::shared_ptr<ov::Data> Encode(const std::shared_ptr<MediaTrack>& track,
+												const std::shared_ptr<const MediaPacket>& keyframe,
+												cmn::MediaCodecId image_codec_id,
+												int32_t width = 0, int32_t height = 0);
+
+		static bool IsSupportedImageCodec(cmn::MediaCodecId codec_id);
+		static bool IsSupportedVideoCodec(cmn::MediaCodecId codec_id);
+
+	private:
+		static AVFrame* Decode(const std::shared_ptr<MediaTrack>& track, const std::shared_ptr<const MediaPacket>& keyframe);
+		static AVFrame* Convert(const AVFrame* frame, AVPixelFormat output_format, int32_t output_width, int32_t output_height);
+		static std::shared_ptr<ov::Data> EncodeImage(const AVFrame* frame, cmn::MediaCodecId image_codec_id);
+	};
+}  // namespace ffmpeg
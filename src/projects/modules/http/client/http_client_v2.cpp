@@ -468,16 +468,20 @@ namespace http
 
 				logtd("Request an URL: %s (address: %s)...", url.CStr(), address.ToString(false).CStr());
 
+				// In non-blocking mode, a worker of the socket pool may handle an error of the connection (e.g. ECONNREFUSED)
+				// and reset `_socket` before Connect() returns, so the socket is kept alive here
+				auto socket = _socket;
+
 				// Convert milliseconds to timeval
-				_socket->SetRecvTimeout(
+				socket->SetRecvTimeout(
 					{.tv_sec  = _recv_timeout_msec / 1000,
 					 .tv_usec = _recv_timeout_msec % 1000});
 
-				error = _socket->Connect(address, _connection_timeout_msec);
+				error = socket->Connect(address, _connection_timeout_msec);
 
 				if (error == nullptr)
 				{
-					if (_socket->GetBlockingMode() == ov::BlockingMode::NonBlocking)
+					if (socket->GetBlockingMode() == ov::BlockingMode::NonBlocking)
 					{
 						// `OnConnected()` will be called when the connection is established
 
@@ -109,31 +109,32 @@ namespace http
 				logtd("Trying to send datas...");
 
 				uint32_t sent_bytes = 0;
-				for (const auto &data : GetResponseDataList())
+
+				if (_chunked_transfer == false)
 				{
-					if (_chunked_transfer)
+					// Send all the data at once so that the socket can write them with scatter-gather I/O
+					const auto &data_list = GetResponseDataList();
+
+					if ((data_list.empty() == false) && (Send(data_list) == false))
 					{
-						sent &= SendChunkedData(data);
-						if (sent == true)
-						{
-							sent_bytes += data->GetLength();
-						}
-						else
-						{
-							logte("Could not send chunked data : %d bytes", data->GetLength());
-							return -1;
-						}
+						logte("Could not send data : %zu bytes", GetResponseDataSize());
+						return -1;
 					}
-					else
+
+					sent_bytes = GetResponseDataSize();
+				}
+				else
+				{
+					for (const auto &data : GetResponseDataList())
 					{
-						sent &= Send(data);
+						sent &= SendChunkedData(data);
 						if (sent == true)
 						{
 							sent_bytes += data->GetLength();
 						}
 						else
 						{
-							logte("Could not send data : %d bytes", data->GetLength());
+							logte("Could not send chunked data : %d bytes", data->GetLength());
 							return -1;
 						}
 					}
@@ -424,6 +424,49 @@ namespace http
 			return _client_socket->Send(send_data);
 		}
 
+		bool HttpResponse::Send(const std::vector<std::shared_ptr<const ov::Data>> &data_list)
+		{
+			if (_tls_data == nullptr)
+			{
+				return _client_socket->Send(data_list);
+			}
+
+			std::vector<std::shared_ptr<const ov::Data>> send_data_list;
+			send_data_list.reserve(data_list.size());
+
+			std::lock_guard<std::mutex> lock(_tls_data->GetSequentialSendMutex());
+
+			for (const auto &data : data_list)
+			{
+				if (data == nullptr)
+				{
+					OV_ASSERT2(data != nullptr);
+					return false;
+				}
+
+				std::shared_ptr<const ov::Data> send_data;
+
+				if (_tls_data->Encrypt(data, &send_data) == false)
+				{
+					logte("Failed to encrypt data: %s", _client_socket->ToString().CStr());
+					return false;
+				}
+
+				if ((send_data != nullptr) && (send_data->IsEmpty() == false))
+				{
+					send_data_list.push_back(send_data);
+				}
+			}
+
+			if (send_data_list.empty())
+			{
+				// There is no data to send
+				return true;
+			}
+
+			return _client_socket->Send(send_data_list);
+		}
+
 		bool HttpResponse::Close()
 		{
 			OV_ASSERT2(_client_socket != nullptr);
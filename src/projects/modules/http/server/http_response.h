@@ -91,6 +91,8 @@ namespace http
 			}
 			virtual bool Send(const void *data, size_t length);
 			virtual bool Send(const std::shared_ptr<const ov::Data> &data);
+			// Sends the buffers in order without concatenating them
+			virtual bool Send(const std::vector<std::shared_ptr<const ov::Data>> &data_list);
 			
 		private:
 			virtual int32_t SendHeader();
@@ -8,6 +8,9 @@
 //==============================================================================
 #include "https_server.h"
 
+#include <config/config_manager.h>
+#include <monitoring/monitoring.h>
+
 #include "./http_server_private.h"
 
 // Reference: https://wiki.mozilla.org/Security/Server_Side_TLS
@@ -25,6 +28,59 @@ namespace http
 {
 	namespace svr
 	{
+		bool HttpsServer::Start(const ov::SocketAddress &address, int worker_count, bool enable_http2)
+		{
+			// Must be prepared before the certificates are inserted
+			PrepareSessionResumption(address);
+
+			if (HttpServer::Start(address, worker_count, enable_http2) == false)
+			{
+				_session_resumption = nullptr;
+				return false;
+			}
+
+			auto server_metrics = MonitorInstance->GetServerMetrics();
+			if (server_metrics != nullptr)
+			{
+				_tls_session_metrics = server_metrics->GetTlsSessionMetrics(address.ToString());
+			}
+
+			return true;
+		}
+
+		void HttpsServer::PrepareSessionResumption(const ov::SocketAddress &address)
+		{
+			auto server_config = cfg::ConfigManager::GetInstance()->GetServer();
+			if (server_config == nullptr)
+			{
+				return;
+			}
+
+			const auto &resumption_config = server_config->GetModules().GetTlsSessionResumption();
+
+			if (resumption_config.IsEnabledForPort(address.Port()) == false)
+			{
+				logtd("TLS session resumption is disabled on %s", address.ToString().CStr());
+				return;
+			}
+
+			ov::TlsSessionResumptionOptions options;
+
+			options.ticket_enabled = resumption_config.IsSessionTicketEnabled();
+			options.ticket_key_rotation_interval = resumption_config.GetTicketKeyRotationInterval();
+			options.cache_enabled = resumption_config.IsSessionCacheEnabled();
+			options.cache_size = std::max(resumption_config.GetSessionCacheSize(), 1);
+			options.session_timeout = resumption_config.GetSessionTimeout();
+
+			_session_resumption = std::make_shared<ov::TlsSessionResumption>(address.ToString(), options);
+
+			logtd("TLS session resumption is enabled on %s (ticket: %s, cache: %s/%zu, timeout: %ds)",
+				  address.ToString().CStr(),
+				  options.ticket_enabled ? "on" : "off",
+				  options.cache_enabled ? "on" : "off", options.cache_size,
+				  options.session_timeout);
+		}
+
 		std::shared_ptr<const ov::Error> HttpsServer::InsertCertificate(const std::shared_ptr<const info::Certificate> &certificate)
 		{
 			if (certificate == nullptr)
@@ -51,6 +107,15 @@ namespace http
 				return error;
 			}
 
+			try
+			{
+				tls_context->SetSessionResumption(_session_resumption);
+			}
+			catch (const ov::OpensslError &e)
+			{
+				return std::make_shared<ov::OpensslError>(e);
+			}
+
 			std::lock_guard lock_guard(_https_certificate_map_mutex);
 
 			logtd("Append the certificate for host: %s", certificate->ToString().CStr());
@@ -148,6 +213,11 @@ namespace http
 						tls_data->GetState() == ov::TlsServerData::State::Accepted)
 					{
 						// The client has accepted the connection
+						if (_tls_session_metrics != nullptr)
+						{
+							_tls_session_metrics->OnHandshakeCompleted(tls_data->GetTls().IsSessionReused());
+						}
+
 						connection->OnTlsAccepted();
 					}
 
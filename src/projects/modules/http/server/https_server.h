@@ -10,6 +10,7 @@
 
 #include "base/info/host.h"
 #include "http_server.h"
+#include "monitoring/tls_session_metrics.h"
 #include "orchestrator/orchestrator.h"
 
 namespace http
@@ -24,6 +25,8 @@ namespace http
 			{
 			}
 
+			bool Start(const ov::SocketAddress &address, int worker_count, bool enable_http2) override;
+
 			std::shared_ptr<const ov::Error> InsertCertificate(const std::shared_ptr<const info::Certificate> &certificate);
 			std::shared_ptr<const ov::Error> RemoveCertificate(const std::shared_ptr<const info::Certificate> &certificate);
 
@@ -54,11 +57,17 @@ namespace http
 		protected:
 			bool HandleSniCallback(ov::TlsContext *tls_context, SSL *ssl, const ov::String &server_name);
 
+			void PrepareSessionResumption(const ov::SocketAddress &address);
+
 		protected:
 			std::mutex _https_certificate_map_mutex;
 
 			// Certificate Name : HttpsCertificate
 			std::map<ov::String, std::shared_ptr<HttpsCertificate>> _https_certificate_map;
+
+			// Shared by the TLS contexts of all certificates, so the sessions can be resumed regardless of SNI
+			std::shared_ptr<ov::TlsSessionResumption> _session_resumption;
+			std::shared_ptr<mon::TlsSessionMetrics> _tls_session_metrics;
 		};
 	}  // namespace svr
 }  // namespace http
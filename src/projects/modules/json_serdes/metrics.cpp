@@ -70,6 +70,39 @@ namespace serdes
 		SetTimeInterval(value, "requestTimeToOrigin", metrics->GetOriginConnectionTimeMSec());
 		SetTimeInterval(value, "responseTimeFromOrigin", metrics->GetOriginSubscribeTimeMSec());
 
+		auto srtp_protected_packets = metrics->GetSrtpProtectedPackets();
+		if (srtp_protected_packets > 0)
+		{
+			Json::Value &srtp = value["srtp"];
+
+			auto protected_bytes = metrics->GetSrtpProtectedBytes();
+			auto elapsed_us		 = metrics->GetSrtpProtectElapsedUs();
+
+			SetInt64(srtp, "protectedPackets", srtp_protected_packets);
+			SetInt64(srtp, "protectedBytes", protected_bytes);
+			SetInt64(srtp, "protectTimeUs", elapsed_us);
+			// Protected bytes per second of CPU time
+			SetInt64(srtp, "protectThroughput", (elapsed_us > 0) ? static_cast<int64_t>(protected_bytes * 1000000.0 / elapsed_us) : 0);
+		}
+
+		auto copied_frame_bytes = metrics->GetCopiedFrameBytes();
+		if (copied_frame_bytes > 0)
+		{
+			SetInt64(value, "copiedFrameBytes", copied_frame_bytes);
+		}
+
+		auto nack_stats = metrics->GetNackStats();
+		if ((nack_stats.lost_packets > 0) || (nack_stats.nack_requests > 0))
+		{
+			Json::Value &nack = value["nack"];
+
+			SetInt64(nack, "lostPackets", nack_stats.lost_packets);
+			SetInt64(nack, "nackRequests", nack_stats.nack_requests);
+			SetInt64(nack, "requestedPackets", nack_stats.requested_packets);
+			SetInt64(nack, "recoveredPackets", nack_stats.recovered_packets);
+			SetInt64(nack, "unrecoveredPackets", nack_stats.unrecovered_packets);
+		}
+
 		return value;
 	}
 
@@ -95,4 +128,150 @@ namespace serdes
 
 		return value;
 	}
-}  // namespace serdes
\ No newline at end of file
+
+	Json::Value JsonFromTlsSessionMetrics(const std::shared_ptr<const mon::TlsSessionMetrics> &metrics)
+	{
+		if (metrics == nullptr)
+		{
+			return Json::nullValue;
+		}
+
+		Json::Value value;
+
+		SetString(value, "address", metrics->GetAddress(), Optional::False);
+		SetInt64(value, "fullHandshakes", metrics->GetFullHandshakeCount());
+		SetInt64(value, "resumedHandshakes", metrics->GetResumedHandshakeCount());
+		SetFloat(value, "resumptionHitRatio", metrics->GetResumptionHitRatio());
+
+		return value;
+	}
+
+	Json::Value JsonFromLatencyMetrics(const std::shared_ptr<const mon::LatencyMetrics> &metrics)
+	{
+		if (metrics == nullptr)
+		{
+			return Json::nullValue;
+		}
+
+		Json::Value value;
+
+		SetString(value, "publisher", StringFromPublisherType(metrics->GetPublisherType()).LowerCaseString(), Optional::False);
+
+		Json::Value &stages = value["stages"];
+		stages = Json::objectValue;
+
+		// Elapsed time from ingest to each stage in microseconds
+		for (size_t index = 1; index < MediaTrace::StageCount; index++)
+		{
+			auto stage_type = static_cast<MediaTraceStage>(index);
+			auto stage = metrics->GetStage(stage_type);
+
+			if (stage.count == 0)
+			{
+				continue;
+			}
+
+			Json::Value &stage_value = stages[GetMediaTraceStageString(stage_type)];
+
+			SetInt64(stage_value, "count", stage.count);
+			SetInt64(stage_value, "p50Us", stage.p50_us);
+			SetInt64(stage_value, "p99Us", stage.p99_us);
+			SetInt64(stage_value, "maxUs", stage.max_us);
+		}
+
+		// How long the packets waited in the pacer of the sessions
+		auto pacer_queue_delay = metrics->GetPacerQueueDelay();
+		if (pacer_queue_delay.count > 0)
+		{
+			Json::Value &pacer_value = value["pacerQueueDelay"];
+
+			SetInt64(pacer_value, "count", pacer_queue_delay.count);
+			SetInt64(pacer_value, "p50Us", pacer_queue_delay.p50_us);
+			SetInt64(pacer_value, "p99Us", pacer_queue_delay.p99_us);
+			SetInt64(pacer_value, "maxUs", pacer_queue_delay.max_us);
+		}
+
+		return value;
+	}
+
+	Json::Value JsonFromLatencySamples(const std::vector<std::shared_ptr<mon::StreamMetrics>> &streams)
+	{
+		Json::Value value;
+		Json::Value &events = value["traceEvents"];
+		events = Json::arrayValue;
+
+		int pid = 0;
+		for (const auto &stream : streams)
+		{
+			pid++;
+
+			Json::Value process_name;
+			process_name["name"] = "process_name";
+			process_name["ph"] = "M";
+			process_name["pid"] = pid;
+			process_name["args"]["name"] = stream->GetName().CStr();
+			events.append(process_name);
+
+			// Each track of each publisher is drawn as a thread
+			std::map<ov::String, int> tid_map;
+
+			for (const auto &latency_metrics : stream->GetLatencyMetricsList())
+			{
+				auto publisher = StringFromPublisherType(latency_metrics->GetPublisherType()).LowerCaseString();
+
+				for (const auto &sample : latency_metrics->GetSamples())
+				{
+					auto thread_name = ov::String::FormatString("%s/%u", publisher.CStr(), sample.track_id);
+					auto tid_item = tid_map.find(thread_name);
+					if (tid_item == tid_map.end())
+					{
+						tid_item = tid_map.emplace(thread_name, static_cast<int>(tid_map.size()) + 1).first;
+
+						Json::Value thread_name_event;
+						thread_name_event["name"] = "thread_name";
+						thread_name_event["ph"] = "M";
+						thread_name_event["pid"] = pid;
+						thread_name_event["tid"] = tid_item->second;
+						thread_name_event["args"]["name"] = thread_name.CStr();
+						events.append(thread_name_event);
+					}
+
+					auto prev_stage = MediaTraceStage::Ingest;
+					if (sample.trace.IsMarked(prev_stage) == false)
+					{
+						continue;
+					}
+
+					// Each stage is drawn as a slice from the previous marked stage
+					for (size_t index = 1; index < MediaTrace::StageCount; index++)
+					{
+						auto stage = static_cast<MediaTraceStage>(index);
+						if (sample.trace.IsMarked(stage) == false)
+						{
+							continue;
+						}
+
+						Json::Value event;
+						event["name"] = GetMediaTraceStageString(stage);
+						event["cat"] = publisher.CStr();
+						event["ph"] = "X";
+						event["pid"] = pid;
+						event["tid"] = tid_item->second;
+						event["ts"] = static_cast<Json::Int64>(sample.trace.GetTime(prev_stage));
+						event["dur"] = static_cast<Json::Int64>(sample.trace.GetTime(stage) - sample.trace.GetTime(prev_stage));
+						event["args"]["trackId"] = sample.track_id;
+						event["args"]["mediaType"] = cmn::GetMediaTypeString(sample.media_type);
+						event["args"]["pts"] = static_cast<Json::Int64>(sample.pts);
+						events.append(event);
+
+						prev_stage = stage;
+					}
+				}
+			}
+		}
+
+		value["displayTimeUnit"] = "ms";
+
+		return value;
+	}
+}  // namespace serdes
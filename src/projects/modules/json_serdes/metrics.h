@@ -15,4 +15,8 @@ namespace serdes
 	Json::Value JsonFromMetrics(const std::shared_ptr<const mon::CommonMetrics> &metrics);
 	Json::Value JsonFromStreamMetrics(const std::shared_ptr<const mon::StreamMetrics> &metrics);
 	Json::Value JsonFromQueueMetrics(const std::shared_ptr<const mon::QueueMetrics> &metrics);
+	Json::Value JsonFromTlsSessionMetrics(const std::shared_ptr<const mon::TlsSessionMetrics> &metrics);
+	Json::Value JsonFromLatencyMetrics(const std::shared_ptr<const mon::LatencyMetrics> &metrics);
+	// Sampled traces in the Chrome trace event format, which can be loaded in chrome://tracing or Perfetto
+	Json::Value JsonFromLatencySamples(const std::vector<std::shared_ptr<mon::StreamMetrics>> &streams);
 }  // namespace serdes
\ No newline at end of file
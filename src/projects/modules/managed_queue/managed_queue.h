@@ -11,16 +11,23 @@
 
 #include <monitoring/monitoring.h>
 
+#include <atomic>
 #include <condition_variable>
 #include <optional>
 #include <queue>
 #include <shared_mutex>
+#include <vector>
 
 #include "base/info/managed_queue.h"
+#include "base/ovlibrary/futex.h"
 #include "base/ovlibrary/ovlibrary.h"
 
 #define MANAGED_QUEUE_METRICS_UPDATE_INTERVAL_IN_MSEC 1000
 #define MANAGED_QUEUE_LOG_INTERVAL_IN_MSEC 5000
+// Number of the nodes moved at once between the per-thread node cache and the shared depot
+#define MANAGED_QUEUE_NODE_BATCH_SIZE 64
+// Maximum number of the node batches kept in the shared depot per item type
+#define MANAGED_QUEUE_NODE_DEPOT_SIZE 64
 
 // Deactivated as it is no longer used
 #define SKIP_MESSAGE_ENABLED false
@@ -36,19 +43,145 @@ namespace ov
 	private:
 		const char* LOG_TAG = "ManagedQueue";
 
+		// Nodes are reused through the node cache, so the data is destroyed when the node is released
 		struct ManagedQueueNode
 		{
-			T data;
+			std::optional<T> data;
 
-			ManagedQueueNode* next;
+			ManagedQueueNode* next = nullptr;
 
-			std::chrono::high_resolution_clock::time_point _start;
+			std::chrono::high_resolution_clock::time_point _start = std::chrono::high_resolution_clock::time_point::min();
 			bool _urgent = false;
+		};
+
+		// Released nodes are cached per thread, so allocating and releasing a node takes no lock.
+		// The producers allocate and the consumer releases, so the nodes go back to the producers
+		// through the depot shared by the queues of the same item type, a batch at a time.
+		class NodeCache
+		{
+		public:
+			static ManagedQueueNode* Allocate()
+			{
+				auto& cache = GetLocalCache();
+
+				if (cache.head == nullptr)
+				{
+					cache.head = GetDepot().Take();
+					cache.count = (cache.head != nullptr) ? MANAGED_QUEUE_NODE_BATCH_SIZE : 0;
+				}
+
+				if (cache.head == nullptr)
+				{
+					return new ManagedQueueNode();
+				}
+
+				auto node = cache.head;
+				cache.head = node->next;
+				cache.count--;
+
+				return node;
+			}
+
+			static void Release(ManagedQueueNode* node)
+			{
+				node->data.reset();
+
+				auto& cache = GetLocalCache();
+
+				node->next = cache.head;
+				cache.head = node;
+				cache.count++;
+
+				// Keep a batch for this thread and give the other to the depot
+				if (cache.count >= (MANAGED_QUEUE_NODE_BATCH_SIZE * 2))
+				{
+					auto batch = cache.head;
+					auto tail = batch;
+					for (int index = 1; index < MANAGED_QUEUE_NODE_BATCH_SIZE; index++)
+					{
+						tail = tail->next;
+					}
+
+					cache.head = tail->next;
+					cache.count -= MANAGED_QUEUE_NODE_BATCH_SIZE;
+					tail->next = nullptr;
+
+					GetDepot().Put(batch);
+				}
+			}
+
+		private:
+			static void DeleteList(ManagedQueueNode* node)
+			{
+				while (node != nullptr)
+				{
+					auto next = node->next;
+					delete node;
+					node = next;
+				}
+			}
+
+			struct LocalCache
+			{
+				ManagedQueueNode* head = nullptr;
+				size_t count = 0;
+
+				~LocalCache()
+				{
+					DeleteList(head);
+				}
+			};
 
-			ManagedQueueNode(const T& value, bool urgent, ManagedQueueNode* next_node = nullptr)
-				: data(value), next(next_node), _start(std::chrono::high_resolution_clock::time_point::min()), _urgent(urgent)
+			class Depot
 			{
-				_start = std::chrono::high_resolution_clock::now();
+			public:
+				// Returns a list of MANAGED_QUEUE_NODE_BATCH_SIZE nodes, or nullptr
+				ManagedQueueNode* Take()
+				{
+					auto lock_guard = std::lock_guard(_mutex);
+
+					if (_batches.empty())
+					{
+						return nullptr;
+					}
+
+					auto batch = _batches.back();
+					_batches.pop_back();
+
+					return batch;
+				}
+
+				void Put(ManagedQueueNode* batch)
+				{
+					{
+						auto lock_guard = std::lock_guard(_mutex);
+
+						if (_batches.size() < MANAGED_QUEUE_NODE_DEPOT_SIZE)
+						{
+							_batches.push_back(batch);
+							return;
+						}
+					}
+
+					DeleteList(batch);
+				}
+
+			private:
+				std::mutex _mutex;
+				std::vector<ManagedQueueNode*> _batches;
+			};
+
+			static LocalCache& GetLocalCache()
+			{
+				static thread_local LocalCache cache;
+				return cache;
+			}
+
+			static Depot& GetDepot()
+			{
+				// Never destroyed, since the caches of the threads may outlive the static objects at exit
+				static Depot* depot = new Depot();
+				return *depot;
 			}
 		};
 
@@ -105,45 +238,31 @@ namespace ov
 		// Urgent item will be inserted at the front of the queue
 		void Enqueue(const T& item, bool urgent = false, int timeout = Infinite)
 		{
-			auto node = new ManagedQueueNode(item, urgent);
-			EnqeuePos pos = urgent ? EnqeuePos::EnqueuFrontPos : EnqeuePos::EnqueuBackPos;
+			auto node = AllocateNode(urgent);
+			node->data.emplace(item);
 
-			EnqueueInternal(node, timeout, pos);
+			EnqueueNode(node, urgent, timeout);
 		}
 
 		// Urgent item will be inserted at the front of the queue
 		void Enqueue(T&& item, bool urgent = false, int timeout = Infinite)
 		{
-			auto node = new ManagedQueueNode(item, urgent);
-			EnqeuePos pos = urgent ? EnqeuePos::EnqueuFrontPos : EnqeuePos::EnqueuBackPos;
+			auto node = AllocateNode(urgent);
+			node->data.emplace(std::move(item));
 
-			EnqueueInternal(node, timeout, pos);
+			EnqueueNode(node, urgent, timeout);
 		}
 
 		std::optional<T> Front(int timeout = Infinite)
 		{
 			auto unique_lock = std::unique_lock(_mutex);
 
-			if (_stop)
+			if (WaitForItem(unique_lock, timeout) == false)
 			{
-				return {};	// Stop is requested
+				return {};	// timed out / Stop is requested
 			}
 
-			if (_size == 0)
-			{
-				std::chrono::system_clock::time_point expire = (timeout == Infinite) ? std::chrono::system_clock::time_point::max() : std::chrono::system_clock::now() + std::chrono::milliseconds(timeout);
-
-				auto result = _condition.wait_until(unique_lock, expire, [this]() -> bool {
-					return (((_size == 0) == false) || _stop);
-				});
-
-				if (!result || _stop)
-				{
-					return {};	// timed out / Stop is requested
-				}
-			}
-
-			return _front_node->data;
+			return *(_front_node->data);
 		}
 
 		// How long the first message has been buffered
@@ -151,6 +270,8 @@ namespace ov
 		{
 			auto lock_guard = std::lock_guard(_mutex);
 
+			DrainIntake();
+
 			return GetBufferedTimeMsInternal();
 		}
 
@@ -158,109 +279,77 @@ namespace ov
 		{
 			auto unique_lock = std::unique_lock(_mutex);
 
-			if (_stop)
-			{
-				return {};	// Stop is requested
-			}
-
-			if (_size == 0)
+			if (WaitForItem(unique_lock, timeout) == false)
 			{
-				std::chrono::system_clock::time_point expire = (timeout == Infinite) ? std::chrono::system_clock::time_point::max() : std::chrono::system_clock::now() + std::chrono::milliseconds(timeout);
-
-				auto result = _condition.wait_until(unique_lock, expire, [this]() -> bool {
-					return (((_size == 0) == false) || _stop);
-				});
-
-				if (!result || _stop)
-				{
-					return {};	// timed out / Stop is requested
-				}
+				return {};	// timed out / Stop is requested
 			}
 
-			return _rear_node->data;
+			return *(_rear_node->data);
 		}
 
 		std::optional<T> Dequeue(int timeout = Infinite)
 		{
 			auto unique_lock = std::unique_lock(_mutex);
 
-			if (_stop)
+			if (WaitForDequeuableItem(unique_lock, timeout) == false)
 			{
-				return {};	// Stop is requested
+				return {};	// timed out / Stop is requested
 			}
 
-			if ((_buffering_delay == 0 &&_size == 0) || 
-				(_buffering_delay != 0 && GetBufferedTimeMsInternal() < _buffering_delay))
-			{
-				std::chrono::system_clock::time_point expire = (timeout == Infinite) ? std::chrono::system_clock::time_point::max() : std::chrono::system_clock::now() + std::chrono::milliseconds(timeout);
-
-				auto result = _condition.wait_until(unique_lock, expire, [this]() -> bool {
-					if (_stop)
-					{
-						return true;
-					}
-					
-					if (_buffering_delay == 0)
-					{
-						return (_size != 0);
-					}
-					else
-					{
-						if (_front_node != nullptr && _front_node->_urgent == true)
-						{
-							return true;
-						}
-
-						if (GetBufferedTimeMsInternal() >= _buffering_delay)
-						{
-							return true;
-						}
-					}
-
-					return false;
-				});
+			T value = PopFront();
 
-				if (!result || _stop)
-				{
-					return {};	// timed out / Stop is requested
-				}
-			}
+			UpdateMetrics();
 
-			ManagedQueueNode* node = _front_node;
-			_front_node = _front_node->next;
-			if (_front_node == nullptr)
+			if (_exceed_threshold_and_wait_enabled == true)
 			{
-				_rear_node = nullptr;
+				_condition.notify_all();
 			}
 
-			T value = std::move(node->data);
+			return value;
+		}
 
-			_size--;
+		// Dequeues up to max_count items at once to reduce the cost of locking and waking up per item.
+		// It waits for the first item like Dequeue(), and the rest are dequeued only if they are available.
+		// Returns the number of items appended to items
+		size_t DequeueBatch(std::vector<T>& items, size_t max_count, int timeout = Infinite)
+		{
+			if (max_count == 0)
+			{
+				return 0;
+			}
 
-			// Update statistics of output message count
-			_output_message_count++;
+			auto unique_lock = std::unique_lock(_mutex);
 
-			// Update statistics of waiting time (microseconds)
-			if (node->_start != std::chrono::system_clock::time_point::max())
+			if (WaitForDequeuableItem(unique_lock, timeout) == false)
 			{
-				auto current = std::chrono::high_resolution_clock::now();
-				_waiting_time_in_us = _waiting_time_in_us * 0.9 + std::chrono::duration_cast<std::chrono::microseconds>(current - node->_start).count() * 0.1;
+				return 0;  // timed out / Stop is requested
 			}
 
-			delete node;
+			size_t count = 0;
+
+			do
+			{
+				items.push_back(PopFront());
+				count++;
+			} while ((count < max_count) && IsDequeuable());
 
 			UpdateMetrics();
 
-			if(_exceed_threshold_and_wait_enabled == true)
+			if (_exceed_threshold_and_wait_enabled == true)
 			{
 				_condition.notify_all();
 			}
 
-			return value;
+			return count;
 		}
 
 		bool IsEmpty() const
 		{
+			if (_intake_head.load(std::memory_order_acquire) != nullptr)
+			{
+				return false;
+			}
+
 			auto lock_guard = std::lock_guard(_mutex);
 
 			return (_size == 0);
@@ -271,13 +360,15 @@ namespace ov
 		{
 			auto lock_guard = std::lock_guard(_mutex);
 
+			DrainIntake();
+
 			while (_front_node != nullptr)
 			{
 				ManagedQueueNode* temp = _front_node;
 
 				_front_node = _front_node->next;
 
-				delete temp;
+				ReleaseNode(temp);
 			}
 
 			_rear_node = nullptr;
@@ -291,7 +382,7 @@ namespace ov
 		{
 			auto lock_guard = std::lock_guard(_mutex);
 
-			return _size;
+			return _size + _intake_count.load(std::memory_order_relaxed);
 		}
 
 		void Stop()
@@ -302,7 +393,9 @@ namespace ov
 
 			ClearMetrics();
 
+			// Wake up the producers waiting for the threshold and the consumers
 			_condition.notify_all();
+			_futex.WakeAll();
 		}
 
 		bool IsStopped() const
@@ -335,6 +428,243 @@ namespace ov
 		}
 
 	private:
+		ManagedQueueNode* AllocateNode(bool urgent)
+		{
+			auto node = NodeCache::Allocate();
+
+			node->next = nullptr;
+			node->_urgent = urgent;
+			node->_start = std::chrono::high_resolution_clock::now();
+
+			return node;
+		}
+
+		void ReleaseNode(ManagedQueueNode* node)
+		{
+			NodeCache::Release(node);
+		}
+
+		void EnqueueNode(ManagedQueueNode* node, bool urgent, int timeout)
+		{
+			// Urgent items, waiting for the threshold and the buffering delay need the lock,
+			// otherwise the producers push the items to the intake without the lock
+			if ((urgent == false) && (_exceed_threshold_and_wait_enabled == false) && (_buffering_delay == 0))
+			{
+				EnqueueToIntake(node);
+				return;
+			}
+
+			EnqeuePos pos = urgent ? EnqeuePos::EnqueuFrontPos : EnqeuePos::EnqueuBackPos;
+
+			EnqueueInternal(node, timeout, pos);
+		}
+
+		// Lock-free path for multiple producers
+		void EnqueueToIntake(ManagedQueueNode* node)
+		{
+			if (_stop)
+			{
+				ReleaseNode(node);
+				return;
+			}
+
+			// The node can be dequeued as soon as it is pushed, so it must not be accessed after that
+			auto start_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(node->_start.time_since_epoch()).count();
+
+			auto head = _intake_head.load(std::memory_order_relaxed);
+			do
+			{
+				node->next = head;
+			} while (_intake_head.compare_exchange_weak(head, node, std::memory_order_seq_cst, std::memory_order_relaxed) == false);
+
+			_intake_count.fetch_add(1, std::memory_order_relaxed);
+
+			// Wake up the consumer only if it is sleeping.
+			// The consumer sets _waiting_count before checking the intake, so either the consumer sees this node or this sees the waiting consumer.
+			if (_waiting_count.load(std::memory_order_seq_cst) > 0)
+			{
+				_futex.WakeAll();
+				return;
+			}
+
+			// The metrics are updated by the consumer, but if the consumer is stuck, no one updates them.
+			// So the producer updates them at the interval if the consumer does not hold the lock.
+			if (start_ns >= _next_producer_metrics_update_ns.load(std::memory_order_relaxed))
+			{
+				auto unique_lock = std::unique_lock(_mutex, std::try_to_lock);
+				if (unique_lock.owns_lock())
+				{
+					_next_producer_metrics_update_ns.store(start_ns + (static_cast<int64_t>(_stats_metric_interval) * 1000000LL), std::memory_order_relaxed);
+
+					DrainIntake();
+					UpdateMetrics();
+				}
+			}
+		}
+
+		// Moves the nodes pushed by the producers to the list. It must be called with the lock.
+		void DrainIntake()
+		{
+			if (_intake_head.load(std::memory_order_seq_cst) == nullptr)
+			{
+				return;
+			}
+
+			auto head = _intake_head.exchange(nullptr, std::memory_order_acquire);
+
+			// The intake is LIFO, reverse it to keep the order of the producers
+			ManagedQueueNode* tail = head;
+			ManagedQueueNode* first = nullptr;
+			size_t count = 0;
+
+			while (head != nullptr)
+			{
+				auto next = head->next;
+				head->next = first;
+				first = head;
+				head = next;
+				count++;
+			}
+
+			if (_size == 0)
+			{
+				_front_node = first;
+			}
+			else
+			{
+				_rear_node->next = first;
+			}
+
+			_rear_node = tail;
+
+			_size += count;
+			_intake_count.fetch_sub(count, std::memory_order_relaxed);
+
+			// Update the peak statistics, the producers don't update it on the lock-free path
+			if (_peak < _size)
+			{
+				_peak = _size;
+			}
+
+			// Update statistics of input message count
+			_input_message_count += count;
+		}
+
+		// Waits until an item exists. It must be called with the lock.
+		bool WaitForItem(std::unique_lock<std::mutex>& unique_lock, int timeout)
+		{
+			return WaitUntil(unique_lock, timeout, [this]() -> bool {
+				return (_size > 0);
+			});
+		}
+
+		// The front item can be dequeued if it exists and is buffered for the buffering delay. It must be called with the lock.
+		bool IsDequeuable()
+		{
+			if (_size == 0)
+			{
+				return false;
+			}
+
+			if (_buffering_delay == 0)
+			{
+				return true;
+			}
+
+			if (_front_node != nullptr && _front_node->_urgent == true)
+			{
+				return true;
+			}
+
+			return (GetBufferedTimeMsInternal() >= _buffering_delay);
+		}
+
+		// Waits until an item can be dequeued. It must be called with the lock.
+		bool WaitForDequeuableItem(std::unique_lock<std::mutex>& unique_lock, int timeout)
+		{
+			return WaitUntil(unique_lock, timeout, [this]() -> bool {
+				return IsDequeuable();
+			});
+		}
+
+		// Sleeps on the futex without the lock until `is_ready` returns true. It must be called with the lock.
+		// Returns false if it timed out or Stop is requested.
+		template <typename Tfunction>
+		bool WaitUntil(std::unique_lock<std::mutex>& unique_lock, int timeout, const Tfunction& is_ready)
+		{
+			std::chrono::system_clock::time_point expire = (timeout == Infinite) ? std::chrono::system_clock::time_point::max() : std::chrono::system_clock::now() + std::chrono::milliseconds(timeout);
+
+			while (true)
+			{
+				if (_stop)
+				{
+					return false;  // Stop is requested
+				}
+
+				DrainIntake();
+
+				if (is_ready())
+				{
+					return true;
+				}
+
+				if (std::chrono::system_clock::now() >= expire)
+				{
+					return false;  // timed out
+				}
+
+				// If the front item is waiting for the buffering delay, wake up when it is buffered enough
+				auto wake_up_time = expire;
+				if (_size > 0)
+				{
+					auto remaining_ms = std::max(_buffering_delay - GetBufferedTimeMsInternal(), 1);
+					wake_up_time = std::min(wake_up_time, std::chrono::system_clock::now() + std::chrono::milliseconds(remaining_ms));
+				}
+
+				// Read the sequence before publishing _waiting_count, then check the intake again,
+				// so the node pushed by a producer that did not see _waiting_count is not missed.
+				auto sequence = _futex.GetSequence();
+				_waiting_count.fetch_add(1, std::memory_order_seq_cst);
+
+				if ((_intake_head.load(std::memory_order_seq_cst) == nullptr) && (_stop == false))
+				{
+					unique_lock.unlock();
+					_futex.Wait(sequence, wake_up_time);
+					unique_lock.lock();
+				}
+
+				_waiting_count.fetch_sub(1, std::memory_order_seq_cst);
+			}
+		}
+
+		// Pops the front item. It must be called with the lock and the queue must not be empty.
+		T PopFront()
+		{
+			ManagedQueueNode* node = _front_node;
+			_front_node = _front_node->next;
+			if (_front_node == nullptr)
+			{
+				_rear_node = nullptr;
+			}
+
+			T value = std::move(*(node->data));
+
+			_size--;
+
+			// Update statistics of output message count
+			_output_message_count++;
+
+			// Update statistics of waiting time (microseconds)
+			if (node->_start != std::chrono::high_resolution_clock::time_point::min())
+			{
+				auto current = std::chrono::high_resolution_clock::now();
+				_waiting_time_in_us = _waiting_time_in_us * 0.9 + std::chrono::duration_cast<std::chrono::microseconds>(current - node->_start).count() * 0.1;
+			}
+
+			ReleaseNode(node);
+
+			return value;
+		}
 
 		int32_t GetBufferedTimeMsInternal()
 		{
@@ -372,6 +702,9 @@ namespace ov
 				return;
 			}
 
+			// Keep the order of the items pushed to the intake
+			DrainIntake();
+
 			// Update statistics of input message count
 			_input_message_count++;
 
@@ -433,7 +766,7 @@ namespace ov
 
 					_drop_message_count++;
 
-					delete node;
+					ReleaseNode(node);
 
 					_condition.notify_all();
 
@@ -454,7 +787,7 @@ namespace ov
 
 					_drop_message_count++;
 					
-					delete node;
+					ReleaseNode(node);
 
 					_condition.notify_all();
 
@@ -470,12 +803,12 @@ namespace ov
 			{
 				std::chrono::system_clock::time_point expire = (timeout == Infinite) ? std::chrono::system_clock::time_point::max() : std::chrono::system_clock::now() + std::chrono::milliseconds(timeout);
 				auto result = _condition.wait_until(unique_lock, expire, [this]() -> bool {
-					return (_size  < _threshold);
+					return (_size < _threshold) || _stop;
 				});
 				if (!result || _stop)
 				{
 					loge(LOG_TAG, "[%s] queue is full. q.size(%d), q.threshold(%d)", _urn->ToString().CStr(), _size, _threshold);
-					delete node;
+					ReleaseNode(node);
 					return;
 				}
 			}
@@ -491,17 +824,11 @@ namespace ov
 
 			UpdateMetrics();
 
-			if (_buffering_delay == 0)
+			// The consumer increases _waiting_count with the lock, so it is not missed here.
+			// If the buffering delay is set, the consumer wakes up by itself when the front item is buffered enough.
+			if (_waiting_count.load(std::memory_order_seq_cst) > 0)
 			{
-				_condition.notify_all();
-			}
-			else
-			{
-				// If the buffering delay is set, notify the waiting thread when the buffering time is exceeded.
-				if (GetBufferedTimeMsInternal() >= _buffering_delay)
-				{
-					_condition.notify_all();
-				}
+				_futex.WakeAll();
 			}
 		}
 
@@ -624,16 +951,26 @@ namespace ov
 		int _log_interval = 0;
 		int64_t _last_logging_time = 0;
 
-		// Linked list of the queue
+		// Linked list of the queue, owned by the consumer side with the lock
 		ManagedQueueNode* _front_node;
 		ManagedQueueNode* _rear_node;
 
-		// Mutex and condition variable for the queue
+		// Producers push the nodes here without the lock (LIFO), they are moved to the list by DrainIntake()
+		std::atomic<ManagedQueueNode*> _intake_head{nullptr};
+		std::atomic<size_t> _intake_count{0};
+		std::atomic<int64_t> _next_producer_metrics_update_ns{0};
+
+		// Number of the threads waiting for items, producers wake them up only if it is not zero
+		std::atomic<int> _waiting_count{0};
+		// The consumers sleep on it, so the producers on the lock-free path wake them up without the mutex
+		Futex _futex;
+
+		// Mutex for the queue, and the condition variable for the producers waiting for the threshold
 		mutable std::mutex _mutex;
 		std::condition_variable _condition;
 
-		// Stop flag
-		bool _stop;
+		// Stop flag, read by the producers without the lock
+		std::atomic<bool> _stop;
 
 		// Use to print logs when the peak value of the queue is increased.
 		size_t _last_logged_peak = 0;
@@ -648,10 +985,10 @@ namespace ov
 
 		// Prevent exceed threshold. If true, the queue will not exceed the threshold
 		// Wait until the queue falls below the threshold
-		bool _exceed_threshold_and_wait_enabled = false;
+		std::atomic<bool> _exceed_threshold_and_wait_enabled{false};
 
 		// Delay
-		int _buffering_delay = 0;
+		std::atomic<int> _buffering_delay{0};
 	};
 
 }  // namespace ov
\ No newline at end of file
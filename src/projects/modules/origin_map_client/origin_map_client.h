@@ -51,7 +51,8 @@ private:
 	uint16_t _redis_port;
 	ov::String _redis_password;
 
-	ov::DelayQueue _update_timer{"OMapC"};
+	// The Redis commands block, so the timer runs on its own thread
+	ov::DelayQueue _update_timer{"OMapC", ov::DelayQueueThreadMode::Dedicated};
 
 	std::map<ov::String, ov::String> _origin_map;
 	std::map<ov::String, ov::String> _origin_map_candidates;
@@ -61,26 +61,42 @@ bool OvtDepacketizer::ParsePacket()
 			_packet_buffer = _packet_buffer->Subdata(packet_mold->PacketLength());
 		}
 
-		if(packet_mold->PayloadType() == OVT_PAYLOAD_TYPE_MESSAGE_REQUEST || 
-			packet_mold->PayloadType() == OVT_PAYLOAD_TYPE_MESSAGE_RESPONSE)
+		if(_packet_handler != nullptr)
 		{
-			if(AppendMessagePacket(packet_mold) == false)
+			if(_packet_handler(packet_mold) == false)
 			{
 				return false;
 			}
 		}
-		else if(packet_mold->PayloadType() == OVT_PAYLOAD_TYPE_MEDIA_PACKET)
+		else if(AppendPacket(packet_mold) == false)
 		{
-			if(AppendMediaPacket(packet_mold) == false)
-			{
-				return false;
-			}
+			return false;
 		}
 	}
 
 	return true;
 }
 
+bool OvtDepacketizer::AppendPacket(const std::shared_ptr<OvtPacket> &packet)
+{
+	if(packet->PayloadType() == OVT_PAYLOAD_TYPE_MESSAGE_REQUEST || 
+		packet->PayloadType() == OVT_PAYLOAD_TYPE_MESSAGE_RESPONSE)
+	{
+		return AppendMessagePacket(packet);
+	}
+	else if(packet->PayloadType() == OVT_PAYLOAD_TYPE_MEDIA_PACKET)
+	{
+		return AppendMediaPacket(packet);
+	}
+
+	return true;
+}
+
+void OvtDepacketizer::SetPacketHandler(PacketHandler handler)
+{
+	_packet_handler = std::move(handler);
+}
+
 bool OvtDepacketizer::IsAvailableMessage()
 {
 	return !_messages.empty();
@@ -108,6 +124,7 @@ bool OvtDepacketizer::AppendMessagePacket(const std::shared_ptr<OvtPacket> &pack
 
 		auto message = _message_buffer.Clone();
 		_messages.push(message);
+		_queued_bytes += message->GetLength();
 		
 		_message_buffer.Clear();
 	}
@@ -162,6 +179,7 @@ bool OvtDepacketizer::AppendMediaPacket(const std::shared_ptr<OvtPacket> &packet
 		media_packet->SetDuration(duration);
 
 		_media_packets.push(media_packet);
+		_queued_bytes += media_packet->GetDataLength();
 
 		_media_packet_buffer.Clear();
 	}
@@ -178,6 +196,7 @@ const std::shared_ptr<ov::Data> OvtDepacketizer::PopMessage()
 
 	auto message = _messages.front();
 	_messages.pop();
+	_queued_bytes -= message->GetLength();
 
 	return message;
 }
@@ -191,6 +210,11 @@ const std::shared_ptr<MediaPacket> OvtDepacketizer::PopMediaPacket()
 
 	auto media_packet = _media_packets.front();
 	_media_packets.pop();
+	_queued_bytes -= media_packet->GetDataLength();
 
 	return media_packet;
-}
\ No newline at end of file
+}
+size_t OvtDepacketizer::GetBufferedBytes() const
+{
+	return _queued_bytes + _packet_buffer->GetLength() + _message_buffer.GetLength() + _media_packet_buffer.GetLength();
+}
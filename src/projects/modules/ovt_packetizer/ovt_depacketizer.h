@@ -4,6 +4,9 @@
 #pragma once
 
 #include <base/mediarouter/media_buffer.h>
+
+#include <functional>
+
 #include "ovt_packet.h"
 #include "ovt_packetizer_interface.h"
 
@@ -16,14 +19,25 @@ public:
 	OvtDepacketizer();
 	~OvtDepacketizer();
 
+	typedef std::function<bool(const std::shared_ptr<OvtPacket> &packet)> PacketHandler;
+
 	bool AppendPacket(const void *data, size_t length);
 	bool AppendPacket(const std::shared_ptr<const ov::Data> &packet);
+	// Appends a packet that has already been parsed
+	bool AppendPacket(const std::shared_ptr<OvtPacket> &packet);
+
+	// If a handler is set, the parsed packets are passed to the handler instead of being assembled.
+	// Used to demultiplex the packets of several channels that share a connection.
+	void SetPacketHandler(PacketHandler handler);
 
 	bool IsAvailableMessage();
 	bool IsAvailableMediaPacket();
 	const std::shared_ptr<ov::Data> PopMessage();
 	const std::shared_ptr<MediaPacket> PopMediaPacket();
 
+	// Bytes of the packets that have been appended but not popped yet
+	size_t GetBufferedBytes() const;
+
 private:
 	bool ParsePacket();
 	bool AppendMessagePacket(const std::shared_ptr<OvtPacket> &packet);
@@ -36,4 +50,8 @@ private:
 
 	std::queue<std::shared_ptr<ov::Data>>		_messages;
 	std::queue<std::shared_ptr<MediaPacket>>	_media_packets;
+	// Bytes of _messages and _media_packets
+	size_t										_queued_bytes = 0;
+
+	PacketHandler								_packet_handler;
 };
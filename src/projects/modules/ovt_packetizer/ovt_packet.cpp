@@ -12,10 +12,9 @@ OvtPacket::OvtPacket()
 	_session_id		 = 0;
 	_payload_length	 = 0;
 
-	_data			 = std::make_shared<ov::Data>();
-	_data->Reserve(OVT_DEFAULT_MAX_PACKET_SIZE);
-	_data->SetLength(OVT_FIXED_HEADER_SIZE);
-	_buffer	   = _data->GetWritableDataAs<uint8_t>();
+	_header			 = std::make_shared<ov::Data>(OVT_FIXED_HEADER_SIZE);
+	_header->SetLength(OVT_FIXED_HEADER_SIZE);
+	_buffer	   = _header->GetWritableDataAs<uint8_t>();
 
 	_buffer[0] = OVT_VERSION << 6;
 }
@@ -25,7 +24,7 @@ OvtPacket::OvtPacket(const ov::Data &data)
 	Load(data);
 }
 
-OvtPacket::OvtPacket(OvtPacket &src)
+OvtPacket::OvtPacket(const OvtPacket &src)
 {
 	_version			 = OVT_VERSION;
 	_marker				 = src._marker;
@@ -36,9 +35,10 @@ OvtPacket::OvtPacket(OvtPacket &src)
 	_payload_length		 = src._payload_length;
 	_is_packet_available = src._is_packet_available;
 
-	_data				 = src._data->Clone();
-	_data->SetLength(src._data->GetLength());
-	_buffer = _data->GetWritableDataAs<uint8_t>();
+	// Only the header is copied, the payload is immutable
+	_header				 = std::make_shared<ov::Data>(src._header->GetData(), src._header->GetLength());
+	_buffer				 = _header->GetWritableDataAs<uint8_t>();
+	_payload			 = src._payload;
 }
 
 OvtPacket::~OvtPacket()
@@ -63,12 +63,10 @@ bool OvtPacket::LoadHeader(const ov::Data &data)
 		return false;
 	}
 
-	_data.reset();
-
-	_data = std::make_shared<ov::Data>();
-	_data->Reserve(OVT_DEFAULT_MAX_PACKET_SIZE);
-	_data->SetLength(OVT_FIXED_HEADER_SIZE);
-	_buffer = _data->GetWritableDataAs<uint8_t>();
+	_header = std::make_shared<ov::Data>(OVT_FIXED_HEADER_SIZE);
+	_header->SetLength(OVT_FIXED_HEADER_SIZE);
+	_buffer = _header->GetWritableDataAs<uint8_t>();
+	_payload = nullptr;
 
 	_buffer[0] = OVT_VERSION << 6;
 
@@ -175,22 +173,40 @@ uint16_t OvtPacket::PayloadLength() const
 
 const uint8_t *OvtPacket::Payload() const
 {
-	return &_buffer[OVT_FIXED_HEADER_SIZE];
+	return (_payload == nullptr) ? nullptr : _payload->GetDataAs<uint8_t>();
+}
+
+const std::shared_ptr<const ov::Data> OvtPacket::GetHeader() const
+{
+	return _header;
+}
+
+const std::shared_ptr<const ov::Data> &OvtPacket::GetPayload() const
+{
+	return _payload;
 }
 
-const uint8_t *OvtPacket::GetBuffer() const
+std::shared_ptr<ov::Data> OvtPacket::CloneHeader(uint32_t session_id) const
 {
-	return &_buffer[0];
+	auto header = std::make_shared<ov::Data>(_header->GetData(), _header->GetLength());
+	ByteWriter<uint32_t>::WriteBigEndian(header->GetWritableDataAs<uint8_t>() + 12, session_id);
+
+	return header;
 }
 
-const std::shared_ptr<ov::Data> &OvtPacket::GetData() const
+std::vector<std::shared_ptr<const ov::Data>> OvtPacket::GetDataList() const
 {
-	return _data;
+	if (_payload == nullptr)
+	{
+		return {_header};
+	}
+
+	return {_header, _payload};
 }
 
 size_t OvtPacket::GetDataLength() const
 {
-	return _data == nullptr ? 0 : _data->GetLength();
+	return PacketLength();
 }
 
 void OvtPacket::SetMarker(bool marker_bit)
@@ -242,26 +258,32 @@ void OvtPacket::SetPayloadLength(size_t payload_length)
 {
 	_payload_length = payload_length;
 	ByteWriter<uint16_t>::WriteBigEndian(&_buffer[16], _payload_length);
-
-	_data->SetLength(OVT_FIXED_HEADER_SIZE + payload_length);
-	_buffer = _data->GetWritableDataAs<uint8_t>();
 }
 
 bool OvtPacket::SetPayload(const uint8_t *payload, size_t payload_length)
 {
-	if (OVT_FIXED_HEADER_SIZE + payload_length > _data->GetCapacity())
+	if (payload_length == 0)
+	{
+		return SetPayload(nullptr);
+	}
+
+	return SetPayload(std::make_shared<ov::Data>(payload, payload_length));
+}
+
+bool OvtPacket::SetPayload(const std::shared_ptr<const ov::Data> &payload)
+{
+	auto payload_length = (payload == nullptr) ? 0 : payload->GetLength();
+
+	if (OVT_FIXED_HEADER_SIZE + payload_length > OVT_DEFAULT_MAX_PACKET_SIZE)
 	{
-		OV_ASSERT(false, "Data capacity must be greater than %ld (packet : %ld)",
-				  _data->GetCapacity(), OVT_FIXED_HEADER_SIZE + payload_length);
+		OV_ASSERT(false, "Payload is too large: %zu (max packet : %d)",
+				  OVT_FIXED_HEADER_SIZE + payload_length, OVT_DEFAULT_MAX_PACKET_SIZE);
 		return false;
 	}
 
+	_payload = payload;
 	SetPayloadLength(payload_length);
 
-	// OVT_DEFAULT_MAX_PACKET_SIZE
-	//_data->SetLength(_payload_length);
-	memcpy(&_buffer[OVT_FIXED_HEADER_SIZE], payload, payload_length);
-
 	_is_packet_available = true;
 
 	return true;
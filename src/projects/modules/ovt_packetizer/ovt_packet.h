@@ -26,8 +26,11 @@
 // |           Payload Length      |
 // +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
 
-// [SessionID] - Reserved
-// Designed for the purpose of classifying each session when two or more sessions are connected with the same 5tuple in the future. Currently not used because the client connects to the server using a different port.
+// [SessionID] - Channel ID
+// Classifies the sessions that are connected with the same 5tuple.
+// By default, the client connects to the server for each stream and this field is not used.
+// In multiplexed mode, the client opens one connection (link) to the server and subscribes several streams over it.
+// Each stream has a channel id that is unique in the link, and the requests, responses and media packets of the stream carry it in this field.
 
 /***********************************************
  * Protocol Specification
@@ -138,6 +141,33 @@
 			[Binary - Serialized MediaPacket]
 		}
 
+ [2] MULTIPLEXED MODE
+ 	The client adds "channel" to the payload of every request, and sets SI of the request to the channel id.
+ 	The server sets SI of the responses and the media packets of the channel to the channel id.
+ 	Since the connection is shared, the server does not close it when the stream of a channel is stopped,
+ 	but sends a STOP message to the channel instead.
+
+ <C->S>
+ 	SI : 3
+ 	Payload :
+ 		{
+ 			"id": 3921933,
+			"application" : "describe" | "play" | "stop",
+			"channel" : 3,
+ 			"target": "ovt://host:port/app/stream"
+ 		}
+
+ <S->C> (When the stream is stopped)
+ 	PT : MESSAGE RESPONSE(20)
+ 	SI : 3
+ 	Payload :
+		{
+			"id": 0,
+			"application" : "stop",
+			"code" : 200,
+			"message" : "Stream has been stopped"
+		}
+
  **********************************************/
 
 
@@ -153,11 +183,14 @@
 // Using MediaPacket (De)Packetizer
 #define MEDIA_PACKET_HEADER_SIZE			(32+64+64+64+8+8+8+8+32)/8
 
+// The header and the payload are kept in separate buffers.
+// The payload is never modified after it is set, so copies of a packet share it and only the header is copied.
+// This lets each session patch the session id of its own header and send it along with the shared payload.
 class OvtPacket
 {
 public:
 	OvtPacket();
-	OvtPacket(OvtPacket &src);
+	OvtPacket(const OvtPacket &src);
 	OvtPacket(const ov::Data &data);
 	virtual ~OvtPacket();
 
@@ -184,10 +217,18 @@ public:
 	void 		SetTimestamp(uint64_t timestamp);
 	void 		SetSessionId(uint32_t session_id);
 
+	// Copies the payload
 	bool 		SetPayload(const uint8_t *payload, size_t payload_size);
+	// Shares the payload without copying, it must not be modified afterwards
+	bool 		SetPayload(const std::shared_ptr<const ov::Data> &payload);
+
+	const std::shared_ptr<const ov::Data> GetHeader() const;
+	const std::shared_ptr<const ov::Data> &GetPayload() const;
+	// Copy of the header with the session id replaced (the payload can be sent as it is)
+	std::shared_ptr<ov::Data> CloneHeader(uint32_t session_id) const;
 
-	const uint8_t* GetBuffer() const;
-	const std::shared_ptr<ov::Data>& GetData() const;
+	// Header and payload (if any), to be sent with Socket::Send(data_list) without copying the payload
+	std::vector<std::shared_ptr<const ov::Data>> GetDataList() const;
 	size_t GetDataLength() const;
 
 private:
@@ -203,6 +244,8 @@ private:
 	uint32_t 	_session_id;
 	uint16_t 	_payload_length;
 
-	uint8_t *					_buffer;
-	std::shared_ptr<ov::Data>	_data;
+	// Points to the buffer of _header
+	uint8_t *						_buffer;
+	std::shared_ptr<ov::Data>		_header;
+	std::shared_ptr<const ov::Data>	_payload;
 };
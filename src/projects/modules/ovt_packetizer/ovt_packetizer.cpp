@@ -99,12 +99,13 @@ bool OvtPacketizer::PacketizeMediaPacket(uint64_t timestamp, const std::shared_p
 
 	 *********************************************************************/
 
-	ov::Data payload;
+	// The OVT packets refer to parts of this buffer without copying
+	auto payload = std::make_shared<ov::Data>(MEDIA_PACKET_HEADER_SIZE + media_packet->GetDataLength());
 
 	// Header + Data
-	payload.SetLength(MEDIA_PACKET_HEADER_SIZE + media_packet->GetDataLength());
+	payload->SetLength(MEDIA_PACKET_HEADER_SIZE + media_packet->GetDataLength());
 
-	auto buffer = payload.GetWritableDataAs<uint8_t>();
+	auto buffer = payload->GetWritableDataAs<uint8_t>();
 
 	ByteWriter<uint32_t>::WriteBigEndian(&buffer[0], media_packet->GetTrackId());
 	ByteWriter<uint64_t>::WriteBigEndian(&buffer[4], media_packet->GetPts());
@@ -122,7 +123,7 @@ bool OvtPacketizer::PacketizeMediaPacket(uint64_t timestamp, const std::shared_p
 	}
 
 	size_t max_payload_size = OVT_DEFAULT_MAX_PACKET_SIZE - OVT_FIXED_HEADER_SIZE;
-	size_t remain_payload_len = payload.GetLength();
+	size_t remain_payload_len = payload->GetLength();
 	size_t offset = 0;
 
 	while(remain_payload_len != 0)
@@ -137,7 +138,7 @@ bool OvtPacketizer::PacketizeMediaPacket(uint64_t timestamp, const std::shared_p
 
 		if(remain_payload_len > max_payload_size)
 		{
-			packet->SetPayload(&buffer[offset], max_payload_size);
+			packet->SetPayload(payload->Subdata(offset, max_payload_size));
 			offset += max_payload_size;
 			remain_payload_len -= max_payload_size;
 		}
@@ -145,7 +146,7 @@ bool OvtPacketizer::PacketizeMediaPacket(uint64_t timestamp, const std::shared_p
 		{
 			// The last packet of group has marker bit.
 			packet->SetMarker(true);
-			packet->SetPayload(&buffer[offset], remain_payload_len);
+			packet->SetPayload(payload->Subdata(offset, remain_payload_len));
 			remain_payload_len = 0;
 		}
 
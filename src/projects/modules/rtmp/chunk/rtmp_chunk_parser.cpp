@@ -23,7 +23,14 @@ RtmpChunkParser::~RtmpChunkParser()
 
 RtmpChunkParser::ParseResult RtmpChunkParser::Parse(const std::shared_ptr<const ov::Data> &data, size_t *bytes_used)
 {
-	ov::ByteStream stream(data.get());
+	return Parse(data->GetData(), data->GetLength(), bytes_used);
+}
+
+RtmpChunkParser::ParseResult RtmpChunkParser::Parse(const void *data, size_t length, size_t *bytes_used)
+{
+	// Refer to the memory instead of copying it
+	const ov::Data data_view(data, length, true);
+	ov::ByteStream stream(&data_view);
 
 	*bytes_used = 0ULL;
 
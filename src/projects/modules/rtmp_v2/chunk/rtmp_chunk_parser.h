@@ -41,6 +41,8 @@ namespace modules::rtmp
 		virtual ~ChunkParser();
 
 		ParseResult Parse(const std::shared_ptr<const ov::Data> &data, size_t *bytes_used);
+		// Parses a chunk from the memory without wrapping it in ov::Data
+		ParseResult Parse(const void *data, size_t length, size_t *bytes_used);
 
 		std::shared_ptr<const Message> GetMessage();
 		size_t GetMessageCount() const;
@@ -44,7 +44,48 @@ bool NACK::Parse(const RtcpPacket &packet)
 // RtcpInfo must provide raw data
 std::shared_ptr<ov::Data> NACK::GetData() const 
 {
-	return nullptr;
+	if(_lost_ids.empty())
+	{
+		return nullptr;
+	}
+
+	// Pack lost ids into FCIs, a FCI covers PID and the following 16 ids
+	std::vector<std::pair<uint16_t, uint16_t>> fci_list;
+	for(size_t i=0; i<_lost_ids.size(); )
+	{
+		uint16_t pid = _lost_ids[i++];
+		uint16_t blp = 0;
+
+		while(i < _lost_ids.size())
+		{
+			uint16_t diff = _lost_ids[i] - pid;
+			if(diff == 0 || diff > 16)
+			{
+				break;
+			}
+
+			blp |= 1 << (diff - 1);
+			i++;
+		}
+
+		fci_list.emplace_back(pid, blp);
+	}
+
+	std::shared_ptr<ov::Data> nack_message = std::make_shared<ov::Data>();
+	nack_message->SetLength(4 + 4 + (fci_list.size() * 4));
+	ov::ByteStream stream(nack_message.get());
+
+	// Feedback
+	stream.WriteBE32(_src_ssrc);
+	stream.WriteBE32(_media_ssrc);
+
+	for(const auto &[pid, blp] : fci_list)
+	{
+		stream.WriteBE16(pid);
+		stream.WriteBE16(blp);
+	}
+
+	return nack_message;
 }
 
 void NACK::DebugPrint()
@@ -73,6 +73,10 @@ public:
 		return _lost_ids[index];
 	}
 
+	// Lost ids must be in the order of the sequence number to be packed into PID/BLP
+	void AddLostId(uint16_t id){_lost_ids.push_back(id);}
+	void AddLostIds(const std::vector<uint16_t> &ids){_lost_ids.insert(_lost_ids.end(), ids.begin(), ids.end());}
+
 private:
 	uint32_t	_src_ssrc = 0;
 	uint32_t	_media_ssrc = 0;
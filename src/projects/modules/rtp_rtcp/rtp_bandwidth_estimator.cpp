@@ -0,0 +1,456 @@
+#include "rtp_bandwidth_estimator.h"
+
+#include <cinttypes>
+#include <cmath>
+
+#define OV_LOG_TAG "RtpBWE"
+
+// If the delay variation is larger than this, the clock of the receiver may have jumped
+#define RTP_BWE_MAX_DELAY_VARIATION_MS		3000
+
+void RtpBandwidthEstimator::OnTransportFeedback(const std::vector<PacketResult> &packet_results, int64_t now_ms)
+{
+	auto prev_target_bitrate = _target_bitrate;
+
+	if (_record_file != nullptr)
+	{
+		for (const auto &packet : packet_results)
+		{
+			::fprintf(_record_file.get(), "P,%" PRId64 ",%" PRId64 ",%zu\n", packet.send_time_us, packet.arrival_time_us, packet.size);
+		}
+		::fprintf(_record_file.get(), "F,%" PRId64 "\n", now_ms);
+	}
+
+	size_t lost_packets = 0;
+	for (const auto &packet : packet_results)
+	{
+		if (packet.arrival_time_us < 0)
+		{
+			lost_packets++;
+			continue;
+		}
+
+		UpdateAckedBitrate(packet);
+
+		double send_delta_ms = 0.0, arrival_delta_ms = 0.0;
+		int64_t arrival_time_ms = 0;
+		if (ComputeDeltas(packet, send_delta_ms, arrival_delta_ms, arrival_time_ms) == true)
+		{
+			UpdateTrendline(send_delta_ms, arrival_delta_ms, arrival_time_ms, now_ms);
+		}
+	}
+
+	UpdateDelayBasedBitrate(now_ms);
+	UpdateLossBasedBitrate(lost_packets, packet_results.size(), now_ms);
+	UpdateTargetBitrate();
+
+	_decreased = _target_bitrate < prev_target_bitrate;
+}
+
+void RtpBandwidthEstimator::OnRemb(uint64_t bitrate_bps, int64_t now_ms)
+{
+	auto prev_target_bitrate = _target_bitrate;
+
+	if (_record_file != nullptr)
+	{
+		::fprintf(_record_file.get(), "R,%" PRId64 ",%" PRIu64 "\n", now_ms, bitrate_bps);
+	}
+
+	_remb_bitrate = bitrate_bps;
+	UpdateTargetBitrate();
+
+	_decreased = _target_bitrate < prev_target_bitrate;
+}
+
+bool RtpBandwidthEstimator::ComputeDeltas(const PacketResult &packet, double &send_delta_ms, double &arrival_delta_ms, int64_t &arrival_time_ms)
+{
+	if (_current_group.valid == false)
+	{
+		_current_group = PacketGroup{true, packet.send_time_us, packet.send_time_us, packet.arrival_time_us};
+		return false;
+	}
+
+	if (packet.send_time_us < _current_group.first_send_time_us)
+	{
+		// Belongs to the previous group
+		return false;
+	}
+
+	if (packet.send_time_us - _current_group.first_send_time_us <= RTP_BWE_BURST_TIME_MS * 1000)
+	{
+		// Same burst
+		_current_group.last_send_time_us = std::max(_current_group.last_send_time_us, packet.send_time_us);
+		_current_group.last_arrival_time_us = std::max(_current_group.last_arrival_time_us, packet.arrival_time_us);
+		return false;
+	}
+
+	// A new group is started, the deltas of the completed group are computed
+	bool computed = false;
+	if (_prev_group.valid == true)
+	{
+		send_delta_ms = static_cast<double>(_current_group.last_send_time_us - _prev_group.last_send_time_us) / 1000.0;
+		arrival_delta_ms = static_cast<double>(_current_group.last_arrival_time_us - _prev_group.last_arrival_time_us) / 1000.0;
+		arrival_time_ms = _current_group.last_arrival_time_us / 1000;
+		computed = true;
+
+		if (std::abs(arrival_delta_ms - send_delta_ms) > RTP_BWE_MAX_DELAY_VARIATION_MS)
+		{
+			logtd("Delay variation(%.2f ms) is too large, the trendline is reset", arrival_delta_ms - send_delta_ms);
+
+			_first_arrival_time_ms = -1;
+			_accumulated_delay_ms = 0.0;
+			_smoothed_delay_ms = 0.0;
+			_num_of_deltas = 0;
+			_delay_history.clear();
+			_trend = 0.0;
+			computed = false;
+		}
+	}
+
+	_prev_group = _current_group;
+	_current_group = PacketGroup{true, packet.send_time_us, packet.send_time_us, packet.arrival_time_us};
+
+	return computed;
+}
+
+void RtpBandwidthEstimator::UpdateTrendline(double send_delta_ms, double arrival_delta_ms, int64_t arrival_time_ms, int64_t now_ms)
+{
+	auto delta_ms = arrival_delta_ms - send_delta_ms;
+
+	_num_of_deltas = std::min<uint32_t>(_num_of_deltas + 1, 1000);
+	if (_first_arrival_time_ms < 0)
+	{
+		_first_arrival_time_ms = arrival_time_ms;
+	}
+
+	_accumulated_delay_ms += delta_ms;
+	_smoothed_delay_ms = RTP_BWE_TRENDLINE_SMOOTHING_COEFF * _smoothed_delay_ms + (1 - RTP_BWE_TRENDLINE_SMOOTHING_COEFF) * _accumulated_delay_ms;
+
+	_delay_history.emplace_back(static_cast<double>(arrival_time_ms - _first_arrival_time_ms), _smoothed_delay_ms);
+	if (_delay_history.size() > RTP_BWE_TRENDLINE_WINDOW_SIZE)
+	{
+		_delay_history.pop_front();
+	}
+
+	if (_delay_history.size() == RTP_BWE_TRENDLINE_WINDOW_SIZE)
+	{
+		_trend = LinearFitSlope();
+	}
+
+	Detect(_trend, send_delta_ms, now_ms);
+}
+
+// Slope of the least squares line of the delay history
+double RtpBandwidthEstimator::LinearFitSlope() const
+{
+	double sum_x = 0, sum_y = 0;
+	for (const auto &[x, y] : _delay_history)
+	{
+		sum_x += x;
+		sum_y += y;
+	}
+
+	auto avg_x = sum_x / _delay_history.size();
+	auto avg_y = sum_y / _delay_history.size();
+
+	double numerator = 0, denominator = 0;
+	for (const auto &[x, y] : _delay_history)
+	{
+		numerator += (x - avg_x) * (y - avg_y);
+		denominator += (x - avg_x) * (x - avg_x);
+	}
+
+	if (denominator == 0)
+	{
+		return _trend;
+	}
+
+	return numerator / denominator;
+}
+
+void RtpBandwidthEstimator::Detect(double trend, double send_delta_ms, int64_t now_ms)
+{
+	if (_num_of_deltas < 2)
+	{
+		_bandwidth_usage = BandwidthUsage::Normal;
+		return;
+	}
+
+	auto modified_trend = std::min<uint32_t>(_num_of_deltas, 60) * trend * RTP_BWE_TRENDLINE_THRESHOLD_GAIN;
+
+	if (modified_trend > _threshold)
+	{
+		if (_time_over_using_ms < 0)
+		{
+			// Assume that the overuse started in the middle of the last group
+			_time_over_using_ms = send_delta_ms / 2;
+		}
+		else
+		{
+			_time_over_using_ms += send_delta_ms;
+		}
+
+		_overuse_counter++;
+
+		if (_time_over_using_ms > RTP_BWE_OVERUSE_TIME_THRESHOLD_MS && _overuse_counter > 1 && trend >= _prev_trend)
+		{
+			if (_bandwidth_usage != BandwidthUsage::Overusing)
+			{
+				_overuse_count++;
+				logtd("Overuse detected - trend(%.4f) modified trend(%.2f) threshold(%.2f)", trend, modified_trend, _threshold);
+			}
+
+			_time_over_using_ms = 0;
+			_overuse_counter = 0;
+			_bandwidth_usage = BandwidthUsage::Overusing;
+		}
+	}
+	else if (modified_trend < -_threshold)
+	{
+		_time_over_using_ms = -1;
+		_overuse_counter = 0;
+		_bandwidth_usage = BandwidthUsage::Underusing;
+	}
+	else
+	{
+		_time_over_using_ms = -1;
+		_overuse_counter = 0;
+		_bandwidth_usage = BandwidthUsage::Normal;
+	}
+
+	_prev_trend = trend;
+
+	UpdateThreshold(modified_trend, now_ms);
+}
+
+void RtpBandwidthEstimator::UpdateThreshold(double modified_trend, int64_t now_ms)
+{
+	if (_last_threshold_update_ms < 0)
+	{
+		_last_threshold_update_ms = now_ms;
+	}
+
+	// Do not adapt to a spike, it is likely to be a sudden change of the network
+	if (std::abs(modified_trend) > _threshold + 15.0)
+	{
+		_last_threshold_update_ms = now_ms;
+		return;
+	}
+
+	auto k = std::abs(modified_trend) < _threshold ? RTP_BWE_THRESHOLD_K_DOWN : RTP_BWE_THRESHOLD_K_UP;
+	auto time_delta_ms = std::min<int64_t>(now_ms - _last_threshold_update_ms, 100);
+
+	_threshold += k * (std::abs(modified_trend) - _threshold) * time_delta_ms;
+	_threshold = std::clamp(_threshold, 6.0, 600.0);
+
+	_last_threshold_update_ms = now_ms;
+}
+
+void RtpBandwidthEstimator::UpdateAckedBitrate(const PacketResult &packet)
+{
+	auto arrival_time_ms = packet.arrival_time_us / 1000;
+
+	_acked_packets.emplace_back(arrival_time_ms, packet.size);
+	_acked_bytes_in_window += packet.size;
+
+	while (_acked_packets.empty() == false && _acked_packets.front().first < arrival_time_ms - RTP_BWE_ACKED_BITRATE_WINDOW_MS)
+	{
+		_acked_bytes_in_window -= _acked_packets.front().second;
+		_acked_packets.pop_front();
+	}
+
+	auto window_ms = arrival_time_ms - _acked_packets.front().first;
+	if (window_ms >= RTP_BWE_ACKED_BITRATE_WINDOW_MS / 2)
+	{
+		_acked_bitrate = _acked_bytes_in_window * 8 * 1000 / window_ms;
+	}
+}
+
+void RtpBandwidthEstimator::UpdateDelayBasedBitrate(int64_t now_ms)
+{
+	if (_acked_bitrate == 0)
+	{
+		return;
+	}
+
+	if (_delay_based_bitrate == 0)
+	{
+		// Start from what the receiver actually gets
+		_delay_based_bitrate = std::clamp<uint64_t>(_acked_bitrate, RTP_BWE_MIN_BITRATE, RTP_BWE_MAX_BITRATE);
+		_last_change_ms = now_ms;
+		return;
+	}
+
+	auto elapsed_ms = std::min<int64_t>(now_ms - _last_change_ms, 1000);
+	_last_change_ms = now_ms;
+
+	auto bitrate = _delay_based_bitrate;
+
+	switch (_bandwidth_usage)
+	{
+		case BandwidthUsage::Overusing:
+			if (_last_decrease_ms < 0 || now_ms - _last_decrease_ms >= RTP_BWE_DECREASE_INTERVAL_MS)
+			{
+				// The acknowledged bitrate is what the link can carry now
+				auto decreased_bitrate = static_cast<uint64_t>(_acked_bitrate * RTP_BWE_DECREASE_FACTOR);
+				if (decreased_bitrate < bitrate)
+				{
+					bitrate = decreased_bitrate;
+					_decrease_count++;
+				}
+
+				_link_capacity = _acked_bitrate;
+				_last_decrease_ms = now_ms;
+			}
+			break;
+
+		case BandwidthUsage::Underusing:
+			// The queues are being drained, hold the bitrate
+			break;
+
+		case BandwidthUsage::Normal:
+			if (elapsed_ms <= 0)
+			{
+				break;
+			}
+
+			if (_link_capacity > 0 && _acked_bitrate > _link_capacity * 1.5)
+			{
+				// The link capacity has grown
+				_link_capacity = 0;
+			}
+
+			if (_link_capacity > 0 && bitrate >= _link_capacity * 0.9)
+			{
+				bitrate += RTP_BWE_ADDITIVE_INCREASE_BPS * elapsed_ms / 1000;
+			}
+			else
+			{
+				bitrate = static_cast<uint64_t>(bitrate * std::pow(RTP_BWE_MULTIPLICATIVE_INCREASE, elapsed_ms / 1000.0));
+			}
+
+			// Not increased beyond what has been proven
+			bitrate = std::min<uint64_t>(bitrate, std::max<uint64_t>(_delay_based_bitrate, _acked_bitrate * RTP_BWE_MAX_ACKED_BITRATE_RATIO));
+			break;
+	}
+
+	_delay_based_bitrate = std::clamp<uint64_t>(bitrate, RTP_BWE_MIN_BITRATE, RTP_BWE_MAX_BITRATE);
+}
+
+void RtpBandwidthEstimator::UpdateLossBasedBitrate(size_t lost_packets, size_t total_packets, int64_t now_ms)
+{
+	_lost_packets_since_loss_update += lost_packets;
+	_packets_since_loss_update += total_packets;
+
+	if (_packets_since_loss_update < RTP_BWE_LOSS_MIN_PACKETS)
+	{
+		return;
+	}
+
+	auto elapsed_ms = _last_loss_update_ms < 0 ? 0 : std::min<int64_t>(now_ms - _last_loss_update_ms, 1000);
+	_last_loss_update_ms = now_ms;
+
+	_loss_ratio = static_cast<double>(_lost_packets_since_loss_update) / _packets_since_loss_update;
+	_lost_packets_since_loss_update = 0;
+	_packets_since_loss_update = 0;
+
+	if (_loss_ratio > RTP_BWE_HIGH_LOSS_RATIO)
+	{
+		if (_last_loss_decrease_ms >= 0 && now_ms - _last_loss_decrease_ms < RTP_BWE_DECREASE_INTERVAL_MS)
+		{
+			return;
+		}
+
+		auto bitrate = _loss_based_bitrate.value_or(_target_bitrate > 0 ? _target_bitrate : _acked_bitrate);
+		if (bitrate == 0)
+		{
+			return;
+		}
+
+		_loss_based_bitrate = std::max<uint64_t>(static_cast<uint64_t>(bitrate * (1.0 - 0.5 * _loss_ratio)), RTP_BWE_MIN_BITRATE);
+		_last_loss_decrease_ms = now_ms;
+		_decrease_count++;
+
+		logtd("High loss(%.3f), loss based bitrate is decreased to %llu", _loss_ratio, _loss_based_bitrate.value());
+	}
+	else if (_loss_ratio < RTP_BWE_LOW_LOSS_RATIO && _loss_based_bitrate.has_value())
+	{
+		_loss_based_bitrate = static_cast<uint64_t>(_loss_based_bitrate.value() * std::pow(RTP_BWE_MULTIPLICATIVE_INCREASE, elapsed_ms / 1000.0));
+
+		if (_delay_based_bitrate > 0 && _loss_based_bitrate.value() >= _delay_based_bitrate)
+		{
+			// No longer limits the target bitrate
+			_loss_based_bitrate.reset();
+		}
+	}
+}
+
+void RtpBandwidthEstimator::UpdateTargetBitrate()
+{
+	uint64_t bitrate = _delay_based_bitrate;
+
+	if (_remb_bitrate.has_value())
+	{
+		// REMB only, if the transport-cc feedback is not used
+		bitrate = (bitrate == 0) ? _remb_bitrate.value() : std::min(bitrate, _remb_bitrate.value());
+	}
+
+	if (bitrate > 0 && _loss_based_bitrate.has_value())
+	{
+		bitrate = std::min(bitrate, _loss_based_bitrate.value());
+	}
+
+	if (bitrate > 0)
+	{
+		bitrate = std::clamp<uint64_t>(bitrate, RTP_BWE_MIN_BITRATE, RTP_BWE_MAX_BITRATE);
+	}
+
+	_target_bitrate = bitrate;
+}
+
+uint64_t RtpBandwidthEstimator::GetTargetBitrate() const
+{
+	return _target_bitrate;
+}
+
+RtpBandwidthEstimator::BandwidthUsage RtpBandwidthEstimator::GetBandwidthUsage() const
+{
+	return _bandwidth_usage;
+}
+
+bool RtpBandwidthEstimator::IsDecreased() const
+{
+	return _decreased;
+}
+
+RtpBandwidthEstimator::Stats RtpBandwidthEstimator::GetStats() const
+{
+	Stats stats;
+
+	stats.target_bitrate = _target_bitrate;
+	stats.acked_bitrate = _acked_bitrate;
+	stats.remb_bitrate = _remb_bitrate.value_or(0);
+	stats.trend = _trend;
+	stats.threshold = _threshold;
+	stats.loss_ratio = _loss_ratio;
+	stats.overuse_count = _overuse_count;
+	stats.decrease_count = _decrease_count;
+
+	return stats;
+}
+
+bool RtpBandwidthEstimator::StartRecording(const ov::String &file_path)
+{
+	FILE *file = ::fopen(file_path.CStr(), "w");
+	if (file == nullptr)
+	{
+		logte("Could not open %s to record the feedback: %s", file_path.CStr(), ov::Error::CreateErrorFromErrno()->What());
+		return false;
+	}
+
+	_record_file = std::shared_ptr<FILE>(file, [](FILE *file) {
+		::fclose(file);
+	});
+
+	return true;
+}
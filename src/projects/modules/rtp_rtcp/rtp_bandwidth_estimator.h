@@ -0,0 +1,172 @@
+#pragma once
+
+#include "base/ovlibrary/ovlibrary.h"
+#include <deque>
+
+#define RTP_BWE_MIN_BITRATE					(100 * 1000)
+#define RTP_BWE_MAX_BITRATE					(100 * 1000 * 1000)
+
+// Packets sent within this time are grouped as a burst (e.g. packets of a frame)
+#define RTP_BWE_BURST_TIME_MS				5
+// Trendline
+#define RTP_BWE_TRENDLINE_WINDOW_SIZE		20
+#define RTP_BWE_TRENDLINE_SMOOTHING_COEFF	0.9
+#define RTP_BWE_TRENDLINE_THRESHOLD_GAIN	4.0
+// Overuse detector (adaptive threshold)
+#define RTP_BWE_OVERUSE_TIME_THRESHOLD_MS	10
+#define RTP_BWE_INITIAL_DELAY_THRESHOLD		12.5
+#define RTP_BWE_THRESHOLD_K_UP				0.0087
+#define RTP_BWE_THRESHOLD_K_DOWN			0.039
+// AIMD rate control
+#define RTP_BWE_DECREASE_FACTOR				0.85
+#define RTP_BWE_DECREASE_INTERVAL_MS		200
+#define RTP_BWE_MULTIPLICATIVE_INCREASE		1.08	// per second
+#define RTP_BWE_ADDITIVE_INCREASE_BPS		50000	// per second, when the estimate is close to the link capacity
+// The estimate is not increased beyond the acknowledged bitrate * this ratio, since it has not been proven
+#define RTP_BWE_MAX_ACKED_BITRATE_RATIO		2.5
+#define RTP_BWE_ACKED_BITRATE_WINDOW_MS		500
+// Loss based control
+#define RTP_BWE_LOW_LOSS_RATIO				0.02
+#define RTP_BWE_HIGH_LOSS_RATIO				0.1
+// The loss ratio is computed over at least this number of packets (a feedback may carry only a few packets)
+#define RTP_BWE_LOSS_MIN_PACKETS			20
+
+// Sender side bandwidth estimator similar to Google Congestion Control (draft-ietf-rmcat-gcc).
+//
+// The delay based controller finds the trend of the one-way delay variation of packet groups from transport-cc feedback,
+// detects overuse with an adaptive threshold and controls the target bitrate with AIMD.
+// The loss based controller and REMB limit the target bitrate from above.
+//
+// It does not read the clock, the caller passes the current time so that the recorded feedback can be replayed deterministically.
+// RtpBandwidthEstimator is not thread-safe.
+//
+// The input can be recorded to a CSV file with StartRecording() and replayed with src/tests/bench/rtp_bandwidth_estimator_bench.
+//   P,<send time us>,<arrival time us or -1>,<size>	a packet result of a transport-cc feedback
+//   F,<now ms>											the end of a transport-cc feedback (the P lines before it)
+//   R,<now ms>,<bitrate bps>							a REMB
+class RtpBandwidthEstimator
+{
+public:
+	enum class BandwidthUsage : uint8_t
+	{
+		Normal,
+		Overusing,
+		Underusing
+	};
+
+	struct PacketResult
+	{
+		int64_t send_time_us = 0;
+		// Negative if the packet is reported as lost
+		int64_t arrival_time_us = -1;
+		size_t size = 0;
+	};
+
+	struct Stats
+	{
+		uint64_t target_bitrate = 0;
+		uint64_t acked_bitrate = 0;
+		uint64_t remb_bitrate = 0;
+		double trend = 0.0;
+		double threshold = RTP_BWE_INITIAL_DELAY_THRESHOLD;
+		double loss_ratio = 0.0;
+		uint64_t overuse_count = 0;
+		uint64_t decrease_count = 0;
+
+		ov::String ToString() const
+		{
+			return ov::String::FormatString("target(%llu) acked(%llu) remb(%llu) trend(%.4f) threshold(%.2f) loss(%.3f) overuse(%llu) decrease(%llu)",
+											target_bitrate, acked_bitrate, remb_bitrate, trend, threshold, loss_ratio, overuse_count, decrease_count);
+		}
+	};
+
+	// Packet results must be in the order of the transport-wide sequence number
+	void OnTransportFeedback(const std::vector<PacketResult> &packet_results, int64_t now_ms);
+	void OnRemb(uint64_t bitrate_bps, int64_t now_ms);
+
+	// 0 until the bandwidth is estimated
+	uint64_t GetTargetBitrate() const;
+	BandwidthUsage GetBandwidthUsage() const;
+	// true if the target bitrate was decreased by the last feedback
+	bool IsDecreased() const;
+
+	Stats GetStats() const;
+
+	// Appends every feedback passed to the estimator to the file
+	bool StartRecording(const ov::String &file_path);
+
+private:
+	struct PacketGroup
+	{
+		bool valid = false;
+		int64_t first_send_time_us = 0;
+		int64_t last_send_time_us = 0;
+		int64_t last_arrival_time_us = 0;
+	};
+
+	// Inter-arrival
+	bool ComputeDeltas(const PacketResult &packet, double &send_delta_ms, double &arrival_delta_ms, int64_t &arrival_time_ms);
+	// Trendline
+	void UpdateTrendline(double send_delta_ms, double arrival_delta_ms, int64_t arrival_time_ms, int64_t now_ms);
+	double LinearFitSlope() const;
+	// Overuse detector
+	void Detect(double trend, double send_delta_ms, int64_t now_ms);
+	void UpdateThreshold(double modified_trend, int64_t now_ms);
+	// Acknowledged bitrate
+	void UpdateAckedBitrate(const PacketResult &packet);
+	// Rate control
+	void UpdateDelayBasedBitrate(int64_t now_ms);
+	void UpdateLossBasedBitrate(size_t lost_packets, size_t total_packets, int64_t now_ms);
+	void UpdateTargetBitrate();
+
+	// Inter-arrival
+	PacketGroup _current_group;
+	PacketGroup _prev_group;
+
+	// Trendline
+	int64_t _first_arrival_time_ms = -1;
+	double _accumulated_delay_ms = 0.0;
+	double _smoothed_delay_ms = 0.0;
+	uint32_t _num_of_deltas = 0;
+	// (arrival time, smoothed delay)
+	std::deque<std::pair<double, double>> _delay_history;
+	double _trend = 0.0;
+	double _prev_trend = 0.0;
+
+	// Overuse detector
+	double _threshold = RTP_BWE_INITIAL_DELAY_THRESHOLD;
+	int64_t _last_threshold_update_ms = -1;
+	double _time_over_using_ms = -1;
+	uint32_t _overuse_counter = 0;
+	BandwidthUsage _bandwidth_usage = BandwidthUsage::Normal;
+
+	// Acknowledged bitrate
+	// (arrival time, size)
+	std::deque<std::pair<int64_t, size_t>> _acked_packets;
+	size_t _acked_bytes_in_window = 0;
+	uint64_t _acked_bitrate = 0;
+
+	// Rate control
+	uint64_t _delay_based_bitrate = 0;
+	// Acknowledged bitrate at the last overuse, the estimate increases slowly around it
+	uint64_t _link_capacity = 0;
+	int64_t _last_change_ms = -1;
+	int64_t _last_decrease_ms = -1;
+
+	std::optional<uint64_t> _loss_based_bitrate;
+	int64_t _last_loss_update_ms = -1;
+	int64_t _last_loss_decrease_ms = -1;
+	size_t _lost_packets_since_loss_update = 0;
+	size_t _packets_since_loss_update = 0;
+	double _loss_ratio = 0.0;
+
+	std::optional<uint64_t> _remb_bitrate;
+
+	uint64_t _target_bitrate = 0;
+	bool _decreased = false;
+
+	uint64_t _overuse_count = 0;
+	uint64_t _decrease_count = 0;
+
+	std::shared_ptr<FILE> _record_file;
+};
@@ -197,10 +197,27 @@ uint64_t RtpFrameJitterBuffer::GetExtentedTimestamp(uint32_t timestamp)
 	return (static_cast<uint64_t>(_timestamp_cycle) << 32) | timestamp;
 }
 
+void RtpFrameJitterBuffer::SetMaxWaitingTimeForLostPackets(uint64_t max_waiting_time_ms)
+{
+	_max_waiting_time_ms = max_waiting_time_ms;
+}
+
 bool RtpFrameJitterBuffer::InsertPacket(const std::shared_ptr<RtpPacket> &packet)
 {
+	if (_max_waiting_time_ms > 0 && packet->PayloadSize() == 0)
+	{
+		// Padding only packet for BWE, it is not a part of any frame and would hold the frames until it expires
+		return true;
+	}
+
 	auto timestamp = GetExtentedTimestamp(packet->Timestamp());
 
+	if (_max_waiting_time_ms > 0 && _last_popped_timestamp.has_value() && timestamp <= _last_popped_timestamp.value())
+	{
+		logtd("Packet arrived too late - timestamp(%u) seq(%u)", packet->Timestamp(), packet->SequenceNumber());
+		return false;
+	}
+
 	auto it = _rtp_frames.find(timestamp);
 	std::shared_ptr<RtpFrame> frame;
 
@@ -248,6 +265,12 @@ void RtpFrameJitterBuffer::BurnOutExpiredFrames()
 	while (it != completed_frame_it)
 	{
 		auto frame = it->second;
+		if (_max_waiting_time_ms > 0 && frame->GetElapsed() < _max_waiting_time_ms)
+		{
+			// Lost packets of the frame may be retransmitted
+			break;
+		}
+
 		logtd("Frame discarded (It may be PADDING frame for BWE) - timestamp(%u) packets(%d) marked(%s)", frame->Timestamp(), frame->PacketCount(), frame->IsMarked() ? "true" : "false");
 		it = _rtp_frames.erase(it);
 	}
@@ -279,6 +302,8 @@ std::shared_ptr<RtpFrame> RtpFrameJitterBuffer::PopAvailableFrame()
 
 	logtd("Pop frame - extended(%llu) timestamp(%u) packets(%d) frames(%u)", it->first, frame->Timestamp(), frame->PacketCount(), _rtp_frames.size());
 
+	_last_popped_timestamp = it->first;
+
 	// remove front frame
 	_rtp_frames.erase(it);
 
@@ -54,6 +54,10 @@ public:
 	bool InsertPacket(const std::shared_ptr<RtpPacket> &packet);
 	bool HasAvailableFrame();
 	std::shared_ptr<RtpFrame> PopAvailableFrame();
+
+	// If it is set, an incomplete frame is held until this time has passed to wait for the retransmission of the lost packets.
+	// 0 (default) discards the incomplete frames as soon as a following frame is completed.
+	void SetMaxWaitingTimeForLostPackets(uint64_t max_waiting_time_ms);
 	
 private:	
 	void BurnOutExpiredFrames();
@@ -66,4 +70,8 @@ private:
 	// timestamp : RtpFrameInfo
 	// it should be ordered, so use std::map
 	std::map<uint64_t, std::shared_ptr<RtpFrame>> _rtp_frames;
+
+	uint64_t _max_waiting_time_ms = 0;
+	// While waiting for the lost packets, frames older than the last popped frame are discarded (e.g. retransmitted packets that arrived too late)
+	std::optional<uint64_t> _last_popped_timestamp;
 };
\ No newline at end of file
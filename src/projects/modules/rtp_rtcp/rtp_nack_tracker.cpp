@@ -0,0 +1,161 @@
+#include "rtp_nack_tracker.h"
+
+#define OV_LOG_TAG "RtpNackTracker"
+
+int64_t RtpNackTracker::Unwrap(uint16_t sequence_number) const
+{
+	auto diff = static_cast<int16_t>(sequence_number - static_cast<uint16_t>(_highest_sequence_number));
+	return _highest_sequence_number + diff;
+}
+
+void RtpNackTracker::OnPacketReceived(uint16_t sequence_number)
+{
+	if (_first_packet == true)
+	{
+		_first_packet = false;
+		_highest_sequence_number = sequence_number;
+		return;
+	}
+
+	auto extended_sequence_number = Unwrap(sequence_number);
+
+	if (extended_sequence_number <= _highest_sequence_number)
+	{
+		// Reordered (or duplicated) packet, it is not lost
+		auto it = _lost_packets.find(extended_sequence_number);
+		if (it != _lost_packets.end())
+		{
+			OnRecovered(it, false);
+		}
+		return;
+	}
+
+	auto gap = extended_sequence_number - _highest_sequence_number - 1;
+	if (gap > RTP_NACK_MAX_LIST_SIZE)
+	{
+		// The sender may have restarted the stream, it is pointless to request them
+		logtw("Too many packets are lost (%lld packets, %lld -> %lld), NACK list is reset", gap, _highest_sequence_number, extended_sequence_number);
+
+		_stats.lost_packets += gap;
+		_stats.unrecovered_packets += gap + _lost_packets.size();
+		_lost_packets.clear();
+	}
+	else if (gap > 0)
+	{
+		auto now = std::chrono::steady_clock::now();
+
+		for (auto lost = _highest_sequence_number + 1; lost < extended_sequence_number; lost++)
+		{
+			_lost_packets.emplace(lost, LostPacket{now, now, 0});
+		}
+
+		_stats.lost_packets += gap;
+		_new_loss_detected = true;
+
+		while (_lost_packets.size() > RTP_NACK_MAX_LIST_SIZE)
+		{
+			_stats.unrecovered_packets++;
+			_lost_packets.erase(_lost_packets.begin());
+		}
+	}
+
+	_highest_sequence_number = extended_sequence_number;
+}
+
+void RtpNackTracker::OnRetransmittedPacketReceived(uint16_t sequence_number)
+{
+	if (_first_packet == true)
+	{
+		return;
+	}
+
+	auto it = _lost_packets.find(Unwrap(sequence_number));
+	if (it == _lost_packets.end())
+	{
+		// Already received or given up
+		return;
+	}
+
+	OnRecovered(it, true);
+}
+
+void RtpNackTracker::OnRecovered(std::map<int64_t, LostPacket>::iterator it, bool retransmitted)
+{
+	auto &lost_packet = it->second;
+
+	// The RTT is sampled only from the packets requested once, otherwise it is not known which request was answered
+	if (retransmitted == true && lost_packet.retries == 1)
+	{
+		auto rtt_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - lost_packet.last_requested_time).count();
+		_rtt_ms = (_rtt_ms * 7 + rtt_ms) / 8;
+		_stats.rtt_ms = _rtt_ms;
+	}
+
+	if (lost_packet.retries > 0)
+	{
+		_stats.recovered_packets++;
+	}
+
+	_lost_packets.erase(it);
+}
+
+std::vector<uint16_t> RtpNackTracker::GetNackList()
+{
+	std::vector<uint16_t> nack_list;
+
+	if (_lost_packets.empty())
+	{
+		return nack_list;
+	}
+
+	auto now = std::chrono::steady_clock::now();
+	if (_new_loss_detected == false && std::chrono::duration_cast<std::chrono::milliseconds>(now - _last_scan_time).count() < RTP_NACK_SCAN_CYCLE_MS)
+	{
+		return nack_list;
+	}
+
+	_new_loss_detected = false;
+	_last_scan_time = now;
+
+	auto retry_interval_ms = std::max<int64_t>(_rtt_ms, RTP_NACK_MIN_RETRY_INTERVAL_MS);
+
+	auto it = _lost_packets.begin();
+	while (it != _lost_packets.end())
+	{
+		auto &lost_packet = it->second;
+
+		auto waiting_time_ms = std::chrono::duration_cast<std::chrono::milliseconds>(now - lost_packet.detected_time).count();
+		if (waiting_time_ms > RTP_NACK_MAX_WAITING_TIME_MS || lost_packet.retries >= RTP_NACK_MAX_RETRIES)
+		{
+			logtd("Give up requesting the lost packet - seq(%u) retries(%u) waiting(%lld ms)", static_cast<uint16_t>(it->first), lost_packet.retries, waiting_time_ms);
+
+			_stats.unrecovered_packets++;
+			it = _lost_packets.erase(it);
+			continue;
+		}
+
+		if (nack_list.size() < RTP_NACK_MAX_IDS_PER_REQUEST &&
+			(lost_packet.retries == 0 || std::chrono::duration_cast<std::chrono::milliseconds>(now - lost_packet.last_requested_time).count() >= retry_interval_ms))
+		{
+			nack_list.push_back(static_cast<uint16_t>(it->first));
+
+			lost_packet.retries++;
+			lost_packet.last_requested_time = now;
+		}
+
+		++it;
+	}
+
+	if (nack_list.empty() == false)
+	{
+		_stats.nack_requests++;
+		_stats.requested_packets += nack_list.size();
+	}
+
+	return nack_list;
+}
+
+RtpNackTracker::Stats RtpNackTracker::GetStats() const
+{
+	return _stats;
+}
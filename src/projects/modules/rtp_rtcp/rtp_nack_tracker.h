@@ -0,0 +1,72 @@
+#pragma once
+
+#include "base/ovlibrary/ovlibrary.h"
+#include <map>
+
+// A lost packet that is not received within this time is given up (it is also the maximum time the jitter buffer waits for it)
+#define RTP_NACK_MAX_WAITING_TIME_MS	300
+#define RTP_NACK_MAX_RETRIES			10
+// Used until the RTT is measured by the retransmitted packets
+#define RTP_NACK_DEFAULT_RTT_MS			100
+#define RTP_NACK_MIN_RETRY_INTERVAL_MS	10
+#define RTP_NACK_MAX_LIST_SIZE			1000
+// A NACK packet can hold up to (RTCP_DEFAULT_MAX_PACKET_SIZE - 12) / 4 FCIs, requests are limited well below that
+#define RTP_NACK_MAX_IDS_PER_REQUEST	256
+#define RTP_NACK_SCAN_CYCLE_MS			10
+
+// Tracks the sequence numbers of a received RTP stream and decides which packets should be requested by NACK (RFC 4585).
+// A lost packet is requested again after an RTT has passed without the retransmission, until it is received or given up.
+class RtpNackTracker
+{
+public:
+	struct Stats
+	{
+		uint64_t lost_packets = 0;
+		uint64_t nack_requests = 0;
+		uint64_t requested_packets = 0;
+		uint64_t recovered_packets = 0;
+		uint64_t unrecovered_packets = 0;
+		int64_t rtt_ms = RTP_NACK_DEFAULT_RTT_MS;
+
+		ov::String ToString() const
+		{
+			return ov::String::FormatString("lost(%llu) nack requests(%llu) requested packets(%llu) recovered(%llu) unrecovered(%llu) rtt(%lld ms)",
+											lost_packets, nack_requests, requested_packets, recovered_packets, unrecovered_packets, rtt_ms);
+		}
+	};
+
+	// Called for every packet received on the media SSRC
+	void OnPacketReceived(uint16_t sequence_number);
+	// Called for the packet restored from RTX
+	void OnRetransmittedPacketReceived(uint16_t sequence_number);
+
+	// Returns the sequence numbers to be requested now in ascending order, it is empty if nothing needs to be requested
+	std::vector<uint16_t> GetNackList();
+
+	Stats GetStats() const;
+
+private:
+	struct LostPacket
+	{
+		std::chrono::steady_clock::time_point detected_time;
+		std::chrono::steady_clock::time_point last_requested_time;
+		uint32_t retries = 0;
+	};
+
+	int64_t Unwrap(uint16_t sequence_number) const;
+	void OnRecovered(std::map<int64_t, LostPacket>::iterator it, bool retransmitted);
+
+	bool _first_packet = true;
+	// Highest extended sequence number received
+	int64_t _highest_sequence_number = 0;
+
+	// Extended sequence number : LostPacket
+	std::map<int64_t, LostPacket> _lost_packets;
+	// true when a new loss is detected after the last scan
+	bool _new_loss_detected = false;
+	std::chrono::steady_clock::time_point _last_scan_time;
+
+	int64_t _rtt_ms = RTP_NACK_DEFAULT_RTT_MS;
+
+	Stats _stats;
+};
@@ -6,6 +6,8 @@
 #include "rtcp_receiver.h"
 #include "rtcp_info/fir.h"
 #include "rtcp_info/pli.h"
+#include "rtcp_info/nack.h"
+#include "rtx_rtp_packet.h"
 
 #include "modules/rtsp/rtsp_data.h"
 
@@ -84,6 +86,28 @@ bool RtpRtcp::AddRtpReceiver(const std::shared_ptr<MediaTrack> &track, const Rtp
 
 	_tracks[track_id] = track;
 	_rtp_track_identifiers.push_back(rtp_track_id);
+
+	if (rtp_track_id.nack_enabled == true)
+	{
+		_nack_trackers[track_id] = std::make_shared<RtpNackTracker>();
+
+		auto buffer_it = _rtp_frame_jitter_buffers.find(track_id);
+		if (buffer_it != _rtp_frame_jitter_buffers.end())
+		{
+			// Wait for the retransmission instead of discarding the incomplete frame right away
+			buffer_it->second->SetMaxWaitingTimeForLostPackets(RTP_NACK_MAX_WAITING_TIME_MS);
+		}
+
+		if (rtp_track_id.rtx_payload_type.has_value() && rtp_track_id.payload_type.has_value())
+		{
+			_rtx_receivers[rtp_track_id.rtx_payload_type.value()] = RtxReceiver{track_id, rtp_track_id.payload_type.value()};
+			logti("AddRtpReceiver : %d / NACK enabled with RTX(pt: %d, apt: %d)", track_id, rtp_track_id.rtx_payload_type.value(), rtp_track_id.payload_type.value());
+		}
+		else
+		{
+			logti("AddRtpReceiver : %d / NACK enabled", track_id);
+		}
+	}
 	if (rtp_track_id.ssrc.has_value())
 	{
 		logti("AddRtpReceiver : %d / %u / %s / %s", track_id, rtp_track_id.ssrc.value(), rtp_track_id.mid.value_or(ov::String("")).CStr(), rtp_track_id.rid.value_or(ov::String("")).CStr());
@@ -112,6 +136,44 @@ bool RtpRtcp::SendRtpPacket(const std::shared_ptr<RtpPacket> &rtp_packet)
 		return false;
 	}
 
+	SendSenderReportIfNeeded(rtp_packet);
+
+	// Send RTP
+	_last_sent_rtp_packet = rtp_packet;
+	return SendDataToNextNode(NodeType::Rtp, rtp_packet->GetData());
+}
+
+bool RtpRtcp::SendRtpPackets(const std::vector<std::shared_ptr<RtpPacket>> &rtp_packets)
+{
+	if (rtp_packets.empty())
+	{
+		return true;
+	}
+
+	std::shared_lock<std::shared_mutex> lock(_state_lock);
+	// nothing to do before node start
+	if(GetNodeState() != ov::Node::NodeState::Started)
+	{
+		logtd("Node has not started, so the received data has been canceled.");
+		return false;
+	}
+
+	std::vector<std::shared_ptr<ov::Data>> data_list;
+	data_list.reserve(rtp_packets.size());
+
+	for (const auto &rtp_packet : rtp_packets)
+	{
+		SendSenderReportIfNeeded(rtp_packet);
+		data_list.push_back(rtp_packet->GetData());
+	}
+
+	// Send RTP burst, the next node (SRTP) protects them at once
+	_last_sent_rtp_packet = rtp_packets.back();
+	return SendDataListToNextNode(NodeType::Rtp, data_list);
+}
+
+void RtpRtcp::SendSenderReportIfNeeded(const std::shared_ptr<RtpPacket> &rtp_packet)
+{
 	// RTCP(SR + SR + SDES + SDES)
 	auto it = _rtcp_sr_generators.find(rtp_packet->Ssrc());
     if(it != _rtcp_sr_generators.end())
@@ -155,10 +217,6 @@ bool RtpRtcp::SendRtpPacket(const std::shared_ptr<RtpPacket> &rtp_packet)
 			logd("RTCP", "Send RTCP succeed : pt(%d) ssrc(%u) length(%d)", rtp_packet->PayloadType(), rtp_packet->Ssrc(), compound_rtcp_data->GetLength());
 		}
 	}
-
-	// Send RTP
-	_last_sent_rtp_packet = rtp_packet;
-	return SendDataToNextNode(NodeType::Rtp, rtp_packet->GetData());
 }
 
 bool RtpRtcp::SendPLI(uint32_t track_id)
@@ -211,6 +269,43 @@ bool RtpRtcp::SendFIR(uint32_t track_id)
 	return SendDataToNextNode(NodeType::Rtcp, rtcp_packet->GetData());
 }
 
+std::optional<RtpNackTracker::Stats> RtpRtcp::GetNackStats(uint32_t track_id) const
+{
+	auto it = _nack_trackers.find(track_id);
+	if(it == _nack_trackers.end())
+	{
+		return std::nullopt;
+	}
+
+	return it->second->GetStats();
+}
+
+void RtpRtcp::SendNackIfNeeded(const std::shared_ptr<RtpNackTracker> &nack_tracker, const std::shared_ptr<RtpReceiveStatistics> &stat)
+{
+	auto nack_list = nack_tracker->GetNackList();
+	if(nack_list.empty())
+	{
+		return;
+	}
+
+	auto nack = std::make_shared<NACK>();
+
+	nack->SetSrcSsrc(stat->GetReceiverSSRC());
+	nack->SetMediaSsrc(stat->GetMediaSSRC());
+	nack->AddLostIds(nack_list);
+
+	auto rtcp_packet = std::make_shared<RtcpPacket>();
+	if(rtcp_packet->Build(nack) == false)
+	{
+		return;
+	}
+
+	logtd("Send NACK : ssrc(%u) lost ids(%zu) first(%u)", stat->GetMediaSSRC(), nack_list.size(), nack_list.front());
+
+	_last_sent_rtcp_packet = rtcp_packet;
+	SendDataToNextNode(NodeType::Rtcp, rtcp_packet->GetData());
+}
+
 bool RtpRtcp::IsTransportCcFeedbackEnabled() const
 {
 	return _transport_cc_feedback_enabled;
@@ -441,6 +536,12 @@ bool RtpRtcp::OnRtpReceived(NodeType from_node, const std::shared_ptr<const ov::
 {
 	auto packet = std::make_shared<RtpPacket>(data);
 
+	// RTX is identified by payload type since it has its own SSRC
+	if(_rtx_receivers.empty() == false && _rtx_receivers.find(packet->PayloadType()) != _rtx_receivers.end())
+	{
+		return OnRtxReceived(packet);
+	}
+
 	std::optional<uint32_t> track_id_opt = GetTrackId(packet->Ssrc());
 	if (track_id_opt.has_value() == false)
 	{
@@ -508,6 +609,14 @@ bool RtpRtcp::OnRtpReceived(NodeType from_node, const std::shared_ptr<const ov::
 
 	stat->AddReceivedRtpPacket(packet);
 
+	// For NACK
+	auto nack_it = _nack_trackers.find(track_id);
+	if (nack_it != _nack_trackers.end())
+	{
+		nack_it->second->OnPacketReceived(packet->SequenceNumber());
+		SendNackIfNeeded(nack_it->second, stat);
+	}
+
 	// Send ReceiverReport
 	if (stat->HasElapsedSinceLastReportBlock(RECEIVER_REPORT_CYCLE_MS) && stat->IsSenderReportReceived() == true)
 	{
@@ -524,34 +633,84 @@ bool RtpRtcp::OnRtpReceived(NodeType from_node, const std::shared_ptr<const ov::
 		}
 	}
 
+	AddTransportCcFeedback(packet, track, stat);
+
+	return InsertToJitterBuffer(track_id, track, packet);
+}
+
+bool RtpRtcp::OnRtxReceived(const std::shared_ptr<RtpPacket> &rtx_packet)
+{
+	auto rtx_receiver = _rtx_receivers[rtx_packet->PayloadType()];
+	auto track_id = rtx_receiver.track_id;
+
+	auto track_it = _tracks.find(track_id);
+	auto stat_it = _receive_statistics.find(track_id);
+	if(track_it == _tracks.end() || stat_it == _receive_statistics.end())
+	{
+		// The media SSRC is not known yet
+		return false;
+	}
+
+	auto track = track_it->second;
+	auto stat = stat_it->second;
+
+	// RTX packets are also counted by the sender's bandwidth estimation
+	AddTransportCcFeedback(rtx_packet, track, stat);
+
+	auto packet = RtxRtpPacket::Restore(*rtx_packet, rtx_receiver.origin_payload_type, stat->GetMediaSSRC());
+	if(packet == nullptr)
+	{
+		// Padding only RTX packet for BWE
+		return true;
+	}
+
+	logtd("RTX received : ssrc(%u) seq(%u) -> osn(%u)", rtx_packet->Ssrc(), rtx_packet->SequenceNumber(), packet->SequenceNumber());
+
+	auto nack_it = _nack_trackers.find(track_id);
+	if (nack_it != _nack_trackers.end())
+	{
+		nack_it->second->OnRetransmittedPacketReceived(packet->SequenceNumber());
+	}
+
+	// Retransmitted packets are not counted in the receiver report statistics, that reports the loss of the original stream
+	return InsertToJitterBuffer(track_id, track, packet);
+}
+
+void RtpRtcp::AddTransportCcFeedback(const std::shared_ptr<RtpPacket> &packet, const std::shared_ptr<MediaTrack> &track, const std::shared_ptr<RtpReceiveStatistics> &stat)
+{
 	// For Transport-wide CC feedback
-	if (_transport_cc_feedback_enabled == true)
+	if (_transport_cc_feedback_enabled == false)
 	{
-		if (_transport_cc_generator == nullptr)
-		{
-			// Since the Receiver SSRC is unknown, the same as the RR of the first track is used. Since it is a wide sequence, media ssrc may not be one. So this also just uses the first media ssrc.
-			_transport_cc_generator = std::make_shared<RtcpTransportCcFeedbackGenerator>(
-										_transport_cc_feedback_extension_id, 
-										stat->GetReceiverSSRC());
-		}
+		return;
+	}
 
-		_transport_cc_generator->AddReceivedRtpPacket(packet);
+	if (_transport_cc_generator == nullptr)
+	{
+		// Since the Receiver SSRC is unknown, the same as the RR of the first track is used. Since it is a wide sequence, media ssrc may not be one. So this also just uses the first media ssrc.
+		_transport_cc_generator = std::make_shared<RtcpTransportCcFeedbackGenerator>(
+									_transport_cc_feedback_extension_id, 
+									stat->GetReceiverSSRC());
+	}
 
-		// Send Transport-wide CC feedback
-		if ((_transport_cc_generator->HasElapsedSinceLastTransportCc(TRANSPORT_CC_CYCLE_MS)) && 
-			(_video_receiver_enabled ? (track->GetMediaType() == cmn::MediaType::Video && packet->Marker() == true) : true))
+	_transport_cc_generator->AddReceivedRtpPacket(packet);
+
+	// Send Transport-wide CC feedback
+	if ((_transport_cc_generator->HasElapsedSinceLastTransportCc(TRANSPORT_CC_CYCLE_MS)) && 
+		(_video_receiver_enabled ? (track->GetMediaType() == cmn::MediaType::Video && packet->Marker() == true) : true))
+	{
+		auto feedback = _transport_cc_generator->GenerateTransportCcMessage();
+		if (feedback != nullptr)
 		{
-			auto feedback = _transport_cc_generator->GenerateTransportCcMessage();
-			if (feedback != nullptr)
-			{
-				_last_sent_rtcp_packet = feedback;
+			_last_sent_rtcp_packet = feedback;
 
-				auto feedback_data = feedback->GetData();
-				SendDataToNextNode(NodeType::Rtcp, feedback_data);
-			}
+			auto feedback_data = feedback->GetData();
+			SendDataToNextNode(NodeType::Rtcp, feedback_data);
 		}
 	}
+}
 
+bool RtpRtcp::InsertToJitterBuffer(uint32_t track_id, const std::shared_ptr<MediaTrack> &track, const std::shared_ptr<RtpPacket> &packet)
+{
 	int jitter_buffer_type = 0;
 	switch(track->GetOriginBitstream())
 	{
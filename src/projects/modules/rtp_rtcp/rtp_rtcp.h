@@ -11,6 +11,7 @@
 #include "rtp_frame_jitter_buffer.h"
 #include "rtp_minimal_jitter_buffer.h"
 #include "rtp_receive_statistics.h"
+#include "rtp_nack_tracker.h"
 
 
 
@@ -49,6 +50,11 @@ public:
 		std::optional<ov::String> rid;
 		uint32_t rid_extension_id = 0;
 
+		// Generic NACK (RFC 4585) and RTX (RFC 4588)
+		bool nack_enabled = false;
+		std::optional<uint8_t> payload_type;
+		std::optional<uint8_t> rtx_payload_type;
+
 	private:
 		uint32_t track_id = 0;
 	};
@@ -62,9 +68,13 @@ public:
 	bool Stop() override;
 
 	bool SendRtpPacket(const std::shared_ptr<RtpPacket> &packet);
+	// Sends a burst of RTP packets so that the next nodes can process them in a batch
+	bool SendRtpPackets(const std::vector<std::shared_ptr<RtpPacket>> &packets);
 	bool SendPLI(uint32_t track_id);
 	bool SendFIR(uint32_t track_id);
 
+	std::optional<RtpNackTracker::Stats> GetNackStats(uint32_t track_id) const;
+
 	bool IsTransportCcFeedbackEnabled() const;
 	bool EnableTransportCcFeedback(uint8_t extension_id);
 	void DisableTransportCcFeedback();
@@ -86,8 +96,17 @@ private:
 
 	std::shared_ptr<RtpFrameJitterBuffer> GetJitterBuffer(uint8_t payload_type);
 
+	bool OnRtxReceived(const std::shared_ptr<RtpPacket> &rtx_packet);
+
+	void AddTransportCcFeedback(const std::shared_ptr<RtpPacket> &packet, const std::shared_ptr<MediaTrack> &track, const std::shared_ptr<RtpReceiveStatistics> &stat);
+	bool InsertToJitterBuffer(uint32_t track_id, const std::shared_ptr<MediaTrack> &track, const std::shared_ptr<RtpPacket> &packet);
+	void SendNackIfNeeded(const std::shared_ptr<RtpNackTracker> &nack_tracker, const std::shared_ptr<RtpReceiveStatistics> &stat);
+
 	std::shared_ptr<RtcpPacket> GenerateTransportCcFeedbackIfNeeded();
 
+	// RTCP(SR + SR + SDES + SDES)
+	void SendSenderReportIfNeeded(const std::shared_ptr<RtpPacket> &rtp_packet);
+
 	std::vector<RtpTrackIdentifier> _rtp_track_identifiers;
 	std::map<uint32_t /*ssrc*/, uint32_t /*track_id*/> _ssrc_to_track_id;
 
@@ -122,6 +141,17 @@ private:
 	// Transport-cc feedback
 	std::shared_ptr<RtcpTransportCcFeedbackGenerator> _transport_cc_generator = nullptr;
 
+	// NACK
+	// track_id : NACK tracker
+	std::unordered_map<uint32_t, std::shared_ptr<RtpNackTracker>> _nack_trackers;
+	struct RtxReceiver
+	{
+		uint32_t track_id = 0;
+		uint8_t origin_payload_type = 0;
+	};
+	// RTX payload type : RtxReceiver
+	std::unordered_map<uint8_t, RtxReceiver> _rtx_receivers;
+
 	// Jitter buffer
 	// payload type : Jitter buffer
 	std::unordered_map<uint8_t, std::shared_ptr<RtpFrameJitterBuffer>> _rtp_frame_jitter_buffers;
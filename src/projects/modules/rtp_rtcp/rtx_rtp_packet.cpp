@@ -44,4 +44,36 @@ bool RtxRtpPacket::PackageAsRtx(uint32_t rtx_ssrc, uint8_t rtx_payload_type, con
 void RtxRtpPacket::SetOriginalSequenceNumber(uint16_t seq_no)
 {
 	ByteWriter<uint16_t>::WriteBigEndian(&_buffer[_payload_offset - RTX_HEADER_SIZE], seq_no);
-}
\ No newline at end of file
+}
+std::shared_ptr<RtpPacket> RtxRtpPacket::Restore(const RtpPacket &rtx_packet, uint8_t origin_payload_type, uint32_t origin_ssrc)
+{
+	if (rtx_packet.PayloadSize() < RTX_HEADER_SIZE)
+	{
+		return nullptr;
+	}
+
+	auto headers_size = rtx_packet.HeadersSize();
+	auto payload_size = rtx_packet.PayloadSize() - RTX_HEADER_SIZE;
+	auto origin_seq_no = ByteReader<uint16_t>::ReadBigEndian(rtx_packet.Payload());
+
+	auto data = std::make_shared<ov::Data>(headers_size + payload_size);
+	data->Append(rtx_packet.Header(), headers_size);
+	data->Append(rtx_packet.Payload() + RTX_HEADER_SIZE, payload_size);
+
+	auto buffer = data->GetWritableDataAs<uint8_t>();
+
+	// Padding of the RTX packet is not restored
+	buffer[0] &= ~0x20;
+	buffer[1] = (rtx_packet.Marker() ? 0x80 : 0x00) | (origin_payload_type & 0x7F);
+	ByteWriter<uint16_t>::WriteBigEndian(&buffer[2], origin_seq_no);
+	ByteWriter<uint32_t>::WriteBigEndian(&buffer[8], origin_ssrc);
+
+	auto packet = std::make_shared<RtpPacket>(data);
+	if (packet->PayloadType() != origin_payload_type)
+	{
+		// Failed to parse
+		return nullptr;
+	}
+
+	return packet;
+}
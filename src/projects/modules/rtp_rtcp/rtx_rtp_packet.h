@@ -35,6 +35,10 @@ public:
 
 	void SetOriginalSequenceNumber(uint16_t seq_no);
 
+	// Restores the original RTP packet from the received RTX packet
+	// Returns nullptr if the RTX packet has no OSN (e.g. padding only packet for bandwidth probing)
+	static std::shared_ptr<RtpPacket> Restore(const RtpPacket &rtx_packet, uint8_t origin_payload_type, uint32_t origin_ssrc);
+
 private:
 	bool PackageAsRtx(uint32_t rtx_ssrc, uint8_t rtx_payload_type, const RtpPacket &src);
 
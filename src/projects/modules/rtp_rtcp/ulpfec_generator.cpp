@@ -3,6 +3,8 @@
 
 #include <string.h>
 
+#include <array>
+
 constexpr size_t 	kFecHeaderSize					= 10;
 constexpr size_t 	kMaskSizeLbitClear				= 2;
 constexpr size_t	kMaskSizeLbitSet				= 6;
@@ -13,6 +15,25 @@ constexpr size_t 	kUlpfecMaxMediaPacketsLbitSet	= 48;
 
 constexpr size_t    kMediaPacketNumMakeFec          = 7; 
 
+// Packet masks protecting N (index) contiguous media packets from the SN base,
+// precomputed so that the common case does not have to set the bits per packet
+using PacketMask = std::array<uint8_t, kMaskSizeLbitSet>;
+static constexpr std::array<PacketMask, kUlpfecMaxMediaPacketsLbitSet + 1> MakeContiguousPacketMasks()
+{
+	std::array<PacketMask, kUlpfecMaxMediaPacketsLbitSet + 1> masks{};
+
+	for (size_t count = 1; count <= kUlpfecMaxMediaPacketsLbitSet; count++)
+	{
+		for (size_t diff = 0; diff < count; diff++)
+		{
+			masks[count][diff / 8] |= static_cast<uint8_t>(1 << (7 - (diff % 8)));
+		}
+	}
+
+	return masks;
+}
+static constexpr auto kContiguousPacketMasks = MakeContiguousPacketMasks();
+
 UlpfecGenerator::UlpfecGenerator()
 {
 	_high_level = false;
@@ -29,10 +50,32 @@ void UlpfecGenerator::SetHighRateProtection(bool high_level)
 
 bool UlpfecGenerator::AddRtpPacketAndGenerateFec(std::shared_ptr<RedRtpPacket> packet)
 {
-	auto copy_packet = std::make_shared<RedRtpPacket>(*packet);
-	_media_packets.push_back(copy_packet);
+	ProtectedPacket media_packet;
+
+	media_packet.payload_offset = packet->Payload() - packet->Buffer();
+	media_packet.payload_size = packet->PayloadSize();
+	media_packet.first_byte = packet->Header()[0];
+
+	// The packet is red packet. So buffer[1] of RTP header has red payload type.
+	// We should use media payload type in the red header.
+	media_packet.m_pt_fields = packet->Header()[packet->HeadersSize() - 1];
+	if(packet->Marker())
+	{
+		media_packet.m_pt_fields |= 0x80;
+	}
+	else
+	{
+		media_packet.m_pt_fields &= 0x7F;
+	}
 
-	if(copy_packet->Marker())
+	media_packet.sequence_number = packet->SequenceNumber();
+	media_packet.timestamp = packet->Timestamp();
+	media_packet.packet = std::move(packet);
+
+	bool marker = media_packet.packet->Marker();
+	_media_packets.push_back(std::move(media_packet));
+
+	if(marker)
 	{
 		Encode();
 	}
@@ -78,80 +121,87 @@ bool UlpfecGenerator::Encode()
 		mask_len = kMaskSizeLbitSet;
 	}
 
+	// A packet is protected only if its distance from the SN base fits in the mask
+	const size_t mask_bit_count = mask_len * 8;
+
 	for(uint32_t i=0; i<fec_packet_count; i++)
 	{
-		uint16_t sn_base = 0;
-		bool first_media_packet;
-		uint8_t mask[6];
-		int selected_media_count;
-
-		first_media_packet = true;
-
 		// TODO(Getroot): A more efficient algorithm should be used like random mask or bursty mask.
-		auto fec_packet = std::make_shared<ov::Data>();
-		fec_packet->SetLength(fec_header_size);
-		auto fec_buffer = fec_packet->GetWritableDataAs<uint8_t>();
+		size_t selected_media_count = (media_size-media_packet_idx) / (fec_packet_count - i);
+		auto first = _media_packets.begin() + media_packet_idx;
+		auto last = first + selected_media_count;
+
+		const auto &first_media_packet = *first;
+		uint16_t sn_base = first_media_packet.sequence_number;
+
+		// Allocate the FEC packet once with the largest payload of the group.
+		// ov::Data zero-fills it, so XORing the shorter payloads gives the same result as growing it.
+		// The packets that are not protected are neither counted nor XORed.
+		size_t max_payload_size = 0;
+		for(auto it = first; it != last; ++it)
+		{
+			if(static_cast<uint16_t>(it->sequence_number - sn_base) < mask_bit_count)
+			{
+				max_payload_size = std::max(max_payload_size, it->payload_size);
+			}
+		}
 
-		// Initialize
-		memset(mask, 0, sizeof(mask));
-		first_media_packet = true;
-		selected_media_count = (media_size-media_packet_idx) / (fec_packet_count - i);
+		auto fec_packet = std::make_shared<ov::Data>(fec_header_size + max_payload_size);
+		fec_packet->SetLength(fec_header_size + max_payload_size);
+		auto fec_buffer = fec_packet->GetWritableDataAs<uint8_t>();
 
-		for(int j=0; j<selected_media_count; j++)
+		// Write P, X, CC fields.
+		// Bits 0, 1 are overwritten in FinalizeFecHeaders.
+		fec_buffer[0] = first_media_packet.first_byte;
+		// M, and PT recovery
+		fec_buffer[1] = first_media_packet.m_pt_fields;
+		// SN Base
+		ByteWriter<uint16_t>::WriteBigEndian(&fec_buffer[2], sn_base);
+		// Write timestamp recovery field.
+		ByteWriter<uint32_t>::WriteBigEndian(&fec_buffer[4], first_media_packet.timestamp);
+		// Write length recovery field.
+		ByteWriter<uint16_t>::WriteBigEndian(&fec_buffer[8], (uint16_t)first_media_packet.payload_size);
+		// Write Payload.
+		memcpy(&fec_buffer[fec_header_size], first_media_packet.Payload(), first_media_packet.payload_size);
+
+		bool contiguous = true;
+		for(auto it = first + 1; it != last; ++it)
 		{
-			auto media_packet = _media_packets[media_packet_idx];
+			uint16_t diff = it->sequence_number - sn_base;
+			if(diff >= mask_bit_count)
+			{
+				contiguous = false;
+				continue;
+			}
 
-			size_t fec_packet_length = fec_header_size + media_packet->PayloadSize();
+			XorFecPacket(fec_buffer, fec_header_size, *it);
 
-			if(fec_packet->GetLength() < fec_packet_length)
+			if(diff != static_cast<size_t>(it - first))
 			{
-				fec_packet->SetLength(fec_packet_length);
-				fec_buffer = fec_packet->GetWritableDataAs<uint8_t>();
+				contiguous = false;
 			}
+		}
 
-			if(first_media_packet)
+		PacketMask mask{};
+		if(contiguous)
+		{
+			mask = kContiguousPacketMasks[selected_media_count];
+		}
+		else
+		{
+			for(auto it = first; it != last; ++it)
 			{
-				// Write P, X, CC fields.
-				// Bits 0, 1 are overwritten in FinalizeFecHeaders.
-				fec_buffer[0] = media_packet->Buffer()[0];
-
-				// The media_packet is red packet. So buffer[1] of RTP header has red payload type.
-				// We should use media payload type in the red header.
-				// M, and PT recovery
-				fec_buffer[1] = media_packet->Buffer()[media_packet->HeadersSize() - 1];
-				if(media_packet->Marker())
-				{
-					fec_buffer[1] |= 0x80;
-				}
-				else
+				uint16_t diff = it->sequence_number - sn_base;
+				if(diff < mask_bit_count)
 				{
-					fec_buffer[1] &= 0x7F;
+					mask[diff / 8] |= 1 << (7 - (diff % 8));
 				}
-
-				// SN Base
-				ByteWriter<uint16_t>::WriteBigEndian(&fec_buffer[2], media_packet->SequenceNumber());
-				// Write timestamp recovery field.
-				ByteWriter<uint32_t>::WriteBigEndian(&fec_buffer[4], media_packet->Timestamp());
-				// Write length recovery field.
-				ByteWriter<uint16_t>::WriteBigEndian(&fec_buffer[8], (uint16_t)media_packet->PayloadSize());
-				// Write Payload.
-				memcpy(&fec_buffer[fec_header_size], media_packet->Payload(), media_packet->PayloadSize());
-
-				sn_base = media_packet->SequenceNumber();
-
-				first_media_packet = false;
 			}
-			else
-			{
-				XorFecPacket(fec_buffer, fec_header_size, media_packet.get());
-			}
-
-			uint16_t diff = media_packet->SequenceNumber() - sn_base;
-			mask[diff / 8] |= 1 << (7 - (diff % 8));
-			media_packet_idx++;
 		}
 
-		FinalizeFecHeader(fec_buffer, fec_packet->GetLength() - fec_header_size, mask, mask_len);
+		media_packet_idx += selected_media_count;
+
+		FinalizeFecHeader(fec_buffer, fec_packet->GetLength() - fec_header_size, mask.data(), mask_len);
 
 		_generated_fec_packets.push(fec_packet);
 	}
@@ -161,44 +211,28 @@ bool UlpfecGenerator::Encode()
 	return true;
 }
 
-void UlpfecGenerator::XorFecPacket(uint8_t *fec_packet, size_t fec_header_len, RedRtpPacket *media_packet)
+void UlpfecGenerator::XorFecPacket(uint8_t *fec_packet, size_t fec_header_len, const ProtectedPacket &media_packet)
 {
-	auto rtp_header = media_packet->Header();
-	auto rtp_header_len = media_packet->HeadersSize();
-	auto rtp_payload = media_packet->Payload();
-	auto rtp_payload_len = media_packet->PayloadSize();
-
 	// XOR the first 2 bytes of the header: V, P, X, CC
-	fec_packet[0] ^= rtp_header[0];
-
-	uint8_t m_pt_fields = rtp_header[rtp_header_len-1];
-	if(media_packet->Marker())
-	{
-		m_pt_fields |= 0x80;
-	}
-	else
-	{
-		m_pt_fields &= 0x7F;
-	}
-	fec_packet[1] ^= m_pt_fields;
+	fec_packet[0] ^= media_packet.first_byte;
+	fec_packet[1] ^= media_packet.m_pt_fields;
 
 	// XOR TS recovery
-	fec_packet[4] ^= rtp_header[4];
-	fec_packet[5] ^= rtp_header[5];
-	fec_packet[6] ^= rtp_header[6];
-	fec_packet[7] ^= rtp_header[7];
+	uint8_t rtp_timestamp_network_order[4];
+	ByteWriter<uint32_t>::WriteBigEndian(rtp_timestamp_network_order, media_packet.timestamp);
+	fec_packet[4] ^= rtp_timestamp_network_order[0];
+	fec_packet[5] ^= rtp_timestamp_network_order[1];
+	fec_packet[6] ^= rtp_timestamp_network_order[2];
+	fec_packet[7] ^= rtp_timestamp_network_order[3];
 
 	// XOR Length recovery
 	uint8_t rtp_payload_length_network_order[2];
-	ByteWriter<uint16_t>::WriteBigEndian(rtp_payload_length_network_order, (uint16_t)rtp_payload_len);
+	ByteWriter<uint16_t>::WriteBigEndian(rtp_payload_length_network_order, (uint16_t)media_packet.payload_size);
 	fec_packet[8] ^= rtp_payload_length_network_order[0];
 	fec_packet[9] ^= rtp_payload_length_network_order[1];
 
 	// XOR Payload
-	for(size_t i = 0; i < rtp_payload_len; i++)
-	{
-		fec_packet[fec_header_len + i] ^= rtp_payload[i];
-	}
+	UlpfecXor::Xor(&fec_packet[fec_header_len], media_packet.Payload(), media_packet.payload_size);
 }
 
 void UlpfecGenerator::FinalizeFecHeader(uint8_t *fec_packet, const size_t fec_payload_len, const uint8_t *mask, const size_t mask_len)
@@ -6,6 +6,7 @@
 
 #include "base/common_types.h"
 #include "red_rtp_packet.h"
+#include "ulpfec_xor.h"
 
 /*
 * RTP + RED + FEC
@@ -55,11 +56,32 @@ public:
 	bool NextPacket(RtpPacket *packet);
 
 private:
+	// The fields of a media packet required to generate FEC.
+	// The packet is shared with the sessions (read-only), so it is referenced instead of being copied.
+	// The payload offset/size are captured when it is added because the packetizer changes them (PackageAsRtp) afterwards.
+	struct ProtectedPacket
+	{
+		std::shared_ptr<RedRtpPacket> packet;
+		size_t payload_offset;
+		size_t payload_size;
+		// V, P, X, CC
+		uint8_t first_byte;
+		// M and media payload type (in the RED header)
+		uint8_t m_pt_fields;
+		uint16_t sequence_number;
+		uint32_t timestamp;
+
+		const uint8_t *Payload() const
+		{
+			return packet->Buffer() + payload_offset;
+		}
+	};
+
 	bool Encode();
-	void XorFecPacket(uint8_t *fec_packet, size_t fec_header_len, RedRtpPacket *packet);
+	void XorFecPacket(uint8_t *fec_packet, size_t fec_header_len, const ProtectedPacket &media_packet);
 	void FinalizeFecHeader(uint8_t *fec_packet, const size_t fec_payload_len, const uint8_t *mask, const size_t mask_len);
 
 	std::queue<std::shared_ptr<ov::Data>>	    _generated_fec_packets;
-	std::vector<std::shared_ptr<RedRtpPacket>>	_media_packets;
+	std::vector<ProtectedPacket>				_media_packets;
 	bool                                        _high_level;
 };
\ No newline at end of file
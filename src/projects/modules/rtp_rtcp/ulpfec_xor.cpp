@@ -0,0 +1,174 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "ulpfec_xor.h"
+
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#	include <immintrin.h>
+#	define ULPFEC_XOR_X86 1
+#elif defined(__ARM_NEON) || defined(__aarch64__)
+#	include <arm_neon.h>
+#	define ULPFEC_XOR_NEON 1
+#endif
+
+void UlpfecXor::XorScalar(uint8_t *dst, const uint8_t *src, size_t length)
+{
+	size_t i = 0;
+
+	// 8 bytes at a time (memcpy keeps the unaligned access well-defined)
+	for (; i + 8 <= length; i += 8)
+	{
+		uint64_t d, s;
+		::memcpy(&d, dst + i, 8);
+		::memcpy(&s, src + i, 8);
+		d ^= s;
+		::memcpy(dst + i, &d, 8);
+	}
+
+	for (; i < length; i++)
+	{
+		dst[i] ^= src[i];
+	}
+}
+
+#if ULPFEC_XOR_X86
+#	if defined(__SSE2__)
+static void XorSse2(uint8_t *dst, const uint8_t *src, size_t length)
+{
+	size_t i = 0;
+
+	for (; i + 64 <= length; i += 64)
+	{
+		auto d0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i));
+		auto d1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i + 16));
+		auto d2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i + 32));
+		auto d3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i + 48));
+		auto s0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+		auto s1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 16));
+		auto s2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 32));
+		auto s3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 48));
+
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_xor_si128(d0, s0));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 16), _mm_xor_si128(d1, s1));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 32), _mm_xor_si128(d2, s2));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 48), _mm_xor_si128(d3, s3));
+	}
+
+	for (; i + 16 <= length; i += 16)
+	{
+		auto d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i));
+		auto s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_xor_si128(d, s));
+	}
+
+	UlpfecXor::XorScalar(dst + i, src + i, length - i);
+}
+#	endif	// defined(__SSE2__)
+
+// Compiled for AVX2 regardless of the build flags, and used only if the CPU supports it
+__attribute__((target("avx2"))) static void XorAvx2(uint8_t *dst, const uint8_t *src, size_t length)
+{
+	size_t i = 0;
+
+	for (; i + 128 <= length; i += 128)
+	{
+		auto d0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + i));
+		auto d1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + i + 32));
+		auto d2 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + i + 64));
+		auto d3 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + i + 96));
+		auto s0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+		auto s1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i + 32));
+		auto s2 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i + 64));
+		auto s3 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i + 96));
+
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_xor_si256(d0, s0));
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i + 32), _mm256_xor_si256(d1, s1));
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i + 64), _mm256_xor_si256(d2, s2));
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i + 96), _mm256_xor_si256(d3, s3));
+	}
+
+	for (; i + 32 <= length; i += 32)
+	{
+		auto d = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + i));
+		auto s = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_xor_si256(d, s));
+	}
+
+	for (; i + 16 <= length; i += 16)
+	{
+		auto d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i));
+		auto s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_xor_si128(d, s));
+	}
+
+	UlpfecXor::XorScalar(dst + i, src + i, length - i);
+}
+#endif	// ULPFEC_XOR_X86
+
+#if ULPFEC_XOR_NEON
+static void XorNeon(uint8_t *dst, const uint8_t *src, size_t length)
+{
+	size_t i = 0;
+
+	for (; i + 64 <= length; i += 64)
+	{
+		auto d = vld1q_u8_x4(dst + i);
+		auto s = vld1q_u8_x4(src + i);
+
+		d.val[0] = veorq_u8(d.val[0], s.val[0]);
+		d.val[1] = veorq_u8(d.val[1], s.val[1]);
+		d.val[2] = veorq_u8(d.val[2], s.val[2]);
+		d.val[3] = veorq_u8(d.val[3], s.val[3]);
+
+		vst1q_u8_x4(dst + i, d);
+	}
+
+	for (; i + 16 <= length; i += 16)
+	{
+		vst1q_u8(dst + i, veorq_u8(vld1q_u8(dst + i), vld1q_u8(src + i)));
+	}
+
+	UlpfecXor::XorScalar(dst + i, src + i, length - i);
+}
+#endif	// ULPFEC_XOR_NEON
+
+const UlpfecXor::Implementation &UlpfecXor::GetImplementation()
+{
+	static const Implementation implementation = []() -> Implementation {
+#if ULPFEC_XOR_X86
+		__builtin_cpu_init();
+
+		if (__builtin_cpu_supports("avx2"))
+		{
+			return {XorAvx2, "AVX2"};
+		}
+
+#	if defined(__SSE2__)
+		return {XorSse2, "SSE2"};
+#	endif
+#elif ULPFEC_XOR_NEON
+		return {XorNeon, "NEON"};
+#endif
+
+		return {XorScalar, "Scalar"};
+	}();
+
+	return implementation;
+}
+
+void UlpfecXor::Xor(uint8_t *dst, const uint8_t *src, size_t length)
+{
+	GetImplementation().function(dst, src, length);
+}
+
+const char *UlpfecXor::GetImplementationName()
+{
+	return GetImplementation().name;
+}
@@ -0,0 +1,37 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// XOR kernel used to build the FEC payloads.
+// The implementation is selected once at runtime according to the CPU (AVX2 > SSE2 > NEON > scalar).
+class UlpfecXor
+{
+public:
+	// dst[i] ^= src[i] for i in [0, length)
+	static void Xor(uint8_t *dst, const uint8_t *src, size_t length);
+
+	static const char *GetImplementationName();
+
+	// Always available, used as the reference of the SIMD implementations
+	static void XorScalar(uint8_t *dst, const uint8_t *src, size_t length);
+
+private:
+	using XorFunction = void (*)(uint8_t *dst, const uint8_t *src, size_t length);
+
+	struct Implementation
+	{
+		XorFunction function;
+		const char *name;
+	};
+
+	static const Implementation &GetImplementation();
+};
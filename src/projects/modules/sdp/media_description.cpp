@@ -731,6 +731,20 @@ std::shared_ptr<const PayloadAttr> MediaDescription::GetFirstPayload() const
 	return nullptr;
 }
 
+std::shared_ptr<const PayloadAttr> MediaDescription::GetRtxPayload(uint8_t associated_payload_type) const
+{
+	for (auto &payload : _payload_list)
+	{
+		if (payload->GetCodec() == PayloadAttr::SupportCodec::RTX &&
+			payload->GetRtxAssociatedPayloadType() == associated_payload_type)
+		{
+			return payload;
+		}
+	}
+
+	return nullptr;
+}
+
 const std::vector<std::shared_ptr<PayloadAttr>> &MediaDescription::GetPayloadList() const
 {
 	return _payload_list;
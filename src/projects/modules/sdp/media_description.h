@@ -57,6 +57,8 @@ public:
 	std::shared_ptr<const PayloadAttr> GetPayload(uint8_t id) const;
 	std::shared_ptr<PayloadAttr> GetPayload(uint8_t id);
 	std::shared_ptr<const PayloadAttr> GetFirstPayload() const;
+	// Find the RTX payload associated with the payload type (a=fmtp:<rtx pt> apt=<associated_payload_type>)
+	std::shared_ptr<const PayloadAttr> GetRtxPayload(uint8_t associated_payload_type) const;
 	// payload list
 	const std::vector<std::shared_ptr<PayloadAttr>> &GetPayloadList() const;
 
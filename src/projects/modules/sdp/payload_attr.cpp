@@ -205,6 +205,27 @@ void PayloadAttr::SetFmtp(const ov::String &fmtp)
 			}
 		}
 	}
+	else if(_codec == SupportCodec::RTX)
+	{
+		// a=fmtp:97 apt=96
+		auto components = fmtp.Split(";");
+		for(const auto &component : components)
+		{
+			auto index = component.IndexOf('=');
+			if(index == -1)
+			{
+				continue;
+			}
+
+			auto name = component.Substring(0, index).Trim();
+			auto value = component.Substring(index+1).Trim();
+
+			if(name.LowerCaseString() == "apt")
+			{
+				_rtx_apt = static_cast<uint8_t>(ov::Converter::ToInt32(value.CStr()));
+			}
+		}
+	}
 	else if(_codec == SupportCodec::MPEG4_GENERIC)
 	{
 		// https://tools.ietf.org/html/rfc3640#section-3.3
@@ -140,6 +140,9 @@ public:
 	std::shared_ptr<ov::Data> GetH265PPS() const {return _h265_pps_bytes;}
 	uint32_t GetH265MaxDONDiff() const {return _h265_max_don_diff;}
 
+	// RTX Specific (a=fmtp:97 apt=96)
+	std::optional<uint8_t> GetRtxAssociatedPayloadType() const {return _rtx_apt;}
+
 private:
 	uint8_t _id = 0;
 	SupportCodec _codec = SupportCodec::Unknown;
@@ -167,4 +170,7 @@ private:
 	std::shared_ptr<ov::Data>	_h265_sps_bytes = nullptr;
 	std::shared_ptr<ov::Data>	_h265_pps_bytes = nullptr;
 	uint32_t _h265_max_don_diff = 0;
+
+	// RTX Specific
+	std::optional<uint8_t> _rtx_apt;
 };
@@ -0,0 +1,317 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "latency_metrics.h"
+
+#include <cmath>
+
+#include "monitoring_private.h"
+
+namespace mon
+{
+	LatencyHistogram::LatencyHistogram()
+	{
+		Reset();
+	}
+
+	int LatencyHistogram::GetIndex(int64_t value)
+	{
+		value = std::clamp<int64_t>(value, 0, (1LL << MaxValueBits) - 1);
+
+		if (value < SubBucketCount)
+		{
+			return static_cast<int>(value);
+		}
+
+		int msb	   = 63 - __builtin_clzll(static_cast<uint64_t>(value));
+		int shift  = msb - SubBucketBits;
+		int bucket = shift + 1;
+		int sub	   = static_cast<int>(value >> shift) - SubBucketCount;
+
+		return (bucket * SubBucketCount) + sub;
+	}
+
+	// Middle of the range that the counter covers
+	int64_t LatencyHistogram::GetValue(int index)
+	{
+		int bucket = index / SubBucketCount;
+		int sub	   = index % SubBucketCount;
+
+		if (bucket == 0)
+		{
+			return sub;
+		}
+
+		int shift = bucket - 1;
+
+		return (static_cast<int64_t>(SubBucketCount + sub) << shift) + ((1LL << shift) / 2);
+	}
+
+	void LatencyHistogram::Record(int64_t value_us)
+	{
+		_counts[GetIndex(value_us)].fetch_add(1, std::memory_order_relaxed);
+		_total_count.fetch_add(1, std::memory_order_relaxed);
+
+		auto max = _max.load(std::memory_order_relaxed);
+		while ((value_us > max) && (_max.compare_exchange_weak(max, value_us, std::memory_order_relaxed) == false))
+		{
+		}
+	}
+
+	void LatencyHistogram::Reset()
+	{
+		for (auto &count : _counts)
+		{
+			count.store(0, std::memory_order_relaxed);
+		}
+
+		_total_count = 0;
+		_max		 = 0;
+	}
+
+	uint64_t LatencyHistogram::GetCount() const
+	{
+		return _total_count.load(std::memory_order_relaxed);
+	}
+
+	int64_t LatencyHistogram::GetMax() const
+	{
+		return _max.load(std::memory_order_relaxed);
+	}
+
+	int64_t LatencyHistogram::GetPercentile(double percentile) const
+	{
+		return GetPercentile(this, nullptr, percentile);
+	}
+
+	int64_t LatencyHistogram::GetPercentile(const LatencyHistogram *first, const LatencyHistogram *second, double percentile)
+	{
+		uint64_t total_count = 0;
+		int64_t max = 0;
+
+		for (auto histogram : {first, second})
+		{
+			if (histogram != nullptr)
+			{
+				total_count += histogram->GetCount();
+				max = std::max(max, histogram->GetMax());
+			}
+		}
+
+		if (total_count == 0)
+		{
+			return 0;
+		}
+
+		auto target = static_cast<uint64_t>(std::ceil(static_cast<double>(total_count) * percentile / 100.0));
+		target		= std::max<uint64_t>(target, 1);
+
+		uint64_t count = 0;
+		for (int index = 0; index < CounterCount; index++)
+		{
+			for (auto histogram : {first, second})
+			{
+				if (histogram != nullptr)
+				{
+					count += histogram->_counts[index].load(std::memory_order_relaxed);
+				}
+			}
+
+			if (count >= target)
+			{
+				return std::min(GetValue(index), max);
+			}
+		}
+
+		return max;
+	}
+
+	LatencyMetrics::LatencyMetrics(PublisherType publisher_type)
+		: _publisher_type(publisher_type)
+	{
+		_current_window	 = 0;
+		_window_start_ms = ov::Clock::NowMSec();
+		_record_count	 = 0;
+	}
+
+	LatencyMetrics::~LatencyMetrics()
+	{
+		for (auto &window : _histograms)
+		{
+			for (auto &histogram : window)
+			{
+				delete histogram.load();
+			}
+		}
+
+		for (auto &histogram : _pacer_queue_delay_histograms)
+		{
+			delete histogram.load();
+		}
+	}
+
+	PublisherType LatencyMetrics::GetPublisherType() const
+	{
+		return _publisher_type;
+	}
+
+	void LatencyMetrics::RotateWindowIfNeeded()
+	{
+		int64_t now_ms		 = ov::Clock::NowMSec();
+		int64_t window_start = _window_start_ms.load(std::memory_order_relaxed);
+
+		if ((now_ms - window_start) < LATENCY_METRICS_WINDOW_MS)
+		{
+			return;
+		}
+
+		// Only one thread rotates the window
+		if (_window_start_ms.compare_exchange_strong(window_start, now_ms) == false)
+		{
+			return;
+		}
+
+		// The previous window becomes the current window after it is cleared.
+		// A few values that are recorded during the rotation may be lost, but it does not matter for statistics.
+		int next_window = 1 - _current_window.load();
+		for (auto &histogram : _histograms[next_window])
+		{
+			ResetHistogram(histogram);
+		}
+		ResetHistogram(_pacer_queue_delay_histograms[next_window]);
+		_current_window = next_window;
+	}
+
+	LatencyHistogram *LatencyMetrics::GetHistogram(std::atomic<LatencyHistogram *> &histogram)
+	{
+		auto current = histogram.load(std::memory_order_acquire);
+		if (current != nullptr)
+		{
+			return current;
+		}
+
+		auto created = new LatencyHistogram();
+		if (histogram.compare_exchange_strong(current, created, std::memory_order_acq_rel) == false)
+		{
+			// Another thread has created it
+			delete created;
+			return current;
+		}
+
+		return created;
+	}
+
+	void LatencyMetrics::ResetHistogram(std::atomic<LatencyHistogram *> &histogram)
+	{
+		auto current = histogram.load(std::memory_order_acquire);
+		if (current != nullptr)
+		{
+			current->Reset();
+		}
+	}
+
+	void LatencyMetrics::RecordStage(MediaTraceStage stage, int64_t elapsed_us)
+	{
+		if ((elapsed_us < 0) || (stage == MediaTraceStage::Ingest))
+		{
+			return;
+		}
+
+		RotateWindowIfNeeded();
+
+		GetHistogram(_histograms[_current_window.load(std::memory_order_relaxed)][static_cast<size_t>(stage)])->Record(elapsed_us);
+	}
+
+	void LatencyMetrics::RecordPacerQueueDelay(int64_t delay_us)
+	{
+		if (delay_us < 0)
+		{
+			return;
+		}
+
+		RotateWindowIfNeeded();
+
+		GetHistogram(_pacer_queue_delay_histograms[_current_window.load(std::memory_order_relaxed)])->Record(delay_us);
+	}
+
+	void LatencyMetrics::Record(cmn::MediaType media_type, uint32_t track_id, int64_t pts, const MediaTrace &trace)
+	{
+		if (trace.IsMarked(MediaTraceStage::Ingest) == false)
+		{
+			return;
+		}
+
+		RotateWindowIfNeeded();
+
+		auto &histograms = _histograms[_current_window.load(std::memory_order_relaxed)];
+
+		// Ingest itself is not recorded
+		for (size_t index = 1; index < MediaTrace::StageCount; index++)
+		{
+			auto elapsed_us = trace.GetElapsedUs(static_cast<MediaTraceStage>(index));
+
+			if (elapsed_us >= 0)
+			{
+				GetHistogram(histograms[index])->Record(elapsed_us);
+			}
+		}
+
+		if ((_record_count++ % LATENCY_METRICS_SAMPLE_INTERVAL) != 0)
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(_samples_mutex);
+
+		_samples.push_back({media_type, track_id, pts, trace});
+
+		while (_samples.size() > LATENCY_METRICS_MAX_SAMPLES)
+		{
+			_samples.pop_front();
+		}
+	}
+
+	LatencyMetrics::Stage LatencyMetrics::GetStage(MediaTraceStage stage) const
+	{
+		return MakeStage(_histograms[0][static_cast<size_t>(stage)], _histograms[1][static_cast<size_t>(stage)]);
+	}
+
+	LatencyMetrics::Stage LatencyMetrics::GetPacerQueueDelay() const
+	{
+		return MakeStage(_pacer_queue_delay_histograms[0], _pacer_queue_delay_histograms[1]);
+	}
+
+	LatencyMetrics::Stage LatencyMetrics::MakeStage(const std::atomic<LatencyHistogram *> &current, const std::atomic<LatencyHistogram *> &previous)
+	{
+		auto current_histogram	= current.load(std::memory_order_acquire);
+		auto previous_histogram = previous.load(std::memory_order_acquire);
+
+		Stage result;
+
+		for (auto histogram : {current_histogram, previous_histogram})
+		{
+			if (histogram != nullptr)
+			{
+				result.count += histogram->GetCount();
+				result.max_us = std::max(result.max_us, histogram->GetMax());
+			}
+		}
+
+		result.p50_us = LatencyHistogram::GetPercentile(current_histogram, previous_histogram, 50.0);
+		result.p99_us = LatencyHistogram::GetPercentile(current_histogram, previous_histogram, 99.0);
+
+		return result;
+	}
+
+	std::vector<LatencyMetrics::Sample> LatencyMetrics::GetSamples() const
+	{
+		std::lock_guard<std::mutex> lock(_samples_mutex);
+
+		return std::vector<Sample>(_samples.begin(), _samples.end());
+	}
+}  // namespace mon
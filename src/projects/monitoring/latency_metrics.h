@@ -0,0 +1,121 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/mediarouter/media_trace.h>
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include "base/common_types.h"
+
+// Windows of the histograms are rotated at this interval, the REST API reports the current and the previous window
+#define LATENCY_METRICS_WINDOW_MS (60 * 1000)
+// One of this number of packets is kept in the trace sample buffer
+#define LATENCY_METRICS_SAMPLE_INTERVAL 16
+#define LATENCY_METRICS_MAX_SAMPLES 512
+
+namespace mon
+{
+	// Log-linear histogram like HdrHistogram. Values are recorded lock-free.
+	// Each power of two range is divided into 16 sub buckets, so a reported value has an error of less than about 6%.
+	class LatencyHistogram
+	{
+	public:
+		static constexpr int SubBucketBits = 4;
+		static constexpr int SubBucketCount = 1 << SubBucketBits;
+		// Up to 2^27 us (about 134 seconds), larger values are clamped
+		static constexpr int MaxValueBits = 27;
+		static constexpr int BucketCount = MaxValueBits - SubBucketBits + 1;
+		static constexpr int CounterCount = BucketCount * SubBucketCount;
+
+		LatencyHistogram();
+
+		void Record(int64_t value_us);
+		void Reset();
+
+		uint64_t GetCount() const;
+		int64_t GetMax() const;
+		int64_t GetPercentile(double percentile) const;
+
+		// Percentile of the values of both histograms (e.g. the current and the previous window) without merging them into a copy.
+		// Either of them may be nullptr.
+		static int64_t GetPercentile(const LatencyHistogram *first, const LatencyHistogram *second, double percentile);
+
+	private:
+		static int GetIndex(int64_t value);
+		static int64_t GetValue(int index);
+
+		// A window is LATENCY_METRICS_WINDOW_MS long, so 32 bits are enough for a counter
+		std::atomic<uint32_t> _counts[CounterCount];
+		std::atomic<uint64_t> _total_count;
+		std::atomic<int64_t> _max;
+	};
+
+	// Latency of a stream that is sent by a publisher, from ingest to each stage of the hot path
+	class LatencyMetrics
+	{
+	public:
+		struct Stage
+		{
+			uint64_t count = 0;
+			int64_t p50_us = 0;
+			int64_t p99_us = 0;
+			int64_t max_us = 0;
+		};
+
+		// Trace of a sampled packet, used to dump the recent activity in Chrome trace format
+		struct Sample
+		{
+			cmn::MediaType media_type = cmn::MediaType::Unknown;
+			uint32_t track_id = 0;
+			int64_t pts = 0;
+			MediaTrace trace;
+		};
+
+		LatencyMetrics(PublisherType publisher_type);
+		~LatencyMetrics();
+
+		PublisherType GetPublisherType() const;
+
+		// Records the elapsed time from ingest to every marked stage of the trace
+		void Record(cmn::MediaType media_type, uint32_t track_id, int64_t pts, const MediaTrace &trace);
+		void RecordStage(MediaTraceStage stage, int64_t elapsed_us);
+		// How long the packets waited in the pacer of a session (WebRTC) before they were sent
+		void RecordPacerQueueDelay(int64_t delay_us);
+
+		// Statistics of the current and the previous window
+		Stage GetStage(MediaTraceStage stage) const;
+		Stage GetPacerQueueDelay() const;
+		std::vector<Sample> GetSamples() const;
+
+	private:
+		void RotateWindowIfNeeded();
+		// The histograms are allocated when the first value is recorded,
+		// so that the stages that a stream does not pass (e.g. the transcoder, the pacer) do not take memory
+		static LatencyHistogram *GetHistogram(std::atomic<LatencyHistogram *> &histogram);
+		static void ResetHistogram(std::atomic<LatencyHistogram *> &histogram);
+		static Stage MakeStage(const std::atomic<LatencyHistogram *> &current, const std::atomic<LatencyHistogram *> &previous);
+
+		PublisherType _publisher_type;
+
+		// [window][stage]
+		std::atomic<LatencyHistogram *> _histograms[2][MediaTrace::StageCount] = {};
+		// [window]
+		std::atomic<LatencyHistogram *> _pacer_queue_delay_histograms[2] = {};
+		std::atomic<int> _current_window;
+		std::atomic<int64_t> _window_start_ms;
+
+		std::atomic<uint64_t> _record_count;
+		mutable std::mutex _samples_mutex;
+		std::deque<Sample> _samples;
+	};
+}  // namespace mon
@@ -87,6 +87,7 @@ namespace mon
 	{
 		_server_metric	 = std::make_shared<ServerMetrics>(server_config);
 		_is_analytics_on = _server_metric->GetConfig()->GetAnalytics().IsParsed();
+		_is_latency_metrics_on = server_config->GetBind().GetManagers().GetApi().IsParsed();
 
 		_alert			 = std::make_shared<alrt::Alert>();
 		_alert->Start(server_config);
@@ -36,6 +36,12 @@ namespace mon
 			return _is_analytics_on;
 		}
 
+		// The latency of the publishers is only reported by the API server, so it is not traced if the API server is disabled
+		bool IsLatencyMetricsOn()
+		{
+			return _is_latency_metrics_on;
+		}
+
 		std::shared_ptr<ServerMetrics> GetServerMetrics();
 		std::map<uint32_t, std::shared_ptr<HostMetrics>> GetHostMetricsList();
 		std::shared_ptr<HostMetrics> GetHostMetrics(const info::Host &host_info);
@@ -69,5 +75,6 @@ namespace mon
 		EventForwarder _forwarder;
 		std::shared_ptr<alrt::Alert> _alert = nullptr;
 		bool _is_analytics_on				= false;
+		bool _is_latency_metrics_on			= false;
 	};
 }  // namespace mon
\ No newline at end of file
@@ -211,4 +211,34 @@ namespace mon
 
 		return _queues[queue_info.GetId()];
 	}
+
+	std::shared_ptr<TlsSessionMetrics> ServerMetrics::GetTlsSessionMetrics(const ov::String &address)
+	{
+		{
+			std::shared_lock<std::shared_mutex> lock(_tls_session_map_guard);
+
+			auto item = _tls_sessions.find(address);
+			if (item != _tls_sessions.end())
+			{
+				return item->second;
+			}
+		}
+
+		std::unique_lock<std::shared_mutex> lock(_tls_session_map_guard);
+
+		auto &metrics = _tls_sessions[address];
+		if (metrics == nullptr)
+		{
+			metrics = std::make_shared<TlsSessionMetrics>(address);
+		}
+
+		return metrics;
+	}
+
+	std::map<ov::String, std::shared_ptr<TlsSessionMetrics>> ServerMetrics::GetTlsSessionMetricsList()
+	{
+		std::shared_lock<std::shared_mutex> lock(_tls_session_map_guard);
+
+		return _tls_sessions;
+	}
 }  // namespace mon
\ No newline at end of file
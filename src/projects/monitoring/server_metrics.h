@@ -10,6 +10,7 @@
 #include "base/info/managed_queue.h"
 #include "host_metrics.h"
 #include "queue_metrics.h"
+#include "tls_session_metrics.h"
 
 namespace mon
 {
@@ -50,5 +51,15 @@ namespace mon
 	protected:
 		std::shared_mutex _queue_map_guard;
 		std::map<uint32_t, std::shared_ptr<QueueMetrics>> _queues;
+
+		// TLS session metrics
+	public:
+		// Returns the metrics of the TLS port (created if not exists)
+		std::shared_ptr<TlsSessionMetrics> GetTlsSessionMetrics(const ov::String &address);
+		std::map<ov::String, std::shared_ptr<TlsSessionMetrics>> GetTlsSessionMetricsList();
+
+	protected:
+		std::shared_mutex _tls_session_map_guard;
+		std::map<ov::String, std::shared_ptr<TlsSessionMetrics>> _tls_sessions;
 	};
 }  // namespace mon
\ No newline at end of file
@@ -98,6 +98,72 @@ namespace mon
 		}
 	}
 
+	void StreamMetrics::IncreaseSrtpProtectStats(uint64_t packets, uint64_t bytes, int64_t elapsed_us)
+	{
+		_srtp_protected_packets += packets;
+		_srtp_protected_bytes += bytes;
+		_srtp_protect_elapsed_us += elapsed_us;
+
+		// If this stream is child then send event to parent
+		auto origin_stream_info = GetLinkedInputStream();
+		if (origin_stream_info != nullptr)
+		{
+			auto origin_stream_metric = _app_metrics->GetStreamMetrics(*origin_stream_info);
+			if (origin_stream_metric != nullptr)
+			{
+				origin_stream_metric->IncreaseSrtpProtectStats(packets, bytes, elapsed_us);
+			}
+		}
+	}
+
+	uint64_t StreamMetrics::GetSrtpProtectedPackets() const
+	{
+		return _srtp_protected_packets.load();
+	}
+
+	uint64_t StreamMetrics::GetSrtpProtectedBytes() const
+	{
+		return _srtp_protected_bytes.load();
+	}
+
+	int64_t StreamMetrics::GetSrtpProtectElapsedUs() const
+	{
+		return _srtp_protect_elapsed_us.load();
+	}
+
+	void StreamMetrics::IncreaseCopiedFrameBytes(uint64_t bytes)
+	{
+		_copied_frame_bytes += bytes;
+
+		// If this stream is child then send event to parent
+		auto origin_stream_info = GetLinkedInputStream();
+		if (origin_stream_info != nullptr)
+		{
+			auto origin_stream_metric = _app_metrics->GetStreamMetrics(*origin_stream_info);
+			if (origin_stream_metric != nullptr)
+			{
+				origin_stream_metric->IncreaseCopiedFrameBytes(bytes);
+			}
+		}
+	}
+
+	uint64_t StreamMetrics::GetCopiedFrameBytes() const
+	{
+		return _copied_frame_bytes.load();
+	}
+
+	void StreamMetrics::SetNackStats(const NackStats &stats)
+	{
+		std::lock_guard<std::mutex> lock(_nack_stats_mutex);
+		_nack_stats = stats;
+	}
+
+	StreamMetrics::NackStats StreamMetrics::GetNackStats() const
+	{
+		std::lock_guard<std::mutex> lock(_nack_stats_mutex);
+		return _nack_stats;
+	}
+
 	void StreamMetrics::IncreaseModuleUsageCount(const std::shared_ptr<const MediaTrack> &media_track)
 	{
 		// Holds the `shared_ptr` to prevent it from being released while in use
@@ -236,4 +302,29 @@ namespace mon
 		}
 	}
 
-}  // namespace mon
\ No newline at end of file
+	std::shared_ptr<LatencyMetrics> StreamMetrics::GetLatencyMetrics(PublisherType type)
+	{
+		std::lock_guard<std::mutex> lock(_latency_metrics_map_mutex);
+
+		auto &latency_metrics = _latency_metrics_map[type];
+		if (latency_metrics == nullptr)
+		{
+			latency_metrics = std::make_shared<LatencyMetrics>(type);
+		}
+
+		return latency_metrics;
+	}
+
+	std::vector<std::shared_ptr<LatencyMetrics>> StreamMetrics::GetLatencyMetricsList() const
+	{
+		std::lock_guard<std::mutex> lock(_latency_metrics_map_mutex);
+
+		std::vector<std::shared_ptr<LatencyMetrics>> list;
+		for (const auto &[type, latency_metrics] : _latency_metrics_map)
+		{
+			list.push_back(latency_metrics);
+		}
+
+		return list;
+	}
+}  // namespace mon
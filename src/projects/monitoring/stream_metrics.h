@@ -10,6 +10,7 @@
 #include "base/info/info.h"
 #include "base/info/stream.h"
 #include "common_metrics.h"
+#include "latency_metrics.h"
 
 namespace mon
 {
@@ -62,6 +63,32 @@ namespace mon
 		void OnSessionDisconnected(PublisherType type) override;
 		void OnSessionsDisconnected(PublisherType type, uint64_t number_of_sessions) override;
 
+		// SRTP protection of the packets sent by the WebRTC sessions (also added to the input stream)
+		void IncreaseSrtpProtectStats(uint64_t packets, uint64_t bytes, int64_t elapsed_us);
+		uint64_t GetSrtpProtectedPackets() const;
+		uint64_t GetSrtpProtectedBytes() const;
+		int64_t GetSrtpProtectElapsedUs() const;
+
+		// Decoded frame data copied by copy-on-write in the transcoder (the frames are shared read-only otherwise)
+		void IncreaseCopiedFrameBytes(uint64_t bytes);
+		uint64_t GetCopiedFrameBytes() const;
+
+		// NACK based recovery of the packets received by the WebRTC provider (totals of all tracks)
+		struct NackStats
+		{
+			uint64_t lost_packets = 0;
+			uint64_t nack_requests = 0;
+			uint64_t requested_packets = 0;
+			uint64_t recovered_packets = 0;
+			uint64_t unrecovered_packets = 0;
+		};
+		void SetNackStats(const NackStats &stats);
+		NackStats GetNackStats() const;
+
+		// Latency of the hot path, measured by each publisher that sends this stream
+		std::shared_ptr<LatencyMetrics> GetLatencyMetrics(PublisherType type);
+		std::vector<std::shared_ptr<LatencyMetrics>> GetLatencyMetricsList() const;
+
 	private:
 		// Related to origin, From Provider
 		std::atomic<int64_t> _connection_time_to_origin_msec  = 0;
@@ -74,5 +101,17 @@ namespace mon
 
 		std::mutex _module_usage_count_map_mutex;
 		std::unordered_map<MediaTrackId, std::shared_ptr<const MediaTrack>> _module_usage_count_map;
+
+		std::atomic<uint64_t> _srtp_protected_packets = 0;
+		std::atomic<uint64_t> _srtp_protected_bytes = 0;
+		std::atomic<int64_t> _srtp_protect_elapsed_us = 0;
+
+		std::atomic<uint64_t> _copied_frame_bytes = 0;
+
+		mutable std::mutex _nack_stats_mutex;
+		NackStats _nack_stats;
+
+		mutable std::mutex _latency_metrics_map_mutex;
+		std::map<PublisherType, std::shared_ptr<LatencyMetrics>> _latency_metrics_map;
 	};
 }  // namespace mon
\ No newline at end of file
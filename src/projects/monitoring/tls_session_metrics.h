@@ -0,0 +1,68 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <atomic>
+
+namespace mon
+{
+	// TLS handshake statistics of a TLS port
+	class TlsSessionMetrics
+	{
+	public:
+		TlsSessionMetrics(const ov::String &address)
+			: _address(address)
+		{
+		}
+
+		const ov::String &GetAddress() const
+		{
+			return _address;
+		}
+
+		void OnHandshakeCompleted(bool resumed)
+		{
+			if (resumed)
+			{
+				_resumed_handshake_count++;
+			}
+			else
+			{
+				_full_handshake_count++;
+			}
+		}
+
+		uint64_t GetFullHandshakeCount() const
+		{
+			return _full_handshake_count;
+		}
+
+		uint64_t GetResumedHandshakeCount() const
+		{
+			return _resumed_handshake_count;
+		}
+
+		// Ratio of the resumed handshakes (0.0 ~ 1.0)
+		double GetResumptionHitRatio() const
+		{
+			uint64_t resumed = _resumed_handshake_count;
+			uint64_t total = resumed + _full_handshake_count;
+
+			return (total > 0) ? (static_cast<double>(resumed) / static_cast<double>(total)) : 0.0;
+		}
+
+	private:
+		ov::String _address;
+
+		std::atomic<uint64_t> _full_handshake_count{0};
+		std::atomic<uint64_t> _resumed_handshake_count{0};
+	};
+}  // namespace mon
@@ -756,7 +756,7 @@ namespace ocst
 		return prov_stream;
 	}
 
-	CommonErrorCode Orchestrator::IsExistStreamInOriginMapStore(const info::VHostAppName &vhost_app_name, const ov::String &stream_name) const
+	CommonErrorCode Orchestrator::GetOriginFromOriginMapStore(const info::VHostAppName &vhost_app_name, const ov::String &stream_name, ov::String &origin_url) const
 	{
 		auto vhost = GetVirtualHost(vhost_app_name);
 		if (vhost == nullptr)
@@ -778,38 +778,73 @@ namespace ocst
 			return CommonErrorCode::ERROR;
 		}
 
-		auto app_stream_name = ov::String::FormatString("%s/%s", vhost_app_name.GetAppName().CStr(), stream_name.CStr());
+		auto cache_key = ov::String::FormatString("%s/%s", vhost_app_name.CStr(), stream_name.CStr());
+		auto now = std::chrono::steady_clock::now();
 
-		ov::String temp_str;
-		return client->GetOrigin(app_stream_name, temp_str);
-	}
-
-	std::shared_ptr<ov::Url> Orchestrator::GetOriginUrlFromOriginMapStore(const info::VHostAppName &vhost_app_name, const ov::String &stream_name) const
-	{
-		auto vhost = GetVirtualHost(vhost_app_name);
-		if (vhost == nullptr)
 		{
-			// Error
-			return nullptr;
-		}
+			std::lock_guard<std::mutex> lock(_origin_map_store_cache_mutex);
 
-		if (vhost->IsOriginMapStoreEnabled() == false)
-		{
-			// disabled by user
-			return nullptr;
+			auto item = _origin_map_store_cache.find(cache_key);
+			if (item != _origin_map_store_cache.end())
+			{
+				if (item->second.expire_time > now)
+				{
+					origin_url = item->second.origin_url;
+					return item->second.result;
+				}
+
+				_origin_map_store_cache.erase(item);
+			}
 		}
 
-		auto client = vhost->GetOriginMapClient();
-		if (client == nullptr)
+		auto app_stream_name = ov::String::FormatString("%s/%s", vhost_app_name.GetAppName().CStr(), stream_name.CStr());
+		auto result = client->GetOrigin(app_stream_name, origin_url);
+
+		// Errors (e.g. the store is not reachable) are not cached so that the next request retries
+		if ((result == CommonErrorCode::SUCCESS) || (result == CommonErrorCode::NOT_FOUND))
 		{
-			// Error
-			return nullptr;
+			std::lock_guard<std::mutex> lock(_origin_map_store_cache_mutex);
+
+			// Remove expired items so that the cache does not grow with the names of streams that have been requested once
+			for (auto it = _origin_map_store_cache.begin(); it != _origin_map_store_cache.end();)
+			{
+				if (it->second.expire_time <= now)
+				{
+					it = _origin_map_store_cache.erase(it);
+				}
+				else
+				{
+					++it;
+				}
+			}
+
+			auto &item = _origin_map_store_cache[cache_key];
+			item.result = result;
+			item.origin_url = origin_url;
+			item.expire_time = now + std::chrono::milliseconds((result == CommonErrorCode::SUCCESS) ? ORIGIN_MAP_STORE_CACHE_TTL_MS : ORIGIN_MAP_STORE_NEGATIVE_CACHE_TTL_MS);
 		}
 
-		auto app_stream_name = ov::String::FormatString("%s/%s", vhost_app_name.GetAppName().CStr(), stream_name.CStr());
+		return result;
+	}
+
+	void Orchestrator::InvalidateOriginMapStoreCache(const info::VHostAppName &vhost_app_name, const ov::String &stream_name)
+	{
+		auto cache_key = ov::String::FormatString("%s/%s", vhost_app_name.CStr(), stream_name.CStr());
+
+		std::lock_guard<std::mutex> lock(_origin_map_store_cache_mutex);
+		_origin_map_store_cache.erase(cache_key);
+	}
 
+	CommonErrorCode Orchestrator::IsExistStreamInOriginMapStore(const info::VHostAppName &vhost_app_name, const ov::String &stream_name) const
+	{
+		ov::String temp_str;
+		return GetOriginFromOriginMapStore(vhost_app_name, stream_name, temp_str);
+	}
+
+	std::shared_ptr<ov::Url> Orchestrator::GetOriginUrlFromOriginMapStore(const info::VHostAppName &vhost_app_name, const ov::String &stream_name) const
+	{
 		ov::String url_str;
-		if (client->GetOrigin(app_stream_name, url_str) == CommonErrorCode::SUCCESS)
+		if (GetOriginFromOriginMapStore(vhost_app_name, stream_name, url_str) == CommonErrorCode::SUCCESS)
 		{
 			return ov::Url::Parse(url_str);
 		}
@@ -841,6 +876,9 @@ namespace ocst
 
 		auto app_stream_name = ov::String::FormatString("%s/%s", vhost_app_name.GetAppName().CStr(), stream_name.CStr());
 		auto ovt_url = ov::String::FormatString("%s/%s", vhost->GetOriginBaseUrl().CStr(), app_stream_name.CStr());
+
+		InvalidateOriginMapStoreCache(vhost_app_name, stream_name);
+
 		if (client->Register(app_stream_name, ovt_url) == true)
 		{
 			return CommonErrorCode::SUCCESS;
@@ -873,6 +911,8 @@ namespace ocst
 
 		auto app_stream_name = ov::String::FormatString("%s/%s", vhost_app_name.GetAppName().CStr(), stream_name.CStr());
 
+		InvalidateOriginMapStoreCache(vhost_app_name, stream_name);
+
 		if (client->Unregister(app_stream_name) == true)
 		{
 			return CommonErrorCode::SUCCESS;
@@ -15,6 +15,13 @@
 #include "virtual_host.h"
 #include "module.h"
 
+// Lookups to the origin map store are cached for a short time so that a burst of requests
+// for a stream that does not exist yet on this edge does not hit the store for each request
+#define ORIGIN_MAP_STORE_CACHE_TTL_MS 1000
+// "Not found" is kept much shorter, since an edge that pulls right after the stream is published on the origin
+// would otherwise fail until the entry expires
+#define ORIGIN_MAP_STORE_NEGATIVE_CACHE_TTL_MS 100
+
 namespace ocst
 {
 	class Orchestrator : public ov::Singleton<Orchestrator>, 
@@ -210,6 +217,10 @@ namespace ocst
 
 		bool GetUrlListForLocation(const info::VHostAppName &vhost_app_name, const ov::String &host_name, const ov::String &stream_name, Origin &matched_origin, std::vector<ov::String> &url_list);
 
+		// Get the origin url of the stream from the origin map store (or the cache)
+		CommonErrorCode GetOriginFromOriginMapStore(const info::VHostAppName &vhost_app_name, const ov::String &stream_name, ov::String &origin_url) const;
+		void InvalidateOriginMapStoreCache(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
+
 		// Server Info
 		std::shared_ptr<const cfg::Server> 	_server_config;
 
@@ -227,9 +238,19 @@ namespace ocst
 		std::vector<std::shared_ptr<VirtualHost>> _virtual_host_list;
 		mutable std::shared_mutex _virtual_host_mutex;
 
+		struct OriginMapStoreCacheItem
+		{
+			CommonErrorCode result = CommonErrorCode::ERROR;
+			ov::String origin_url;
+			std::chrono::steady_clock::time_point expire_time;
+		};
+		// key: <vhost_app_name>/<stream_name>
+		mutable std::map<ov::String, OriginMapStoreCacheItem> _origin_map_store_cache;
+		mutable std::mutex _origin_map_store_cache_mutex;
+
 		std::shared_ptr<pvd::Stream> GetProviderStream(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
 
-		// Module Timer : It is called periodically by the timer
-		ov::DelayQueue _timer{"Orchestrator"};
+		// Module Timer : It is called periodically by the timer (on its own thread, since deleting applications blocks)
+		ov::DelayQueue _timer{"Orchestrator", ov::DelayQueueThreadMode::Dedicated};
 	};
 }  // namespace ocst
@@ -53,6 +53,7 @@ namespace pvd
         std::shared_ptr<pvd::Application> OnCreateProviderApplication(const info::Application &application_info) override;
         bool OnDeleteProviderApplication(const std::shared_ptr<pvd::Application> &application) override;
 
-        ov::DelayQueue _multiplex_watcher_timer{"AppTicker"};
+        // The multiplex files are read on the tick, so it runs on its own thread
+        ov::DelayQueue _multiplex_watcher_timer{"AppTicker", ov::DelayQueueThreadMode::Dedicated};
     };
 }
\ No newline at end of file
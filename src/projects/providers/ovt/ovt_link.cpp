@@ -0,0 +1,438 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "ovt_link.h"
+
+#include <modules/ovt_packetizer/ovt_packetizer.h>
+#include <netinet/tcp.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#define OV_LOG_TAG "OvtLink"
+
+namespace pvd
+{
+	OvtLinkChannel::OvtLinkChannel(uint32_t id)
+		: _id(id)
+	{
+		_event_fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		if (_event_fd < 0)
+		{
+			logte("Could not create eventfd for channel %u : %s", _id, ov::Error::CreateErrorFromErrno()->What());
+		}
+	}
+
+	OvtLinkChannel::~OvtLinkChannel()
+	{
+		if (_event_fd >= 0)
+		{
+			::close(_event_fd);
+			_event_fd = -1;
+		}
+	}
+
+	uint32_t OvtLinkChannel::GetId() const
+	{
+		return _id;
+	}
+
+	int OvtLinkChannel::GetEventFd() const
+	{
+		return _event_fd;
+	}
+
+	bool OvtLinkChannel::IsClosed() const
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		return _closed;
+	}
+
+	size_t OvtLinkChannel::GetBufferedBytes() const
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		return _depacketizer.GetBufferedBytes();
+	}
+
+	std::shared_ptr<ov::Data> OvtLinkChannel::WaitForMessage(int timeout_msec)
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+
+		_condition.wait_for(lock, std::chrono::milliseconds(timeout_msec), [this]() -> bool {
+			return _closed || _depacketizer.IsAvailableMessage();
+		});
+
+		if (_depacketizer.IsAvailableMessage() == false)
+		{
+			return nullptr;
+		}
+
+		return _depacketizer.PopMessage();
+	}
+
+	bool OvtLinkChannel::IsAvailableMessage()
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		return _depacketizer.IsAvailableMessage();
+	}
+
+	bool OvtLinkChannel::IsAvailableMediaPacket()
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		return _depacketizer.IsAvailableMediaPacket();
+	}
+
+	std::shared_ptr<ov::Data> OvtLinkChannel::PopMessage()
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (_depacketizer.IsAvailableMessage() == false)
+		{
+			return nullptr;
+		}
+
+		return _depacketizer.PopMessage();
+	}
+
+	std::shared_ptr<MediaPacket> OvtLinkChannel::PopMediaPacket()
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (_depacketizer.IsAvailableMediaPacket() == false)
+		{
+			return nullptr;
+		}
+
+		return _depacketizer.PopMediaPacket();
+	}
+
+	void OvtLinkChannel::ResetEvent()
+	{
+		if (_event_fd < 0)
+		{
+			return;
+		}
+
+		eventfd_t value;
+		[[maybe_unused]] auto result = ::eventfd_read(_event_fd, &value);
+	}
+
+	bool OvtLinkChannel::AppendPacket(const std::shared_ptr<OvtPacket> &packet)
+	{
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			if (_closed)
+			{
+				// The packets that arrive after the stop are dropped
+				return true;
+			}
+
+			if (_depacketizer.AppendPacket(packet) == false)
+			{
+				return false;
+			}
+
+			if (_depacketizer.GetBufferedBytes() > OVT_LINK_CHANNEL_MAX_BUFFER_SIZE)
+			{
+				logtw("Channel %u buffers %zu bytes which exceeds the limit (%d), the stream does not drain it", _id, _depacketizer.GetBufferedBytes(), OVT_LINK_CHANNEL_MAX_BUFFER_SIZE);
+				return false;
+			}
+		}
+
+		// A packet may complete a message or a media packet only when the marker is set
+		if (packet->Marker())
+		{
+			_condition.notify_all();
+			SignalEvent();
+		}
+
+		return true;
+	}
+
+	void OvtLinkChannel::Close()
+	{
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_closed = true;
+		}
+
+		_condition.notify_all();
+		SignalEvent();
+	}
+
+	void OvtLinkChannel::SignalEvent()
+	{
+		if (_event_fd < 0)
+		{
+			return;
+		}
+
+		[[maybe_unused]] auto result = ::eventfd_write(_event_fd, 1);
+	}
+
+	std::shared_ptr<OvtLink> OvtLink::Create(const std::shared_ptr<ov::SocketPool> &pool, const ov::SocketAddress &address)
+	{
+		auto socket = pool->AllocSocket(address.GetFamily());
+		if (socket == nullptr)
+		{
+			logte("To create client socket is failed.");
+			return nullptr;
+		}
+
+		socket->SetSockOpt<int>(IPPROTO_TCP, TCP_NODELAY, 1);
+		socket->SetSockOpt<int>(IPPROTO_TCP, TCP_QUICKACK, 1);
+		socket->MakeBlocking();
+
+		struct timeval tv = {1, 500000};  // 1.5 sec
+		socket->SetRecvTimeout(tv);
+
+		auto error = socket->Connect(address, 1500);
+		if (error != nullptr)
+		{
+			logte("Cannot connect to origin server (%s) : (%s)", error->GetMessage().CStr(), address.ToString().CStr());
+			socket->Close();
+			return nullptr;
+		}
+
+		auto link = std::make_shared<OvtLink>(socket, address);
+		if (link->Start() == false)
+		{
+			link->Stop();
+			return nullptr;
+		}
+
+		logti("OVT link to %s has been established", address.ToString().CStr());
+
+		return link;
+	}
+
+	OvtLink::OvtLink(const std::shared_ptr<ov::Socket> &socket, const ov::SocketAddress &address)
+		: _socket(socket),
+		  _address(address),
+		  _connected(true),
+		  _stop(false)
+	{
+	}
+
+	OvtLink::~OvtLink()
+	{
+		Stop();
+	}
+
+	bool OvtLink::IsConnected() const
+	{
+		return _connected;
+	}
+
+	const ov::SocketAddress &OvtLink::GetAddress() const
+	{
+		return _address;
+	}
+
+	bool OvtLink::Start()
+	{
+		_depacketizer.SetPacketHandler(std::bind(&OvtLink::OnPacket, this, std::placeholders::_1));
+
+		try
+		{
+			_receive_thread = std::thread(&OvtLink::ReceiveThread, this);
+			pthread_setname_np(_receive_thread.native_handle(), "OvtLink");
+		}
+		catch (const std::system_error &e)
+		{
+			logte("Could not start the receive thread of OVT link : %s", e.what());
+			return false;
+		}
+
+		return true;
+	}
+
+	void OvtLink::Stop()
+	{
+		if (_stop.exchange(true))
+		{
+			return;
+		}
+
+		_connected = false;
+
+		if (_socket != nullptr)
+		{
+			_socket->Close();
+		}
+
+		if (_receive_thread.joinable())
+		{
+			_receive_thread.join();
+		}
+
+		CloseAllChannels();
+	}
+
+	std::shared_ptr<OvtLinkChannel> OvtLink::OpenChannel()
+	{
+		if (IsConnected() == false)
+		{
+			return nullptr;
+		}
+
+		std::lock_guard<std::mutex> lock(_channels_mutex);
+
+		if (_channels.size() >= (OVT_LINK_MAX_CHANNEL_ID - OVT_LINK_MIN_CHANNEL_ID + 1))
+		{
+			logtw("There is no available channel in OVT link to %s", _address.ToString().CStr());
+			return nullptr;
+		}
+
+		// Find the next unused channel ID
+		uint32_t channel_id = _last_channel_id;
+		do
+		{
+			channel_id = (channel_id >= OVT_LINK_MAX_CHANNEL_ID) ? OVT_LINK_MIN_CHANNEL_ID : (channel_id + 1);
+		} while (_channels.find(channel_id) != _channels.end());
+
+		_last_channel_id = channel_id;
+
+		auto channel = std::make_shared<OvtLinkChannel>(channel_id);
+		if (channel->GetEventFd() < 0)
+		{
+			return nullptr;
+		}
+
+		_channels.emplace(channel_id, channel);
+
+		logtd("Channel %u is opened in OVT link to %s (%zu channels)", channel_id, _address.ToString().CStr(), _channels.size());
+
+		return channel;
+	}
+
+	void OvtLink::CloseChannel(const std::shared_ptr<OvtLinkChannel> &channel)
+	{
+		if (channel == nullptr)
+		{
+			return;
+		}
+
+		channel->Close();
+
+		std::lock_guard<std::mutex> lock(_channels_mutex);
+		auto item = _channels.find(channel->GetId());
+		if ((item != _channels.end()) && (item->second == channel))
+		{
+			_channels.erase(item);
+		}
+
+		logtd("Channel %u is closed in OVT link to %s (%zu channels)", channel->GetId(), _address.ToString().CStr(), _channels.size());
+	}
+
+	size_t OvtLink::GetChannelCount() const
+	{
+		std::lock_guard<std::mutex> lock(_channels_mutex);
+		return _channels.size();
+	}
+
+	bool OvtLink::SendMessage(uint32_t channel_id, const std::shared_ptr<ov::Data> &message)
+	{
+		if (IsConnected() == false)
+		{
+			return false;
+		}
+
+		OvtPacketizer packetizer;
+		if (packetizer.PacketizeMessage(OVT_PAYLOAD_TYPE_MESSAGE_REQUEST, ov::Clock::NowMSec(), message) == false)
+		{
+			return false;
+		}
+
+		// Fragments of a message must not be interleaved with the fragments of another channel
+		std::lock_guard<std::mutex> lock(_send_mutex);
+
+		while (packetizer.IsAvailablePackets())
+		{
+			auto packet = packetizer.PopPacket();
+			packet->SetSessionId(channel_id);
+
+			if (_socket->Send(packet->GetDataList()) == false)
+			{
+				logte("Could not send message to %s (channel %u)", _address.ToString().CStr(), channel_id);
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void OvtLink::ReceiveThread()
+	{
+		uint8_t buffer[65535];
+
+		while (_stop == false)
+		{
+			size_t read_bytes = 0ULL;
+			auto error = _socket->Recv(buffer, sizeof(buffer), &read_bytes);
+
+			if (read_bytes == 0)
+			{
+				if ((error != nullptr) && (error->GetCode() == EAGAIN))
+				{
+					// Timed out, the link is kept until all channels are closed
+					continue;
+				}
+
+				if (_stop == false)
+				{
+					logte("OVT link to %s is disconnected : %s", _address.ToString().CStr(), (error != nullptr) ? error->What() : "Unknown");
+				}
+				break;
+			}
+
+			if (_depacketizer.AppendPacket(buffer, read_bytes) == false)
+			{
+				logte("An error occurred while parsing packet from %s: Invalid packet", _address.ToString().CStr());
+				break;
+			}
+		}
+
+		_connected = false;
+
+		// The streams of the closed channels are terminated and will be restarted by the failover
+		CloseAllChannels();
+	}
+
+	bool OvtLink::OnPacket(const std::shared_ptr<OvtPacket> &packet)
+	{
+		std::shared_ptr<OvtLinkChannel> channel;
+
+		{
+			std::lock_guard<std::mutex> lock(_channels_mutex);
+			auto item = _channels.find(packet->SessionId());
+			if (item == _channels.end())
+			{
+				// The channel has already been closed
+				return true;
+			}
+
+			channel = item->second;
+		}
+
+		if (channel->AppendPacket(packet) == false)
+		{
+			logtw("Could not append packet to channel %u of OVT link to %s", channel->GetId(), _address.ToString().CStr());
+			channel->Close();
+		}
+
+		return true;
+	}
+
+	void OvtLink::CloseAllChannels()
+	{
+		std::lock_guard<std::mutex> lock(_channels_mutex);
+
+		for (auto &item : _channels)
+		{
+			item.second->Close();
+		}
+	}
+}  // namespace pvd
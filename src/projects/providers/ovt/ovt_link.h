@@ -0,0 +1,120 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+#include <base/ovsocket/ovsocket.h>
+#include <modules/ovt_packetizer/ovt_depacketizer.h>
+#include <modules/ovt_packetizer/ovt_packet.h>
+
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+
+// Channel ID 0 is used by the non-multiplexed connections
+#define OVT_LINK_MIN_CHANNEL_ID 1
+#define OVT_LINK_MAX_CHANNEL_ID 0xFFFF
+// A channel whose stream does not drain the packets is closed when this many bytes are buffered,
+// so that a stalled stream cannot grow the memory without bound (the other channels of the link are not affected)
+#define OVT_LINK_CHANNEL_MAX_BUFFER_SIZE (32 * 1024 * 1024)
+
+namespace pvd
+{
+	// A stream that is pulled through an OvtLink.
+	// The packets of the channel are assembled by its own depacketizer and the stream is woken up through an eventfd,
+	// so the channel can be registered to the epoll of the StreamMotor like a socket.
+	class OvtLinkChannel
+	{
+	public:
+		explicit OvtLinkChannel(uint32_t id);
+		~OvtLinkChannel();
+
+		uint32_t GetId() const;
+		// eventfd that is readable while there is something to process
+		int GetEventFd() const;
+
+		bool IsClosed() const;
+		size_t GetBufferedBytes() const;
+
+		// Waits for a response message (used while describing/playing)
+		std::shared_ptr<ov::Data> WaitForMessage(int timeout_msec);
+
+		bool IsAvailableMessage();
+		bool IsAvailableMediaPacket();
+		std::shared_ptr<ov::Data> PopMessage();
+		std::shared_ptr<MediaPacket> PopMediaPacket();
+
+		// Must be called before draining the channel, so that a packet appended while draining triggers the next event
+		void ResetEvent();
+
+	protected:
+		friend class OvtLink;
+
+		// Called by the receive thread of the link
+		bool AppendPacket(const std::shared_ptr<OvtPacket> &packet);
+		void Close();
+
+	private:
+		void SignalEvent();
+
+		const uint32_t _id;
+		int _event_fd = -1;
+
+		mutable std::mutex _mutex;
+		std::condition_variable _condition;
+		OvtDepacketizer _depacketizer;
+		bool _closed = false;
+	};
+
+	// A TCP connection to an origin that is shared by several streams.
+	// Each stream uses its own channel, and the SessionID field of the OVT header carries the channel ID.
+	class OvtLink
+	{
+	public:
+		static std::shared_ptr<OvtLink> Create(const std::shared_ptr<ov::SocketPool> &pool, const ov::SocketAddress &address);
+
+		OvtLink(const std::shared_ptr<ov::Socket> &socket, const ov::SocketAddress &address);
+		~OvtLink();
+
+		bool IsConnected() const;
+		const ov::SocketAddress &GetAddress() const;
+
+		std::shared_ptr<OvtLinkChannel> OpenChannel();
+		void CloseChannel(const std::shared_ptr<OvtLinkChannel> &channel);
+		size_t GetChannelCount() const;
+
+		// Sends a message through the channel (thread-safe)
+		bool SendMessage(uint32_t channel_id, const std::shared_ptr<ov::Data> &message);
+
+		void Stop();
+
+	private:
+		bool Start();
+		void ReceiveThread();
+		bool OnPacket(const std::shared_ptr<OvtPacket> &packet);
+		void CloseAllChannels();
+
+		std::shared_ptr<ov::Socket> _socket;
+		ov::SocketAddress _address;
+
+		std::atomic<bool> _connected;
+		std::atomic<bool> _stop;
+		std::thread _receive_thread;
+
+		// Receive thread only
+		OvtDepacketizer _depacketizer;
+
+		std::mutex _send_mutex;
+
+		mutable std::mutex _channels_mutex;
+		std::map<uint32_t, std::shared_ptr<OvtLinkChannel>> _channels;
+		uint32_t _last_channel_id = OVT_LINK_MIN_CHANNEL_ID - 1;
+	};
+}  // namespace pvd
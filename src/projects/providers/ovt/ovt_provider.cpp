@@ -40,6 +40,19 @@ namespace pvd
 	{
 		Stop();
 
+		{
+			std::lock_guard<std::mutex> lock(_links_mutex);
+			for (auto &item : _links)
+			{
+				// nullptr is the entry of a link being connected
+				if (item.second != nullptr)
+				{
+					item.second->Stop();
+				}
+			}
+			_links.clear();
+		}
+
 		if (_client_socket_pool != nullptr)
 		{
 			_client_socket_pool->Uninitialize();
@@ -59,6 +72,121 @@ namespace pvd
 		return _client_socket_pool;
 	}
 
+	std::shared_ptr<OvtLinkChannel> OvtProvider::OpenLinkChannel(const ov::SocketAddress &address, std::shared_ptr<OvtLink> &link)
+	{
+		auto pool = GetClientSocketPool();
+		if (pool == nullptr)
+		{
+			return nullptr;
+		}
+
+		auto key = address.ToString();
+
+		std::unique_lock<std::mutex> lock(_links_mutex);
+
+		while (true)
+		{
+			auto item = _links.find(key);
+			if (item == _links.end())
+			{
+				break;
+			}
+
+			if (item->second == nullptr)
+			{
+				// Another stream is connecting to the origin, wait for it instead of connecting twice
+				_links_condition.wait(lock);
+				continue;
+			}
+
+			link = item->second;
+
+			if (link->IsConnected() == false)
+			{
+				// The remaining channels of the disconnected link are already closed, they will be released by their streams
+				_links.erase(item);
+				link = nullptr;
+			}
+
+			break;
+		}
+
+		if (link == nullptr)
+		{
+			// Connecting may take a while, so it is done without the lock and the other streams of this origin wait for the pending entry
+			_links.emplace(key, nullptr);
+			lock.unlock();
+
+			auto new_link = OvtLink::Create(pool, address);
+
+			lock.lock();
+
+			if (new_link == nullptr)
+			{
+				_links.erase(key);
+				_links_condition.notify_all();
+				return nullptr;
+			}
+
+			_links[key] = new_link;
+			_links_condition.notify_all();
+
+			link = new_link;
+		}
+
+		auto channel = link->OpenChannel();
+		if ((channel == nullptr) && (link->GetChannelCount() == 0))
+		{
+			// Don't keep a link without channels
+			auto item = _links.find(key);
+			if ((item != _links.end()) && (item->second == link))
+			{
+				_links.erase(item);
+			}
+
+			lock.unlock();
+
+			logtw("Could not open a channel in the OVT link to %s", key.CStr());
+			link->Stop();
+			link = nullptr;
+		}
+
+		return channel;
+	}
+
+	void OvtProvider::CloseLinkChannel(const std::shared_ptr<OvtLink> &link, const std::shared_ptr<OvtLinkChannel> &channel)
+	{
+		if (link == nullptr)
+		{
+			return;
+		}
+
+		std::shared_ptr<OvtLink> unused_link;
+
+		{
+			std::lock_guard<std::mutex> lock(_links_mutex);
+
+			link->CloseChannel(channel);
+
+			if (link->GetChannelCount() == 0)
+			{
+				auto item = _links.find(link->GetAddress().ToString());
+				if ((item != _links.end()) && (item->second == link))
+				{
+					_links.erase(item);
+				}
+
+				unused_link = link;
+			}
+		}
+
+		if (unused_link != nullptr)
+		{
+			logti("OVT link to %s is released", unused_link->GetAddress().ToString().CStr());
+			unused_link->Stop();
+		}
+	}
+
 	bool OvtProvider::OnCreateHost(const info::Host &host_info)
 	{
 		return true;
@@ -10,6 +10,8 @@
 #include <base/provider/pull_provider/provider.h>
 #include <orchestrator/orchestrator.h>
 
+#include "ovt_link.h"
+
 /*
  * OvtProvider
  * 		: Create PhysicalPort, OvtApplication
@@ -53,6 +55,11 @@ namespace pvd
 
 		std::shared_ptr<ov::SocketPool> GetClientSocketPool();
 
+		// Opens a channel in the link to the origin (a link is created if there is no connected link to the origin)
+		std::shared_ptr<OvtLinkChannel> OpenLinkChannel(const ov::SocketAddress &address, std::shared_ptr<OvtLink> &link);
+		// The link is disconnected when the last channel is closed
+		void CloseLinkChannel(const std::shared_ptr<OvtLink> &link, const std::shared_ptr<OvtLinkChannel> &channel);
+
 	protected:
 		bool OnCreateHost(const info::Host &host_info) override;
 		bool OnDeleteHost(const info::Host &host_info) override;
@@ -61,5 +68,11 @@ namespace pvd
 
 		std::shared_ptr<ov::SocketPool> _client_socket_pool = nullptr;
 		int _worker_count = 1;
+
+		// Links for the multiplexed streams, key : address of the origin
+		// (the value is nullptr while the link is being connected, and _links_condition is notified when it is done)
+		std::mutex _links_mutex;
+		std::condition_variable _links_condition;
+		std::map<ov::String, std::shared_ptr<OvtLink>> _links;
 	};
 }  // namespace pvd
\ No newline at end of file
@@ -39,6 +39,7 @@ namespace pvd
 		: pvd::PullStream(application, stream_info, url_list, properties)
 	{
 		_last_request_id = 0;
+		_multiplex = GetApplicationInfo().GetConfig().GetProviders().GetOvtProvider().IsMultiplex();
 		SetState(State::IDLE);
 		logtd("OvtStream Created : %d", GetId());
 	}
@@ -58,6 +59,24 @@ namespace pvd
 			client_socket->Close();
 		}
 
+		auto link = _link;
+		auto channel = _channel;
+		if (link != nullptr)
+		{
+			auto provider = GetOvtProvider();
+			if (provider != nullptr)
+			{
+				provider->CloseLinkChannel(link, channel);
+			}
+			else
+			{
+				link->CloseChannel(channel);
+			}
+
+			_channel = nullptr;
+			_link = nullptr;
+		}
+
 		_curr_url = nullptr;
 
 		std::lock_guard<std::shared_mutex> mlock(_packetizer_lock);
@@ -175,6 +194,13 @@ namespace pvd
 			return false;
 		}
 
+		auto socket_address = ov::SocketAddress::CreateAndGetFirst(_curr_url->Host(), _curr_url->Port());
+
+		if (_multiplex)
+		{
+			return OpenLinkChannel(socket_address);
+		}
+
 		auto pool = GetOvtProvider()->GetClientSocketPool();
 
 		if (pool == nullptr)
@@ -183,8 +209,6 @@ namespace pvd
 			return false;
 		}
 
-		auto socket_address = ov::SocketAddress::CreateAndGetFirst(_curr_url->Host(), _curr_url->Port());
-
 		auto client_socket = pool->AllocSocket(socket_address.GetFamily());
 
 		if (client_socket == nullptr)
@@ -216,6 +240,44 @@ namespace pvd
 		return true;
 	}
 
+	bool OvtStream::OpenLinkChannel(const ov::SocketAddress &socket_address)
+	{
+		std::shared_ptr<OvtLink> link;
+		auto channel = GetOvtProvider()->OpenLinkChannel(socket_address, link);
+		if (channel == nullptr)
+		{
+			SetState(State::ERROR);
+			logte("Could not open a channel to origin server (%s)", socket_address.ToString().CStr());
+			return false;
+		}
+
+		_link = link;
+		_channel = channel;
+
+		logtd("[%s/%s(%u)] uses channel %u of the link to %s", GetApplicationTypeName(), GetName().CStr(), GetId(), channel->GetId(), socket_address.ToString().CStr());
+
+		SetState(State::CONNECTED);
+
+		return true;
+	}
+
+	bool OvtStream::SendRequest(Json::Value &root)
+	{
+		auto link = _link;
+		auto channel = _channel;
+
+		if (channel != nullptr)
+		{
+			root["channel"] = channel->GetId();
+			return link->SendMessage(channel->GetId(), ov::Json::Stringify(root).ToData(false));
+		}
+
+		auto message = ov::Json::Stringify(root).ToData(false);
+
+		std::shared_lock<std::shared_mutex> lock(_packetizer_lock);
+		return _packetizer->PacketizeMessage(OVT_PAYLOAD_TYPE_MESSAGE_REQUEST, ov::Clock::NowMSec(), message);
+	}
+
 	bool OvtStream::RequestDescribe()
 	{
 		if (GetState() != State::CONNECTED)
@@ -230,10 +292,7 @@ namespace pvd
 		root["application"] = "describe";
 		root["target"] = _curr_url->Source().CStr();
 
-		auto message = ov::Json::Stringify(root).ToData(false);
-
-		std::shared_lock<std::shared_mutex> lock(_packetizer_lock);
-		if (_packetizer->PacketizeMessage(OVT_PAYLOAD_TYPE_MESSAGE_REQUEST, ov::Clock::NowMSec(), message) == false)
+		if (SendRequest(root) == false)
 		{
 			return false;
 		}
@@ -510,10 +569,7 @@ namespace pvd
 		root["application"] = "play";
 		root["target"] = _curr_url->Source().CStr();
 
-		auto message = ov::Json::Stringify(root).ToData(false);
-
-		std::shared_lock<std::shared_mutex> lock(_packetizer_lock);
-		if (_packetizer->PacketizeMessage(OVT_PAYLOAD_TYPE_MESSAGE_REQUEST, ov::Clock::NowMSec(), message) == false)
+		if (SendRequest(root) == false)
 		{
 			logte("%s/%s(%u) - Could not request to play. Socket send error", GetApplicationInfo().GetVHostAppName().CStr(), GetName().CStr(), GetId());
 			return false;
@@ -595,15 +651,7 @@ namespace pvd
 		root["application"] = "stop";
 		root["target"] = _curr_url->Source().CStr();
 
-		auto message = ov::Json::Stringify(root).ToData(false);
-
-		std::shared_lock<std::shared_mutex> lock(_packetizer_lock);
-		if (_packetizer->PacketizeMessage(OVT_PAYLOAD_TYPE_MESSAGE_REQUEST, ov::Clock::NowMSec(), message) == false)
-		{
-			return false;
-		}
-
-		return true;
+		return SendRequest(root);
 	}
 
 	bool OvtStream::OnOvtPacketized(std::shared_ptr<OvtPacket> &packet)
@@ -616,7 +664,7 @@ namespace pvd
 			return false;
 		}
 
-		if (client_socket->Send(packet->GetData()) == false)
+		if (client_socket->Send(packet->GetDataList()) == false)
 		{
 			SetState(State::ERROR);
 			logte("Could not send message");
@@ -628,6 +676,19 @@ namespace pvd
 
 	std::shared_ptr<ov::Data> OvtStream::ReceiveMessage()
 	{
+		auto channel = _channel;
+		if (channel != nullptr)
+		{
+			auto message = channel->WaitForMessage(OVT_TIMEOUT_MSEC);
+			if (message == nullptr)
+			{
+				logte("%s/%s(%u) - Could not receive message from channel %u%s", GetApplicationInfo().GetVHostAppName().CStr(), GetName().CStr(), GetId(), channel->GetId(), channel->IsClosed() ? " : channel is closed" : "");
+				SetState(State::ERROR);
+			}
+
+			return message;
+		}
+
 		while (true)
 		{
 			auto result = ReceivePacket();
@@ -695,8 +756,38 @@ namespace pvd
 		return true;
 	}
 
+	bool OvtStream::IsAvailableMessage()
+	{
+		auto channel = _channel;
+		return (channel != nullptr) ? channel->IsAvailableMessage() : _depacketizer.IsAvailableMessage();
+	}
+
+	bool OvtStream::IsAvailableMediaPacket()
+	{
+		auto channel = _channel;
+		return (channel != nullptr) ? channel->IsAvailableMediaPacket() : _depacketizer.IsAvailableMediaPacket();
+	}
+
+	std::shared_ptr<ov::Data> OvtStream::PopMessage()
+	{
+		auto channel = _channel;
+		return (channel != nullptr) ? channel->PopMessage() : _depacketizer.PopMessage();
+	}
+
+	std::shared_ptr<MediaPacket> OvtStream::PopMediaPacket()
+	{
+		auto channel = _channel;
+		return (channel != nullptr) ? channel->PopMediaPacket() : _depacketizer.PopMediaPacket();
+	}
+
 	int OvtStream::GetFileDescriptorForDetectingEvent()
 	{
+		auto channel = _channel;
+		if (channel != nullptr)
+		{
+			return channel->GetEventFd();
+		}
+
 		auto client_socket = _client_socket;
 		if (client_socket == nullptr)
 		{
@@ -707,20 +798,32 @@ namespace pvd
 
 	PullStream::ProcessMediaResult OvtStream::ProcessMediaPacket()
 	{
+		auto channel = _channel;
+		if (channel != nullptr)
+		{
+			// The packets are received by the link, so just process what the channel has
+			channel->ResetEvent();
+
+			if (channel->IsClosed() && (IsAvailableMediaPacket() == false) && (IsAvailableMessage() == false))
+			{
+				logte("%s/%s(%u) - Channel %u has been closed", GetApplicationInfo().GetVHostAppName().CStr(), GetName().CStr(), GetId(), channel->GetId());
+				SetState(State::ERROR);
+				return ProcessMediaResult::PROCESS_MEDIA_FAILURE;
+			}
+		}
 		// Non block
-		auto result = ReceivePacket(true);
-		if (result == false)
+		else if (ReceivePacket(true) == false)
 		{
-			logte("%s/%s(%u) - Could not receive packet : err(%d)", GetApplicationInfo().GetVHostAppName().CStr(), GetName().CStr(), GetId(), static_cast<uint8_t>(result));
+			logte("%s/%s(%u) - Could not receive packet", GetApplicationInfo().GetVHostAppName().CStr(), GetName().CStr(), GetId());
 			SetState(State::ERROR);
 			return ProcessMediaResult::PROCESS_MEDIA_FAILURE;
 		}
 
 		while (true)
 		{
-			if (_depacketizer.IsAvailableMediaPacket()) 
+			if (IsAvailableMediaPacket()) 
 			{
-				auto media_packet = _depacketizer.PopMediaPacket();
+				auto media_packet = PopMediaPacket();
 
 				media_packet->SetMsid(GetMsid());
 				media_packet->SetPacketType(cmn::PacketType::OVT);
@@ -743,16 +846,16 @@ namespace pvd
 
 				SendFrame(media_packet);
 
-				if (_depacketizer.IsAvailableMediaPacket() || _depacketizer.IsAvailableMessage())
+				if (IsAvailableMediaPacket() || IsAvailableMessage())
 				{
 					continue;
 				}
 
 				return PullStream::ProcessMediaResult::PROCESS_MEDIA_SUCCESS;
 			}
-			else if (_depacketizer.IsAvailableMessage())
+			else if (IsAvailableMessage())
 			{
-				auto message = _depacketizer.PopMessage();
+				auto message = PopMessage();
 
 				// Parsing Payload
 				ov::String payload(message->GetDataAs<char>(), message->GetLength());
@@ -15,6 +15,8 @@
 #include <base/provider/pull_provider/application.h>
 #include <base/provider/pull_provider/stream.h>
 
+#include "ovt_link.h"
+
 #define OVT_TIMEOUT_MSEC		3000
 
 namespace pvd
@@ -60,6 +62,8 @@ namespace pvd
 		bool StopStream() override; // Stop
 
 		bool ConnectOrigin();
+		bool OpenLinkChannel(const ov::SocketAddress &socket_address);
+		bool SendRequest(Json::Value &root);
 		bool RequestDescribe();
 		bool ReceiveDescribe(uint32_t request_id);
 		bool RequestPlay();
@@ -70,9 +74,20 @@ namespace pvd
 		bool ReceivePacket(bool non_block = false);
 		std::shared_ptr<ov::Data> ReceiveMessage();
 
+		// Dispatch to the channel in the multiplexed mode or to the depacketizer of the own connection
+		bool IsAvailableMessage();
+		bool IsAvailableMediaPacket();
+		std::shared_ptr<ov::Data> PopMessage();
+		std::shared_ptr<MediaPacket> PopMediaPacket();
+
 		void Release();
 
 		std::shared_ptr<ov::Socket> _client_socket = nullptr;
+
+		// <Providers><OVT><Multiplex>
+		bool _multiplex = false;
+		std::shared_ptr<OvtLink> _link = nullptr;
+		std::shared_ptr<OvtLinkChannel> _channel = nullptr;
 		std::shared_ptr<const ov::Url> _curr_url = nullptr;
 
 		uint32_t _last_request_id;
@@ -1830,15 +1830,18 @@ namespace pvd::rtmp
 
 	int32_t RtmpChunkHandler::HandleData(const std::shared_ptr<const ov::Data> &data)
 	{
-		int32_t total_bytes_used					 = 0;
-		std::shared_ptr<const ov::Data> current_data = data;
+		int32_t total_bytes_used = 0;
+		auto buffer				 = data->GetDataAs<uint8_t>();
+		size_t remaining_size	 = data->GetLength();
 
-		while (current_data->IsEmpty() == false)
+		while (remaining_size > 0)
 		{
 			size_t bytes_used = 0;
-			auto status		  = _chunk_parser.Parse(current_data, &bytes_used);
+			// Parse the chunks from the received memory directly instead of making a Subdata() for each chunk
+			auto status		  = _chunk_parser.Parse(buffer + total_bytes_used, remaining_size, &bytes_used);
 
 			total_bytes_used += bytes_used;
+			remaining_size -= bytes_used;
 
 			switch (status)
 			{
@@ -1853,15 +1856,13 @@ namespace pvd::rtmp
 					if (HandleChunkMessage() == false)
 					{
 						logad("HandleChunkMessage Fail");
-						logat("Failed to import packet\n%s", current_data->Dump(current_data->GetLength()).CStr());
+						logat("Failed to import packet\n%s", ov::Dump(buffer + total_bytes_used - bytes_used, remaining_size + bytes_used).CStr());
 
 						return -1LL;
 					}
 					break;
 			}
 
-			current_data = current_data->Subdata(bytes_used);
-
 			if (status == modules::rtmp::ChunkParser::ParseResult::NeedMoreData)
 			{
 				break;
@@ -0,0 +1,120 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "rtmp_input_buffer.h"
+
+namespace pvd
+{
+	std::shared_ptr<const ov::Data> RtmpInputBuffer::Prepare(const std::shared_ptr<const ov::Data> &data)
+	{
+		if (IsEmpty())
+		{
+			// Parse the received data directly
+			_prepared_data = data;
+			_is_prepared_from_buffer = false;
+		}
+		else
+		{
+			Append(data->GetData(), data->GetLength());
+
+			// Refer to the buffer instead of copying it
+			_prepared_data = std::make_shared<ov::Data>(_buffer.data() + _read_offset, _write_offset - _read_offset, true);
+			_is_prepared_from_buffer = true;
+		}
+
+		return _prepared_data;
+	}
+
+	void RtmpInputBuffer::Commit(size_t bytes_used)
+	{
+		if (_prepared_data == nullptr)
+		{
+			OV_ASSERT2(false);
+			return;
+		}
+
+		OV_ASSERT2(bytes_used <= _prepared_data->GetLength());
+		bytes_used = std::min(bytes_used, _prepared_data->GetLength());
+
+		if (_is_prepared_from_buffer)
+		{
+			_read_offset += bytes_used;
+
+			if (_read_offset == _write_offset)
+			{
+				_read_offset = 0;
+				_write_offset = 0;
+			}
+		}
+		else
+		{
+			// Keep only the bytes which are not processed
+			Append(_prepared_data->GetDataAs<uint8_t>() + bytes_used, _prepared_data->GetLength() - bytes_used);
+		}
+
+		_prepared_data = nullptr;
+		_is_prepared_from_buffer = false;
+	}
+
+	size_t RtmpInputBuffer::GetLength() const
+	{
+		if ((_prepared_data != nullptr) && (_is_prepared_from_buffer == false))
+		{
+			return _prepared_data->GetLength();
+		}
+
+		return _write_offset - _read_offset;
+	}
+
+	bool RtmpInputBuffer::IsEmpty() const
+	{
+		return GetLength() == 0;
+	}
+
+	void RtmpInputBuffer::Clear()
+	{
+		_buffer.clear();
+		_buffer.shrink_to_fit();
+
+		_read_offset = 0;
+		_write_offset = 0;
+
+		_prepared_data = nullptr;
+		_is_prepared_from_buffer = false;
+	}
+
+	void RtmpInputBuffer::Append(const void *data, size_t length)
+	{
+		if (length == 0)
+		{
+			return;
+		}
+
+		if ((_write_offset + length) > _buffer.size())
+		{
+			auto pending_length = _write_offset - _read_offset;
+
+			// Move the pending bytes to the front to make a room
+			if (_read_offset > 0)
+			{
+				::memmove(_buffer.data(), _buffer.data() + _read_offset, pending_length);
+
+				_read_offset = 0;
+				_write_offset = pending_length;
+			}
+
+			if ((_write_offset + length) > _buffer.size())
+			{
+				_buffer.resize(std::max(_write_offset + length, _buffer.size() * 2));
+			}
+		}
+
+		::memcpy(_buffer.data() + _write_offset, data, length);
+		_write_offset += length;
+	}
+}  // namespace pvd
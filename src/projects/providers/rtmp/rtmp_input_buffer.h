@@ -0,0 +1,49 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+namespace pvd
+{
+	// Holds the bytes which are received from the socket but not processed yet by the RTMP parser.
+	//
+	// When nothing is pending, the received data is parsed as it is and only the unprocessed tail is copied.
+	// Consuming bytes only moves the read offset, and the pending bytes are moved to the front of the buffer
+	// only when there is no room left at the end, so the buffer is not reallocated for every read.
+	class RtmpInputBuffer
+	{
+	public:
+		// Returns the data to be parsed, which is valid until Commit() is called.
+		// If nothing is pending, returns `data` itself without copying.
+		std::shared_ptr<const ov::Data> Prepare(const std::shared_ptr<const ov::Data> &data);
+
+		// Called after parsing the data returned by Prepare() with the number of bytes processed.
+		// The remaining bytes are kept to be parsed with the next data.
+		void Commit(size_t bytes_used);
+
+		// Number of bytes pending (including the data which is prepared but not committed)
+		size_t GetLength() const;
+		bool IsEmpty() const;
+
+		void Clear();
+
+	private:
+		void Append(const void *data, size_t length);
+
+		std::vector<uint8_t> _buffer;
+		size_t _read_offset = 0;
+		size_t _write_offset = 0;
+
+		// The data returned by Prepare()
+		std::shared_ptr<const ov::Data> _prepared_data = nullptr;
+		// Whether _prepared_data refers to _buffer
+		bool _is_prepared_from_buffer = false;
+	};
+}  // namespace pvd
@@ -180,36 +180,31 @@ namespace pvd
 		}
 		_acknowledgement_traffic_after_last_acked += data_length;
 
-		if ((_remained_data != nullptr) && (_remained_data->GetLength() > RTMP_MAX_PACKET_SIZE))
+		if (_input_buffer.GetLength() > RTMP_MAX_PACKET_SIZE)
 		{
 			logte("The packet is ignored because the size is too large: [%d]), packet size: %zu, threshold: %d",
-				  GetChannelId(), _remained_data->GetLength(), RTMP_MAX_PACKET_SIZE);
+				  GetChannelId(), _input_buffer.GetLength(), RTMP_MAX_PACKET_SIZE);
 
 			return false;
 		}
 
-		if ((_remained_data == nullptr) || _remained_data->IsEmpty())
-		{
-			_remained_data = data->Clone();
-		}
-		else
-		{
-			_remained_data->Append(data);
-		}
+		auto input_data = _input_buffer.Prepare(data);
+		size_t total_process_size = 0;
 
-		logtt("Trying to parse data\n%s", _remained_data->Dump(_remained_data->GetLength()).CStr());
+		logtt("Trying to parse data\n%s", input_data->Dump(input_data->GetLength()).CStr());
 
-		while (true)
+		while (total_process_size < input_data->GetLength())
 		{
+			auto remained_data = (total_process_size == 0) ? input_data : input_data->Subdata(total_process_size);
 			int32_t process_size = 0;
 
 			if (_handshake_state == RtmpHandshakeState::Complete)
 			{
-				process_size = ReceiveChunkPacket(_remained_data);
+				process_size = ReceiveChunkPacket(remained_data);
 			}
 			else
 			{
-				process_size = ReceiveHandshakePacket(_remained_data);
+				process_size = ReceiveHandshakePacket(remained_data);
 			}
 
 			if (process_size < 0)
@@ -217,9 +212,11 @@ namespace pvd
 				logtd("Could not process RTMP packet: [%s/%s] (%u/%u), size: %zu bytes, returns: %d",
 					  _vhost_app_name.CStr(), _stream_name.CStr(),
 					  _app_id, GetId(),
-					  _remained_data->GetLength(),
+					  remained_data->GetLength(),
 					  process_size);
 
+				_input_buffer.Commit(total_process_size);
+
 				Stop();
 				return false;
 			}
@@ -230,9 +227,12 @@ namespace pvd
 				break;
 			}
 
-			_remained_data = _remained_data->Subdata(process_size);
+			total_process_size += process_size;
 		}
 
+		// The data which is not processed is kept to be parsed with the next data
+		_input_buffer.Commit(total_process_size);
+
 		if (_acknowledgement_traffic_after_last_acked > _acknowledgement_size)
 		{
 			SendAcknowledgementSize(_acknowledgement_traffic);
@@ -989,13 +989,16 @@ namespace pvd
 	{
 		int32_t process_size = 0;
 		size_t import_size = 0;
-		std::shared_ptr<const ov::Data> current_data = data;
+		auto buffer = data->GetDataAs<uint8_t>();
+		size_t remained_size = data->GetLength();
 
-		while (current_data->IsEmpty() == false)
+		while (remained_size > 0)
 		{
-			auto status = _import_chunk->Parse(current_data, &import_size);
+			// Parse the chunks from the received memory directly instead of making a Subdata() for each chunk
+			auto status = _import_chunk->Parse(buffer + process_size, remained_size, &import_size);
 
 			process_size += import_size;
+			remained_size -= import_size;
 
 			switch (status)
 			{
@@ -1010,15 +1013,13 @@ namespace pvd
 					if (ReceiveChunkMessage() == false)
 					{
 						logtd("ReceiveChunkMessage Fail");
-						logtt("Failed to import packet\n%s", current_data->Dump(current_data->GetLength()).CStr());
+						logtt("Failed to import packet\n%s", ov::Dump(buffer + process_size - import_size, remained_size + import_size).CStr());
 
 						return -1LL;
 					}
 					break;
 			}
 
-			current_data = current_data->Subdata(import_size);
-
 			if (status == RtmpChunkParser::ParseResult::NeedMoreData)
 			{
 				break;
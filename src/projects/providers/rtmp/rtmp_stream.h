@@ -16,6 +16,7 @@
 #include "modules/rtmp/chunk/rtmp_export_chunk.h"
 #include "modules/rtmp/chunk/rtmp_handshake.h"
 #include "modules/access_control/access_controller.h"
+#include "rtmp_input_buffer.h"
 
 #define MAX_STREAM_MESSAGE_COUNT (500)
 #define BASELINE_PROFILE (66)
@@ -168,7 +169,7 @@ namespace pvd
 		std::shared_ptr<ov::Socket> _remote = nullptr;
 
 		// Received data buffer
-		std::shared_ptr<ov::Data> _remained_data = nullptr;
+		RtmpInputBuffer _input_buffer;
 
 		// Singed Policy
 		uint64_t _stream_expired_msec = 0;
@@ -111,27 +111,23 @@ namespace pvd::rtmp
 			return false;
 		}
 
-		if ((_remaining_data == nullptr) || _remaining_data->IsEmpty())
-		{
-			_remaining_data = data->Clone();
-		}
-		else
-		{
-			_remaining_data->Append(data);
-		}
+		auto input_data = _input_buffer.Prepare(data);
+		size_t total_bytes_used = 0;
 
-		logat("Trying to parse data\n%s", _remaining_data->Dump(_remaining_data->GetLength()).CStr());
+		logat("Trying to parse data\n%s", input_data->Dump(input_data->GetLength()).CStr());
 
-		while (true)
+		while (total_bytes_used < input_data->GetLength())
 		{
+			auto remaining_data = (total_bytes_used == 0) ? input_data : input_data->Subdata(total_bytes_used);
+
 			int32_t bytes_used = _handshake_handler.IsHandshakeCompleted()
-									 ? _chunk_handler.HandleData(_remaining_data)
-									 : _handshake_handler.HandleData(_remaining_data);
+									 ? _chunk_handler.HandleData(remaining_data)
+									 : _handshake_handler.HandleData(remaining_data);
 
 			if (bytes_used > 0)
 			{
 				// Successfully parsed some data
-				_remaining_data = _remaining_data->Subdata(bytes_used);
+				total_bytes_used += bytes_used;
 				continue;
 			}
 
@@ -142,13 +138,18 @@ namespace pvd::rtmp
 			}
 
 			logad("Could not process RTMP packet: size: %zu bytes, returns: %d",
-				  _remaining_data->GetLength(),
+				  remaining_data->GetLength(),
 				  bytes_used);
 
+			_input_buffer.Commit(total_bytes_used);
+
 			Stop();
 			return false;
 		}
 
+		// The data which is not processed is kept to be parsed with the next data
+		_input_buffer.Commit(total_bytes_used);
+
 		_chunk_handler.AccumulateAcknowledgementSize(data->GetLength());
 
 		return true;
@@ -14,6 +14,7 @@
 
 #include "./handlers/rtmp_chunk_handler.h"
 #include "./handlers/rtmp_handshake_handler.h"
+#include "./rtmp_input_buffer.h"
 
 namespace modules::rtmp
 {
@@ -111,7 +112,7 @@ namespace pvd::rtmp
 		std::shared_ptr<ov::Socket> _remote		  = nullptr;
 
 		// Received data buffer
-		std::shared_ptr<ov::Data> _remaining_data = nullptr;
+		RtmpInputBuffer _input_buffer;
 
 		// Signed Policy
 		uint64_t _stream_expired_msec			  = 0;
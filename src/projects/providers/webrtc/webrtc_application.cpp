@@ -110,14 +110,17 @@ namespace pvd
 		payload->SetRtpmap(payload_type_num++, "H264", 90000);
 		payload->SetFmtp(ov::String::FormatString("packetization-mode=1;profile-level-id=%x;level-asymmetry-allowed=1",	0x42e01f));
 		payload->EnableRtcpFb(PayloadAttr::RtcpFbType::CcmFir, true);
+		payload->EnableRtcpFb(PayloadAttr::RtcpFbType::Nack, true);
 		payload->EnableRtcpFb(PayloadAttr::RtcpFbType::NackPli, true);
 		payload->EnableRtcpFb(PayloadAttr::RtcpFbType::TransportCc, true);
 		video_media_desc->AddPayload(payload);
+		video_media_desc->AddPayload(MakeRtxPayload(payload_type_num++, payload->GetId()));
 
 		// VP8
 		payload = std::make_shared<PayloadAttr>();
 		payload->SetRtpmap(payload_type_num++, "VP8", 90000);
 		payload->EnableRtcpFb(PayloadAttr::RtcpFbType::CcmFir, true);
+		payload->EnableRtcpFb(PayloadAttr::RtcpFbType::Nack, true);
 		payload->EnableRtcpFb(PayloadAttr::RtcpFbType::NackPli, true);
 		
 		if (transport_cc_enabled)
@@ -126,6 +129,7 @@ namespace pvd
 		}
 
 		video_media_desc->AddPayload(payload);
+		video_media_desc->AddPayload(MakeRtxPayload(payload_type_num++, payload->GetId()));
 
 		video_media_desc->Update();
 		offer_sdp->AddMedia(video_media_desc);
@@ -168,6 +172,15 @@ namespace pvd
 		return offer_sdp;
 	}
 
+	std::shared_ptr<PayloadAttr> WebRTCApplication::MakeRtxPayload(uint8_t rtx_payload_type, uint8_t associated_payload_type)
+	{
+		auto payload = std::make_shared<PayloadAttr>();
+		payload->SetRtpmap(rtx_payload_type, "rtx", 90000);
+		payload->SetFmtp(ov::String::FormatString("apt=%d", associated_payload_type));
+
+		return payload;
+	}
+
 	std::shared_ptr<SessionDescription> WebRTCApplication::CreateAnswerSDP(const std::shared_ptr<const SessionDescription> &offer_sdp, const ov::String &local_ufrag, const std::set<IceCandidate> &ice_candidates)
 	{
 		if(offer_sdp == nullptr)
@@ -280,12 +293,27 @@ namespace pvd
 			}
 
 			// payloads
+			auto is_supported_codec = [](const std::shared_ptr<const PayloadAttr> &payload) -> bool {
+				return payload->GetCodec() == PayloadAttr::SupportCodec::H264 ||
+					   payload->GetCodec() == PayloadAttr::SupportCodec::H265 ||
+					   payload->GetCodec() == PayloadAttr::SupportCodec::VP8 ||
+					   payload->GetCodec() == PayloadAttr::SupportCodec::OPUS;
+			};
+
 			for (auto &offer_payload : offer_media_desc->GetPayloadList())
 			{
-				if (offer_payload->GetCodec() != PayloadAttr::SupportCodec::H264 &&
-					offer_payload->GetCodec() != PayloadAttr::SupportCodec::H265 &&
-					offer_payload->GetCodec() != PayloadAttr::SupportCodec::VP8 &&
-					offer_payload->GetCodec() != PayloadAttr::SupportCodec::OPUS)
+				if (offer_payload->GetCodec() == PayloadAttr::SupportCodec::RTX)
+				{
+					// RTX is accepted only for the payload that is accepted
+					auto apt = offer_payload->GetRtxAssociatedPayloadType();
+					auto associated_payload = apt.has_value() ? offer_media_desc->GetPayload(apt.value()) : nullptr;
+					if (associated_payload == nullptr || is_supported_codec(associated_payload) == false)
+					{
+						logtd("rtx(%d) for unsupported payload has ignored", offer_payload->GetId());
+						continue;
+					}
+				}
+				else if (is_supported_codec(offer_payload) == false)
 				{
 					logti("unsupported codec(%s) has ignored", offer_payload->GetCodecStr().CStr());
 					continue;
@@ -303,6 +331,12 @@ namespace pvd
 					answer_payload->EnableRtcpFb(PayloadAttr::RtcpFbType::CcmFir, true);
 				}
 
+				// Generic NACK
+				if (offer_payload->IsRtcpFbEnabled(PayloadAttr::RtcpFbType::Nack))
+				{
+					answer_payload->EnableRtcpFb(PayloadAttr::RtcpFbType::Nack, true);
+				}
+
 				// NACK PLI
 				if (offer_payload->IsRtcpFbEnabled(PayloadAttr::RtcpFbType::NackPli))
 				{
@@ -35,6 +35,7 @@ namespace pvd
 		
 	private:
 		std::shared_ptr<SessionDescription> CreateOfferSDP();
+		static std::shared_ptr<PayloadAttr> MakeRtxPayload(uint8_t rtx_payload_type, uint8_t associated_payload_type);
 
 		std::shared_ptr<IcePort> _ice_port = nullptr;
 		std::shared_ptr<RtcSignallingServer> _rtc_signalling = nullptr;
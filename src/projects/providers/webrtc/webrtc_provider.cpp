@@ -126,6 +126,15 @@ namespace pvd
 			return false;
 		}
 
+		// All streams share the DTLS context instead of building SSL_CTX for each of them
+		_dtls_context = DtlsTransport::CreateTlsContext(_certificate);
+
+		if (_dtls_context == nullptr)
+		{
+			logte("Could not create DTLS context.");
+			return false;
+		}
+
 		return true;
 	}
 
@@ -496,7 +505,7 @@ namespace pvd
 		auto ice_session_id = _ice_port->IssueUniqueSessionId();
 
 		// Local Offer, Remote Answer
-		auto stream = WebRTCStream::Create(StreamSourceType::WebRTC, final_stream_name, PushProvider::GetSharedPtrAs<PushProvider>(), offer_sdp, answer_sdp, _certificate, _ice_port, ice_session_id);
+		auto stream = WebRTCStream::Create(StreamSourceType::WebRTC, final_stream_name, PushProvider::GetSharedPtrAs<PushProvider>(), offer_sdp, answer_sdp, _dtls_context, _ice_port, ice_session_id);
 		if (stream == nullptr)
 		{
 			logte("Could not create %s stream in %s application", final_stream_name.CStr(), final_vhost_app_name.CStr());
@@ -759,7 +768,7 @@ namespace pvd
 		auto ice_session_id = _ice_port->IssueUniqueSessionId();
 
 		// Remote Offer, Local Answer
-		auto stream = WebRTCStream::Create(StreamSourceType::WebRTC, final_stream_name, PushProvider::GetSharedPtrAs<PushProvider>(), answer_sdp, offer_sdp, _certificate, _ice_port, ice_session_id);
+		auto stream = WebRTCStream::Create(StreamSourceType::WebRTC, final_stream_name, PushProvider::GetSharedPtrAs<PushProvider>(), answer_sdp, offer_sdp, _dtls_context, _ice_port, ice_session_id);
 		if (stream == nullptr)
 		{
 			logte("Could not create %s stream in %s application", final_stream_name.CStr(), final_vhost_app_name.CStr());
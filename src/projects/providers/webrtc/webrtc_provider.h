@@ -125,6 +125,7 @@ namespace pvd
 		std::shared_ptr<RtcSignallingServer> _signalling_server = nullptr;
 		std::shared_ptr<WhipServer> _whip_server = nullptr;
 		std::shared_ptr<Certificate> _certificate = nullptr;
+		std::shared_ptr<ov::TlsContext> _dtls_context = nullptr;
 
 		std::mutex _stream_lock;
 
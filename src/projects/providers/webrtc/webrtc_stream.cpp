@@ -20,11 +20,11 @@ namespace pvd
 													   const std::shared_ptr<PushProvider> &provider,
 													   const std::shared_ptr<const SessionDescription> &local_sdp,
 													   const std::shared_ptr<const SessionDescription> &remote_sdp,
-													   const std::shared_ptr<Certificate> &certificate,
+													   const std::shared_ptr<ov::TlsContext> &dtls_context,
 													   const std::shared_ptr<IcePort> &ice_port,
 													   session_id_t ice_session_id)
 	{
-		auto stream = std::make_shared<WebRTCStream>(source_type, stream_name, provider, local_sdp, remote_sdp, certificate, ice_port, ice_session_id);
+		auto stream = std::make_shared<WebRTCStream>(source_type, stream_name, provider, local_sdp, remote_sdp, dtls_context, ice_port, ice_session_id);
 		if (stream != nullptr)
 		{
 			if (stream->Start() == false)
@@ -39,7 +39,7 @@ namespace pvd
 							   const std::shared_ptr<PushProvider> &provider,
 							   const std::shared_ptr<const SessionDescription> &local_sdp,
 							   const std::shared_ptr<const SessionDescription> &remote_sdp,
-							   const std::shared_ptr<Certificate> &certificate,
+							   const std::shared_ptr<ov::TlsContext> &dtls_context,
 							   const std::shared_ptr<IcePort> &ice_port,
 							   session_id_t ice_session_id)
 		: PushStream(source_type, stream_name, provider), Node(NodeType::Edge)
@@ -59,7 +59,7 @@ namespace pvd
 		}
 
 		_ice_port = ice_port;
-		_certificate = certificate;
+		_dtls_context = dtls_context;
 		_session_key = ov::Random::GenerateString(8);
 		_ice_session_id = ice_session_id;
 
@@ -96,7 +96,7 @@ namespace pvd
 		_dtls_transport = std::make_shared<DtlsTransport>();
 
 		auto application = std::static_pointer_cast<WebRTCApplication>(GetApplication());
-		_dtls_transport->SetLocalCertificate(_certificate);
+		_dtls_transport->SetTlsContext(_dtls_context);
 		_dtls_transport->StartDTLS();
 
 		// RFC3264
@@ -192,6 +192,7 @@ namespace pvd
 		ov::Node::Start();
 
 		_fir_timer.Start();
+		_nack_stats_timer.Start();
 
 		// _sent_sequence_header = false;
 
@@ -267,6 +268,22 @@ namespace pvd
 		rtp_track_id.mid_extension_id = mid_extension_id;
 		rtp_track_id.rid = has_rid_extension ? std::optional<ov::String>(rid_attr->GetId()) : std::nullopt;
 		rtp_track_id.rid_extension_id = rid_extension_id;
+		rtp_track_id.payload_type = payload_attr->GetId();
+
+		// Generic NACK, the answer has the negotiated rtcp-fb
+		// With simulcast, the layers share the RTX payload type and can be told apart only by the RTX SSRCs that are not signalled, 
+		// so NACK is not used for simulcast layers.
+		auto answer_payload_attr = answer_media_desc->GetPayload(payload_attr->GetId());
+		if (rid_attr == nullptr && answer_payload_attr != nullptr && answer_payload_attr->IsRtcpFbEnabled(PayloadAttr::RtcpFbType::Nack) == true)
+		{
+			rtp_track_id.nack_enabled = true;
+
+			auto rtx_payload_attr = answer_media_desc->GetRtxPayload(payload_attr->GetId());
+			if (rtx_payload_attr != nullptr)
+			{
+				rtp_track_id.rtx_payload_type = rtx_payload_attr->GetId();
+			}
+		}
 
 		if (_rtp_rtcp->AddRtpReceiver(track, rtp_track_id) == false)
 		{
@@ -457,6 +474,17 @@ namespace pvd
 
 		if (_rtp_rtcp != nullptr)
 		{
+			for (const auto &[track_id, track] : GetTracks())
+			{
+				auto nack_stats = _rtp_rtcp->GetNackStats(track_id);
+				if (nack_stats.has_value())
+				{
+					logti("NACK stats of %s/%s track(%u) : %s", GetApplicationName(), GetName().CStr(), track_id, nack_stats->ToString().CStr());
+				}
+			}
+
+			ReportNackStats();
+
 			_rtp_rtcp->Stop();
 		}
 
@@ -498,6 +526,34 @@ namespace pvd
 		return SendDataToPrevNode(data);
 	}
 
+	void WebRTCStream::ReportNackStats()
+	{
+		auto stream_metrics = StreamMetrics(*this);
+		if (stream_metrics == nullptr)
+		{
+			return;
+		}
+
+		mon::StreamMetrics::NackStats total;
+
+		for (const auto &[track_id, track] : GetTracks())
+		{
+			auto nack_stats = _rtp_rtcp->GetNackStats(track_id);
+			if (nack_stats.has_value() == false)
+			{
+				continue;
+			}
+
+			total.lost_packets += nack_stats->lost_packets;
+			total.nack_requests += nack_stats->nack_requests;
+			total.requested_packets += nack_stats->requested_packets;
+			total.recovered_packets += nack_stats->recovered_packets;
+			total.unrecovered_packets += nack_stats->unrecovered_packets;
+		}
+
+		stream_metrics->SetNackStats(total);
+	}
+
 	// From RtpRtcp node
 	void WebRTCStream::OnRtpFrameReceived(const std::vector<std::shared_ptr<RtpPacket>> &rtp_packets)
 	{
@@ -513,6 +569,12 @@ namespace pvd
 
 		logtt("%s", first_rtp_packet->Dump().CStr());
 
+		if (_nack_stats_timer.IsElapsed(1000))
+		{
+			_nack_stats_timer.Update();
+			ReportNackStats();
+		}
+
 		auto track = GetTrack(track_id);
 		if (track == nullptr)
 		{
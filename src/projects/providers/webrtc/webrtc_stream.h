@@ -30,7 +30,7 @@ namespace pvd
 													const std::shared_ptr<PushProvider> &provider,
 													const std::shared_ptr<const SessionDescription> &local_sdp,
 													const std::shared_ptr<const SessionDescription> &remote_sdp,
-													const std::shared_ptr<Certificate> &certificate, 
+													const std::shared_ptr<ov::TlsContext> &dtls_context, 
 													const std::shared_ptr<IcePort> &ice_port,
 													session_id_t ice_session_id);
 		
@@ -38,7 +38,7 @@ namespace pvd
 								const std::shared_ptr<PushProvider> &provider,
 								const std::shared_ptr<const SessionDescription> &local_sdp,
 								const std::shared_ptr<const SessionDescription> &remote_sdp,
-								const std::shared_ptr<Certificate> &certificate, 
+								const std::shared_ptr<ov::TlsContext> &dtls_context, 
 								const std::shared_ptr<IcePort> &ice_port,
 								session_id_t ice_session_id);
 		~WebRTCStream() final;
@@ -88,7 +88,12 @@ namespace pvd
 
 		void OnFrame(const std::shared_ptr<MediaTrack> &track, const std::shared_ptr<MediaPacket> &media_packet);
 
+		// Publishes the NACK statistics of all tracks to the stream metrics.
+		// It must be called in the thread that receives RTP packets.
+		void ReportNackStats();
+
 		ov::StopWatch _fir_timer;
+		ov::StopWatch _nack_stats_timer;
 
 		ov::String _session_key;
 
@@ -98,7 +103,7 @@ namespace pvd
 		std::shared_ptr<const SessionDescription> _answer_sdp;
 
 		std::shared_ptr<IcePort> _ice_port;
-		std::shared_ptr<Certificate> _certificate;
+		std::shared_ptr<ov::TlsContext> _dtls_context;
 
 		std::shared_ptr<RtpRtcp>            _rtp_rtcp;
 		std::shared_ptr<SrtpTransport>      _srtp_transport;
@@ -137,6 +137,14 @@ bool LLHlsChunklist::AppendPartialSegmentInfo(uint32_t segment_sequence, const S
 		_last_partial_segment_sequence = info.GetSequence();
 
 		segment->InsertPartialSegmentInfo(std::make_shared<SegmentInfo>(info));
+
+		if (segment->IsCompleted() == true)
+		{
+			segment->SetRenderedTags(MakeProgramDateTimeTag(segment->GetStartTime()),
+									 ov::String::FormatString("#EXTINF:%lf,\n%s", segment->GetDuration(), segment->GetUrl().CStr()));
+		}
+
+		FreezeOldSegments();
 	}
 
 	UpdateCacheForDefaultChunklist();
@@ -166,24 +174,135 @@ bool LLHlsChunklist::RemoveSegmentInfo(uint32_t segment_sequence)
 
 	_segments.erase(segment_sequence);
 
+	while ((_frozen_segments.empty() == false) && (_frozen_segments.front().sequence <= segment_sequence))
+	{
+		_frozen_segments.pop_front();
+	}
+
+	// Release the sealed blocks that no longer hold the text of any segment
+	auto first_used_block_id = _frozen_segments.empty() ? (_first_frozen_block_id + _frozen_blocks.size()) : _frozen_segments.front().block_id;
+	while (_first_frozen_block_id < first_used_block_id)
+	{
+		_frozen_blocks.pop_front();
+		_first_frozen_block_id++;
+	}
+
 	return true;
 }
 
+void LLHlsChunklist::FreezeOldSegments()
+{
+	auto last_segment = GetLastSegmentToPrint();
+	if (last_segment == nullptr)
+	{
+		return;
+	}
+
+	for (auto it = _segments.upper_bound(_last_frozen_sequence); it != _segments.end(); it++)
+	{
+		auto &segment = it->second;
+
+		// EXT-X-PART tags are still printed for this segment
+		if (segment->GetSequence() > last_segment->GetSequence() - 3)
+		{
+			break;
+		}
+
+		if (segment->GetPartialSegmentsCount() > 0)
+		{
+			if (segment->IsCompleted() == false)
+			{
+				break;
+			}
+
+			if ((_open_frozen_block == nullptr) || (_open_frozen_block->GetLength() >= FrozenBlockSize))
+			{
+				if (_open_frozen_block != nullptr)
+				{
+					_frozen_blocks.push_back(_open_frozen_block);
+				}
+
+				_open_frozen_block = std::make_shared<ov::Data>(FrozenBlockSize + 1024);
+			}
+
+			ov::String text;
+			AppendSegment(text, segment, last_segment, "", false);
+
+			_frozen_segments.push_back({segment->GetSequence(), _first_frozen_block_id + _frozen_blocks.size(), _open_frozen_block->GetLength()});
+			_open_frozen_block->Append(text.CStr(), text.GetLength());
+		}
+
+		_last_frozen_sequence = segment->GetSequence();
+	}
+}
+
 void LLHlsChunklist::UpdateCacheForDefaultChunklist()
 {
 	// no query string, no skip, no legacy, all segments
-	ov::String chunklist = MakeChunklist("", false, false, true);
+	std::vector<std::shared_ptr<const ov::Data>> chunklist;
+
+	if (_end_list == true)
 	{
-		// lock 
-		std::lock_guard<std::shared_mutex> lock(_cached_default_chunklist_guard);
-		_cached_default_chunklist = chunklist;
+		// The last chunklist is made only once, so it doesn't need the frozen segments
+		auto playlist = MakeChunklist("", false, false, true);
+		if (playlist.IsEmpty() == false)
+		{
+			chunklist.push_back(playlist.ToData(false));
+		}
+	}
+	else
+	{
+		ov::String header;
+		ov::String tail(4096);
+
+		std::shared_lock<std::shared_mutex> segment_lock(_segments_guard);
+		auto last_segment = GetLastSegmentToPrint();
+		if (last_segment != nullptr)
+		{
+			AppendHeader(header, "", false, static_cast<uint32_t>(_segments.begin()->first));
+			chunklist.push_back(header.ToData(false));
+
+			if (_frozen_segments.empty() == false)
+			{
+				auto &first_frozen_segment = _frozen_segments.front();
+				auto open_block_id = _first_frozen_block_id + _frozen_blocks.size();
+
+				for (auto block_id = first_frozen_segment.block_id; block_id <= open_block_id; block_id++)
+				{
+					std::shared_ptr<const ov::Data> block = (block_id == open_block_id) ? _open_frozen_block->Clone() : _frozen_blocks[block_id - _first_frozen_block_id];
+
+					if (block_id == first_frozen_segment.block_id)
+					{
+						block = block->Subdata(first_frozen_segment.offset);
+					}
+
+					if (block->IsEmpty() == false)
+					{
+						chunklist.push_back(block);
+					}
+				}
+			}
+
+			// Only the segments after the frozen ones are rendered
+			for (auto it = _segments.upper_bound(_last_frozen_sequence); it != _segments.end(); it++)
+			{
+				AppendSegment(tail, it->second, last_segment, "", false);
+			}
+			segment_lock.unlock();
+
+			AppendRenditionReports(tail, "", false);
+			chunklist.push_back(tail.ToData(false));
+		}
 	}
 
 	{
 		// lock 
-		std::lock_guard<std::shared_mutex> lock(_cached_default_chunklist_gzip_guard);
-		_cached_default_chunklist_gzip = ov::Zip::CompressGzip(chunklist.ToData(false));
+		std::lock_guard<std::shared_mutex> lock(_cached_default_chunklist_guard);
+		_cached_default_chunklist = std::move(chunklist);
+		_cached_default_chunklist_version++;
 	}
+
+	// The gzip data is made in ToGzipData() when it is requested
 }
 
 bool LLHlsChunklist::SaveOldSegmentInfo(std::shared_ptr<SegmentInfo> &segment_info)
@@ -289,29 +408,61 @@ ov::String LLHlsChunklist::MakeExtXKey() const
 	return xkey;
 }
 
-ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool skip, bool legacy, bool rewind, bool vod, uint32_t vod_start_segment_number) const
+ov::String LLHlsChunklist::MakeProgramDateTimeTag(int64_t start_time_ms)
 {
-	std::shared_lock<std::shared_mutex> segment_lock(_segments_guard);
-	uint8_t version = 6;
-	if (_segments.size() == 0)
+	std::chrono::system_clock::time_point tp{std::chrono::milliseconds{start_time_ms}};
+	return ov::String::FormatString("#EXT-X-PROGRAM-DATE-TIME:%s\n", ov::Converter::ToISO8601String(tp).CStr());
+}
+
+// #EXTINF and URI of the completed segment
+void LLHlsChunklist::AppendSegmentTags(ov::String &playlist, const std::shared_ptr<SegmentInfo> &segment, const ov::String &query_string) const
+{
+	if (segment->HasRenderedTags() == true)
 	{
-		return "";
+		playlist.Append(segment->GetRenderedExtinf());
+	}
+	else
+	{
+		playlist.AppendFormat("#EXTINF:%lf,\n", segment->GetDuration());
+		playlist.Append(segment->GetUrl());
 	}
 
-	if (_end_list == true)
+	if (query_string.IsEmpty() == false)
 	{
-		vod = true;
+		playlist.AppendFormat("?%s", query_string.CStr());
 	}
+	playlist.Append("\n");
+}
 
-	if (vod == true)
+std::shared_ptr<LLHlsChunklist::SegmentInfo> LLHlsChunklist::GetLastSegmentToPrint() const
+{
+	if (_segments.empty())
 	{
-		// VoD doesn't need Low-Latency HLS
-		legacy = true;
+		return nullptr;
 	}
 
-	// TODO(Getroot) : Implement _HLS_skip=YES (skip = true)
+	auto last_segment = _segments.rbegin()->second;
+	if (last_segment == nullptr)
+	{
+		// no segment info
+		return nullptr;
+	}
 
-	ov::String playlist(20480);
+	// skip empty segment info 
+	if (last_segment->GetPartialSegmentsCount() == 0)
+	{
+		if (_segments.size() > 1)
+		{
+			last_segment = std::prev(_segments.end(), 2)->second;
+		}
+	}
+
+	return last_segment;
+}
+
+void LLHlsChunklist::AppendHeader(ov::String &playlist, const ov::String &query_string, bool legacy, uint32_t media_sequence) const
+{
+	uint8_t version = 6;
 
 	playlist.AppendFormat("#EXTM3U\n");
 
@@ -346,23 +497,174 @@ ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool sk
 		// playlist.AppendFormat("#EXT-X-SERVER-CONTROL:HOLD-BACK=%u\n", target_duration * 3);
 	}
 
-	std::shared_ptr<LLHlsChunklist::SegmentInfo> first_segment = nullptr;
-	auto last_segment = _segments.rbegin()->second;
-	if (last_segment == nullptr)
+	playlist.AppendFormat("#EXT-X-MEDIA-SEQUENCE:%u\n", media_sequence);
+
+	if (_map_uri.IsEmpty() == false)
 	{
-		// no segment info
-		return "";
+		playlist.AppendFormat("#EXT-X-MAP:URI=\"%s", _map_uri.CStr());
+		if (query_string.IsEmpty() == false)
+		{
+			playlist.AppendFormat("?%s", query_string.CStr());
+		}
+		playlist.AppendFormat("\"\n");
 	}
 
-	// skip empty segment info 
-	if (last_segment->GetPartialSegmentsCount() == 0)
+	// CENC
+	if (_cenc_property.scheme != bmff::CencProtectScheme::None)
 	{
-		if (_segments.size() > 1)
+		playlist.AppendFormat("%s\n", MakeExtXKey().CStr());
+	}
+}
+
+void LLHlsChunklist::AppendSegment(ov::String &playlist, const std::shared_ptr<SegmentInfo> &segment, const std::shared_ptr<SegmentInfo> &last_segment, const ov::String &query_string, bool legacy) const
+{
+	if (segment->GetPartialSegmentsCount() == 0)
+	{
+		return;
+	}
+
+	if (legacy == true && segment->IsCompleted() == false)
+	{
+		return;
+	}
+
+	// Completed segments reuse the tags rendered when they were completed,
+	// so only the live tail is rendered here.
+	if (segment->HasRenderedTags() == true)
+	{
+		playlist.Append(segment->GetRenderedProgramDateTime());
+	}
+	else
+	{
+		playlist.Append(MakeProgramDateTimeTag(segment->GetStartTime()));
+	}
+
+	// Low Latency Mode
+	if (legacy == false)
+	{
+		// Output partial segments info
+		// Only output partial segments for the last 4 segments.
+		if (segment->GetSequence() > last_segment->GetSequence() - 3)
 		{
-			last_segment = std::prev(_segments.end(), 2)->second;
+			for (auto &partial_segment : segment->GetPartialSegments())
+			{
+				playlist.AppendFormat("#EXT-X-PART:DURATION=%lf,URI=\"%s",
+									partial_segment->GetDuration(), partial_segment->GetUrl().CStr());
+				if (query_string.IsEmpty() == false)
+				{
+					playlist.AppendFormat("?%s", query_string.CStr());
+				}
+				playlist.AppendFormat("\"");
+				if (partial_segment->IsIndependent() == true)
+				{
+					playlist.AppendFormat(",INDEPENDENT=YES");
+				}
+
+				playlist.Append("\n");
+
+				//If it is the last one, output PRELOAD-HINT
+				if (_preload_hint_enabled == true &&
+					segment->GetSequence() == last_segment->GetSequence() &&
+					partial_segment == segment->GetPartialSegments().back())
+				{
+					playlist.AppendFormat("#EXT-X-PRELOAD-HINT:TYPE=PART,URI=\"%s", partial_segment->GetNextUrl().CStr());
+					if (query_string.IsEmpty() == false)
+					{
+						playlist.AppendFormat("?%s", query_string.CStr());
+					}
+					playlist.AppendFormat("\"\n");
+				}
+			}
 		}
 	}
 
+	// Don't print Completed segment info if it is the last segment
+	// It will be printed when the next segment is created.
+	if ((legacy == true && segment->IsCompleted()) || 
+		(legacy == false && segment->IsCompleted() && segment->GetSequence() != last_segment->GetSequence()))
+	{
+		AppendSegmentTags(playlist, segment, query_string);
+	}
+}
+
+void LLHlsChunklist::AppendRenditionReports(ov::String &playlist, const ov::String &query_string, bool legacy) const
+{
+	// Output #EXT-X-RENDITION-REPORT
+	// lock
+	std::shared_lock<std::shared_mutex> rendition_lock(_renditions_guard);
+	for (const auto &[track_id, rendition] : _renditions)
+	{
+		// Skip mine 
+		if (track_id == static_cast<int32_t>(_track->GetId()))
+		{
+			continue;
+		}
+		// Skip another media type
+		if (rendition->GetTrack()->GetMediaType() != _track->GetMediaType())
+		{
+			continue;
+		}
+
+		playlist.AppendFormat("#EXT-X-RENDITION-REPORT:URI=\"%s", rendition->GetUrl().CStr());
+		if (query_string.IsEmpty() == false)
+		{
+			playlist.AppendFormat("?%s", query_string.CStr());
+		}
+		playlist.AppendFormat("\"");
+
+		// LAST-MSN, LAST-PART
+		int64_t last_msn, last_part;
+		rendition->GetLastSequenceNumber(last_msn, last_part);
+
+		if (legacy == true && last_msn > 0)
+		{
+			// https://datatracker.ietf.org/doc/html/draft-pantos-hls-rfc8216bis#section-4.4.5.4
+			// If the Rendition contains Partial Segments then this value is the Media Sequence Number of the last Partial Segment. 
+
+			// In legacy, the completed msn is reported.
+			last_msn -= 1;
+		}
+
+		playlist.AppendFormat(",LAST-MSN=%llu", last_msn);
+
+		if (legacy == false)
+		{
+			playlist.AppendFormat(",LAST-PART=%llu", last_part);
+		}
+		
+		playlist.AppendFormat("\n");
+	}
+}
+
+ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool skip, bool legacy, bool rewind, bool vod, uint32_t vod_start_segment_number) const
+{
+	std::shared_lock<std::shared_mutex> segment_lock(_segments_guard);
+	if (_segments.size() == 0)
+	{
+		return "";
+	}
+
+	if (_end_list == true)
+	{
+		vod = true;
+	}
+
+	if (vod == true)
+	{
+		// VoD doesn't need Low-Latency HLS
+		legacy = true;
+	}
+
+	// TODO(Getroot) : Implement _HLS_skip=YES (skip = true)
+
+	std::shared_ptr<LLHlsChunklist::SegmentInfo> first_segment = nullptr;
+	auto last_segment = GetLastSegmentToPrint();
+	if (last_segment == nullptr)
+	{
+		// no segment info
+		return "";
+	}
+
 	if (rewind == true)
 	{
 		first_segment = _segments.begin()->second;
@@ -401,23 +703,10 @@ ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool sk
 		first_segment = it->second;
 	}
 
-	playlist.AppendFormat("#EXT-X-MEDIA-SEQUENCE:%u\n", vod == false ? first_segment->GetSequence() : 0);
+	// Reserve enough space for the tags of all segments to avoid reallocations on long DVR windows
+	ov::String playlist(std::max<size_t>(20480, (_segments.size() + (vod ? _old_segments.size() : 0)) * 160));
 
-	if (_map_uri.IsEmpty() == false)
-	{
-		playlist.AppendFormat("#EXT-X-MAP:URI=\"%s", _map_uri.CStr());
-		if (query_string.IsEmpty() == false)
-		{
-			playlist.AppendFormat("?%s", query_string.CStr());
-		}
-		playlist.AppendFormat("\"\n");
-	}
-
-	// CENC
-	if (_cenc_property.scheme != bmff::CencProtectScheme::None)
-	{
-		playlist.AppendFormat("%s\n", MakeExtXKey().CStr());
-	}
+	AppendHeader(playlist, query_string, legacy, vod == false ? static_cast<uint32_t>(first_segment->GetSequence()) : 0);
 
 	if (vod == true)
 	{
@@ -428,15 +717,8 @@ ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool sk
 				continue;
 			}
 
-			std::chrono::system_clock::time_point tp{std::chrono::milliseconds{segment->GetStartTime()}};
-			playlist.AppendFormat("#EXT-X-PROGRAM-DATE-TIME:%s\n", ov::Converter::ToISO8601String(tp).CStr());
-			playlist.AppendFormat("#EXTINF:%lf,\n", segment->GetDuration());
-			playlist.AppendFormat("%s", segment->GetUrl().CStr());
-			if (query_string.IsEmpty() == false)
-			{
-				playlist.AppendFormat("?%s", query_string.CStr());
-			}
-			playlist.Append("\n");
+			playlist.Append(segment->HasRenderedTags() ? segment->GetRenderedProgramDateTime() : MakeProgramDateTimeTag(segment->GetStartTime()));
+			AppendSegmentTags(playlist, segment, query_string);
 		}
 	}
 
@@ -444,137 +726,21 @@ ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool sk
 	for (auto it = _segments.find(first_segment->GetSequence()) ; it != _segments.end(); it ++)
 	{
 		auto number = it->first;
-		auto segment = it->second;
 
 		if (vod == true && number < vod_start_segment_number)
 		{
 			continue;
 		}
 
-		if (segment->GetPartialSegmentsCount() == 0)
-		{
-			continue;
-		}
-
-		if (legacy == true && segment->IsCompleted() == false)
-		{
-			continue;
-		}
-
-		std::chrono::system_clock::time_point tp{std::chrono::milliseconds{segment->GetStartTime()}};
-		playlist.AppendFormat("#EXT-X-PROGRAM-DATE-TIME:%s\n", ov::Converter::ToISO8601String(tp).CStr());
-
-		logtd("MakeChunklist[Track : %s/%s]: segment(%d) duration(%.2f) url(%s) start_time(%lld) date_time(%s)",
-			_track->GetPublicName().CStr(), _track->GetVariantName().CStr(),
-			segment->GetSequence(), segment->GetDuration(), segment->GetUrl().CStr(), segment->GetStartTime(), 
-			ov::Converter::ToISO8601String(tp).CStr());
-
-		// Low Latency Mode
-		if (legacy == false)
-		{
-			// Output partial segments info
-			// Only output partial segments for the last 4 segments.
-			if (segment->GetSequence() > last_segment->GetSequence() - 3)
-			{
-				for (auto &partial_segment : segment->GetPartialSegments())
-				{
-					playlist.AppendFormat("#EXT-X-PART:DURATION=%lf,URI=\"%s",
-										partial_segment->GetDuration(), partial_segment->GetUrl().CStr());
-					if (query_string.IsEmpty() == false)
-					{
-						playlist.AppendFormat("?%s", query_string.CStr());
-					}
-					playlist.AppendFormat("\"");
-					if (partial_segment->IsIndependent() == true)
-					{
-						playlist.AppendFormat(",INDEPENDENT=YES");
-					}
-
-					playlist.Append("\n");
-
-					//If it is the last one, output PRELOAD-HINT
-					if (_preload_hint_enabled == true &&
-						segment->GetSequence() == last_segment->GetSequence() &&
-						partial_segment == segment->GetPartialSegments().back())
-					{
-						playlist.AppendFormat("#EXT-X-PRELOAD-HINT:TYPE=PART,URI=\"%s", partial_segment->GetNextUrl().CStr());
-						if (query_string.IsEmpty() == false)
-						{
-							playlist.AppendFormat("?%s", query_string.CStr());
-						}
-						playlist.AppendFormat("\"\n");
-					}
-				}
-			}
-		}
-
-		// Don't print Completed segment info if it is the last segment
-		// It will be printed when the next segment is created.
-		if ((legacy == true && segment->IsCompleted()) || 
-			(legacy == false && segment->IsCompleted() && segment->GetSequence() != last_segment->GetSequence()))
-		{
-			playlist.AppendFormat("#EXTINF:%lf,\n", segment->GetDuration());
-			playlist.AppendFormat("%s", segment->GetUrl().CStr());
-			if (query_string.IsEmpty() == false)
-			{
-				playlist.AppendFormat("?%s", query_string.CStr());
-			}
-			playlist.Append("\n");
-		}
+		AppendSegment(playlist, it->second, last_segment, query_string, legacy);
 	}
 	segment_lock.unlock();
 
-#if 1
 	// only for live and low-latency mode
 	if (vod == false && legacy == false)
 	{
-		// Output #EXT-X-RENDITION-REPORT
-		// lock
-		std::shared_lock<std::shared_mutex> rendition_lock(_renditions_guard);
-		for (const auto &[track_id, rendition] : _renditions)
-		{
-			// Skip mine 
-			if (track_id == static_cast<int32_t>(_track->GetId()))
-			{
-				continue;
-			}
-			// Skip another media type
-			if (rendition->GetTrack()->GetMediaType() != _track->GetMediaType())
-			{
-				continue;
-			}
-
-			playlist.AppendFormat("#EXT-X-RENDITION-REPORT:URI=\"%s", rendition->GetUrl().CStr());
-			if (query_string.IsEmpty() == false)
-			{
-				playlist.AppendFormat("?%s", query_string.CStr());
-			}
-			playlist.AppendFormat("\"");
-
-			// LAST-MSN, LAST-PART
-			int64_t last_msn, last_part;
-			rendition->GetLastSequenceNumber(last_msn, last_part);
-
-			if (legacy == true && last_msn > 0)
-			{
-				// https://datatracker.ietf.org/doc/html/draft-pantos-hls-rfc8216bis#section-4.4.5.4
-				// If the Rendition contains Partial Segments then this value is the Media Sequence Number of the last Partial Segment. 
-
-				// In legacy, the completed msn is reported.
-				last_msn -= 1;
-			}
-
-			playlist.AppendFormat(",LAST-MSN=%llu", last_msn);
-
-			if (legacy == false)
-			{
-				playlist.AppendFormat(",LAST-PART=%llu", last_part);
-			}
-			
-			playlist.AppendFormat("\n");
-		}
+		AppendRenditionReports(playlist, query_string, legacy);
 	}
-#endif
 
 	if (vod == true)
 	{
@@ -586,27 +752,91 @@ ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool sk
 
 ov::String LLHlsChunklist::ToString(const ov::String &query_string, bool skip, bool legacy, bool rewind, bool vod, uint32_t vod_start_segment_number) const
 {
-	if (_segments.size() == 0)
+	if (query_string.IsEmpty() && skip == false && legacy == false && rewind == true && vod == false && vod_start_segment_number == 0)
 	{
-		return "";
+		// return cached chunklist for default chunklist
+		std::shared_lock<std::shared_mutex> lock(_cached_default_chunklist_guard);
+		if (_cached_default_chunklist.empty() == false)
+		{
+			size_t length = 0;
+			for (const auto &data : _cached_default_chunklist)
+			{
+				length += data->GetLength();
+			}
+
+			ov::String chunklist(length);
+			for (const auto &data : _cached_default_chunklist)
+			{
+				chunklist.Append(data->GetDataAs<char>(), data->GetLength());
+			}
+
+			return chunklist;
+		}
 	}
 
-	if (query_string.IsEmpty() && skip == false && legacy == false && rewind == true && vod == false && vod_start_segment_number == 0 && !_cached_default_chunklist.IsEmpty())
+	return MakeChunklist(query_string, skip, legacy, rewind, vod, vod_start_segment_number);
+}
+
+std::vector<std::shared_ptr<const ov::Data>> LLHlsChunklist::ToDataList(const ov::String &query_string, bool skip, bool legacy, bool rewind) const
+{
+	if (query_string.IsEmpty() && skip == false && legacy == false && rewind == true)
 	{
-		// return cached chunklist for default chunklist
 		std::shared_lock<std::shared_mutex> lock(_cached_default_chunklist_guard);
-		return _cached_default_chunklist;
+		if (_cached_default_chunklist.empty() == false)
+		{
+			return _cached_default_chunklist;
+		}
 	}
 
-	return MakeChunklist(query_string, skip, legacy, rewind, vod, vod_start_segment_number);
+	return {MakeChunklist(query_string, skip, legacy, rewind).ToData(false)};
 }
 
 std::shared_ptr<const ov::Data> LLHlsChunklist::ToGzipData(const ov::String &query_string, bool skip, bool legacy, bool rewind) const
 {
-	if (query_string.IsEmpty() && skip == false && legacy == false && _cached_default_chunklist_gzip != nullptr && rewind == true)
+	if (query_string.IsEmpty() && skip == false && legacy == false && rewind == true)
 	{
-		std::shared_lock<std::shared_mutex> lock(_cached_default_chunklist_gzip_guard);
-		return _cached_default_chunklist_gzip;
+		std::vector<std::shared_ptr<const ov::Data>> chunklist;
+		uint64_t version;
+		{
+			std::shared_lock<std::shared_mutex> lock(_cached_default_chunklist_guard);
+			chunklist = _cached_default_chunklist;
+			version = _cached_default_chunklist_version;
+		}
+
+		if (chunklist.empty() == false)
+		{
+			{
+				std::shared_lock<std::shared_mutex> lock(_cached_default_chunklist_gzip_guard);
+				if ((_cached_default_chunklist_gzip != nullptr) && (_cached_default_chunklist_gzip_version == version))
+				{
+					return _cached_default_chunklist_gzip;
+				}
+			}
+
+			// Compress the latest default chunklist once, and share it with the following requests
+			std::lock_guard<std::shared_mutex> lock(_cached_default_chunklist_gzip_guard);
+			if ((_cached_default_chunklist_gzip != nullptr) && (_cached_default_chunklist_gzip_version >= version))
+			{
+				return _cached_default_chunklist_gzip;
+			}
+
+			size_t length = 0;
+			for (const auto &data : chunklist)
+			{
+				length += data->GetLength();
+			}
+
+			auto plain_data = std::make_shared<ov::Data>(length);
+			for (const auto &data : chunklist)
+			{
+				plain_data->Append(data);
+			}
+
+			_cached_default_chunklist_gzip = ov::Zip::CompressGzip(plain_data);
+			_cached_default_chunklist_gzip_version = version;
+
+			return _cached_default_chunklist_gzip;
+		}
 	}
 
 	return ov::Zip::CompressGzip(ToString(query_string, skip, legacy, rewind).ToData(false));
@@ -156,6 +156,31 @@ public:
 			return _completed;
 		}
 
+		// The tags of a completed segment never change, so they are rendered only once
+		// and reused every time the chunklist is made.
+		void SetRenderedTags(const ov::String &program_date_time, const ov::String &extinf)
+		{
+			_rendered_program_date_time = program_date_time;
+			_rendered_extinf = extinf;
+		}
+
+		bool HasRenderedTags() const
+		{
+			return _rendered_extinf.IsEmpty() == false;
+		}
+
+		// #EXT-X-PROGRAM-DATE-TIME:...\n
+		const ov::String &GetRenderedProgramDateTime() const
+		{
+			return _rendered_program_date_time;
+		}
+
+		// #EXTINF:...,\n<url> (without query string and line feed)
+		const ov::String &GetRenderedExtinf() const
+		{
+			return _rendered_extinf;
+		}
+
 		ov::String GetStartDate() const
 		{
 			ov::String start_date;
@@ -205,6 +230,9 @@ public:
 		std::deque<std::shared_ptr<SegmentInfo>> _partial_segments;
 
 		std::vector<std::shared_ptr<Marker>> _markers;
+
+		ov::String _rendered_program_date_time;
+		ov::String _rendered_extinf;
 	}; // class SegmentInfo
 
 	LLHlsChunklist(const ov::String &url, const std::shared_ptr<const MediaTrack> &track, 
@@ -236,6 +264,8 @@ public:
 	bool RemoveSegmentInfo(uint32_t segment_sequence);
 
 	ov::String ToString(const ov::String &query_string, bool skip, bool legacy, bool rewind, bool vod = false, uint32_t vod_start_segment_number = 0) const;
+	// Same as ToString(), but the default chunklist is returned as the cached pieces without being copied
+	std::vector<std::shared_ptr<const ov::Data>> ToDataList(const ov::String &query_string, bool skip, bool legacy, bool rewind) const;
 	std::shared_ptr<const ov::Data> ToGzipData(const ov::String &query_string, bool skip, bool legacy, bool rewind) const;
 
 	std::shared_ptr<SegmentInfo> GetSegmentInfo(uint32_t segment_sequence) const;
@@ -253,8 +283,19 @@ private:
 
 	ov::String MakeChunklist(const ov::String &query_string, bool skip, bool legacy, bool rewind, bool vod = false, uint32_t vod_start_segment_number = 0) const;
 
+	// These must be called with _segments_guard locked
+	std::shared_ptr<SegmentInfo> GetLastSegmentToPrint() const;
+	void AppendHeader(ov::String &playlist, const ov::String &query_string, bool legacy, uint32_t media_sequence) const;
+	void AppendSegment(ov::String &playlist, const std::shared_ptr<SegmentInfo> &segment, const std::shared_ptr<SegmentInfo> &last_segment, const ov::String &query_string, bool legacy) const;
+	void FreezeOldSegments();
+
+	void AppendRenditionReports(ov::String &playlist, const ov::String &query_string, bool legacy) const;
+
 	ov::String MakeExtXKey() const;
 
+	static ov::String MakeProgramDateTimeTag(int64_t start_time_ms);
+	void AppendSegmentTags(ov::String &playlist, const std::shared_ptr<SegmentInfo> &segment, const ov::String &query_string) const;
+
 	ov::String MakeMarkers(const std::vector<std::shared_ptr<Marker>> &markers) const;
 
 	std::shared_ptr<const MediaTrack> _track;
@@ -287,12 +328,41 @@ private:
 	std::map<int32_t, std::shared_ptr<LLHlsChunklist>> _renditions;
 	mutable std::shared_mutex _renditions_guard;
 
-	ov::String _cached_default_chunklist;
+	// The default chunklist (no query string, no skip, no legacy, rewind) is kept as a list of pieces:
+	// the header, the text of the frozen segments and the live tail. Only the header and the tail
+	// are rendered when a partial segment is appended.
+	std::vector<std::shared_ptr<const ov::Data>> _cached_default_chunklist;
+	// Increased every time _cached_default_chunklist is updated
+	uint64_t _cached_default_chunklist_version = 0;
 	mutable std::shared_mutex _cached_default_chunklist_guard;
 
-	std::shared_ptr<ov::Data> _cached_default_chunklist_gzip;
+	// Compressed lazily on the first gzip request after the default chunklist is updated,
+	// so that the chunklist is not compressed if no client accepts gzip.
+	mutable std::shared_ptr<ov::Data> _cached_default_chunklist_gzip;
+	mutable uint64_t _cached_default_chunklist_gzip_version = 0;
 	mutable std::shared_mutex _cached_default_chunklist_gzip_guard;
 
+	// A completed segment that has left the EXT-X-PART window never changes, so its text
+	// (#EXT-X-PROGRAM-DATE-TIME, #EXTINF and the URL) is frozen into a block once and shared
+	// by every default chunklist until the segment is removed.
+	struct FrozenSegment
+	{
+		int64_t sequence;
+		// Block that holds the text of this segment
+		uint64_t block_id;
+		// Offset of the text in the block
+		size_t offset;
+	};
+	static constexpr size_t FrozenBlockSize = 16 * 1024;
+	std::deque<FrozenSegment> _frozen_segments;
+	// Sealed blocks, _frozen_blocks[0] has _first_frozen_block_id
+	std::deque<std::shared_ptr<const ov::Data>> _frozen_blocks;
+	uint64_t _first_frozen_block_id = 0;
+	// The block being filled. Its id is _first_frozen_block_id + _frozen_blocks.size()
+	std::shared_ptr<ov::Data> _open_frozen_block;
+	// The last sequence number whose text is frozen (or that has nothing to print)
+	int64_t _last_frozen_sequence = -1;
+
 	bmff::CencProperty _cenc_property;
 
 	bool _end_list = false;
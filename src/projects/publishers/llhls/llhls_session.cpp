@@ -580,7 +580,10 @@ void LLHlsSession::ResponseChunklist(const std::shared_ptr<http::svr::HttpExchan
 			}
 		}
 
-		response->AppendData(chunklist);
+		for (const auto &data : chunklist)
+		{
+			response->AppendData(data);
+		}
 
 		// If a client uses previously cached llhls.m3u8 and requests chunklist
 		if (_origin_mode == false && _number_of_players == 0)
@@ -712,7 +715,11 @@ void LLHlsSession::ResponseSegment(const std::shared_ptr<http::svr::HttpExchange
 			response->SetHeader("Cache-Control", cache_control);
 		}
 
-		response->AppendData(segment);
+		// Each partial segment is appended as it is and sent with scatter-gather I/O
+		for (const auto &data : segment)
+		{
+			response->AppendData(data);
+		}
 	}
 	else
 	{
@@ -702,7 +702,7 @@ bool LLHlsStream::DumpSegment(const std::shared_ptr<mdl::Dump> &item, const int3
 		return false;
 	}
 
-	auto segment_data = segment->GetData();
+	auto segment_data = segment->GetDataList();
 
 	// Get updated chunklist
 	auto chunklist = GetChunklistWriter(track_id);
@@ -739,6 +739,11 @@ bool LLHlsStream::DumpData(const std::shared_ptr<mdl::Dump> &item, const ov::Str
 	return item->DumpData(file_name, data);
 }
 
+bool LLHlsStream::DumpData(const std::shared_ptr<mdl::Dump> &item, const ov::String &file_name, const std::vector<std::shared_ptr<const ov::Data>> &data_list)
+{
+	return item->DumpData(file_name, data_list);
+}
+
 std::tuple<LLHlsStream::RequestResult, std::shared_ptr<const ov::Data>> LLHlsStream::GetMasterPlaylist(const ov::String &file_name, const ov::String &chunk_query_string, bool gzip, bool legacy, bool rewind, bool include_path)
 {
 	if (GetState() != State::STARTED)
@@ -791,18 +796,18 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<const ov::Data>> LLHlsStr
 	return {RequestResult::Success, master_playlist->ToString(chunk_query_string, legacy, rewind, include_path).ToData(false)};
 }
 
-std::tuple<LLHlsStream::RequestResult, std::shared_ptr<const ov::Data>> LLHlsStream::GetChunklist(const ov::String &query_string, const int32_t &track_id, int64_t msn, int64_t psn, bool skip, bool gzip, bool legacy, bool rewind) const
+std::tuple<LLHlsStream::RequestResult, std::vector<std::shared_ptr<const ov::Data>>> LLHlsStream::GetChunklist(const ov::String &query_string, const int32_t &track_id, int64_t msn, int64_t psn, bool skip, bool gzip, bool legacy, bool rewind) const
 {
 	auto chunklist = GetChunklistWriter(track_id);
 	if (chunklist == nullptr)
 	{
 		logtw("Could not find chunklist for track_id = %d", track_id);
-		return {RequestResult::NotFound, nullptr};
+		return {RequestResult::NotFound, {}};
 	}
 
 	if (IsReadyToPlay() == false)
 	{
-		return {RequestResult::Accepted, nullptr};
+		return {RequestResult::Accepted, {}};
 	}
 
 	if (msn >= 0 && psn >= 0)
@@ -811,14 +816,14 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<const ov::Data>> LLHlsStr
 		if (chunklist->GetLastSequenceNumber(last_msn, last_psn) == false)
 		{
 			logtw("Could not get last sequence number for track_id = %d", track_id);
-			return {RequestResult::NotFound, nullptr};
+			return {RequestResult::NotFound, {}};
 		}
 
 		if (msn > last_msn || (msn >= last_msn && psn > last_psn))
 		{
 			// Hold the request until a Playlist contains a Segment with the requested Sequence Number
 			logtd("Accepted chunklist for track_id = %d, msn = %ld, psn = %ld (last_msn = %ld, last_psn = %ld)", track_id, msn, psn, last_msn, last_psn);
-			return {RequestResult::Accepted, nullptr};
+			return {RequestResult::Accepted, {}};
 		}
 		else
 		{
@@ -828,10 +833,10 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<const ov::Data>> LLHlsStr
 
 	if (gzip == true)
 	{
-		return {RequestResult::Success, chunklist->ToGzipData(query_string, skip, legacy, rewind)};
+		return {RequestResult::Success, {chunklist->ToGzipData(query_string, skip, legacy, rewind)}};
 	}
 
-	return {RequestResult::Success, chunklist->ToString(query_string, skip, legacy, rewind).ToData(false)};
+	return {RequestResult::Success, chunklist->ToDataList(query_string, skip, legacy, rewind)};
 }
 
 std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::GetInitializationSegment(const int32_t &track_id) const
@@ -846,23 +851,23 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::G
 	return {RequestResult::Success, storage->GetInitializationSection()};
 }
 
-std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::GetSegment(const int32_t &track_id, const int64_t &segment_number) const
+std::tuple<LLHlsStream::RequestResult, std::vector<std::shared_ptr<const ov::Data>>> LLHlsStream::GetSegment(const int32_t &track_id, const int64_t &segment_number) const
 {
 	auto storage = GetStorage(track_id);
 	if (storage == nullptr)
 	{
 		logtw("Could not find storage for track_id = %d", track_id);
-		return {RequestResult::NotFound, nullptr};
+		return {RequestResult::NotFound, {}};
 	}
 
 	auto segment = storage->GetSegment(segment_number);
 	if (segment == nullptr)
 	{
 		logtw("Could not find segment for track_id = %d, segment = %ld (last_segment = %ld)", track_id, segment_number, storage->GetLastSegmentNumber());
-		return {RequestResult::NotFound, nullptr};
+		return {RequestResult::NotFound, {}};
 	}
 
-	return {RequestResult::Success, segment->GetData()};
+	return {RequestResult::Success, segment->GetDataList()};
 }
 
 std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::GetPartial(const int32_t &track_id, const int64_t &segment_number, const int64_t &partial_number) const
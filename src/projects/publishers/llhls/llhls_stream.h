@@ -71,9 +71,11 @@ public:
 	const ov::String &GetStreamKey() const;
 
 	std::tuple<RequestResult, std::shared_ptr<const ov::Data>> GetMasterPlaylist(const ov::String &file_name, const ov::String &chunk_query_string, bool gzip, bool legacy, bool rewind, bool include_path=true);
-	std::tuple<RequestResult, std::shared_ptr<const ov::Data>> GetChunklist(const ov::String &chunk_query_string, const int32_t &track_id, int64_t msn, int64_t psn, bool skip, bool gzip, bool legacy, bool rewind) const;
+	// The chunklist may consist of several pieces of data to avoid copying the cached chunklist
+	std::tuple<RequestResult, std::vector<std::shared_ptr<const ov::Data>>> GetChunklist(const ov::String &chunk_query_string, const int32_t &track_id, int64_t msn, int64_t psn, bool skip, bool gzip, bool legacy, bool rewind) const;
 	std::tuple<RequestResult, std::shared_ptr<ov::Data>> GetInitializationSegment(const int32_t &track_id) const;
-	std::tuple<RequestResult, std::shared_ptr<ov::Data>> GetSegment(const int32_t &track_id, const int64_t &segment_number) const;
+	// The segment is returned as the list of its partial segments to avoid concatenating them
+	std::tuple<RequestResult, std::vector<std::shared_ptr<const ov::Data>>> GetSegment(const int32_t &track_id, const int64_t &segment_number) const;
 	std::tuple<RequestResult, std::shared_ptr<ov::Data>> GetPartial(const int32_t &track_id, const int64_t &segment_number, const int64_t &chunk_number) const;
 
 	//////////////////////////
@@ -140,6 +142,7 @@ private:
 	bool DumpSegment(const std::shared_ptr<mdl::Dump> &item, const int32_t &track_id, const int64_t &segment_number);
 
 	bool DumpData(const std::shared_ptr<mdl::Dump> &item, const ov::String &file_name, const std::shared_ptr<const ov::Data> &data);
+	bool DumpData(const std::shared_ptr<mdl::Dump> &item, const ov::String &file_name, const std::vector<std::shared_ptr<const ov::Data>> &data_list);
 
 	int64_t GetMinimumLastSegmentNumber() const;
 	bool StopToSaveOldSegmentsInfo();
@@ -228,28 +228,37 @@ void OvtPublisher::OnDataReceived(const std::shared_ptr<ov::Socket> &remote,
 
 		uint32_t request_id = json_request_id.asUInt();
 		ov::String app = json_request_app.asString().c_str();
+
+		// Multiplexed mode (optional)
+		uint32_t channel_id = 0;
+		Json::Value &json_request_channel = object.GetJsonValue()["channel"];
+		if (json_request_channel.isUInt())
+		{
+			channel_id = json_request_channel.asUInt();
+		}
+
 		auto url = ov::Url::Parse(json_request_target.asString().c_str());
 		if (url == nullptr)
 		{
-			ResponseResult(remote, 0, "unknown", json_request_id.asUInt(), 404, "An invalid request : Target is not valid");
+			ResponseResult(remote, channel_id, "unknown", json_request_id.asUInt(), 404, "An invalid request : Target is not valid");
 			return;
 		}
 
 		if (app.UpperCaseString() == "DESCRIBE")
 		{
-			HandleDescribeRequest(remote, request_id, url);
+			HandleDescribeRequest(remote, channel_id, request_id, url);
 		}
 		else if (app.UpperCaseString() == "PLAY")
 		{
-			HandlePlayRequest(remote, request_id, url);
+			HandlePlayRequest(remote, channel_id, request_id, url);
 		}
 		else if (app.UpperCaseString() == "STOP")
 		{
-			HandleStopRequest(remote, 0, request_id, url);
+			HandleStopRequest(remote, channel_id, request_id, url);
 		}
 		else
 		{
-			ResponseResult(remote, 0, app.CStr(), request_id, 404, "Unknown application");
+			ResponseResult(remote, channel_id, app.CStr(), request_id, 404, "Unknown application");
 		}
 	}
 }
@@ -281,7 +290,7 @@ void OvtPublisher::OnDisconnected(const std::shared_ptr<ov::Socket> &remote,
 	RemoveDepacketizer(remote->GetNativeHandle());
 }
 
-void OvtPublisher::HandleDescribeRequest(const std::shared_ptr<ov::Socket> &remote, const uint32_t request_id, const std::shared_ptr<const ov::Url> &url)
+void OvtPublisher::HandleDescribeRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t channel_id, const uint32_t request_id, const std::shared_ptr<const ov::Url> &url)
 {
 	auto orchestrator = ocst::Orchestrator::GetInstance();
 
@@ -298,7 +307,7 @@ void OvtPublisher::HandleDescribeRequest(const std::shared_ptr<ov::Socket> &remo
 		if (orchestrator->RequestPullStreamWithOriginMap(url, vhost_app_name, stream_name) == false)
 		{
 			msg.Format("There is no such stream (%s/%s)", vhost_app_name.CStr(), url->Stream().CStr());
-			ResponseResult(remote, 0, "describe", request_id, 404, msg);
+			ResponseResult(remote, channel_id, "describe", request_id, 404, msg);
 			return;
 		}
 		else
@@ -307,7 +316,7 @@ void OvtPublisher::HandleDescribeRequest(const std::shared_ptr<ov::Socket> &remo
 			if (stream == nullptr)
 			{
 				msg.Format("Could not pull the stream: [%s/%s]", vhost_app_name.CStr(), stream_name.CStr());
-				ResponseResult(remote, 0, "describe", request_id, 404, msg);
+				ResponseResult(remote, channel_id, "describe", request_id, 404, msg);
 				return;
 			}
 		}
@@ -316,7 +325,7 @@ void OvtPublisher::HandleDescribeRequest(const std::shared_ptr<ov::Socket> &remo
 	if (stream->WaitUntilStart(3000) == false)
 	{
 		msg.Format("(%s/%s) stream has not started.", vhost_app_name.CStr(), url->Stream().CStr());
-		ResponseResult(remote, 0, "describe", request_id, 202, msg);
+		ResponseResult(remote, channel_id, "describe", request_id, 202, msg);
 		return;
 	}
 
@@ -324,14 +333,14 @@ void OvtPublisher::HandleDescribeRequest(const std::shared_ptr<ov::Socket> &remo
 	if (stream->GetDescription(description) == false)
 	{
 		msg.Format("(%s/%s) stream doesn't have description.", vhost_app_name.CStr(), url->Stream().CStr());
-		ResponseResult(remote, 0, "describe", request_id, 404, msg);
+		ResponseResult(remote, channel_id, "describe", request_id, 404, msg);
 		return;
 	}
 
-	ResponseResult(remote, 0, "describe", request_id, 200, "ok", description);
+	ResponseResult(remote, channel_id, "describe", request_id, 200, "ok", description);
 }
 
-void OvtPublisher::HandlePlayRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t request_id, const std::shared_ptr<const ov::Url> &url)
+void OvtPublisher::HandlePlayRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t channel_id, uint32_t request_id, const std::shared_ptr<const ov::Url> &url)
 {
 	auto vhost_app_name = ocst::Orchestrator::GetInstance()->ResolveApplicationNameFromDomain(url->Host(), url->App());
 
@@ -340,7 +349,7 @@ void OvtPublisher::HandlePlayRequest(const std::shared_ptr<ov::Socket> &remote,
 	{
 		ov::String msg;
 		msg.Format("There is no such app (%s)", vhost_app_name.CStr());
-		ResponseResult(remote, 0, "play", request_id, 404, msg);
+		ResponseResult(remote, channel_id, "play", request_id, 404, msg);
 		return;
 	}
 
@@ -349,28 +358,30 @@ void OvtPublisher::HandlePlayRequest(const std::shared_ptr<ov::Socket> &remote,
 	{
 		ov::String msg;
 		msg.Format("There is no such stream (%s/%s)", vhost_app_name.CStr(), url->Stream().CStr());
-		ResponseResult(remote, 0, "play", request_id, 404, msg);
+		ResponseResult(remote, channel_id, "play", request_id, 404, msg);
 		return;
 	}
 
-	// Session ID is remote socket's ID
-	auto session = OvtSession::Create(app, stream, remote->GetNativeHandle(), remote);
+	// Session ID is remote socket's ID. A multiplexed remote has several sessions, so a unique ID is issued.
+	uint32_t session_id = (channel_id == 0) ? remote->GetNativeHandle() : (stream->IssueUniqueSessionId() | OVT_MULTIPLEXED_SESSION_ID_FLAG);
+
+	auto session = OvtSession::Create(app, stream, session_id, remote, channel_id);
 	if (session == nullptr)
 	{
 		ov::String msg;
 		msg.Format("Internal Error : Cannot create session");
-		ResponseResult(remote, 0, "play", request_id, 404, msg);
+		ResponseResult(remote, channel_id, "play", request_id, 404, msg);
 		return;
 	}
 
 	LinkRemoteWithStream(remote->GetNativeHandle(), stream);
 
-	ResponseResult(remote, session->GetId(), "play", request_id, 200, "ok");
+	ResponseResult(remote, (channel_id == 0) ? session->GetId() : channel_id, "play", request_id, 200, "ok");
 
-	stream->AddSession(session);
+	stream->AddSession(session, true);
 }
 
-void OvtPublisher::HandleStopRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t session_id, uint32_t request_id, const std::shared_ptr<const ov::Url> &url)
+void OvtPublisher::HandleStopRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t channel_id, uint32_t request_id, const std::shared_ptr<const ov::Url> &url)
 {
 	auto vhost_app_name = ocst::Orchestrator::GetInstance()->ResolveApplicationNameFromDomain(url->Host(), url->App());
 	auto stream = std::static_pointer_cast<OvtStream>(GetStream(vhost_app_name, url->Stream()));
@@ -379,11 +390,20 @@ void OvtPublisher::HandleStopRequest(const std::shared_ptr<ov::Socket> &remote,
 	{
 		ov::String msg;
 		msg.Format("There is no such stream (%s/%s)", vhost_app_name.CStr(), url->Stream().CStr());
-		ResponseResult(remote, 0, "stop", request_id, 404, msg);
+		ResponseResult(remote, channel_id, "stop", request_id, 404, msg);
 		return;
 	}
 
-	ResponseResult(remote, session_id, "stop", request_id, 200, "ok");
+	ResponseResult(remote, channel_id, "stop", request_id, 200, "ok");
+
+	// The remote no longer plays this stream, so it doesn't have to be found when the remote is disconnected
+	UnlinkRemoteFromStream(remote->GetNativeHandle(), stream);
+
+	if (channel_id != 0)
+	{
+		stream->RemoveSessionByChannelId(remote->GetNativeHandle(), channel_id);
+		return;
+	}
 
 	// Session ID is remote socket's ID
 	stream->RemoveSession(remote->GetNativeHandle());
@@ -431,7 +451,10 @@ void OvtPublisher::SendResponse(const std::shared_ptr<ov::Socket> &remote, uint3
 			return;
 		}
 
-		remote->Send(packet->GetData());
+		// The client of the multiplexed connection finds the channel with this
+		packet->SetSessionId(session_id);
+
+		remote->Send(packet->GetDataList());
 	}
 }
 
@@ -452,3 +475,21 @@ bool OvtPublisher::UnlinkRemoteFromStream(int remote_id)
 
 	return true;
 }
+
+bool OvtPublisher::UnlinkRemoteFromStream(int remote_id, const std::shared_ptr<OvtStream> &stream)
+{
+	std::lock_guard<std::shared_mutex> guard(_remote_stream_map_lock);
+
+	// A multiplexed remote links a stream once per play, so only one of them is removed
+	auto streams = _remote_stream_map.equal_range(remote_id);
+	for (auto it = streams.first; it != streams.second; ++it)
+	{
+		if (it->second == stream)
+		{
+			_remote_stream_map.erase(it);
+			return true;
+		}
+	}
+
+	return false;
+}
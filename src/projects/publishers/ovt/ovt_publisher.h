@@ -10,6 +10,10 @@
 #include "modules/ovt_packetizer/ovt_packet.h"
 #include "ovt_application.h"
 
+// Session IDs of the multiplexed sessions have this bit set, so that they do not conflict with the session IDs of
+// the non-multiplexed sessions (socket descriptors)
+#define OVT_MULTIPLEXED_SESSION_ID_FLAG 0x80000000U
+
 class OvtPublisher : public pub::Publisher, public PhysicalPortObserver
 {
 public:
@@ -49,9 +53,10 @@ private:
 	void OnDisconnected(const std::shared_ptr<ov::Socket> &remote, PhysicalPortDisconnectReason reason, const std::shared_ptr<const ov::Error> &error) override;
 	//--------------------------------------------------------------------
 
-	void HandleDescribeRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t request_id, const std::shared_ptr<const ov::Url> &url);
-	void HandlePlayRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t request_id, const std::shared_ptr<const ov::Url> &url);
-	void HandleStopRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t session_id, uint32_t request_id, const std::shared_ptr<const ov::Url> &url);
+	// channel_id is not 0 if the request is sent over a multiplexed connection
+	void HandleDescribeRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t channel_id, uint32_t request_id, const std::shared_ptr<const ov::Url> &url);
+	void HandlePlayRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t channel_id, uint32_t request_id, const std::shared_ptr<const ov::Url> &url);
+	void HandleStopRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t channel_id, uint32_t request_id, const std::shared_ptr<const ov::Url> &url);
 
 	void ResponseResult(const std::shared_ptr<ov::Socket> &remote, uint32_t session_id, const ov::String app, uint32_t request_id, uint32_t code, const ov::String &msg);
 	void ResponseResult(const std::shared_ptr<ov::Socket> &remote, uint32_t session_id, const ov::String app, uint32_t request_id, uint32_t code, const ov::String &msg, const Json::Value &contents);
@@ -60,6 +65,8 @@ private:
 
 	bool LinkRemoteWithStream(int remote_id, std::shared_ptr<OvtStream> &stream);
 	bool UnlinkRemoteFromStream(int remote_id);
+	// Unlinks one play of the stream by the remote
+	bool UnlinkRemoteFromStream(int remote_id, const std::shared_ptr<OvtStream> &stream);
 
 	std::shared_ptr<OvtDepacketizer> GetDepacketizer(int remote_id);
 	bool RemoveDepacketizer(int remote_id);
@@ -2,6 +2,7 @@
 #include <base/ovlibrary/byte_io.h>
 #include <base/publisher/stream.h>
 #include <modules/ovt_packetizer/ovt_packet.h>
+#include <modules/ovt_packetizer/ovt_packetizer.h>
 #include <monitoring/monitoring.h>
 #include "ovt_session.h"
 #include "ovt_private.h"
@@ -9,10 +10,11 @@
 std::shared_ptr<OvtSession> OvtSession::Create(const std::shared_ptr<pub::Application> &application,
 										  	   const std::shared_ptr<pub::Stream> &stream,
 										  	   uint32_t session_id,
-										  	   const std::shared_ptr<ov::Socket> &connector)
+										  	   const std::shared_ptr<ov::Socket> &connector,
+											   uint32_t channel_id)
 {
 	auto session_info = info::Session(*std::static_pointer_cast<info::Stream>(stream), session_id);
-	auto session = std::make_shared<OvtSession>(session_info, application, stream, connector);
+	auto session = std::make_shared<OvtSession>(session_info, application, stream, connector, channel_id);
 	if(!session->Start())
 	{
 		return nullptr;
@@ -23,10 +25,12 @@ std::shared_ptr<OvtSession> OvtSession::Create(const std::shared_ptr<pub::Applic
 OvtSession::OvtSession(const info::Session &session_info,
 		   const std::shared_ptr<pub::Application> &application,
 		   const std::shared_ptr<pub::Stream> &stream,
-		   const std::shared_ptr<ov::Socket> &connector)
+		   const std::shared_ptr<ov::Socket> &connector,
+		   uint32_t channel_id)
    : pub::Session(session_info, application, stream)
 {
 	_connector = connector;
+	_channel_id = channel_id;
 	_sent_ready = false;
 
 	MonitorInstance->OnSessionConnected(*GetStream(), PublisherType::Ovt);
@@ -48,12 +52,54 @@ bool OvtSession::Start()
 
 bool OvtSession::Stop()
 {
-	logtd("OvtSession(%d) has stopped", GetId());
-	_connector->Close();
-	
+	if (_stopped.exchange(true) == false)
+	{
+		logtd("OvtSession(%d) has stopped", GetId());
+
+		if (IsMultiplexed())
+		{
+			// Other streams are using the connector
+			SendStopMessage();
+		}
+		else
+		{
+			_connector->Close();
+		}
+	}
+
 	return Session::Stop();
 }
 
+void OvtSession::SendStopMessage()
+{
+	if (_connector->GetState() != ov::SocketState::Connected)
+	{
+		return;
+	}
+
+	Json::Value root;
+
+	root["id"] = 0;
+	root["application"] = "stop";
+	root["code"] = 200;
+	root["message"] = "Stream has been stopped";
+
+	OvtPacketizer packetizer;
+
+	if (packetizer.PacketizeMessage(OVT_PAYLOAD_TYPE_MESSAGE_RESPONSE, ov::Clock::NowMSec(), ov::Json::Stringify(root).ToData(false)) == false)
+	{
+		return;
+	}
+
+	while (packetizer.IsAvailablePackets())
+	{
+		auto packet = packetizer.PopPacket();
+		packet->SetSessionId(_channel_id);
+
+		_connector->Send(packet->GetDataList());
+	}
+}
+
 void OvtSession::SendOutgoingData(const std::any &packet)
 {
 	std::shared_ptr<OvtPacket> session_packet;
@@ -83,11 +129,23 @@ void OvtSession::SendOutgoingData(const std::any &packet)
 		return;
 	}
 
-	// Set OVT Session ID into packet
-	auto copy_packet = std::make_shared<OvtPacket>(*session_packet);
-	copy_packet->SetSessionId(GetId());
+	// Only the header is copied to set OVT Session ID, the payload is shared by all sessions
+	auto header = session_packet->CloneHeader(IsMultiplexed() ? _channel_id : GetId());
+	auto &payload = session_packet->GetPayload();
+
+	if (payload == nullptr)
+	{
+		_connector->Send(header);
+		return;
+	}
 
-	_connector->Send(copy_packet->GetData());
+	_connector->Send({header, payload});
+}
+
+void OvtSession::OnGopCacheBurstStarted()
+{
+	// The cached GOP starts from the first packet of a keyframe
+	_sent_ready = true;
 }
 
 const std::shared_ptr<ov::Socket> OvtSession::GetConnector()
@@ -95,6 +153,16 @@ const std::shared_ptr<ov::Socket> OvtSession::GetConnector()
 	return _connector;
 }
 
+uint32_t OvtSession::GetChannelId() const
+{
+	return _channel_id;
+}
+
+bool OvtSession::IsMultiplexed() const
+{
+	return _channel_id != 0;
+}
+
 void OvtSession::OnMessageReceived(const std::any &message)
 {
 	// NOTHING YET
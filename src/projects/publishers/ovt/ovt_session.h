@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+
 #include <base/info/media_track.h>
 #include <base/ovsocket/socket.h>
 #include <base/publisher/session.h>
@@ -10,23 +12,35 @@ public:
 	static std::shared_ptr<OvtSession> Create(const std::shared_ptr<pub::Application> &application,
 											  const std::shared_ptr<pub::Stream> &stream,
 											  uint32_t ovt_session_id,
-											  const std::shared_ptr<ov::Socket> &connector);
+											  const std::shared_ptr<ov::Socket> &connector,
+											  uint32_t channel_id = 0);
 
 	OvtSession(const info::Session &session_info,
 			const std::shared_ptr<pub::Application> &application,
 			const std::shared_ptr<pub::Stream> &stream,
-			const std::shared_ptr<ov::Socket> &connector);
+			const std::shared_ptr<ov::Socket> &connector,
+			uint32_t channel_id);
 	~OvtSession() override;
 
 	bool Start() override;
 	bool Stop() override;
 
 	void SendOutgoingData(const std::any &packet) override;
+	void OnGopCacheBurstStarted() override;
 	void OnMessageReceived(const std::any &message) override;
 
 	const std::shared_ptr<ov::Socket> GetConnector();
 
+	// 0 if the connector is not multiplexed
+	uint32_t GetChannelId() const;
+	bool IsMultiplexed() const;
+
 private:
+	// Notifies the client that the stream of the channel is stopped, since the shared connector is not closed
+	void SendStopMessage();
+
 	std::shared_ptr<ov::Socket>		_connector;
+	uint32_t						_channel_id = 0;
 	bool 							_sent_ready;
+	std::atomic<bool>				_stopped = false;
 };
@@ -53,6 +53,8 @@ bool OvtStream::Start()
 		return false;
 	}
 
+	SetGopCacheOptions(GetApplicationInfo().GetConfig().GetPublishers().GetOvtPublisher().GetGopCache());
+
 	logtd("OvtStream(%d) has been started", GetId());
 	_packetizer = std::make_shared<OvtPacketizer>(OvtPacketizerInterface::GetSharedPtr());
 
@@ -202,6 +204,7 @@ void OvtStream::SendVideoFrame(const std::shared_ptr<MediaPacket> &media_packet)
 	std::shared_lock<std::shared_mutex> mlock(_packetizer_lock);
 	if(_packetizer != nullptr)
 	{
+		_gop_packet_info = pub::GopCache::PacketInfo(media_packet->GetTrackId(), true, media_packet->IsKeyFrame(), 0);
 		_packetizer->PacketizeMediaPacket(media_packet->GetPts(), media_packet);
 	}
 }
@@ -217,6 +220,7 @@ void OvtStream::SendAudioFrame(const std::shared_ptr<MediaPacket> &media_packet)
 	std::shared_lock<std::shared_mutex> mlock(_packetizer_lock);
 	if(_packetizer != nullptr)
 	{
+		_gop_packet_info = pub::GopCache::PacketInfo(media_packet->GetTrackId(), false, false, 0);
 		_packetizer->PacketizeMediaPacket(media_packet->GetPts(), media_packet);
 	}
 }
@@ -225,7 +229,11 @@ bool OvtStream::OnOvtPacketized(std::shared_ptr<OvtPacket> &packet)
 {
 	// Broadcasting
 	auto stream_packet = std::make_any<std::shared_ptr<OvtPacket>>(packet);
-	BroadcastPacket(stream_packet);
+
+	_gop_packet_info.bytes = packet->GetDataLength();
+	BroadcastPacket(stream_packet, _gop_packet_info);
+	// Only the first OVT packet of a keyframe starts a GOP
+	_gop_packet_info.is_key_frame_start = false;
 	
 	
 	MonitorInstance->IncreaseBytesOut(*pub::Stream::GetSharedPtrAs<info::Stream>(), PublisherType::Ovt, packet->GetDataLength() * GetSessionCount());
@@ -252,12 +260,33 @@ bool OvtStream::RemoveSessionByConnectorId(int connector_id)
 
 	logtd("RemoveSessionByConnectorId : all(%d) connector(%d)", sessions.size(), connector_id);
 
+	bool removed = false;
+
 	for(const auto &item : sessions)
 	{
 		auto session = std::static_pointer_cast<OvtSession>(item.second);
 		logtd("session : %d %d", session->GetId(), session->GetConnector()->GetNativeHandle());
 
+		// A multiplexed connector may have several sessions
 		if(session->GetConnector()->GetNativeHandle() == connector_id)
+		{
+			RemoveSession(session->GetId());
+			removed = true;
+		}
+	}
+
+	return removed;
+}
+
+bool OvtStream::RemoveSessionByChannelId(int connector_id, uint32_t channel_id)
+{
+	auto sessions = GetAllSessions();
+
+	for(const auto &item : sessions)
+	{
+		auto session = std::static_pointer_cast<OvtSession>(item.second);
+
+		if((session->GetConnector()->GetNativeHandle() == connector_id) && (session->GetChannelId() == channel_id))
 		{
 			RemoveSession(session->GetId());
 			return true;
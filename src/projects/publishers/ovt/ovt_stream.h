@@ -25,6 +25,8 @@ public:
 	bool OnOvtPacketized(std::shared_ptr<OvtPacket> &packet) override;
 
 	bool RemoveSessionByConnectorId(int connector_id);
+	// Removes the session of the channel of the multiplexed connector
+	bool RemoveSessionByChannelId(int connector_id, uint32_t channel_id);
 
 	bool GetDescription(Json::Value &description);
 
@@ -39,4 +41,7 @@ private:
 	Json::Value							_description;
 	std::shared_mutex					_packetizer_lock;
 	std::shared_ptr<OvtPacketizer>		_packetizer;
+
+	// GOP cache information of the media packet that is being packetized
+	pub::GopCache::PacketInfo			_gop_packet_info{0, false, false, 0};
 };
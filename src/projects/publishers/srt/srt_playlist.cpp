@@ -29,10 +29,12 @@ namespace pub
 	SrtPlaylist::SrtPlaylist(
 		const std::shared_ptr<const info::Stream> &stream_info,
 		const std::shared_ptr<const info::Playlist> &playlist_info,
-		const std::shared_ptr<SrtPlaylistSink> &sink)
+		const std::shared_ptr<SrtPlaylistSink> &sink,
+		bool gop_cache_enabled)
 		: _stream_info(stream_info),
 		  _playlist_info(playlist_info),
-		  _sink(sink)
+		  _sink(sink),
+		  _gop_cache_enabled(gop_cache_enabled)
 	{
 		_packetizer = std::make_shared<mpegts::Packetizer>();
 	}
@@ -103,8 +105,9 @@ namespace pub
 			// Broadcast if the data size exceeds the SRT's payload length
 			if ((size + data->GetLength()) > SRT_LIVE_DEF_PLSIZE)
 			{
-				_sink->OnSrtPlaylistData(self, _data_to_send);
+				_sink->OnSrtPlaylistData(self, _data_to_send, _data_to_send_is_key_frame_start);
 				_data_to_send = data->Clone();
+				_data_to_send_is_key_frame_start = false;
 			}
 			else
 			{
@@ -113,6 +116,18 @@ namespace pub
 		}
 	}
 
+	void SrtPlaylist::FlushData()
+	{
+		if ((_sink == nullptr) || (_data_to_send->GetLength() == 0))
+		{
+			return;
+		}
+
+		_sink->OnSrtPlaylistData(GetSharedPtrAs<SrtPlaylist>(), _data_to_send, _data_to_send_is_key_frame_start);
+		_data_to_send = std::make_shared<ov::Data>();
+		_data_to_send_is_key_frame_start = false;
+	}
+
 	void SrtPlaylist::OnPsi(const std::vector<std::shared_ptr<const MediaTrack>> &tracks, const std::vector<std::shared_ptr<mpegts::Packet>> &psi_packets)
 	{
 		std::shared_ptr<ov::Data> psi_data = std::make_shared<ov::Data>();
@@ -144,6 +159,14 @@ namespace pub
 		logat("OnFrame - %zu packets (total %zu bytes)", pes_packets.size(), total_packet_size);
 #endif	// DEBUG
 
+		if (_gop_cache_enabled && (media_packet->GetMediaType() == cmn::MediaType::Video) && media_packet->IsKeyFrame())
+		{
+			// A keyframe starts a new SRT payload, so that the GOP cache of the stream can start from it.
+			// Without the GOP cache, the payloads are kept full.
+			FlushData();
+			_data_to_send_is_key_frame_start = true;
+		}
+
 		SendData(pes_packets);
 	}
 }  // namespace pub
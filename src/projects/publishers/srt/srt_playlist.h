@@ -24,9 +24,11 @@ namespace pub
 	public:
 		virtual ~SrtPlaylistSink() = default;
 
+		// is_key_frame_start: the data starts with a video keyframe
 		virtual void OnSrtPlaylistData(
 			const std::shared_ptr<SrtPlaylist> &playlist,
-			const std::shared_ptr<const ov::Data> &data) = 0;
+			const std::shared_ptr<const ov::Data> &data,
+			bool is_key_frame_start) = 0;
 	};
 
 	struct SrtData
@@ -50,10 +52,12 @@ namespace pub
 	class SrtPlaylist : public mpegts::PacketizerSink, public ov::EnableSharedFromThis<SrtPlaylistSink>
 	{
 	public:
+		// If gop_cache_enabled is true, each video keyframe starts a new SRT payload so that the GOP cache can start from it
 		SrtPlaylist(
 			const std::shared_ptr<const info::Stream> &stream_info,
 			const std::shared_ptr<const info::Playlist> &playlist_info,
-			const std::shared_ptr<SrtPlaylistSink> &sink);
+			const std::shared_ptr<SrtPlaylistSink> &sink,
+			bool gop_cache_enabled);
 
 		void AddTrack(const std::shared_ptr<MediaTrack> &track);
 		void AddTracks(const std::vector<std::shared_ptr<MediaTrack>> &tracks);
@@ -78,6 +82,11 @@ namespace pub
 			return _psi_data;
 		}
 
+		ov::String GetFileName() const
+		{
+			return _playlist_info->GetFileName();
+		}
+
 	private:
 		struct TrackInfo
 		{
@@ -93,6 +102,8 @@ namespace pub
 
 	private:
 		void SendData(const std::vector<std::shared_ptr<mpegts::Packet>> &packets);
+		// Sends the data that is being collected even if it is smaller than the SRT payload
+		void FlushData();
 
 	private:
 		std::shared_ptr<const info::Stream> _stream_info;
@@ -104,7 +115,10 @@ namespace pub
 
 		std::shared_ptr<SrtPlaylistSink> _sink;
 
+		bool _gop_cache_enabled = false;
+
 		std::shared_ptr<const ov::Data> _psi_data;
 		std::shared_ptr<ov::Data> _data_to_send = std::make_shared<ov::Data>();
+		bool _data_to_send_is_key_frame_start = false;
 	};
 }  // namespace pub
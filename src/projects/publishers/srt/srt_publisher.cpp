@@ -349,7 +349,7 @@ namespace pub
 		session->SetRequestedUrl(requested_url);
 		session->SetFinalUrl(final_url);
 
-		stream->AddSession(session);
+		stream->AddSession(session, true);
 	}
 
 	void SrtPublisher::OnDataReceived(const std::shared_ptr<ov::Socket> &remote,
@@ -239,6 +239,8 @@ namespace pub
 		auto config = GetApplication()->GetConfig();
 		auto srt_config = config.GetPublishers().GetSrtPublisher();
 
+		SetGopCacheOptions(srt_config.GetGopCache());
+
 		std::map<int32_t, std::shared_ptr<MediaTrack>> data_tracks;
 
 		PrepareDefaultPlaylist();
@@ -269,9 +271,11 @@ namespace pub
 			srt_playlist = std::make_shared<SrtPlaylist>(
 				GetSharedPtrAs<info::Stream>(),
 				playlist,
-				GetSharedPtrAs<SrtPlaylistSink>());
+				GetSharedPtrAs<SrtPlaylistSink>(),
+				IsGopCacheEnabled());
 
 			_srt_playlist_map_by_file_name[file_name] = srt_playlist;
+			_gop_cache_key_map_by_file_name[file_name] = ++_last_gop_cache_key;
 
 			auto first_supported_rendition_found = false;
 
@@ -383,8 +387,19 @@ namespace pub
 		for (const auto &[file_name, playlist] : _srt_playlist_map_by_file_name)
 		{
 			playlist->Stop();
+
+			// The GOP of the playlist will not be updated anymore
+			auto key_item = _gop_cache_key_map_by_file_name.find(file_name);
+			if (key_item != _gop_cache_key_map_by_file_name.end())
+			{
+				EraseGopCache(key_item->second);
+			}
 		}
 
+		_srt_playlist_map_by_track_id.clear();
+		_srt_playlist_map_by_file_name.clear();
+		_gop_cache_key_map_by_file_name.clear();
+
 		auto result = Stream::Stop();
 
 		if (result)
@@ -443,11 +458,24 @@ namespace pub
 
 	void SrtStream::OnSrtPlaylistData(
 		const std::shared_ptr<SrtPlaylist> &playlist,
-		const std::shared_ptr<const ov::Data> &data)
+		const std::shared_ptr<const ov::Data> &data,
+		bool is_key_frame_start)
 	{
 		auto srt_data = std::make_shared<const SrtData>(playlist, data);
+		auto packet = std::make_any<std::shared_ptr<const SrtData>>(srt_data);
+
+		// Each playlist is a separate MPEG-TS stream, so it has its own GOP.
+		// The caller (EnqueuePacket() or Start()) holds _srt_playlist_map_mutex.
+		auto key_item = _gop_cache_key_map_by_file_name.find(playlist->GetFileName());
 
-		BroadcastPacket(std::make_any<std::shared_ptr<const SrtData>>(srt_data));
+		if (key_item != _gop_cache_key_map_by_file_name.end())
+		{
+			BroadcastPacket(packet, GopCache::PacketInfo(key_item->second, true, is_key_frame_start, data->GetLength()));
+		}
+		else
+		{
+			BroadcastPacket(packet);
+		}
 
 		MonitorInstance->IncreaseBytesOut(
 			*GetSharedPtrAs<info::Stream>(),
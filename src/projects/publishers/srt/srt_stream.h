@@ -48,7 +48,8 @@ namespace pub
 		//--------------------------------------------------------------------
 		void OnSrtPlaylistData(
 			const std::shared_ptr<SrtPlaylist> &playlist,
-			const std::shared_ptr<const ov::Data> &data) override;
+			const std::shared_ptr<const ov::Data> &data,
+			bool is_key_frame_start) override;
 		//--------------------------------------------------------------------
 
 	private:
@@ -85,5 +86,8 @@ namespace pub
 		std::map<int32_t, std::vector<std::shared_ptr<SrtPlaylist>>> _srt_playlist_map_by_track_id;
 		// key: playlist file name, value: playlist
 		std::map<ov::String, std::shared_ptr<SrtPlaylist>> _srt_playlist_map_by_file_name;
+		// key: playlist file name, value: key of the GOP of the playlist in the GOP cache
+		std::map<ov::String, uint64_t> _gop_cache_key_map_by_file_name;
+		uint64_t _last_gop_cache_key = 0;
 	};
 }  // namespace pub
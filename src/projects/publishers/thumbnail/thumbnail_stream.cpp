@@ -2,6 +2,8 @@
 
 #include <regex>
 
+#include <modules/ffmpeg/snapshot.h>
+
 #include "base/publisher/application.h"
 #include "base/publisher/stream.h"
 #include "thumbnail_private.h"
@@ -17,6 +19,12 @@ ThumbnailStream::ThumbnailStream(const std::shared_ptr<pub::Application> applica
 								 const info::Stream &info)
 	: Stream(application, info)
 {
+	auto &on_demand_config = application->GetConfig().GetPublishers().GetThumbnailPublisher().GetOnDemand();
+
+	_on_demand_enabled = on_demand_config.IsEnabled();
+	_on_demand_cache_ttl = std::chrono::milliseconds(std::max(on_demand_config.GetCacheTTL(), 0));
+	_on_demand_width = on_demand_config.GetWidth();
+	_on_demand_height = on_demand_config.GetHeight();
 }
 
 ThumbnailStream::~ThumbnailStream()
@@ -38,12 +46,22 @@ bool ThumbnailStream::Start()
 	bool found = false;
 	for (const auto &[id, track] : _tracks)
 	{
-		if ((track->GetCodecId() == cmn::MediaCodecId::Png ||
-			 track->GetCodecId() == cmn::MediaCodecId::Jpeg ||
-			 track->GetCodecId() == cmn::MediaCodecId::Webp))
+		if (ffmpeg::Snapshot::IsSupportedImageCodec(track->GetCodecId()))
+		{
+			found = true;
+		}
+		else if ((_on_demand_enabled == true) &&
+				 (track->GetMediaType() == cmn::MediaType::Video) &&
+				 ffmpeg::Snapshot::IsSupportedVideoCodec(track->GetCodecId()))
 		{
+			// Use the track with the highest resolution as the source of on-demand thumbnails
+			if ((_keyframe_track == nullptr) ||
+				((track->GetWidth() * track->GetHeight()) > (_keyframe_track->GetWidth() * _keyframe_track->GetHeight())))
+			{
+				_keyframe_track = track;
+			}
+
 			found = true;
-			break;
 		}
 	}
 
@@ -53,6 +71,13 @@ bool ThumbnailStream::Start()
 		return false;
 	}
 
+	if (_keyframe_track != nullptr)
+	{
+		logti("ThumbnailStream(%s/%s) generates thumbnails on demand from track %u (%s)",
+			  GetApplication()->GetVHostAppName().CStr(), GetName().CStr(),
+			  _keyframe_track->GetId(), cmn::GetCodecIdString(_keyframe_track->GetCodecId()));
+	}
+
 	return Stream::Start();
 }
 
@@ -60,7 +85,17 @@ bool ThumbnailStream::Stop()
 {
 	logtd("ThumbnailStream(%u) has been stopped", GetId());
 
-	return Stream::Stop();
+	auto result = Stream::Stop();
+
+	// Wake up the requests waiting for a thumbnail
+	{
+		std::lock_guard<std::mutex> lock(_encoded_frame_mutex);
+		_latest_keyframe = nullptr;
+		_on_demand_images.clear();
+	}
+	_encoded_frame_cond.notify_all();
+
+	return result;
 }
 
 void ThumbnailStream::SendVideoFrame(const std::shared_ptr<MediaPacket> &media_packet)
@@ -78,18 +113,34 @@ void ThumbnailStream::SendVideoFrame(const std::shared_ptr<MediaPacket> &media_p
 		return;
 	}
 
-	if (!(track->GetCodecId() == cmn::MediaCodecId::Png ||
-		  track->GetCodecId() == cmn::MediaCodecId::Jpeg ||
-		  track->GetCodecId() == cmn::MediaCodecId::Webp))
+	if ((_keyframe_track != nullptr) && (track->GetId() == _keyframe_track->GetId()))
+	{
+		// Keep only the latest keyframe, it is decoded when a thumbnail is requested
+		if (media_packet->IsKeyFrame() && (media_packet->GetData() != nullptr))
+		{
+			{
+				std::lock_guard<std::mutex> lock(_encoded_frame_mutex);
+				_latest_keyframe = media_packet;
+			}
+			_encoded_frame_cond.notify_all();
+		}
+
+		return;
+	}
+
+	if (ffmpeg::Snapshot::IsSupportedImageCodec(track->GetCodecId()) == false)
 	{
 		// Could not support codec for image
 		return;
 	}
 
-	std::lock_guard<std::shared_mutex> lock(_encoded_frame_mutex);
 	if (media_packet->GetData() != nullptr)
 	{
-		_encoded_frames[track->GetCodecId()] = std::move(media_packet->GetData()->Clone());
+		{
+			std::lock_guard<std::mutex> lock(_encoded_frame_mutex);
+			_encoded_frames[track->GetCodecId()] = std::move(media_packet->GetData()->Clone());
+		}
+		_encoded_frame_cond.notify_all();
 	}
 }
 
@@ -98,34 +149,96 @@ void ThumbnailStream::SendAudioFrame(const std::shared_ptr<MediaPacket> &media_p
 	// Nothing..
 }
 
+bool ThumbnailStream::HasImageTrack(cmn::MediaCodecId codec_id) const
+{
+	for (const auto &[id, track] : _tracks)
+	{
+		if (track->GetCodecId() == codec_id)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
 std::shared_ptr<ov::Data> ThumbnailStream::GetVideoFrameByCodecId(cmn::MediaCodecId codec_id, int64_t timeout_ms)
 {
-	ov::StopWatch	watch;
-	
-	watch.Start();
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(std::max(timeout_ms, static_cast<int64_t>(0)));
+
+	std::unique_lock<std::mutex> lock(_encoded_frame_mutex);
+
+	// If the image is encoded by the transcoder, it takes precedence over on-demand generation
+	if ((_keyframe_track != nullptr) && (HasImageTrack(codec_id) == false))
+	{
+		return GetOnDemandVideoFrame(lock, codec_id, deadline);
+	}
+
+	std::shared_ptr<ov::Data> encoded_frame = nullptr;
+
+	_encoded_frame_cond.wait_until(lock, deadline, [&]() -> bool {
+		auto it = _encoded_frames.find(codec_id);
+		if (it != _encoded_frames.end())
+		{
+			encoded_frame = it->second;
+			return true;
+		}
+
+		return GetState() != Stream::State::STARTED;
+	});
 
-	do
+	return encoded_frame;
+}
+
+std::shared_ptr<ov::Data> ThumbnailStream::GetOnDemandVideoFrame(std::unique_lock<std::mutex> &lock, cmn::MediaCodecId codec_id, const std::chrono::steady_clock::time_point &deadline)
+{
+	while (GetState() == Stream::State::STARTED)
 	{
-		if (true)
+		auto &entry = _on_demand_images[codec_id];
+		auto now = std::chrono::steady_clock::now();
+
+		if (entry.image != nullptr)
 		{
-			std::shared_lock<std::shared_mutex> lock(_encoded_frame_mutex);
-			auto it = _encoded_frames.find(codec_id);
-			if (it != _encoded_frames.end())
+			// The image is still valid if it is within TTL or there is no newer keyframe
+			if (((now - entry.created_time) < _on_demand_cache_ttl) || (entry.keyframe == _latest_keyframe))
 			{
-				return it->second;
+				return entry.image;
 			}
 		}
 
-		if( (timeout_ms > 0) && (watch.Elapsed() < timeout_ms))
+		if ((entry.encoding == false) && (_latest_keyframe != nullptr))
 		{
-			usleep(100 * 1000);	 // 100ms
+			// This request makes the image, the other requests wait for it
+			auto keyframe = _latest_keyframe;
+			entry.encoding = true;
+
+			lock.unlock();
+			auto image = ffmpeg::Snapshot::Encode(_keyframe_track, keyframe, codec_id, _on_demand_width, _on_demand_height);
+			lock.lock();
+
+			// The entry may be removed by Stop() while encoding
+			auto &updated_entry = _on_demand_images[codec_id];
+			updated_entry.encoding = false;
+
+			if (image != nullptr)
+			{
+				updated_entry.image = image;
+				updated_entry.keyframe = keyframe;
+				updated_entry.created_time = std::chrono::steady_clock::now();
+			}
+
+			_encoded_frame_cond.notify_all();
+
+			return (image != nullptr) ? image : updated_entry.image;
 		}
-		else
+
+		// Wait for the keyframe or the image made by another request
+		if (_encoded_frame_cond.wait_until(lock, deadline) == std::cv_status::timeout)
 		{
-			break;
+			// Returns the previous image (if any) rather than nothing
+			return _on_demand_images[codec_id].image;
 		}
-
-	} while (true);
+	}
 
 	return nullptr;
-}
\ No newline at end of file
+}
@@ -25,7 +25,34 @@ private:
 	bool Start() override;
 	bool Stop() override;
 
-	std::shared_mutex _encoded_frame_mutex;
+	bool HasImageTrack(cmn::MediaCodecId codec_id) const;
+
+	// Must be called with _encoded_frame_mutex locked
+	std::shared_ptr<ov::Data> GetOnDemandVideoFrame(std::unique_lock<std::mutex> &lock, cmn::MediaCodecId codec_id, const std::chrono::steady_clock::time_point &deadline);
+
+	struct OnDemandImage
+	{
+		std::shared_ptr<ov::Data> image = nullptr;
+		// The keyframe that the image was made from
+		std::shared_ptr<const MediaPacket> keyframe = nullptr;
+		std::chrono::steady_clock::time_point created_time;
+		// Another request is decoding/encoding the image
+		bool encoding = false;
+	};
+
+	std::mutex _encoded_frame_mutex;
+	// Notified when an encoded frame, a keyframe or an on-demand image is updated, or the stream is stopped
+	std::condition_variable _encoded_frame_cond;
 	std::map<cmn::MediaCodecId, std::shared_ptr<ov::Data>> _encoded_frames;
+
+	// On-demand mode
+	bool _on_demand_enabled = false;
+	std::chrono::milliseconds _on_demand_cache_ttl{1000};
+	int32_t _on_demand_width = 0;
+	int32_t _on_demand_height = 0;
+	std::shared_ptr<MediaTrack> _keyframe_track = nullptr;
+	std::shared_ptr<const MediaPacket> _latest_keyframe = nullptr;
+	std::map<cmn::MediaCodecId, OnDemandImage> _on_demand_images;
+
 	std::shared_ptr<mon::StreamMetrics> _stream_metrics;
 };
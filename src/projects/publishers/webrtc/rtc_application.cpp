@@ -42,6 +42,11 @@ std::shared_ptr<Certificate> RtcApplication::GetCertificate()
 	return _certificate;
 }
 
+std::shared_ptr<ov::TlsContext> RtcApplication::GetDtlsContext()
+{
+	return _dtls_context;
+}
+
 std::shared_ptr<pub::Stream> RtcApplication::CreateStream(const std::shared_ptr<info::Stream> &info, uint32_t worker_count)
 {
 	logtd("RtcApplication::CreateStream : %s/%u", info->GetName().CStr(), info->GetId());
@@ -89,6 +94,14 @@ bool RtcApplication::Start()
 		}
 	}
 
+	// Building SSL_CTX (loading the key, ciphers, SRTP profiles) per session is expensive, so all sessions share it
+	_dtls_context = DtlsTransport::CreateTlsContext(_certificate);
+	if (_dtls_context == nullptr)
+	{
+		logte("Cannot create DTLS context");
+		return false;
+	}
+
 	return Application::Start();
 }
 
@@ -33,6 +33,8 @@ public:
 	~RtcApplication() final;
 
 	std::shared_ptr<Certificate> GetCertificate();
+	// DTLS context shared by all sessions of this application
+	std::shared_ptr<ov::TlsContext> GetDtlsContext();
 
 private:
 	bool Start() override;
@@ -45,4 +47,5 @@ private:
 	std::shared_ptr<IcePort> _ice_port;
 	std::shared_ptr<RtcSignallingServer> _rtc_signalling;
 	std::shared_ptr<Certificate> _certificate;
+	std::shared_ptr<ov::TlsContext> _dtls_context;
 };
\ No newline at end of file
@@ -0,0 +1,138 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "rtc_pacer.h"
+
+#include "rtc_private.h"
+
+RtcPacer::RtcPacer()
+{
+	_last_update_time = std::chrono::steady_clock::now();
+	_budget_bytes	  = GetMaxBudget();
+}
+
+void RtcPacer::SetPacingBitrate(uint64_t bitrate_bps)
+{
+	_pacing_bitrate = std::max<uint64_t>(bitrate_bps, RTC_PACER_MIN_BITRATE);
+}
+
+uint64_t RtcPacer::GetPacingBitrate() const
+{
+	return _pacing_bitrate;
+}
+
+void RtcPacer::Enqueue(const std::shared_ptr<RtpPacket> &rtp_packet, PacketType type, uint16_t origin_sequence_number)
+{
+	Packet packet{rtp_packet, type, origin_sequence_number, std::chrono::steady_clock::now()};
+
+	if (type == PacketType::Video)
+	{
+		_normal_priority_queue.push_back(std::move(packet));
+	}
+	else
+	{
+		_high_priority_queue.push_back(std::move(packet));
+	}
+
+	_queued_bytes += rtp_packet->GetDataLength();
+}
+
+// A burst of up to two intervals can be sent at once
+int64_t RtcPacer::GetMaxBudget() const
+{
+	return std::max<int64_t>(static_cast<int64_t>(_pacing_bitrate / 8 * RTC_PACER_INTERVAL_MS * 2 / 1000), 1500);
+}
+
+void RtcPacer::UpdateBudget(const std::chrono::steady_clock::time_point &now)
+{
+	auto elapsed_us	  = std::chrono::duration_cast<std::chrono::microseconds>(now - _last_update_time).count();
+	_last_update_time = now;
+
+	auto max_budget	  = GetMaxBudget();
+	_budget_bytes += static_cast<int64_t>(_pacing_bitrate / 8 * elapsed_us / 1000000);
+	// Debt is limited so that a drained queue does not hold the following packets for too long
+	_budget_bytes = std::clamp<int64_t>(_budget_bytes, -max_budget, max_budget);
+}
+
+bool RtcPacer::Dequeue(std::vector<Packet> &packets)
+{
+	auto now = std::chrono::steady_clock::now();
+
+	UpdateBudget(now);
+
+	// Audio and retransmissions are sent right away, but they consume the budget
+	while (_high_priority_queue.empty() == false)
+	{
+		auto &packet = _high_priority_queue.front();
+		auto length	 = packet.rtp_packet->GetDataLength();
+
+		_budget_bytes -= length;
+		_queued_bytes -= length;
+		_stats.sent_packets++;
+
+		packets.push_back(std::move(packet));
+		_high_priority_queue.pop_front();
+	}
+
+	if (_normal_priority_queue.empty())
+	{
+		return false;
+	}
+
+	auto oldest_delay_ms = std::chrono::duration_cast<std::chrono::milliseconds>(now - _normal_priority_queue.front().enqueued_time).count();
+	bool drain			 = oldest_delay_ms > RTC_PACER_MAX_QUEUE_DELAY_MS;
+	if (drain)
+	{
+		_stats.drain_count++;
+		logtd("Pacer queue delay(%lld ms) exceeded the limit, drain %zu packets (pacing bitrate: %llu)", oldest_delay_ms, _normal_priority_queue.size(), _pacing_bitrate);
+	}
+
+	while ((_normal_priority_queue.empty() == false) && ((_budget_bytes > 0) || drain))
+	{
+		auto &packet	= _normal_priority_queue.front();
+		auto length		= packet.rtp_packet->GetDataLength();
+		auto delay_ms	= std::chrono::duration_cast<std::chrono::milliseconds>(now - packet.enqueued_time).count();
+
+		_budget_bytes -= length;
+		_queued_bytes -= length;
+
+		_stats.sent_packets++;
+		if (delay_ms > 0)
+		{
+			_stats.delayed_packets++;
+			_stats.total_queue_delay_ms += delay_ms;
+			_stats.max_queue_delay_ms = std::max(_stats.max_queue_delay_ms, delay_ms);
+		}
+
+		packets.push_back(std::move(packet));
+		_normal_priority_queue.pop_front();
+	}
+
+	return _normal_priority_queue.empty() == false;
+}
+
+bool RtcPacer::IsEmpty() const
+{
+	return _high_priority_queue.empty() && _normal_priority_queue.empty();
+}
+
+RtcPacer::Stats RtcPacer::GetStats() const
+{
+	auto stats			 = _stats;
+
+	stats.pacing_bitrate = _pacing_bitrate;
+	stats.queued_packets = _high_priority_queue.size() + _normal_priority_queue.size();
+	stats.queued_bytes	 = _queued_bytes;
+
+	if (_normal_priority_queue.empty() == false)
+	{
+		stats.queue_delay_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _normal_priority_queue.front().enqueued_time).count();
+	}
+
+	return stats;
+}
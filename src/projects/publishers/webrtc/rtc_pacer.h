@@ -0,0 +1,104 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+#include <modules/rtp_rtcp/rtp_packet.h>
+
+#include <deque>
+
+// Interval at which the queued packets are released
+#define RTC_PACER_INTERVAL_MS 5
+// Pacing bitrate = Estimated bitrate * RTC_PACER_PACING_FACTOR (same factor as libwebrtc)
+#define RTC_PACER_PACING_FACTOR 2.5
+// Used until the bandwidth is estimated by the player
+#define RTC_PACER_DEFAULT_BITRATE (20 * 1000 * 1000)
+#define RTC_PACER_MIN_BITRATE (1 * 1000 * 1000)
+// If the oldest packet has waited longer than this, the queue is drained regardless of the budget
+#define RTC_PACER_MAX_QUEUE_DELAY_MS 200
+
+// Leaky bucket pacer that spreads a burst of RTP packets (e.g. a keyframe) over time
+// instead of sending hundreds of packets to a player at once.
+//
+// Audio and retransmission packets are never delayed, video packets are released within the budget
+// that is filled at the pacing bitrate. RtcPacer is not thread-safe, the caller must serialize access.
+class RtcPacer
+{
+public:
+	enum class PacketType : uint8_t
+	{
+		Audio,
+		Video,
+		Retransmission
+	};
+
+	struct Packet
+	{
+		std::shared_ptr<RtpPacket> rtp_packet;
+		PacketType type;
+		// Sequence number of the packet before it is rewritten for the session
+		uint16_t origin_sequence_number;
+		std::chrono::steady_clock::time_point enqueued_time;
+	};
+
+	struct Stats
+	{
+		uint64_t pacing_bitrate = 0;
+
+		size_t queued_packets = 0;
+		size_t queued_bytes = 0;
+		// How long the oldest packet in the queue has waited
+		int64_t queue_delay_ms = 0;
+
+		uint64_t sent_packets = 0;
+		uint64_t delayed_packets = 0;
+		int64_t max_queue_delay_ms = 0;
+		int64_t total_queue_delay_ms = 0;
+		// Number of times the queue was drained because RTC_PACER_MAX_QUEUE_DELAY_MS was exceeded
+		uint64_t drain_count = 0;
+
+		double GetAverageQueueDelayMs() const
+		{
+			return (delayed_packets > 0) ? (static_cast<double>(total_queue_delay_ms) / delayed_packets) : 0.0;
+		}
+	};
+
+	RtcPacer();
+
+	void SetPacingBitrate(uint64_t bitrate_bps);
+	uint64_t GetPacingBitrate() const;
+
+	void Enqueue(const std::shared_ptr<RtpPacket> &rtp_packet, PacketType type, uint16_t origin_sequence_number);
+
+	// Moves the packets that can be sent now to packets.
+	// Returns true if some packets are still waiting in the queue.
+	bool Dequeue(std::vector<Packet> &packets);
+
+	bool IsEmpty() const;
+
+	Stats GetStats() const;
+
+private:
+	void UpdateBudget(const std::chrono::steady_clock::time_point &now);
+	int64_t GetMaxBudget() const;
+
+	uint64_t _pacing_bitrate = RTC_PACER_DEFAULT_BITRATE;
+
+	// Bytes that can be sent now. It becomes negative when a packet larger than the budget is sent.
+	int64_t _budget_bytes = 0;
+	std::chrono::steady_clock::time_point _last_update_time;
+
+	// Audio and retransmissions
+	std::deque<Packet> _high_priority_queue;
+	// Video
+	std::deque<Packet> _normal_priority_queue;
+	size_t _queued_bytes = 0;
+
+	Stats _stats;
+};
@@ -8,6 +8,8 @@
 //==============================================================================
 #include "rtc_session.h"
 
+#include <cmath>
+#include <optional>
 #include <utility>
 
 #include "base/info/stream.h"
@@ -98,7 +100,7 @@ bool RtcSession::Start()
 
 	_dtls_transport								= std::make_shared<DtlsTransport>();
 	std::shared_ptr<RtcApplication> application = std::static_pointer_cast<RtcApplication>(GetApplication());
-	_dtls_transport->SetLocalCertificate(application->GetCertificate());
+	_dtls_transport->SetTlsContext(application->GetDtlsContext());
 	_dtls_transport->StartDTLS();
 
 	// RFC3264
@@ -193,6 +195,19 @@ bool RtcSession::Start()
 	_abr_test_watch.Start();
 	_bitrate_estimate_watch.Start();
 
+	if (ov::Converter::ToBool(std::getenv("OME_DUMP_BWE")))
+	{
+		// The feedback can be replayed offline with src/tests/bench/rtp_bandwidth_estimator_bench
+		auto dump_path = ov::PathManager::GetAppPath("dump/bwe");
+		ov::PathManager::MakeDirectoryRecursive(dump_path);
+
+		auto file_path = ov::PathManager::Combine(dump_path, ov::String::FormatString("%s_%u.csv", GetStream()->GetName().CStr(), GetId()));
+		if (_bandwidth_estimator.StartRecording(file_path))
+		{
+			logti("Bandwidth estimator feedback of session(%u) is recorded to %s", GetId(), file_path.CStr());
+		}
+	}
+
 	return Session::Start();
 }
 
@@ -220,12 +235,25 @@ bool RtcSession::Stop()
 
 	if (_srtp_transport != nullptr)
 	{
+		ReportSrtpProtectStats();
 		_srtp_transport->Stop();
 	}
 
 	// TODO(Getroot): Doesn't need this?
 	//_ws_session->Close();
 
+	{
+		std::lock_guard<std::mutex> pacer_lock(_pacer_lock);
+		auto stats = _pacer.GetStats();
+		if (stats.sent_packets > 0)
+		{
+			logtd("Pacer stats - session(%u) pacing bitrate(%llu) sent packets(%llu) delayed packets(%llu) avg queue delay(%.2f ms) max queue delay(%lld ms) drain count(%llu)",
+				  GetId(), stats.pacing_bitrate, stats.sent_packets, stats.delayed_packets, stats.GetAverageQueueDelayMs(), stats.max_queue_delay_ms, stats.drain_count);
+		}
+	}
+
+	logtd("Bandwidth estimator stats - session(%u) %s", GetId(), _bandwidth_estimator.GetStats().ToString().CStr());
+
 	ov::Node::Stop();
 
 	return Session::Stop();
@@ -524,6 +552,24 @@ void RtcSession::SendOutgoingData(const std::any &packet)
 		return;
 	}
 
+	// Start from the cached GOP as soon as the packets can be sent
+	if ((_gop_cache_requested == false) && GetStream()->IsGopCacheEnabled())
+	{
+		if (_srtp_transport->IsKeyReady() == false)
+		{
+			// DTLS handshake is not completed yet, the packet cannot be sent
+			return;
+		}
+
+		_gop_cache_requested = true;
+
+		if (GetStream()->SendGopCache(std::static_pointer_cast<RtcSession>(RtpRtcpInterface::GetSharedPtr())))
+		{
+			// This packet is in the cache (or older than it)
+			return;
+		}
+	}
+
 	// RTP Session must be copied and sent because data is altered due to SRTP.
 	auto copy_packet = std::make_shared<RtpPacket>(*session_packet);
 
@@ -536,23 +582,108 @@ void RtcSession::SendOutgoingData(const std::any &packet)
 		copy_packet->SetSequenceNumber(_audio_rtp_sequence_number++);
 	}
 
-	// Set transport-wide sequence number
-	SetTransportWideSequenceNumber(copy_packet, _wide_sequence_number);
-	SetAbsSendTime(copy_packet, ov::Clock::NowMSec());
+	// Packets go through the pacer so that a burst (e.g. a keyframe) is spread over time
+	std::unique_lock<std::mutex> pacer_lock(_pacer_lock);
+	_pacer.Enqueue(copy_packet, copy_packet->IsVideoPacket() ? RtcPacer::PacketType::Video : RtcPacer::PacketType::Audio, session_packet->SequenceNumber());
+	ReleasePacedPackets(pacer_lock);
+}
+
+bool RtcSession::SendPacedPackets()
+{
+	std::vector<RtcPacer::Packet> packets;
+	auto remaining = _pacer.Dequeue(packets);
+
+	if (packets.empty())
+	{
+		return remaining;
+	}
+
+	std::vector<std::shared_ptr<RtpPacket>> rtp_packets;
+	rtp_packets.reserve(packets.size());
+
+	auto now_ms = ov::Clock::NowMSec();
+	auto now = std::chrono::steady_clock::now();
+	// Only video packets are paced, audio and retransmissions are sent right away
+	std::optional<std::chrono::steady_clock::time_point> oldest_video_enqueued_time;
+
+	for (const auto &packet : packets)
+	{
+		if ((packet.type == RtcPacer::PacketType::Video) && (oldest_video_enqueued_time.has_value() == false))
+		{
+			oldest_video_enqueued_time = packet.enqueued_time;
+		}
+
+		// Retransmissions are not counted in transport-cc
+		if (packet.type != RtcPacer::PacketType::Retransmission)
+		{
+			// Set transport-wide sequence number
+			SetTransportWideSequenceNumber(packet.rtp_packet, _wide_sequence_number);
+			SetAbsSendTime(packet.rtp_packet, now_ms);
+
+			RecordRtpSent(packet.rtp_packet, packet.origin_sequence_number, _wide_sequence_number);
+
+			_wide_sequence_number++;
+
+			MonitorInstance->IncreaseBytesOut(*GetStream(), PublisherType::Webrtc, packet.rtp_packet->GetDataLength());
+		}
+
+		rtp_packets.push_back(packet.rtp_packet);
+	}
 
 	// rtp_rtcp -> srtp -> dtls -> Edge Node(RtcSession)
+	// The released packets are sent as a burst so that SRTP protects them at once
+	_rtp_rtcp->SendRtpPackets(rtp_packets);
+
+	// One sample per burst (the oldest video packet) rather than per packet,
+	// so that thousands of sessions don't contend on the histogram of the stream
+	if (oldest_video_enqueued_time.has_value())
+	{
+		GetStream()->RecordPacerQueueDelay(std::chrono::duration_cast<std::chrono::microseconds>(now - oldest_video_enqueued_time.value()).count());
+	}
+
+	return remaining;
+}
 
-	// Packet loss simulation codes
-	// if (ov::Random::GenerateUInt32(1, 33) != 10)
+void RtcSession::ReleasePacedPackets(std::unique_lock<std::mutex> &pacer_lock)
+{
+	if ((SendPacedPackets() == false) || (_pacing_scheduled == true))
 	{
-		_rtp_rtcp->SendRtpPacket(copy_packet);
+		return;
 	}
 
-	RecordRtpSent(copy_packet, session_packet->SequenceNumber(), _wide_sequence_number);
+	_pacing_scheduled = true;
+	pacer_lock.unlock();
+
+	// The remaining packets will be sent by the pacer timer
+	_publisher->SchedulePacing(std::static_pointer_cast<RtcSession>(RtpRtcpInterface::GetSharedPtr()));
+}
+
+bool RtcSession::OnPacingTimer()
+{
+	//It must not be called during start and stop.
+	std::shared_lock<std::shared_mutex> lock(_start_stop_lock);
+	std::lock_guard<std::mutex> pacer_lock(_pacer_lock);
+
+	if (pub::Session::GetState() != SessionState::Started)
+	{
+		_pacing_scheduled = false;
+		return false;
+	}
 
-	_wide_sequence_number++;
+	_pacing_scheduled = SendPacedPackets();
 
-	MonitorInstance->IncreaseBytesOut(*GetStream(), PublisherType::Webrtc, copy_packet->GetDataLength());
+	return _pacing_scheduled;
+}
+
+void RtcSession::UpdatePacingBitrate()
+{
+	if ((std::isfinite(_estimated_bitrates) == false) || (_estimated_bitrates <= 0))
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> pacer_lock(_pacer_lock);
+	_pacer.SetPacingBitrate(static_cast<uint64_t>(_estimated_bitrates * RTC_PACER_PACING_FACTOR));
 }
 
 bool RtcSession::SetTransportWideSequenceNumber(const std::shared_ptr<RtpPacket> &rtp_packet, uint16_t wide_sequence_number)
@@ -593,60 +724,37 @@ bool RtcSession::RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packe
 		return false;
 	}
 
-	auto sent_log					  = std::make_shared<RtpSentLog>();
-	sent_log->_sequence_number		  = rtp_packet->SequenceNumber();
-	sent_log->_wide_sequence_number	  = wide_sequence_number;
-	sent_log->_track_id				  = rtp_packet->GetTrackId();
-	sent_log->_payload_type			  = rtp_packet->PayloadType();
-	sent_log->_origin_sequence_number = origin_sequence_number;
-	sent_log->_timestamp			  = rtp_packet->Timestamp();
-	sent_log->_marker				  = rtp_packet->Marker();
-	sent_log->_ssrc					  = rtp_packet->Ssrc();
-
-	sent_log->_sent_bytes			  = rtp_packet->GetDataLength();
-	sent_log->_sent_time			  = std::chrono::system_clock::now();
+	RtpSentLog sent_log;
+	sent_log._sequence_number		 = rtp_packet->SequenceNumber();
+	sent_log._wide_sequence_number	 = wide_sequence_number;
+	sent_log._track_id				 = rtp_packet->GetTrackId();
+	sent_log._payload_type			 = rtp_packet->PayloadType();
+	sent_log._origin_sequence_number = origin_sequence_number;
+	sent_log._timestamp				 = rtp_packet->Timestamp();
+	sent_log._marker				 = rtp_packet->Marker();
+	sent_log._ssrc					 = rtp_packet->Ssrc();
 
-	auto video_rtp_key				  = sent_log->_sequence_number % MAX_RTP_RECORDS;
-	auto wide_rtp_key				  = sent_log->_wide_sequence_number % MAX_RTP_RECORDS;
-
-	std::lock_guard<std::shared_mutex> lock(_rtp_record_map_lock);
+	sent_log._sent_bytes			 = rtp_packet->GetDataLength();
+	sent_log._sent_time				 = std::chrono::system_clock::now();
 
 	if (rtp_packet->IsVideoPacket())
 	{
-		_video_rtp_sent_record_map[video_rtp_key] = sent_log;
+		_video_rtp_sent_logs.Record(sent_log._sequence_number, sent_log);
 	}
-	_wide_rtp_sent_record_map[wide_rtp_key] = sent_log;
+	_wide_rtp_sent_logs.Record(wide_sequence_number, sent_log);
 
 	return true;
 }
 
-std::shared_ptr<RtcSession::RtpSentLog> RtcSession::TraceRtpSentByVideoSeqNo(uint16_t sequence_number)
+bool RtcSession::TraceRtpSentByVideoSeqNo(uint16_t sequence_number, RtpSentLog &sent_log) const
 {
-	std::shared_lock<std::shared_mutex> lock(_rtp_record_map_lock);
-
-	auto key = sequence_number % MAX_RTP_RECORDS;
-	auto it	 = _video_rtp_sent_record_map.find(key);
-	if (it == _video_rtp_sent_record_map.end())
-	{
-		return nullptr;
-	}
-
-	return it->second;
+	return _video_rtp_sent_logs.Trace(sequence_number, sent_log);
 }
 
 // Get RTP Sent Log from RTP History
-std::shared_ptr<RtcSession::RtpSentLog> RtcSession::TraceRtpSentByWideSeqNo(uint16_t wide_sequence_number)
+bool RtcSession::TraceRtpSentByWideSeqNo(uint16_t wide_sequence_number, RtpSentLog &sent_log) const
 {
-	std::shared_lock<std::shared_mutex> lock(_rtp_record_map_lock);
-
-	auto key = wide_sequence_number % MAX_RTP_RECORDS;
-	auto it	 = _wide_rtp_sent_record_map.find(key);
-	if (it == _wide_rtp_sent_record_map.end())
-	{
-		return nullptr;
-	}
-
-	return it->second;
+	return _wide_rtp_sent_logs.Trace(wide_sequence_number, sent_log);
 }
 
 void RtcSession::OnRtpFrameReceived(const std::vector<std::shared_ptr<RtpPacket>> &rtp_packets)
@@ -702,9 +810,39 @@ bool RtcSession::ProcessReceiverReport(const std::shared_ptr<RtcpInfo> &rtcp_inf
 
 	//rr->DebugPrint();
 
+	// Receiver reports arrive periodically (about every second), so the SRTP statistics are reported with them
+	ReportSrtpProtectStats();
+
 	return true;
 }
 
+void RtcSession::ReportSrtpProtectStats()
+{
+	if (_srtp_transport == nullptr)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(_srtp_protect_stats_lock);
+
+	auto stats = _srtp_transport->GetProtectStats();
+	if (stats.packets <= _reported_srtp_protect_stats.packets)
+	{
+		return;
+	}
+
+	auto stream_metrics = StreamMetrics(*GetStream());
+	if (stream_metrics != nullptr)
+	{
+		stream_metrics->IncreaseSrtpProtectStats(
+			stats.packets - _reported_srtp_protect_stats.packets,
+			stats.bytes - _reported_srtp_protect_stats.bytes,
+			std::chrono::duration_cast<std::chrono::microseconds>(stats.elapsed - _reported_srtp_protect_stats.elapsed).count());
+	}
+
+	_reported_srtp_protect_stats = stats;
+}
+
 bool RtcSession::ProcessNACK(const std::shared_ptr<RtcpInfo> &rtcp_info)
 {
 	if (_rtx_enabled == false)
@@ -724,28 +862,34 @@ bool RtcSession::ProcessNACK(const std::shared_ptr<RtcpInfo> &rtcp_info)
 		return false;
 	}
 
-	// Retransmission
+	// Retransmissions are sent through the pacer with high priority,
+	// so they are not delayed behind the queued video packets.
+	std::unique_lock<std::mutex> pacer_lock(_pacer_lock);
+
 	for (size_t i = 0; i < nack->GetLostIdCount(); i++)
 	{
-		auto seq_no	  = nack->GetLostId(i);
-		auto sent_log = TraceRtpSentByVideoSeqNo(seq_no);
-		if (sent_log == nullptr)
+		auto seq_no = nack->GetLostId(i);
+		RtpSentLog sent_log;
+		if (TraceRtpSentByVideoSeqNo(seq_no, sent_log) == false)
 		{
 			continue;
 		}
 
-		logtd("RTX requested(%d) - TrackID(%u) PayloadType(%d) OriginSeqNo(%u)", seq_no, sent_log->_track_id, sent_log->_payload_type, sent_log->_origin_sequence_number);
+		logtd("RTX requested(%d) - TrackID(%u) PayloadType(%d) OriginSeqNo(%u)", seq_no, sent_log._track_id, sent_log._payload_type, sent_log._origin_sequence_number);
 
-		auto rtx_packet = stream->GetRtxRtpPacket(sent_log->_track_id, sent_log->_payload_type, sent_log->_origin_sequence_number);
+		auto rtx_packet = stream->GetRtxRtpPacket(sent_log._track_id, sent_log._payload_type, sent_log._origin_sequence_number);
 		if (rtx_packet != nullptr)
 		{
 			auto copy_rtx_packet = std::make_shared<RtxRtpPacket>(*rtx_packet);
 			copy_rtx_packet->SetSequenceNumber(_rtx_sequence_number++);
-			copy_rtx_packet->SetOriginalSequenceNumber(sent_log->_sequence_number);
-			return _rtp_rtcp->SendRtpPacket(copy_rtx_packet);
+			copy_rtx_packet->SetOriginalSequenceNumber(sent_log._sequence_number);
+			_pacer.Enqueue(copy_rtx_packet, RtcPacer::PacketType::Retransmission, seq_no);
 		}
 	}
 
+	// Lost packets are retransmitted as a burst so that SRTP protects them at once
+	ReleasePacedPackets(pacer_lock);
+
 	return true;
 }
 
@@ -759,78 +903,44 @@ bool RtcSession::ProcessTransportCc(const std::shared_ptr<RtcpInfo> &rtcp_info)
 		return false;
 	}
 
-	uint64_t sent_bytes	  = 0;
-	int64_t sent_duration = 0;
-
-	// For debug
-	// logtd("TransportCC - SenderSsrc(%u) MediaSsrc(%u) PacketStatusCount(%u)", transport_cc->GetSenderSsrc(), transport_cc->GetMediaSsrc(), transport_cc->GetPacketStatusCount());
-
-	// for (size_t i = 0; i < transport_cc->GetPacketStatusCount(); i++)
-	// {
-	// 	auto packet_status = transport_cc->GetPacketFeedbackInfo(i);
-	// 	auto sent_log = TraceRtpSentByWideSeqNo(packet_status->_wide_sequence_number);
-	// 	if (sent_log == nullptr)
-	// 	{
-	// 		logte("TransportCC - No sent log found for seqno(%u)", packet_status->_wide_sequence_number);
-	// 		continue;
-	// 	}
-
-	// 	logtd("%s", sent_log->ToString().CStr());
-	// }
+	std::vector<RtpBandwidthEstimator::PacketResult> packet_results;
+	packet_results.reserve(transport_cc->GetPacketStatusCount());
 
-	// return true;
+	// The arrival time of the first packet is relative to the reference time (64ms unit),
+	// and the others are relative to the previous received packet (250us unit)
+	int64_t arrival_time_us = static_cast<int64_t>(transport_cc->GetReferenceTime()) * 64000;
 
-	for (size_t i = 1; i < transport_cc->GetPacketStatusCount(); i++)
+	for (size_t i = 0; i < transport_cc->GetPacketStatusCount(); i++)
 	{
 		auto packet_status = transport_cc->GetPacketFeedbackInfo(i);
-		auto sent_log	   = TraceRtpSentByWideSeqNo(packet_status->_wide_sequence_number);
-		if (sent_log == nullptr)
-		{
-			logte("TransportCC - No sent log found for seqno(%u)", packet_status->_wide_sequence_number);
-			continue;
-		}
-		auto prev_sent_log = TraceRtpSentByWideSeqNo(packet_status->_wide_sequence_number - 1);
-		if (prev_sent_log == nullptr)
+		if (packet_status->_received == true)
 		{
-			logtd("TransportCC - No prev sent log found for seqno(%u)", packet_status->_wide_sequence_number - 1);
-			continue;
+			arrival_time_us += static_cast<int64_t>(packet_status->_received_delta) * 250;
 		}
 
-		// Calc delta of sent_log and prev_sent_log
-		int32_t sent_delta_time = (std::chrono::duration_cast<std::chrono::microseconds>(sent_log->_sent_time - prev_sent_log->_sent_time).count()) / 250;
-
-		auto duration			= packet_status->_received_delta - sent_delta_time;
-		if (duration <= 0)
+		RtpSentLog sent_log;
+		if (TraceRtpSentByWideSeqNo(packet_status->_wide_sequence_number, sent_log) == false)
 		{
-			//duration = 1;
+			logtd("TransportCC - No sent log found for seqno(%u)", packet_status->_wide_sequence_number);
+			continue;
 		}
 
-		sent_bytes += sent_log->_sent_bytes;
-		sent_duration += duration;
+		RtpBandwidthEstimator::PacketResult packet_result;
+		packet_result.send_time_us	  = std::chrono::duration_cast<std::chrono::microseconds>(sent_log._sent_time.time_since_epoch()).count();
+		packet_result.arrival_time_us = packet_status->_received == true ? arrival_time_us : -1;
+		packet_result.size			  = sent_log._sent_bytes;
 
-		logtd("WideSeqNo(%u) Refer(%u) RecvDelta(%u) SentDelta(%u) SentBytes(%u) Duration(%d)", packet_status->_wide_sequence_number, transport_cc->GetReferenceTime(), packet_status->_received_delta, sent_delta_time, sent_log->_sent_bytes, duration);
+		packet_results.push_back(packet_result);
 	}
 
-	if (sent_bytes > 0)
+	if (packet_results.empty())
 	{
-		double sent_seconds = static_cast<double>(sent_duration) / 4000.0;
-
-		_total_sent_seconds += sent_seconds;
-		_total_sent_bytes += sent_bytes;
-		_estimated_bitrates = static_cast<double>((_total_sent_bytes * 8)) / _total_sent_seconds;
-
-		if (_bitrate_estimate_watch.IsElapsed(1000) == true)
-		{
-			_bitrate_estimate_watch.Update();
-			ChangeRenditionIfNeeded();
-
-			logtd("Estimated Bandwidth(%f) TotalSentBytes(%u) TotalSentSeconds(%f)", static_cast<double>(_total_sent_bytes * 8) / _total_sent_seconds, _total_sent_bytes, _total_sent_seconds);
-
-			_total_sent_seconds = 0;
-			_total_sent_bytes	= 0;
-		}
+		return true;
 	}
 
+	_bandwidth_estimator.OnTransportFeedback(packet_results, std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+	UpdateEstimatedBitrate();
+
 	return true;
 }
 
@@ -840,19 +950,38 @@ bool RtcSession::ProcessRemb(const std::shared_ptr<RtcpInfo> &rtcp_info)
 
 	logtd("REMB Estimated Bandwidth(%lld)", remb->GetBitrateBps());
 
-	_previous_estimated_bitrate = _estimated_bitrates;
-	_estimated_bitrates			= remb->GetBitrateBps();
+	_bandwidth_estimator.OnRemb(remb->GetBitrateBps(), std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+	UpdateEstimatedBitrate();
+
+	return true;
+}
 
-	if (_bitrate_estimate_watch.IsElapsed(1000) == true)
+void RtcSession::UpdateEstimatedBitrate()
+{
+	auto target_bitrate = _bandwidth_estimator.GetTargetBitrate();
+	if (target_bitrate == 0)
 	{
-		_bitrate_estimate_watch.Update();
-		ChangeRenditionIfNeeded();
+		// Not estimated yet
+		return;
 	}
 
-	return true;
+	_estimated_bitrates = target_bitrate;
+	UpdatePacingBitrate();
+
+	// Go lower as soon as the congestion is detected, other decisions are made once per second
+	bool congestion_detected = _bandwidth_estimator.IsDecreased();
+	if (congestion_detected == true || _bitrate_estimate_watch.IsElapsed(1000) == true)
+	{
+		_bitrate_estimate_watch.Update();
+
+		logtd("Estimated Bandwidth - %s", _bandwidth_estimator.GetStats().ToString().CStr());
+
+		ChangeRenditionIfNeeded(congestion_detected);
+		_previous_estimated_bitrate = _estimated_bitrates;
+	}
 }
 
-void RtcSession::ChangeRenditionIfNeeded()
+void RtcSession::ChangeRenditionIfNeeded(bool congestion_detected)
 {
 	if (_auto_abr == false)
 	{
@@ -865,7 +994,7 @@ void RtcSession::ChangeRenditionIfNeeded()
 	if (1.1 * _estimated_bitrates <= current_rendition_bitrates)
 	{
 		auto lower = _playlist->GetNextLowerBitrateRendition(_current_rendition);
-		if (lower != nullptr && IsNextRenditionGoodChoice(lower) == true)
+		if (lower != nullptr && (congestion_detected == true || IsNextRenditionGoodChoice(lower) == true))
 		{
 			logtd("ChangeRenditionIfNeeded - Change to low bitrate");
 			if (RequestChangeRendition(SwitchOver::LOWER) == true)
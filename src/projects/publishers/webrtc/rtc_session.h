@@ -16,10 +16,13 @@
 #include "base/publisher/session.h"
 #include "modules/dtls_srtp/dtls_transport.h"
 #include "modules/ice/ice_port.h"
+#include "modules/rtp_rtcp/rtp_bandwidth_estimator.h"
 #include "modules/rtp_rtcp/rtp_packetizer_interface.h"
 #include "modules/rtp_rtcp/rtp_rtcp.h"
 #include "modules/sdp/session_description.h"
+#include "rtc_pacer.h"
 #include "rtc_playlist.h"
+#include "rtp_sent_log_ring.h"
 
 /*	Node Connection
  * [  RTP_RTCP ]
@@ -97,6 +100,10 @@ public:
 		return _ice_session_id;
 	}
 
+	// Called by the pacer timer of WebRtcPublisher while packets are waiting in the pacer.
+	// Returns true if it needs to be called again.
+	bool OnPacingTimer();
+
 private:
 	bool ProcessReceiverReport(const std::shared_ptr<RtcpInfo> &rtcp_info);
 	bool ProcessNACK(const std::shared_ptr<RtcpInfo> &rtcp_info);
@@ -108,6 +115,9 @@ private:
 
 	void ChangeRendition();
 
+	// Adds the SRTP protect statistics since the last report to the stream metrics
+	void ReportSrtpProtectStats();
+
 	bool SendPlaylistInfo(const std::shared_ptr<const RtcPlaylist> &playlist) const;
 	bool SendRenditionChanged(const std::shared_ptr<const RtcRendition> &rendition) const;
 
@@ -117,6 +127,9 @@ private:
 	std::shared_ptr<SrtpTransport> _srtp_transport;
 	std::shared_ptr<DtlsTransport> _dtls_transport;
 
+	std::mutex _srtp_protect_stats_lock;
+	SrtpAdapter::ProtectStats _reported_srtp_protect_stats;
+
 	std::shared_ptr<const SessionDescription> _offer_sdp;
 	std::shared_ptr<const SessionDescription> _peer_sdp;
 	std::shared_ptr<IcePort> _ice_port;
@@ -129,6 +142,8 @@ private:
 	uint32_t _audio_ssrc		   = 0;
 
 	bool _red_enabled			   = false;
+	// Only accessed by the stream worker thread
+	bool _gop_cache_requested	   = false;
 	bool _rtx_enabled			   = false;
 
 	uint16_t _rtx_sequence_number  = 1;
@@ -151,54 +166,45 @@ private:
 	ov::StopWatch _abr_test_watch;
 	bool _changed = false;
 
-	struct RtpSentLog
-	{
-		uint16_t _wide_sequence_number	 = 0;
-		uint16_t _sequence_number		 = 0;
-
-		uint32_t _track_id				 = 0;
-		uint8_t _payload_type			 = 0;
-		uint16_t _origin_sequence_number = 0;
-
-		uint32_t _ssrc					 = 0;
-		uint32_t _timestamp				 = 0;
-		bool _marker					 = false;
-
-		uint32_t _sent_bytes			 = 0;
-		std::chrono::system_clock::time_point _sent_time;
-
-		ov::String ToString()
-		{
-			return ov::String::FormatString("WideSeq(%d) SSRC(%u) Seq(%d) Track(%d) PT(%d) Timestamp(%u) Marker(%s) OriginSeq(%d) SentBytes(%u)",
-											_wide_sequence_number, _ssrc, _sequence_number, _track_id, _payload_type, _timestamp, _marker == true ? "O" : "X", _origin_sequence_number, _sent_bytes);
-		}
-	};
-
 	bool RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packet, uint16_t origin_sequence_number, uint16_t wide_sequence_number);
 
-	std::shared_mutex _rtp_record_map_lock;
-	// For NACK
-	// video sequence number % MAX_RTP_RECORDS : RtpSentRecord
-	std::unordered_map<uint16_t, std::shared_ptr<RtpSentLog>> _video_rtp_sent_record_map;
-	// For TRANSPORT-CC
-	// wide sequence number % MAX_RTP_RECORDS : RtpSentRecord
-	std::unordered_map<uint16_t, std::shared_ptr<RtpSentLog>> _wide_rtp_sent_record_map;
+	// For NACK (indexed by video sequence number)
+	RtpSentLogRing _video_rtp_sent_logs;
+	// For TRANSPORT-CC (indexed by wide sequence number)
+	RtpSentLogRing _wide_rtp_sent_logs;
 
-	std::shared_ptr<RtpSentLog> TraceRtpSentByVideoSeqNo(uint16_t sequence_number);
-	std::shared_ptr<RtpSentLog> TraceRtpSentByWideSeqNo(uint16_t wide_sequence_number);
+	bool TraceRtpSentByVideoSeqNo(uint16_t sequence_number, RtpSentLog &sent_log) const;
+	bool TraceRtpSentByWideSeqNo(uint16_t wide_sequence_number, RtpSentLog &sent_log) const;
 
 	bool SetTransportWideSequenceNumber(const std::shared_ptr<RtpPacket> &rtp_packet, uint16_t wide_sequence_number);
 	bool SetAbsSendTime(const std::shared_ptr<RtpPacket> &rtp_packet, uint64_t time_ms);
 
+	// Pacing
+	// _pacer_lock is held while the released packets are sent,
+	// so the transport-wide sequence numbers are assigned in the order the packets are sent.
+	std::mutex _pacer_lock;
+	RtcPacer _pacer;
+	bool _pacing_scheduled = false;
+
+	// Must be called with _pacer_lock locked. Returns true if packets are still waiting in the pacer.
+	bool SendPacedPackets();
+	// Sends the packets that the pacer releases now, and schedules the pacer timer for the rest.
+	// pacer_lock may be unlocked when it returns.
+	void ReleasePacedPackets(std::unique_lock<std::mutex> &pacer_lock);
+	void UpdatePacingBitrate();
+
 	// For Estimated bitrate
-	double _total_sent_seconds = 0;
-	uint64_t _total_sent_bytes = 0;
+	// Fed by TRANSPORT-CC and REMB on the thread that receives RTCP
+	RtpBandwidthEstimator _bandwidth_estimator;
 	double _estimated_bitrates = 0;
 	ov::StopWatch _bitrate_estimate_watch;
 
+	void UpdateEstimatedBitrate();
+
 	// Auto switch rendition
 	bool _auto_abr = true;
-	void ChangeRenditionIfNeeded();
+	// If congestion_detected is true, it goes to the lower rendition without waiting
+	void ChangeRenditionIfNeeded(bool congestion_detected);
 
 	// true means Don't know yet
 	bool IsNextRenditionGoodChoice(const std::shared_ptr<const RtcRendition> &rendition);
@@ -129,6 +129,8 @@ bool RtcStream::Start()
 
 	auto webrtc_config	   = GetApplicationInfo().GetConfig().GetPublishers().GetWebrtcPublisher();
 
+	SetGopCacheOptions(webrtc_config.GetGopCache());
+
 	_rtx_enabled		   = webrtc_config.IsRtxEnabled();
 	_ulpfec_enabled		   = webrtc_config.IsUlpfecEnalbed();
 	_jitter_buffer_enabled = webrtc_config.IsJitterBufferEnabled();
@@ -671,7 +673,12 @@ std::shared_ptr<PayloadAttr> RtcStream::MakeRtxPayloadAttr(const std::shared_ptr
 bool RtcStream::OnRtpPacketized(std::shared_ptr<RtpPacket> packet)
 {
 	auto stream_packet = std::make_any<std::shared_ptr<RtpPacket>>(packet);
-	BroadcastPacket(stream_packet);
+	// RED packets are copies of the media packets, so they are cached apart from them by the payload type
+	BroadcastPacket(stream_packet, pub::GopCache::PacketInfo(
+									   (static_cast<uint64_t>(packet->GetTrackId()) << 32) | packet->PayloadType(),
+									   packet->IsVideoPacket(),
+									   packet->IsKeyframe() && packet->IsFirstPacketOfFrame(),
+									   packet->GetDataLength()));
 
 	if (_rtx_enabled == true)
 	{
@@ -0,0 +1,141 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+
+// What RtcSession has sent, to handle NACK and TRANSPORT-CC
+struct RtpSentLog
+{
+	uint16_t _wide_sequence_number	 = 0;
+	uint16_t _sequence_number		 = 0;
+
+	uint32_t _track_id				 = 0;
+	uint8_t _payload_type			 = 0;
+	uint16_t _origin_sequence_number = 0;
+
+	uint32_t _ssrc					 = 0;
+	uint32_t _timestamp				 = 0;
+	bool _marker					 = false;
+
+	uint32_t _sent_bytes			 = 0;
+	std::chrono::system_clock::time_point _sent_time;
+
+	ov::String ToString() const
+	{
+		return ov::String::FormatString("WideSeq(%d) SSRC(%u) Seq(%d) Track(%d) PT(%d) Timestamp(%u) Marker(%s) OriginSeq(%d) SentBytes(%u)",
+										_wide_sequence_number, _ssrc, _sequence_number, _track_id, _payload_type, _timestamp, _marker == true ? "O" : "X", _origin_sequence_number, _sent_bytes);
+	}
+};
+
+// Fixed-size ring of RtpSentLog indexed by the 16-bit sequence number.
+//
+// It is written only while the packets released by the pacer are sent (under the pacer lock of RtcSession),
+// and read by the thread that receives RTCP (NACK/TRANSPORT-CC) without a lock.
+// Each slot is protected by a sequence counter: the writer makes it odd while updating the slot,
+// and the reader discards the copy if the counter was changed while it was copying.
+// The fields of a slot are atomics accessed with relaxed ordering, so the copy of a slot that is
+// being overwritten is not a data race, it is only discarded.
+class RtpSentLogRing
+{
+public:
+	// Must be a power of two that divides 65536 so that the sequence number wraps around at the same slot
+	static constexpr size_t Size = 2048;
+	static_assert((Size & (Size - 1)) == 0, "Size must be a power of two");
+
+	void Record(uint16_t sequence_number, const RtpSentLog &sent_log)
+	{
+		auto &slot	 = _slots[sequence_number & (Size - 1)];
+		auto version = slot._version.load(std::memory_order_relaxed);
+
+		slot._version.store(version + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		slot._sequence_number.store(sequence_number, std::memory_order_relaxed);
+		slot._wide_sequence_number.store(sent_log._wide_sequence_number, std::memory_order_relaxed);
+		slot._log_sequence_number.store(sent_log._sequence_number, std::memory_order_relaxed);
+		slot._track_id.store(sent_log._track_id, std::memory_order_relaxed);
+		slot._payload_type.store(sent_log._payload_type, std::memory_order_relaxed);
+		slot._origin_sequence_number.store(sent_log._origin_sequence_number, std::memory_order_relaxed);
+		slot._ssrc.store(sent_log._ssrc, std::memory_order_relaxed);
+		slot._timestamp.store(sent_log._timestamp, std::memory_order_relaxed);
+		slot._marker.store(sent_log._marker, std::memory_order_relaxed);
+		slot._sent_bytes.store(sent_log._sent_bytes, std::memory_order_relaxed);
+		slot._sent_time.store(sent_log._sent_time.time_since_epoch().count(), std::memory_order_relaxed);
+
+		slot._version.store(version + 2, std::memory_order_release);
+	}
+
+	bool Trace(uint16_t sequence_number, RtpSentLog &sent_log) const
+	{
+		const auto &slot = _slots[sequence_number & (Size - 1)];
+
+		auto version	 = slot._version.load(std::memory_order_acquire);
+		if ((version == 0) || ((version & 1) != 0))
+		{
+			// Not recorded yet, or being updated
+			return false;
+		}
+
+		auto recorded_sequence_number	 = slot._sequence_number.load(std::memory_order_relaxed);
+
+		RtpSentLog copy;
+		copy._wide_sequence_number	 = slot._wide_sequence_number.load(std::memory_order_relaxed);
+		copy._sequence_number		 = slot._log_sequence_number.load(std::memory_order_relaxed);
+		copy._track_id				 = slot._track_id.load(std::memory_order_relaxed);
+		copy._payload_type			 = slot._payload_type.load(std::memory_order_relaxed);
+		copy._origin_sequence_number = slot._origin_sequence_number.load(std::memory_order_relaxed);
+		copy._ssrc					 = slot._ssrc.load(std::memory_order_relaxed);
+		copy._timestamp				 = slot._timestamp.load(std::memory_order_relaxed);
+		copy._marker				 = slot._marker.load(std::memory_order_relaxed);
+		copy._sent_bytes			 = slot._sent_bytes.load(std::memory_order_relaxed);
+		copy._sent_time				 = std::chrono::system_clock::time_point(std::chrono::system_clock::duration(slot._sent_time.load(std::memory_order_relaxed)));
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (slot._version.load(std::memory_order_relaxed) != version)
+		{
+			return false;
+		}
+
+		// The slot may have been overwritten by a newer packet
+		if (recorded_sequence_number != sequence_number)
+		{
+			return false;
+		}
+
+		sent_log = copy;
+
+		return true;
+	}
+
+private:
+	struct Slot
+	{
+		std::atomic<uint32_t> _version{0};
+		// The index of the ring (the video or the wide sequence number)
+		std::atomic<uint16_t> _sequence_number{0};
+
+		std::atomic<uint16_t> _wide_sequence_number{0};
+		std::atomic<uint16_t> _log_sequence_number{0};
+		std::atomic<uint32_t> _track_id{0};
+		std::atomic<uint8_t> _payload_type{0};
+		std::atomic<uint16_t> _origin_sequence_number{0};
+		std::atomic<uint32_t> _ssrc{0};
+		std::atomic<uint32_t> _timestamp{0};
+		std::atomic<bool> _marker{false};
+		std::atomic<uint32_t> _sent_bytes{0};
+		std::atomic<std::chrono::system_clock::rep> _sent_time{0};
+	};
+
+	std::array<Slot, Size> _slots;
+};
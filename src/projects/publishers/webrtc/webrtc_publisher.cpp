@@ -109,6 +109,13 @@ bool WebRtcPublisher::Start()
 	if (StartSignallingServer(server_config, webrtc_bind_config) &&
 		StartICEPorts(server_config, webrtc_bind_config))
 	{
+		for (int i = 0; i < RTC_PACER_TIMER_COUNT; i++)
+		{
+			auto timer = std::make_shared<ov::DelayQueue>(ov::String::FormatString("WebRTCPacer%d", i).CStr());
+			timer->Start();
+			_pacer_timers.push_back(timer);
+		}
+
 		return Publisher::Start();
 	}
 
@@ -134,9 +141,38 @@ bool WebRtcPublisher::Stop()
 		_signalling_server->Stop();
 	}
 
+	for (auto &timer : _pacer_timers)
+	{
+		timer->Stop();
+		timer->Clear();
+	}
+
 	return Publisher::Stop();
 }
 
+void WebRtcPublisher::SchedulePacing(const std::shared_ptr<RtcSession> &session)
+{
+	if (_pacer_timers.empty())
+	{
+		return;
+	}
+
+	auto &timer = _pacer_timers[session->GetId() % _pacer_timers.size()];
+
+	std::weak_ptr<RtcSession> weak_session = session;
+	timer->Push(
+		[weak_session](void *parameter) -> ov::DelayQueueAction {
+			auto session = weak_session.lock();
+			if ((session == nullptr) || (session->OnPacingTimer() == false))
+			{
+				return ov::DelayQueueAction::Stop;
+			}
+
+			return ov::DelayQueueAction::Repeat;
+		},
+		nullptr, RTC_PACER_INTERVAL_MS);
+}
+
 bool WebRtcPublisher::DisconnectSessionInternal(const std::shared_ptr<RtcSession> &session)
 {
 	auto stream = std::dynamic_pointer_cast<RtcStream>(session->GetStream());
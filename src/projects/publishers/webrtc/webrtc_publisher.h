@@ -17,6 +17,9 @@
 #include "base/publisher/publisher.h"
 #include "rtc_application.h"
 
+// Number of threads that send the packets queued in the pacers of the sessions
+#define RTC_PACER_TIMER_COUNT 4
+
 class WebRtcPublisher : public pub::Publisher,
 						public IcePortObserver,
 						public RtcSignallingObserver
@@ -29,6 +32,9 @@ public:
 
 	bool Stop() override;
 
+	// Calls session->OnPacingTimer() every RTC_PACER_INTERVAL_MS until it returns false
+	void SchedulePacing(const std::shared_ptr<RtcSession> &session);
+
 	// IcePortObserver Implementation
 	void OnStateChanged(IcePort &port, uint32_t session_id, IceConnectionState state, std::any user_data) override;
 	void OnDataReceived(IcePort &port, uint32_t session_id, std::shared_ptr<const ov::Data> data, std::any user_data) override;
@@ -105,6 +111,9 @@ private:
 	std::shared_ptr<IcePort> _ice_port;
 	std::shared_ptr<RtcSignallingServer> _signalling_server;
 
+	// Sessions are distributed to the timers by session id
+	std::vector<std::shared_ptr<ov::DelayQueue>> _pacer_timers;
+
 	// for special purpose log - Deprecated
 	// ov::DelayQueue _timer;
 };
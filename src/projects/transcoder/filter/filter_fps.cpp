@@ -166,7 +166,8 @@ std::shared_ptr<MediaFrame> FilterFps::Pop()
 													 (AVRational){_input_timebase.GetNum(), _input_timebase.GetDen()},
 													 (AVRounding)(AV_ROUND_NEAR_INF | AV_ROUND_PASS_MINMAX));
 
-		auto pop_frame = _frames[0]->CloneFrame(true);
+		// Duplicated frames share the same data, only the timestamps differ
+		auto pop_frame = _frames[0]->CloneFrame();
 		pop_frame->SetPts(curr_timebase_pts);
 
 		int64_t duration = next_timebase_pts - curr_timebase_pts;
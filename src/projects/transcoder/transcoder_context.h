@@ -12,6 +12,7 @@
 #include <base/ovlibrary/ovlibrary.h>
 #include <stdint.h>
 
+#include "base/mediarouter/media_trace.h"
 #include "base/mediarouter/media_type.h"
 extern "C"
 {
@@ -186,6 +187,7 @@ public:
 		return _flags;
 	}
 
+	// The data must be writable (see MakeWritable())
 	void FillZeroData()
 	{
 		if(!_priv_data) {
@@ -221,9 +223,71 @@ public:
 		return _codec_module_id;
 	}
 
+	MediaTrace &GetTrace()
+	{
+		return _trace;
+	}
+
+	const MediaTrace &GetTrace() const
+	{
+		return _trace;
+	}
 
-	// This function should only be called before filtering 
-	std::shared_ptr<MediaFrame> CloneFrame(bool deep_copy = false)
+	void SetTrace(const MediaTrace &trace)
+	{
+		_trace = trace;
+	}
+
+
+	// Makes the data of the frame exclusive to this MediaFrame so that it can be modified (copy-on-write).
+	// The data is copied only if it is shared with other frames, and the number of copied bytes is returned through copied_bytes.
+	bool MakeWritable(size_t *copied_bytes = nullptr)
+	{
+		if (copied_bytes != nullptr)
+		{
+			*copied_bytes = 0;
+		}
+
+		if (_priv_data == nullptr)
+		{
+			return false;
+		}
+
+		if (::av_frame_is_writable(_priv_data) != 0)
+		{
+			return true;
+		}
+
+		size_t bytes = 0;
+		for (int i = 0; i < AV_NUM_DATA_POINTERS; i++)
+		{
+			if (_priv_data->buf[i] != nullptr)
+			{
+				bytes += _priv_data->buf[i]->size;
+			}
+		}
+		for (int i = 0; i < _priv_data->nb_extended_buf; i++)
+		{
+			bytes += _priv_data->extended_buf[i]->size;
+		}
+
+		if (::av_frame_make_writable(_priv_data) < 0)
+		{
+			return false;
+		}
+
+		if (copied_bytes != nullptr)
+		{
+			*copied_bytes = bytes;
+		}
+
+		return true;
+	}
+
+	// This function should only be called before filtering.
+	// The cloned frame references the same data as this frame, so the data MUST be treated as read-only.
+	// Call MakeWritable() before modifying the data of the cloned frame.
+	std::shared_ptr<MediaFrame> CloneFrame()
 	{
 		auto frame = std::make_shared<MediaFrame>();
 
@@ -233,17 +297,13 @@ public:
 			auto clone_priv_data = ::av_frame_clone(_priv_data);
 			if (clone_priv_data != nullptr)
 			{
-				if (deep_copy == true)
-				{
-					::av_frame_make_writable(clone_priv_data);
-				}
-
 				frame->SetPrivData(clone_priv_data);
 			}
 		}
 
 		frame->SetMediaType(_media_type);
 		frame->SetSourceId(_source_id);
+		frame->SetTrace(_trace);
 
 		if (_media_type == cmn::MediaType::Video)
 		{
@@ -310,6 +370,9 @@ private:
 	cmn::MediaCodecModuleId _codec_module_id = cmn::MediaCodecModuleId::None;
 	cmn::DeviceId _codec_device_id = 0;
 
+	// Trace of the packet this frame was decoded from
+	MediaTrace _trace;
+
 	// Video 
 	int32_t _width = 0;
 	int32_t _height = 0;
@@ -375,6 +375,8 @@ void TranscodeDecoder::Stop()
 
 void TranscodeDecoder::SendBuffer(std::shared_ptr<const MediaPacket> packet)
 {
+	_trace_history.Push(packet->GetPts(), packet->GetTrace());
+
 	_input_buffer.Enqueue(std::move(packet));
 }
 
@@ -417,6 +419,15 @@ void TranscodeDecoder::Complete(TranscodeResult result, std::shared_ptr<MediaFra
 	if (frame != nullptr)
 	{
 		frame->SetTrackId(_decoder_id);
+
+		// The decoder does not change the timebase, so the frame has the pts of the packet it was decoded from
+		MediaTrace trace;
+		if (_trace_history.Find(frame->GetPts(), trace) == false)
+		{
+			trace.Reset();
+		}
+		trace.Mark(MediaTraceStage::Decode);
+		frame->SetTrace(trace);
 	}
 
 	_complete_handler(result, _decoder_id, std::move(frame));
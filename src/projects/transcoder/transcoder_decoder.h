@@ -44,6 +44,8 @@ protected:
 	std::shared_ptr<MediaTrack> _track;
 	CompleteHandler _complete_handler;
 
+	MediaTraceHistory _trace_history;
+
 	ov::Future _codec_init_event;
 
 	bool _change_format = false;
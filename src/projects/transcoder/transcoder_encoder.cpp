@@ -404,7 +404,9 @@ std::shared_ptr<MediaTrack> &TranscodeEncoder::GetRefTrack()
 void TranscodeEncoder::SendBuffer(std::shared_ptr<const MediaFrame> frame)
 {
 	// logte("%lld, msid:%u", frame->GetPts(), frame->GetMsid());
-		
+
+	_trace_history.Push(frame->GetPts(), frame->GetTrace());
+
 	if (_input_buffer.IsExceedWaitEnable() == true)
 	{
 		_input_buffer.Enqueue(std::move(frame), false, 1000);
@@ -450,6 +452,18 @@ void TranscodeEncoder::Complete(TranscodeResult result, std::shared_ptr<MediaPac
 		return;
 	}
 
+	if (packet != nullptr)
+	{
+		// The encoded packet is a new packet, so it takes over the trace of the frame it was encoded from
+		MediaTrace trace;
+		if (_trace_history.Find(packet->GetPts(), trace) == false)
+		{
+			trace.Reset();
+		}
+		trace.Mark(MediaTraceStage::Encode);
+		packet->SetTrace(trace);
+	}
+
 	_complete_handler(result, _encoder_id, std::move(packet));
 }
 
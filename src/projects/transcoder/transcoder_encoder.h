@@ -67,6 +67,8 @@ protected:
 
 	CompleteHandler _complete_handler;
 
+	MediaTraceHistory _trace_history;
+
 	// Force Keyframce
 	ov::PreciseTimer _force_keyframe_timer;
 	// 0: no force keyframe,  > 0: force keyframe by sum of duration
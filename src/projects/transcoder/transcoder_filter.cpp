@@ -157,6 +157,9 @@ bool TranscodeFilter::SendBuffer(std::shared_ptr<MediaFrame> buffer)
 		return false;
 	}
 
+	// The filter may change the timebase, so the traces are kept by the time in microseconds
+	_trace_history.Push(ToMicroseconds(buffer->GetPts(), GetInputTrack()->GetTimeBase()), buffer->GetTrace());
+
 	return _internal->SendBuffer(std::move(buffer));
 }
 
@@ -258,11 +261,24 @@ void TranscodeFilter::OnComplete(TranscodeResult result, std::shared_ptr<MediaFr
 	{
 		frame->SetCodecModuleId(GetOutputTrack()->GetCodecModuleId());
 		frame->SetCodecDeviceId(GetOutputTrack()->GetCodecDeviceId());
+
+		MediaTrace trace;
+		if (_trace_history.Find(ToMicroseconds(frame->GetPts(), GetOutputTrack()->GetTimeBase()), trace) == false)
+		{
+			trace.Reset();
+		}
+		trace.Mark(MediaTraceStage::Filter);
+		frame->SetTrace(trace);
 	}
 
 	_complete_handler(result, _id, frame);
 }
 
+int64_t TranscodeFilter::ToMicroseconds(int64_t timestamp, const cmn::Timebase &timebase)
+{
+	return static_cast<int64_t>(static_cast<double>(timestamp) * timebase.GetExpr() * 1000000.0);
+}
+
 cmn::Timebase TranscodeFilter::GetInputTimebase() const
 {
 	return _internal->GetInputTimebase();
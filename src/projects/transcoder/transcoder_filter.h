@@ -57,6 +57,7 @@ public:
 private:
 	bool CreateInternal();
 	bool IsNeedUpdate(std::shared_ptr<MediaFrame> buffer);
+	static int64_t ToMicroseconds(int64_t timestamp, const cmn::Timebase &timebase);
 
 	int32_t _id;
 
@@ -72,4 +73,6 @@ private:
 
 	std::shared_mutex _mutex;
 	std::shared_ptr<FilterBase> _internal;
+
+	MediaTraceHistory _trace_history;
 };
@@ -192,6 +192,8 @@ bool TranscoderStream::Stop()
 	_last_decoded_frame_pts.clear();
 	_last_decoded_frames.clear();
 
+	logtd("%s Copied frame data: %" PRIu64 " bytes", _log_prefix.CStr(), GetCopiedFrameBytes());
+
 	// Notify to delete the stream created on the MediaRouter
 	NotifyDeleteStreams();
 
@@ -1907,7 +1909,8 @@ void TranscoderStream::OnDecodedFrame(TranscodeResult result, MediaTrackId decod
 
 					for (int64_t filler_pts = start_pts; filler_pts < end_pts; filler_pts += duration_per_frame)
 					{
-						std::shared_ptr<MediaFrame> clone_frame = decoded_frame->CloneFrame(true);
+						// Video fillers repeat the decoded picture, so they share its data
+						std::shared_ptr<MediaFrame> clone_frame = decoded_frame->CloneFrame();
 						if (!clone_frame)
 						{
 							continue;
@@ -1926,6 +1929,25 @@ void TranscoderStream::OnDecodedFrame(TranscodeResult result, MediaTrackId decod
 								// To do this properly, It need to reallocate audio buffers of MediaFrame.
 								clone_frame->SetNbSamples(remain_samples);
 							}
+
+							// Audio fillers are silence, so the shared data has to be copied before zeroing it
+							size_t copied_bytes = 0;
+							if (clone_frame->MakeWritable(&copied_bytes) == false)
+							{
+								logtw("%s Could not make the filler frame writable", _log_prefix.CStr());
+								continue;
+							}
+							_copied_frame_bytes += copied_bytes;
+
+							if (copied_bytes > 0)
+							{
+								auto stream_metrics = StreamMetrics(*_input_stream);
+								if (stream_metrics != nullptr)
+								{
+									stream_metrics->IncreaseCopiedFrameBytes(copied_bytes);
+								}
+							}
+
 							clone_frame->FillZeroData();
 						}
 
@@ -2299,7 +2321,8 @@ void TranscoderStream::SpreadToFilters(MediaTrackId decoder_id, std::shared_ptr<
 
 	for (auto &filter_id : filter_ids)
 	{
-		auto frame_clone = frame->CloneFrame(true);
+		// Filters do not modify the input frame (libavfilter copies it by itself if needed), so the data is shared
+		auto frame_clone = frame->CloneFrame();
 		if (frame_clone == nullptr)
 		{
 			logte("%s Failed to clone frame", _log_prefix.CStr());
@@ -98,6 +98,12 @@ public:
 	bool Update(const std::shared_ptr<info::Stream> &stream);
 	bool Push(std::shared_ptr<MediaPacket> packet);
 
+	// Total bytes of the decoded frame data copied by copy-on-write (frames are shared read-only otherwise)
+	uint64_t GetCopiedFrameBytes() const
+	{
+		return _copied_frame_bytes;
+	}
+
 	// Notify event to mediarouter
 	void NotifyCreateStreams();
 	void NotifyDeleteStreams();
@@ -333,4 +339,6 @@ private:
 	ov::Queue<std::shared_ptr<MediaPacket>> _initial_media_packet_buffer;
 
 	std::atomic<bool> _is_updating = false;
+
+	std::atomic<uint64_t> _copied_frame_bytes = 0;
 };
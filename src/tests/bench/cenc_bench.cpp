@@ -0,0 +1,185 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <modules/bitstream/h264/h264_decoder_configuration_record.h>
+#include <modules/containers/bmff/cenc.h>
+
+#include <cstdio>
+
+#include "common/bench.h"
+#include "common/cenc_reference.h"
+#include "latency/h264_generator.h"
+
+// Measures the throughput (MB/s) of bmff::Encryptor for 'cenc' and 'cbcs':
+// - 720p H.264 (AVCC) with the large I_PCM keyframes and the filler data of 8 Mbps, one sub-sample per slice
+// - 400 byte audio samples without sub-samples
+// The block by block implementation of common/cenc_reference.h is measured as the baseline.
+namespace
+{
+	constexpr double MinDurationSec = 1.0;
+
+	std::shared_ptr<ov::Data> ToData(const std::vector<uint8_t> &bytes)
+	{
+		return std::make_shared<ov::Data>(bytes.data(), bytes.size());
+	}
+
+	bmff::CencProperty MakeProperty(bmff::CencProtectScheme scheme)
+	{
+		bmff::CencProperty property;
+
+		property.scheme = scheme;
+		property.key_id = ToData(std::vector<uint8_t>(16, 0x11));
+		property.key = ToData(std::vector<uint8_t>(16, 0x22));
+		property.iv = ToData(std::vector<uint8_t>(16, 0x33));
+
+		return property;
+	}
+
+	struct Workload
+	{
+		const char *name;
+		std::shared_ptr<MediaTrack> track;
+		std::vector<bmff::Sample> samples;
+		size_t total_bytes = 0;
+	};
+
+	Workload MakeVideoWorkload()
+	{
+		Workload workload;
+		workload.name = "video 720p 8 Mbps";
+
+		lb::H264Generator generator(1280, 720, 30, 30, 8000000);
+
+		auto record_bytes = generator.MakeDecoderConfigurationRecord();
+		auto record = std::make_shared<AVCDecoderConfigurationRecord>();
+		record->Parse(ToData(record_bytes));
+
+		workload.track = std::make_shared<MediaTrack>();
+		workload.track->SetMediaType(cmn::MediaType::Video);
+		workload.track->SetCodecId(cmn::MediaCodecId::H264);
+		workload.track->SetDecoderConfigurationRecord(record);
+
+		for (int frame = 0; frame < 60; frame++)
+		{
+			auto avcc = generator.Next(lb::LatencyMarker()).ToAvcc();
+			auto packet = std::make_shared<MediaPacket>(0, cmn::MediaType::Video, 0, ToData(avcc), 0, 0, 0,
+														MediaPacketFlag::Unknown, cmn::BitstreamFormat::H264_AVCC, cmn::PacketType::NALU);
+
+			workload.samples.emplace_back(packet);
+			workload.total_bytes += avcc.size();
+		}
+
+		return workload;
+	}
+
+	Workload MakeAudioWorkload()
+	{
+		Workload workload;
+		workload.name = "audio 400 bytes";
+
+		workload.track = std::make_shared<MediaTrack>();
+		workload.track->SetMediaType(cmn::MediaType::Audio);
+		workload.track->SetCodecId(cmn::MediaCodecId::Aac);
+
+		for (int index = 0; index < 1000; index++)
+		{
+			std::vector<uint8_t> bytes(400, static_cast<uint8_t>(index));
+			auto packet = std::make_shared<MediaPacket>(0, cmn::MediaType::Audio, 0, ToData(bytes), 0, 0, 0,
+														MediaPacketFlag::Key, cmn::BitstreamFormat::AAC_RAW, cmn::PacketType::RAW);
+
+			workload.samples.emplace_back(packet);
+			workload.total_bytes += bytes.size();
+		}
+
+		return workload;
+	}
+
+	void Print(const Workload &workload, bmff::CencProtectScheme scheme, const char *implementation, size_t bytes, double elapsed_sec)
+	{
+		char label[64];
+		::snprintf(label, sizeof(label), "%s, %s, %s", workload.name, bmff::CencProtectSchemeToString(scheme), implementation);
+		::printf("%-48s %10.1f MB/s\n", label, static_cast<double>(bytes) / elapsed_sec / 1e6);
+	}
+
+	void RunEncryptor(const Workload &workload, bmff::CencProtectScheme scheme)
+	{
+		bmff::Encryptor encryptor(workload.track, MakeProperty(scheme));
+		bmff::Sample cipher_sample;
+		size_t bytes = 0;
+
+		bench::Stopwatch watch;
+		while (watch.ElapsedSec() < MinDurationSec)
+		{
+			for (const auto &sample : workload.samples)
+			{
+				encryptor.Encrypt(sample, cipher_sample);
+				bench::DoNotOptimize(cipher_sample);
+			}
+
+			bytes += workload.total_bytes;
+		}
+
+		Print(workload, scheme, "Encryptor", bytes, watch.ElapsedSec());
+	}
+
+	// The sub-samples are taken from the encryptor, so that only the encryption is measured
+	void RunReference(const Workload &workload, bmff::CencProtectScheme scheme)
+	{
+		bmff::Encryptor encryptor(workload.track, MakeProperty(scheme));
+		std::vector<std::vector<uint8_t>> clear_samples;
+		std::vector<std::vector<bmff::Sample::SubSample>> sub_samples;
+
+		for (const auto &sample : workload.samples)
+		{
+			bmff::Sample cipher_sample;
+			encryptor.Encrypt(sample, cipher_sample);
+
+			auto data = sample._media_packet->GetData();
+			clear_samples.emplace_back(data->GetDataAs<uint8_t>(), data->GetDataAs<uint8_t>() + data->GetLength());
+			sub_samples.push_back(cipher_sample._sai._sub_samples);
+		}
+
+		auto property = MakeProperty(scheme);
+		cenc::Reference reference(property.key->GetDataAs<uint8_t>(), property.iv->GetDataAs<uint8_t>());
+		auto is_video = (workload.track->GetMediaType() == cmn::MediaType::Video);
+		size_t bytes = 0;
+
+		bench::Stopwatch watch;
+		while (watch.ElapsedSec() < MinDurationSec)
+		{
+			for (size_t index = 0; index < clear_samples.size(); index++)
+			{
+				auto cipher = (scheme == bmff::CencProtectScheme::Cenc)
+								  ? reference.EncryptCtr(clear_samples[index], sub_samples[index])
+								  : reference.EncryptCbcs(clear_samples[index], sub_samples[index], 1, is_video ? 9 : 0);
+				bench::DoNotOptimize(cipher);
+			}
+
+			bytes += workload.total_bytes;
+		}
+
+		Print(workload, scheme, "block by block", bytes, watch.ElapsedSec());
+	}
+}  // namespace
+
+int main()
+{
+	// The log of every sample would be measured too
+	ov_log_set_level(OVLogLevelInformation);
+
+	for (const auto &workload : {MakeVideoWorkload(), MakeAudioWorkload()})
+	{
+		for (auto scheme : {bmff::CencProtectScheme::Cenc, bmff::CencProtectScheme::Cbcs})
+		{
+			RunEncryptor(workload, scheme);
+			RunReference(workload, scheme);
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,607 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <base/ovcrypto/ovcrypto.h>
+#include <modules/dtls_srtp/dtls_handshake_worker.h>
+#include <modules/dtls_srtp/dtls_transport.h>
+#include <modules/dtls_srtp/srtp_transport.h>
+#include <openssl/ssl.h>
+#include <srtp2/srtp.h>
+
+#include <atomic>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/bench.h"
+
+// A burst of 2,000 DTLS clients connects while 100 sessions are playing, like the start of a live event.
+// The clients are OpenSSL DTLS clients in another thread, connected to the server sessions with in-memory datagrams.
+// The "application thread" of the bench receives the datagrams of the clients and sends a media packet to each playing
+// session every millisecond, like the thread of a WebRTC application. For each server, it reports:
+// - the time to create a session, the handshakes/s of the burst, and the clients that connected
+// - how late the media packets are sent during the burst (p50/p99/max)
+// The servers are:
+// - "before": a context per session and the handshake in the application thread (replicated here with ov::Tls)
+// - "per-session context": DtlsTransport with SetLocalCertificate()
+// - "after": DtlsTransport with the context shared by CreateTlsContext(), handshakes in DtlsHandshakeWorker
+namespace
+{
+	constexpr int ClientCount = 2000;
+	constexpr int ViewerCount = 100;
+	constexpr int64_t MediaIntervalUs = 1000;
+	constexpr double TimeoutSec = 120.0;
+
+	bool IsRtpPacket(const void *data, size_t length)
+	{
+		return (length >= 12) && ((static_cast<const uint8_t *>(data)[0] & 0xC0) == 0x80);
+	}
+
+	class Client
+	{
+	public:
+		explicit Client(SSL_CTX *context)
+		{
+			_ssl = ::SSL_new(context);
+
+			auto read_bio = ::BIO_new(::BIO_s_mem());
+			auto write_bio = ::BIO_new(::BIO_s_mem());
+			BIO_set_mem_eof_return(read_bio, -1);
+
+			::SSL_set_bio(_ssl, read_bio, write_bio);
+			::SSL_set_connect_state(_ssl);
+			::SSL_set_options(_ssl, SSL_OP_NO_QUERY_MTU);
+			::SSL_set_mtu(_ssl, 1200);
+		}
+
+		~Client()
+		{
+			::SSL_free(_ssl);
+		}
+
+		// Called by the server, in any thread
+		void Receive(const void *data, size_t length)
+		{
+			if (IsRtpPacket(data, length))
+			{
+				// The media is not measured on the client
+				return;
+			}
+
+			std::lock_guard<std::mutex> lock(_inbox_mutex);
+			_inbox.emplace_back(static_cast<const uint8_t *>(data), static_cast<const uint8_t *>(data) + length);
+		}
+
+		// Called by the client thread: continues the handshake with the received datagrams,
+		// and returns false if there was nothing to do
+		bool Process(std::vector<std::shared_ptr<ov::Data>> &outbox)
+		{
+			std::vector<std::vector<uint8_t>> inbox;
+
+			{
+				std::lock_guard<std::mutex> lock(_inbox_mutex);
+				inbox.swap(_inbox);
+			}
+
+			bool started = _started;
+			_started = true;
+
+			// Retransmits the last flight if the timer of DTLS has expired
+			bool retransmitted = (::DTLSv1_handle_timeout(_ssl) > 0);
+
+			if (started && inbox.empty() && (retransmitted == false))
+			{
+				return false;
+			}
+
+			if (inbox.empty())
+			{
+				Continue();
+			}
+
+			for (const auto &datagram : inbox)
+			{
+				::BIO_write(::SSL_get_rbio(_ssl), datagram.data(), static_cast<int>(datagram.size()));
+				Continue();
+			}
+
+			auto write_bio = ::SSL_get_wbio(_ssl);
+			auto pending = BIO_ctrl_pending(write_bio);
+
+			if (pending > 0)
+			{
+				auto data = std::make_shared<ov::Data>(pending);
+				data->SetLength(pending);
+				::BIO_read(write_bio, data->GetWritableData(), static_cast<int>(pending));
+				outbox.push_back(data);
+			}
+
+			return true;
+		}
+
+		std::atomic<bool> connected{false};
+		bench::Clock::time_point connected_time;
+
+	private:
+		void Continue()
+		{
+			if (connected)
+			{
+				return;
+			}
+
+			if (::SSL_do_handshake(_ssl) == 1)
+			{
+				connected_time = bench::Clock::now();
+				connected = true;
+			}
+		}
+
+		SSL *_ssl = nullptr;
+		bool _started = false;
+
+		std::mutex _inbox_mutex;
+		std::vector<std::vector<uint8_t>> _inbox;
+	};
+
+	class ServerSession
+	{
+	public:
+		virtual ~ServerSession() = default;
+
+		// A datagram of the client
+		virtual void Receive(const std::shared_ptr<const ov::Data> &data) = 0;
+		// An SRTP packet to the client, dropped if the handshake is not finished
+		virtual void SendMedia(const std::shared_ptr<ov::Data> &data) = 0;
+		virtual void Stop() = 0;
+	};
+
+	// The path before DtlsHandshakeWorker: the handshake runs in the thread that received the packet
+	class InlineSession : public ServerSession
+	{
+	public:
+		InlineSession(const std::shared_ptr<::Certificate> &certificate, Client *client)
+			: _client(client)
+		{
+			ov::TlsBioCallback callback = {
+				.read_callback = [this](ov::Tls *tls, void *buffer, size_t length) -> ssize_t {
+					if (_packets.empty())
+					{
+						return 0;
+					}
+
+					auto packet = _packets.front();
+					_packets.erase(_packets.begin());
+
+					auto read_length = std::min<size_t>(length, packet->GetLength());
+					::memcpy(buffer, packet->GetData(), read_length);
+
+					return read_length;
+				},
+				.write_callback = [this](ov::Tls *tls, const void *data, size_t length) -> ssize_t {
+					_client->Receive(data, length);
+					return length;
+				},
+				.destroy_callback = nullptr,
+				.ctrl_callback = [](ov::Tls *tls, int cmd, long num, void *ptr) -> long {
+					return (cmd == BIO_CTRL_FLUSH) ? 1 : 0;
+				}};
+
+			// The callbacks of the context are called during the handshake, so the context is kept like DtlsTransport does
+			_tls_context = DtlsTransport::CreateTlsContext(certificate);
+			_tls.Initialize(_tls_context, callback, true);
+			_tls.Accept();
+		}
+
+		void Receive(const std::shared_ptr<const ov::Data> &data) override
+		{
+			if (_connected)
+			{
+				return;
+			}
+
+			_packets.push_back(data);
+
+			if (_tls.Accept() == SSL_ERROR_NONE)
+			{
+				auto server_key = std::make_shared<ov::Data>();
+				auto client_key = std::make_shared<ov::Data>();
+				_tls.ExportKeyingMaterial(_tls.GetSelectedSrtpProfileId(), "EXTRACTOR-dtls_srtp", server_key, client_key);
+
+				_connected = true;
+			}
+		}
+
+		void SendMedia(const std::shared_ptr<ov::Data> &data) override
+		{
+			if (_connected)
+			{
+				_client->Receive(data->GetData(), data->GetLength());
+			}
+		}
+
+		void Stop() override
+		{
+			_tls.Uninitialize();
+		}
+
+	private:
+		Client *_client;
+		std::shared_ptr<ov::TlsContext> _tls_context;
+		ov::Tls _tls;
+		std::vector<std::shared_ptr<const ov::Data>> _packets;
+		bool _connected = false;
+	};
+
+	// Plays the role of IcePort: the packets of DtlsTransport go to the client
+	class LoopbackIce : public ov::Node
+	{
+	public:
+		explicit LoopbackIce(Client *client)
+			: ov::Node(NodeType::Ice),
+			  _client(client)
+		{
+		}
+
+		bool OnDataReceivedFromPrevNode(NodeType from_node, const std::shared_ptr<ov::Data> &data) override
+		{
+			_client->Receive(data->GetData(), data->GetLength());
+			return true;
+		}
+
+		bool OnDataReceivedFromNextNode(NodeType from_node, const std::shared_ptr<const ov::Data> &data) override
+		{
+			return false;
+		}
+
+	private:
+		Client *_client;
+	};
+
+	// SrtpTransport -> DtlsTransport -> LoopbackIce, connected like RtcSession does
+	class TransportSession : public ServerSession
+	{
+	public:
+		TransportSession(const std::shared_ptr<ov::TlsContext> &context, const std::shared_ptr<::Certificate> &certificate, Client *client)
+		{
+			_srtp = std::make_shared<SrtpTransport>();
+			_dtls = std::make_shared<DtlsTransport>();
+			_ice = std::make_shared<LoopbackIce>(client);
+
+			if (context != nullptr)
+			{
+				_dtls->SetTlsContext(context);
+			}
+			else
+			{
+				_dtls->SetLocalCertificate(certificate);
+			}
+
+			_srtp->RegisterNextNode(_dtls);
+			_srtp->Start();
+			_dtls->RegisterPrevNode(_srtp);
+			_dtls->RegisterNextNode(_ice);
+			_dtls->Start();
+			_ice->RegisterPrevNode(_dtls);
+			_ice->Start();
+
+			_dtls->StartDTLS();
+		}
+
+		void Receive(const std::shared_ptr<const ov::Data> &data) override
+		{
+			_dtls->OnDataReceivedFromNextNode(NodeType::Ice, data);
+		}
+
+		void SendMedia(const std::shared_ptr<ov::Data> &data) override
+		{
+			_dtls->OnDataReceivedFromPrevNode(NodeType::Srtp, data);
+		}
+
+		void Stop() override
+		{
+			_dtls->Stop();
+			_srtp->Stop();
+			_ice->Stop();
+		}
+
+	private:
+		std::shared_ptr<SrtpTransport> _srtp;
+		std::shared_ptr<DtlsTransport> _dtls;
+		std::shared_ptr<LoopbackIce> _ice;
+	};
+
+	using SessionFactory = std::function<std::unique_ptr<ServerSession>(Client *client)>;
+
+	// Runs the handshakes of the clients that are added
+	class ClientThread
+	{
+	public:
+		ClientThread()
+		{
+			_thread = std::thread([this]() { Run(); });
+		}
+
+		~ClientThread()
+		{
+			_stop = true;
+			_thread.join();
+		}
+
+		void Add(int first_index, const std::vector<Client *> &clients)
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+
+			for (size_t index = 0; index < clients.size(); index++)
+			{
+				_clients.emplace_back(first_index + static_cast<int>(index), clients[index]);
+			}
+		}
+
+		// The datagrams from the clients to the server: (index of the client, datagram)
+		void TakeDatagrams(std::vector<std::pair<int, std::shared_ptr<ov::Data>>> &datagrams)
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			datagrams.swap(_datagrams);
+		}
+
+	private:
+		void Run()
+		{
+			std::vector<std::pair<int, Client *>> clients;
+			std::vector<std::shared_ptr<ov::Data>> outbox;
+
+			while (_stop == false)
+			{
+				{
+					std::lock_guard<std::mutex> lock(_mutex);
+					clients = _clients;
+				}
+
+				bool idle = true;
+
+				for (auto &[index, client] : clients)
+				{
+					if (client->connected)
+					{
+						continue;
+					}
+
+					outbox.clear();
+
+					if (client->Process(outbox))
+					{
+						idle = false;
+					}
+
+					if (outbox.empty() == false)
+					{
+						std::lock_guard<std::mutex> lock(_mutex);
+
+						for (auto &datagram : outbox)
+						{
+							_datagrams.emplace_back(index, datagram);
+						}
+					}
+				}
+
+				if (idle)
+				{
+					std::this_thread::sleep_for(std::chrono::microseconds(100));
+				}
+			}
+		}
+
+		std::atomic<bool> _stop{false};
+		std::thread _thread;
+
+		std::mutex _mutex;
+		std::vector<std::pair<int, Client *>> _clients;
+		std::vector<std::pair<int, std::shared_ptr<ov::Data>>> _datagrams;
+	};
+
+	size_t CountConnected(const std::vector<std::unique_ptr<Client>> &clients, size_t first, size_t count)
+	{
+		size_t connected = 0;
+
+		for (size_t index = first; index < first + count; index++)
+		{
+			connected += clients[index]->connected ? 1 : 0;
+		}
+
+		return connected;
+	}
+
+	void Run(const char *name, SSL_CTX *client_context, const SessionFactory &factory)
+	{
+		constexpr int TotalCount = ViewerCount + ClientCount;
+
+		std::vector<std::unique_ptr<Client>> clients;
+		std::vector<std::unique_ptr<ServerSession>> sessions;
+
+		for (int index = 0; index < TotalCount; index++)
+		{
+			clients.push_back(std::make_unique<Client>(client_context));
+		}
+
+		bench::Stopwatch setup_watch;
+		for (int index = 0; index < TotalCount; index++)
+		{
+			sessions.push_back(factory(clients[index].get()));
+		}
+		auto setup_us = static_cast<double>(setup_watch.ElapsedUs()) / TotalCount;
+
+		ClientThread client_thread;
+		std::vector<std::pair<int, std::shared_ptr<ov::Data>>> datagrams;
+		size_t next_datagram = 0;
+
+		auto media_packet = std::make_shared<ov::Data>(1200);
+		media_packet->SetLength(1200);
+		::memset(media_packet->GetWritableData(), 0, 1200);
+		media_packet->GetWritableDataAs<uint8_t>()[0] = 0x80;
+
+		bench::Samples delays;
+		delays.Reserve(static_cast<size_t>(TimeoutSec * 1000000 / MediaIntervalUs));
+
+		// The thread of the application: one datagram of the clients at a time, and the media of the playing sessions on time
+		auto run_until = [&](const std::function<bool()> &done, bool measure) -> bool {
+			auto start = bench::Clock::now();
+			auto next_tick = start;
+			size_t checked = 0;
+
+			while (true)
+			{
+				auto now = bench::Clock::now();
+
+				if (now >= next_tick)
+				{
+					if (measure)
+					{
+						delays.Add(std::chrono::duration<double, std::milli>(now - next_tick).count());
+					}
+
+					for (int index = 0; index < ViewerCount; index++)
+					{
+						sessions[index]->SendMedia(media_packet);
+					}
+
+					next_tick += std::chrono::microseconds(MediaIntervalUs);
+
+					if ((++checked % 10) == 0)
+					{
+						if (done())
+						{
+							return true;
+						}
+
+						if (std::chrono::duration<double>(now - start).count() > TimeoutSec)
+						{
+							return false;
+						}
+					}
+
+					continue;
+				}
+
+				if (next_datagram >= datagrams.size())
+				{
+					datagrams.clear();
+					next_datagram = 0;
+					client_thread.TakeDatagrams(datagrams);
+				}
+
+				if (next_datagram < datagrams.size())
+				{
+					auto &[index, datagram] = datagrams[next_datagram++];
+					sessions[index]->Receive(datagram);
+				}
+				else
+				{
+					std::this_thread::sleep_until(std::min(next_tick, now + std::chrono::microseconds(100)));
+				}
+			}
+		};
+
+		// The viewers are playing before the burst
+		std::vector<Client *> viewers;
+		for (int index = 0; index < ViewerCount; index++)
+		{
+			viewers.push_back(clients[index].get());
+		}
+		client_thread.Add(0, viewers);
+
+		if (run_until([&]() { return CountConnected(clients, 0, ViewerCount) == ViewerCount; }, false) == false)
+		{
+			::printf("%-24s the viewers could not connect\n", name);
+		}
+
+		// The burst
+		std::vector<Client *> burst;
+		for (int index = ViewerCount; index < TotalCount; index++)
+		{
+			burst.push_back(clients[index].get());
+		}
+
+		auto burst_start = bench::Clock::now();
+		client_thread.Add(ViewerCount, burst);
+		run_until([&]() { return CountConnected(clients, ViewerCount, ClientCount) == ClientCount; }, true);
+
+		auto connected = CountConnected(clients, ViewerCount, ClientCount);
+		auto burst_end = burst_start;
+
+		for (int index = ViewerCount; index < TotalCount; index++)
+		{
+			if (clients[index]->connected)
+			{
+				burst_end = std::max(burst_end, clients[index]->connected_time);
+			}
+		}
+
+		auto burst_sec = std::chrono::duration<double>(burst_end - burst_start).count();
+
+		::printf("%-24s %8.1f us/session %8.0f handshakes/s (%zu/%d in %.2f s)   media send delay: p50 %6.2f p99 %7.2f max %7.2f ms\n",
+				 name, setup_us, (burst_sec > 0.0) ? (connected / burst_sec) : 0.0, connected, ClientCount, burst_sec,
+				 delays.Percentile(50.0), delays.Percentile(99.0), delays.Max());
+
+		for (auto &session : sessions)
+		{
+			session->Stop();
+		}
+	}
+
+	SSL_CTX *CreateClientContext(const std::shared_ptr<::Certificate> &certificate)
+	{
+		auto context = ::SSL_CTX_new(::DTLS_client_method());
+
+		::SSL_CTX_use_certificate(context, certificate->GetCertification());
+		::SSL_CTX_use_PrivateKey(context, certificate->GetPrivateKey());
+		::SSL_CTX_set_verify(context, SSL_VERIFY_NONE, nullptr);
+		::SSL_CTX_set_tlsext_use_srtp(context, "SRTP_AES128_CM_SHA1_80");
+
+		return context;
+	}
+}  // namespace
+
+int main()
+{
+	ov_log_set_level(OVLogLevelWarning);
+	::srtp_init();
+
+	auto server_certificate = std::make_shared<::Certificate>();
+	auto client_certificate = std::make_shared<::Certificate>();
+
+	if ((server_certificate->Generate() != nullptr) || (client_certificate->Generate() != nullptr))
+	{
+		::printf("Could not generate the certificates\n");
+		return 1;
+	}
+
+	auto client_context = CreateClientContext(client_certificate);
+
+	::printf("%d clients connect while %d sessions receive a packet every %" PRId64 " us, %u CPUs\n",
+			 ClientCount, ViewerCount, MediaIntervalUs, std::thread::hardware_concurrency());
+
+	Run("before", client_context, [&](Client *client) -> std::unique_ptr<ServerSession> {
+		return std::make_unique<InlineSession>(server_certificate, client);
+	});
+
+	Run("per-session context", client_context, [&](Client *client) -> std::unique_ptr<ServerSession> {
+		return std::make_unique<TransportSession>(nullptr, server_certificate, client);
+	});
+
+	auto shared_context = DtlsTransport::CreateTlsContext(server_certificate);
+	Run("after", client_context, [&](Client *client) -> std::unique_ptr<ServerSession> {
+		return std::make_unique<TransportSession>(shared_context, server_certificate, client);
+	});
+
+	::SSL_CTX_free(client_context);
+
+	return 0;
+}
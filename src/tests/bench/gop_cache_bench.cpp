@@ -0,0 +1,194 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <base/publisher/gop_cache.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+#include "common/bench.h"
+
+// Measures the join time of a new viewer with and without pub::GopCache, for GOPs of 1, 2 and 4 seconds:
+// - a 4 Mbps, 30 fps video (keyframes 6 times as large as the other frames) in packets of 1,200 bytes,
+//   and 50 audio packets of 200 bytes per second, are pushed to the cache on a simulated clock
+// - 2,000 viewers join at random times
+// Without the cache, the first frame is the next keyframe. With it, the first frame is the cached keyframe,
+// which arrives once the burst has sent it (at BurstBitrate, or at once if BurstBitrate is 0),
+// and the viewer is behind live by the age of the GOP.
+// The CPU time of Push() and GetPackets() (the copy of the cached packets for a new session) is measured too.
+namespace
+{
+	constexpr int64_t VideoBitrate = 4000000;
+	constexpr int FrameRate = 30;
+	constexpr size_t VideoPacketSize = 1200;
+	constexpr int AudioPacketRate = 50;
+	constexpr size_t AudioPacketSize = 200;
+
+	constexpr double DurationSec = 60.0;
+	constexpr double WarmUpSec = 10.0;
+	constexpr int JoinCount = 2000;
+
+	struct PacketInfo
+	{
+		double time;
+		bool is_key_frame;
+	};
+
+	struct Event
+	{
+		double time;
+		bool is_video;
+		bool is_key_frame;
+		size_t bytes;
+	};
+
+	std::vector<Event> MakeTimeline(double gop_sec)
+	{
+		std::vector<Event> events;
+
+		auto frames_per_gop = static_cast<int>(gop_sec * FrameRate);
+		auto average_frame_size = static_cast<double>(VideoBitrate) / 8.0 / FrameRate;
+		// K + (N - 1) * P = N * average, where K = 6 * P
+		auto p_frame_size = static_cast<size_t>(frames_per_gop * average_frame_size / (frames_per_gop + 5));
+
+		for (int frame = 0; frame < static_cast<int>(DurationSec * FrameRate); frame++)
+		{
+			auto is_key_frame = (frame % frames_per_gop) == 0;
+			auto frame_size = is_key_frame ? (p_frame_size * 6) : p_frame_size;
+			auto time = static_cast<double>(frame) / FrameRate;
+
+			for (size_t offset = 0; offset < frame_size; offset += VideoPacketSize)
+			{
+				events.push_back(Event{time, true, is_key_frame && (offset == 0), std::min(VideoPacketSize, frame_size - offset)});
+			}
+		}
+
+		for (int packet = 0; packet < static_cast<int>(DurationSec * AudioPacketRate); packet++)
+		{
+			events.push_back(Event{static_cast<double>(packet) / AudioPacketRate, false, false, AudioPacketSize});
+		}
+
+		std::stable_sort(events.begin(), events.end(), [](const Event &a, const Event &b) {
+			return a.time < b.time;
+		});
+
+		return events;
+	}
+
+	// Time (ms) until the keyframe is sent with the burst: the keyframe and the audio interleaved with it
+	double GetKeyFrameArrivalMs(const std::vector<pub::GopCache::Packet> &packets, int64_t burst_bitrate)
+	{
+		if (burst_bitrate == 0)
+		{
+			return 0.0;
+		}
+
+		auto key_frame_time = std::any_cast<const PacketInfo &>(packets.front().packet).time;
+		size_t bytes = 0;
+
+		for (const auto &packet : packets)
+		{
+			if (std::any_cast<const PacketInfo &>(packet.packet).time > key_frame_time)
+			{
+				break;
+			}
+
+			bytes += packet.bytes;
+		}
+
+		return static_cast<double>(bytes) * 8.0 * 1000.0 / static_cast<double>(burst_bitrate);
+	}
+
+	void Run(double gop_sec)
+	{
+		auto events = MakeTimeline(gop_sec);
+
+		std::mt19937 random(1);
+		std::uniform_real_distribution<double> distribution(WarmUpSec, DurationSec - gop_sec);
+		std::vector<double> join_times(JoinCount);
+		for (auto &time : join_times)
+		{
+			time = distribution(random);
+		}
+		std::sort(join_times.begin(), join_times.end());
+
+		pub::GopCache cache;
+		cache.SetMaxBytes(16 * 1024 * 1024);
+
+		bench::Samples without_cache;
+		bench::Samples with_cache_unpaced;
+		bench::Samples with_cache_2x;
+		bench::Samples with_cache_5x;
+		bench::Samples behind_live;
+		bench::Samples burst_kb;
+		bench::Samples get_packets_us;
+
+		std::vector<pub::GopCache::Packet> packets;
+		int64_t push_ns = 0;
+		size_t event_index = 0;
+
+		for (auto join_time : join_times)
+		{
+			for (; (event_index < events.size()) && (events[event_index].time <= join_time); event_index++)
+			{
+				const auto &event = events[event_index];
+
+				auto start = bench::Clock::now();
+				cache.Push(std::make_any<PacketInfo>(PacketInfo{event.time, event.is_key_frame}),
+						   pub::GopCache::PacketInfo(event.is_video ? 1 : 2, event.is_video, event.is_key_frame, event.bytes));
+				push_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(bench::Clock::now() - start).count();
+			}
+
+			// Without the cache: the next keyframe
+			auto next_key_frame_time = std::ceil(join_time / gop_sec) * gop_sec;
+			without_cache.Add((next_key_frame_time - join_time) * 1000.0);
+
+			auto start = bench::Clock::now();
+			cache.GetPackets(packets);
+			get_packets_us.Add(std::chrono::duration<double, std::micro>(bench::Clock::now() - start).count());
+
+			size_t bytes = 0;
+			for (const auto &packet : packets)
+			{
+				bytes += packet.bytes;
+			}
+
+			with_cache_unpaced.Add(GetKeyFrameArrivalMs(packets, 0));
+			with_cache_2x.Add(GetKeyFrameArrivalMs(packets, VideoBitrate * 2));
+			with_cache_5x.Add(GetKeyFrameArrivalMs(packets, VideoBitrate * 5));
+			behind_live.Add((join_time - std::any_cast<const PacketInfo &>(packets[0].packet).time) * 1000.0);
+			burst_kb.Add(static_cast<double>(bytes) / 1024.0);
+		}
+
+		char label[64];
+
+		::printf("GOP %.0f s (%zu packets pushed, %.0f ns per Push())\n", gop_sec, event_index, static_cast<double>(push_ns) / event_index);
+
+		without_cache.Print("  first frame, without cache", "ms");
+		with_cache_unpaced.Print("  first frame, cache, BurstBitrate 0", "ms");
+		::snprintf(label, sizeof(label), "  first frame, cache, burst %lld Mbps", static_cast<long long>(VideoBitrate * 2 / 1000000));
+		with_cache_2x.Print(label, "ms");
+		::snprintf(label, sizeof(label), "  first frame, cache, burst %lld Mbps", static_cast<long long>(VideoBitrate * 5 / 1000000));
+		with_cache_5x.Print(label, "ms");
+		behind_live.Print("  behind live, cache", "ms");
+		burst_kb.Print("  burst size, cache", "KB");
+		get_packets_us.Print("  GetPackets()", "us");
+	}
+}  // namespace
+
+int main()
+{
+	for (auto gop_sec : {1.0, 2.0, 4.0})
+	{
+		Run(gop_sec);
+	}
+
+	return 0;
+}
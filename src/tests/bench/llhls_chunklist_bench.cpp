@@ -0,0 +1,106 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <publishers/llhls/llhls_chunklist.h>
+
+#include "common/bench.h"
+
+// Measures the cost of updating the default LL-HLS chunklist on every partial segment
+// with 1h, 6h and 24h DVR windows (6 s segments, 0.5 s parts), and compares it with
+// rendering the whole window from scratch.
+namespace
+{
+	constexpr double SegmentDuration = 6.0;
+	constexpr double PartDuration = 0.5;
+	constexpr int PartsPerSegment = static_cast<int>(SegmentDuration / PartDuration);
+
+	void AppendPart(LLHlsChunklist &chunklist, uint32_t segment_sequence, int part_index)
+	{
+		if (part_index == 0)
+		{
+			chunklist.CreateSegmentInfo(LLHlsChunklist::SegmentInfo(segment_sequence, ov::String::FormatString("seg_0_%u_video_llhls.m4s", segment_sequence)));
+		}
+
+		auto start_ms = 1700000000000LL + static_cast<int64_t>((segment_sequence * PartsPerSegment + part_index) * PartDuration * 1000);
+		auto part_url = ov::String::FormatString("part_0_%u_%d_video_llhls.m4s", segment_sequence, part_index);
+		auto next_url = ov::String::FormatString("part_0_%u_%d_video_llhls.m4s", segment_sequence, part_index + 1);
+
+		chunklist.AppendPartialSegmentInfo(segment_sequence,
+										   LLHlsChunklist::SegmentInfo(part_index, start_ms, PartDuration, 1000, part_url, next_url,
+																	   part_index == 0, part_index == PartsPerSegment - 1));
+	}
+
+	void Run(const char *label, uint32_t window_seconds)
+	{
+		auto window_segments = static_cast<uint32_t>(window_seconds / SegmentDuration);
+
+		auto track = std::make_shared<MediaTrack>();
+		track->SetId(0);
+		track->SetMediaType(cmn::MediaType::Video);
+		track->SetVariantName("video");
+
+		LLHlsChunklist chunklist("chunklist_0_video_llhls.m3u8", track, window_segments, static_cast<uint32_t>(SegmentDuration), PartDuration, "init_0_video_llhls.m4s", true);
+		chunklist.SetPartHoldBack(PartDuration * 3);
+
+		// Fill the window
+		uint32_t segment_sequence = 0;
+		bench::Stopwatch fill_watch;
+		for (; segment_sequence < window_segments; segment_sequence++)
+		{
+			for (int part_index = 0; part_index < PartsPerSegment; part_index++)
+			{
+				AppendPart(chunklist, segment_sequence, part_index);
+			}
+		}
+		auto fill_sec = fill_watch.ElapsedSec();
+
+		// Steady state: the window slides by one segment every PartsPerSegment updates
+		bench::Samples update_us;
+		bench::Samples request_us;
+		bench::Samples full_render_us;
+		size_t chunklist_bytes = 0;
+		size_t pieces = 0;
+
+		for (int count = 0; count < 20; count++, segment_sequence++)
+		{
+			for (int part_index = 0; part_index < PartsPerSegment; part_index++)
+			{
+				bench::Stopwatch watch;
+				AppendPart(chunklist, segment_sequence, part_index);
+				update_us.Add(watch.ElapsedUs());
+
+				watch.Restart();
+				auto list = chunklist.ToDataList("", false, false, true);
+				request_us.Add(watch.ElapsedUs());
+				pieces = list.size();
+
+				// The previous implementation rendered the whole window here
+				watch.Restart();
+				auto full = chunklist.ToString("q=1", false, false, true);
+				full_render_us.Add(watch.ElapsedUs());
+				chunklist_bytes = full.GetLength();
+			}
+
+			chunklist.RemoveSegmentInfo(segment_sequence - window_segments);
+		}
+
+		::printf("== %s window: %u segments, %zu bytes, %zu pieces, filled in %.2f s\n", label, window_segments, chunklist_bytes, pieces, fill_sec);
+		update_us.Print("  update (incremental)", "us");
+		full_render_us.Print("  update (full render, previous)", "us");
+		request_us.Print("  request (cached pieces)", "us");
+	}
+}  // namespace
+
+int main()
+{
+	Run("1h", 3600);
+	Run("6h", 6 * 3600);
+	Run("24h", 24 * 3600);
+
+	return 0;
+}
@@ -0,0 +1,293 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <base/ovlibrary/log_async_writer.h>
+#include <base/ovlibrary/ovlibrary.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/bench.h"
+
+// Measures the information logs of 32 threads that log at the same time, written to the console (/dev/null) and a file:
+// - "before": the path before the background writer, replicated here (the prefix is formatted with localtime_r() and
+//   ov::String for every line, then fprintf() + fflush() to the console and an std::ofstream flushed for every line)
+// - "after": ov_log_internal(), which formats in a thread_local buffer and pushes to the ring of the thread
+// The calls/s are measured until the last call returns, and "flushed" until all lines are written.
+// Then 1,000 short-lived threads and 400 threads that are alive at once log, to show that the memory of the rings is bounded.
+namespace
+{
+	constexpr int ThreadCount = 32;
+	constexpr int LinesPerThread = 20000;
+
+	class Baseline
+	{
+	public:
+		explicit Baseline(const std::string &path)
+			: _stream(path, std::ofstream::out | std::ofstream::app)
+		{
+		}
+
+		void Log(const char *tag, const char *format, int value)
+		{
+			auto current = std::chrono::system_clock::now();
+			auto mseconds = std::chrono::duration_cast<std::chrono::milliseconds>(current.time_since_epoch()).count() % 1000;
+
+			std::time_t time = std::time(nullptr);
+			std::tm local_time{};
+			::localtime_r(&time, &local_time);
+
+			ov::String log;
+			log.Format("[%04d-%02d-%02d %02d:%02d:%02d.%03d] I [%s:%lu] %s | ",
+					   1900 + local_time.tm_year, local_time.tm_mon + 1, local_time.tm_mday,
+					   local_time.tm_hour, local_time.tm_min, local_time.tm_sec, static_cast<int>(mseconds),
+					   ov::Platform::GetThreadName(), ov::Platform::GetThreadId(), tag);
+			log.AppendFormat(format, value);
+
+			::fprintf(stdout, "%s\n", log.CStr());
+			::fflush(stdout);
+
+			std::lock_guard<std::mutex> lock(_stream_mutex);
+			_stream << log.CStr() << std::endl;
+			_stream.flush();
+		}
+
+	private:
+		std::mutex _stream_mutex;
+		std::ofstream _stream;
+	};
+
+	// The console of the logs is /dev/null while the threads are running
+	class QuietConsole
+	{
+	public:
+		QuietConsole()
+		{
+			::fflush(stdout);
+			_saved_fd = ::dup(STDOUT_FILENO);
+
+			auto null_fd = ::open("/dev/null", O_WRONLY);
+			::dup2(null_fd, STDOUT_FILENO);
+			::close(null_fd);
+		}
+
+		~QuietConsole()
+		{
+			::fflush(stdout);
+			::dup2(_saved_fd, STDOUT_FILENO);
+			::close(_saved_fd);
+		}
+
+	private:
+		int _saved_fd = -1;
+	};
+
+	// The lines that contain `text`
+	size_t CountLines(const std::string &directory, const char *text)
+	{
+		size_t lines = 0;
+		auto dir = ::opendir(directory.c_str());
+
+		if (dir == nullptr)
+		{
+			return 0;
+		}
+
+		while (auto entry = ::readdir(dir))
+		{
+			if (entry->d_name[0] == '.')
+			{
+				continue;
+			}
+
+			std::ifstream stream(directory + "/" + entry->d_name);
+			std::string line;
+
+			while (std::getline(stream, line))
+			{
+				if (line.find(text) != std::string::npos)
+				{
+					lines++;
+				}
+			}
+		}
+
+		::closedir(dir);
+
+		return lines;
+	}
+
+	void RemoveFiles(const std::string &directory)
+	{
+		auto dir = ::opendir(directory.c_str());
+
+		if (dir == nullptr)
+		{
+			return;
+		}
+
+		while (auto entry = ::readdir(dir))
+		{
+			if (entry->d_name[0] != '.')
+			{
+				::unlink((directory + "/" + entry->d_name).c_str());
+			}
+		}
+
+		::closedir(dir);
+	}
+
+	template <typename Function>
+	void RunThreads(int thread_count, Function function)
+	{
+		std::atomic<bool> start{false};
+		std::vector<std::thread> threads;
+
+		for (int thread_index = 0; thread_index < thread_count; thread_index++)
+		{
+			threads.emplace_back([&start, &function, thread_index]() {
+				while (start.load() == false)
+				{
+					std::this_thread::yield();
+				}
+
+				function(thread_index);
+			});
+		}
+
+		start = true;
+
+		for (auto &thread : threads)
+		{
+			thread.join();
+		}
+	}
+
+	void Print(const char *name, double calls_sec, double flushed_sec, size_t written, int64_t cpu_us)
+	{
+		size_t total = static_cast<size_t>(ThreadCount) * LinesPerThread;
+
+		::printf("%-8s %10.0f calls/s %10.0f lines/s flushed %8.2f us CPU/line   %zu/%zu lines written (%zu dropped)\n",
+				 name, total / calls_sec, written / flushed_sec, static_cast<double>(cpu_us) / total, written, total, total - written);
+	}
+
+	void RunBaseline(const std::string &directory)
+	{
+		double calls_sec;
+		int64_t cpu_us;
+
+		{
+			Baseline baseline(directory + "/before.log");
+			QuietConsole quiet;
+			bench::Stopwatch watch;
+
+			RunThreads(ThreadCount, [&baseline](int thread_index) {
+				for (int index = 0; index < LinesPerThread; index++)
+				{
+					baseline.Log("Bench", "A line of the information log of the benchmark, index: %d", index);
+				}
+			});
+
+			calls_sec = watch.ElapsedSec();
+			cpu_us = watch.CpuUs();
+		}
+
+		Print("before", calls_sec, calls_sec, CountLines(directory, "benchmark, index"), cpu_us);
+		RemoveFiles(directory);
+	}
+
+	void RunAsync(const std::string &directory)
+	{
+		double calls_sec;
+		double flushed_sec;
+		int64_t cpu_us;
+
+		{
+			QuietConsole quiet;
+			bench::Stopwatch watch;
+
+			RunThreads(ThreadCount, [](int thread_index) {
+				for (int index = 0; index < LinesPerThread; index++)
+				{
+					ov_log_internal(OVLogLevelInformation, "Bench", __FILE__, __LINE__, __PRETTY_FUNCTION__,
+									"A line of the information log of the benchmark, index: %d", index);
+				}
+			});
+
+			calls_sec = watch.ElapsedSec();
+			ov_log_flush();
+			flushed_sec = watch.ElapsedSec();
+			cpu_us = watch.CpuUs();
+		}
+
+		Print("after", calls_sec, flushed_sec, CountLines(directory, "benchmark, index"), cpu_us);
+		RemoveFiles(directory);
+	}
+
+	// Threads that log and exit, `thread_count` at once, `round_count` times
+	void RunChurn(const char *name, const std::string &directory, int thread_count, int round_count)
+	{
+		auto rss_before_kb = bench::ResidentKb();
+
+		{
+			QuietConsole quiet;
+
+			for (int round = 0; round < round_count; round++)
+			{
+				RunThreads(thread_count, [](int thread_index) {
+					for (int index = 0; index < 10; index++)
+					{
+						ov_log_internal(OVLogLevelInformation, "Bench", __FILE__, __LINE__, __PRETTY_FUNCTION__, "A short-lived thread, index: %d", index);
+					}
+				});
+
+				ov_log_flush();
+			}
+		}
+
+		auto rss_after_kb = bench::ResidentKb();
+
+		::printf("%-30s %6.1f MB of memory after logging (%d rings at most: %.1f MB)\n",
+				 name, static_cast<double>(rss_after_kb - rss_before_kb) / 1024.0,
+				 OV_LOG_ASYNC_MAX_RING_COUNT, OV_LOG_ASYNC_MAX_RING_COUNT * (OV_LOG_ASYNC_RING_SIZE / 1024.0 / 1024.0));
+
+		RemoveFiles(directory);
+	}
+}  // namespace
+
+int main()
+{
+	char directory[] = "/tmp/ome_log_bench.XXXXXX";
+
+	if (::mkdtemp(directory) == nullptr)
+	{
+		::perror("mkdtemp");
+		return 1;
+	}
+
+	ov_log_set_path(directory);
+
+	::printf("%d threads, %d information lines each\n", ThreadCount, LinesPerThread);
+	RunBaseline(directory);
+	RunAsync(directory);
+
+	RunChurn("1,000 short-lived threads", directory, 8, 125);
+	RunChurn("400 threads alive at once", directory, 400, 1);
+
+	::rmdir(directory);
+
+	return 0;
+}
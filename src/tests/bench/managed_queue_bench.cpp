@@ -0,0 +1,299 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <modules/managed_queue/managed_queue.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "common/bench.h"
+
+// Measures the queue of the publisher workers with 1, 4 and 16 producers and one consumer: the throughput, the CPU time per
+// item, and the latency from Enqueue() to the consumer.
+// - "before": the hot path of ov::ManagedQueue before the lock-free intake, replicated here (a node is allocated for every
+//   item, Enqueue() takes the mutex and notifies every waiter, and Dequeue() takes one item under the mutex)
+// - "after": ov::ManagedQueue with Dequeue(), and with DequeueBatch() as the publishers use it
+// Built with the monitoring of common/stub/monitoring/monitoring.h.
+namespace
+{
+	constexpr int ItemsPerRun = 4000000;
+	constexpr int PacedItemsPerRun = 20000;
+
+	int64_t NowNs()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(bench::Clock::now().time_since_epoch()).count();
+	}
+
+	template <typename T>
+	class Baseline
+	{
+	public:
+		~Baseline()
+		{
+			while (_front_node != nullptr)
+			{
+				auto node = _front_node;
+				_front_node = _front_node->next;
+				delete node;
+			}
+		}
+
+		void Enqueue(const T &item)
+		{
+			auto node = new Node(item);
+			auto unique_lock = std::unique_lock(_mutex);
+
+			_input_message_count++;
+
+			if (_size == 0)
+			{
+				_front_node = node;
+			}
+			else
+			{
+				_rear_node->next = node;
+			}
+
+			_rear_node = node;
+			_size++;
+
+			UpdateMetrics();
+
+			_condition.notify_all();
+		}
+
+		std::optional<T> Dequeue(int timeout)
+		{
+			auto unique_lock = std::unique_lock(_mutex);
+
+			if (_size == 0)
+			{
+				auto expire = std::chrono::system_clock::now() + std::chrono::milliseconds(timeout);
+
+				if (_condition.wait_until(unique_lock, expire, [this]() -> bool {
+						return _size != 0;
+					}) == false)
+				{
+					return {};
+				}
+			}
+
+			auto node = _front_node;
+			_front_node = _front_node->next;
+			if (_front_node == nullptr)
+			{
+				_rear_node = nullptr;
+			}
+
+			T value = std::move(node->data);
+
+			_size--;
+			_output_message_count++;
+
+			auto current = std::chrono::high_resolution_clock::now();
+			_waiting_time_in_us = _waiting_time_in_us * 0.9 + std::chrono::duration_cast<std::chrono::microseconds>(current - node->start).count() * 0.1;
+
+			delete node;
+
+			UpdateMetrics();
+
+			return value;
+		}
+
+	private:
+		struct Node
+		{
+			explicit Node(const T &value)
+				: data(value),
+				  start(std::chrono::high_resolution_clock::now())
+			{
+			}
+
+			T data;
+			Node *next = nullptr;
+			std::chrono::high_resolution_clock::time_point start;
+		};
+
+		void UpdateMetrics()
+		{
+			if (_peak < _size)
+			{
+				_peak = _size;
+			}
+
+			if (_timer.IsStart() == false)
+			{
+				_timer.Start();
+			}
+
+			if (_timer.IsElapsed(1000))
+			{
+				_timer.Update();
+			}
+		}
+
+		std::mutex _mutex;
+		std::condition_variable _condition;
+
+		Node *_front_node = nullptr;
+		Node *_rear_node = nullptr;
+		size_t _size = 0;
+
+		size_t _peak = 0;
+		uint64_t _input_message_count = 0;
+		uint64_t _output_message_count = 0;
+		double _waiting_time_in_us = 0.0;
+		ov::StopWatch _timer;
+	};
+
+	struct Result
+	{
+		double items_per_sec = 0.0;
+		double p99_us = 0.0;
+	};
+
+	// `interval_us` > 0 paces the producers, so the consumer sleeps between the items and the wake-up latency is measured.
+	// `dequeue` takes the available items into `items`, and returns false if none came in time.
+	template <typename Tqueue, typename Tdequeue>
+	Result Run(const char *name, Tqueue &queue, const Tdequeue &dequeue, int producer_count, int interval_us)
+	{
+		auto items_per_producer = ((interval_us > 0) ? PacedItemsPerRun : ItemsPerRun) / producer_count;
+		int64_t total = static_cast<int64_t>(items_per_producer) * producer_count;
+
+		bench::Samples latencies;
+		latencies.Reserve(total);
+
+		std::atomic<bool> start{false};
+		std::vector<std::thread> producers;
+
+		for (int producer = 0; producer < producer_count; producer++)
+		{
+			producers.emplace_back([&queue, &start, items_per_producer, interval_us]() {
+				while (start.load() == false)
+				{
+				}
+
+				for (int index = 0; index < items_per_producer; index++)
+				{
+					queue.Enqueue(NowNs());
+
+					if (interval_us > 0)
+					{
+						std::this_thread::sleep_for(std::chrono::microseconds(interval_us));
+					}
+				}
+			});
+		}
+
+		bench::Stopwatch watch;
+		start = true;
+
+		std::vector<int64_t> items;
+		int64_t received = 0;
+
+		while (received < total)
+		{
+			items.clear();
+
+			if (dequeue(queue, items) == false)
+			{
+				break;
+			}
+
+			auto now_ns = NowNs();
+			for (auto enqueued_ns : items)
+			{
+				latencies.Add(static_cast<double>(now_ns - enqueued_ns) / 1000.0);
+			}
+
+			received += items.size();
+		}
+
+		auto elapsed_sec = watch.ElapsedSec();
+		auto cpu_us = watch.CpuUs();
+
+		for (auto &producer : producers)
+		{
+			producer.join();
+		}
+
+		Result result;
+		result.items_per_sec = static_cast<double>(received) / elapsed_sec;
+		result.p99_us = latencies.Percentile(99.0);
+
+		::printf("  %-22s items/s=%12.0f cpu/item=%8.1f ns   latency p50=%9.1f p99=%9.1f max=%9.1f us\n", name, result.items_per_sec,
+				 static_cast<double>(cpu_us) * 1000.0 / static_cast<double>(std::max<int64_t>(received, 1)),
+				 latencies.Percentile(50.0), result.p99_us, latencies.Max());
+
+		return result;
+	}
+
+	void Compare(int producer_count, int interval_us)
+	{
+		::printf("%d producer(s)%s\n", producer_count, (interval_us > 0) ? ", paced" : "");
+
+		Baseline<int64_t> baseline;
+		auto before = Run(
+			"before", baseline,
+			[](Baseline<int64_t> &queue, std::vector<int64_t> &items) {
+				auto item = queue.Dequeue(5000);
+				if (item.has_value())
+				{
+					items.push_back(item.value());
+				}
+
+				return item.has_value();
+			},
+			producer_count, interval_us);
+
+		ov::ManagedQueue<int64_t> queue(nullptr, 0);
+		Run(
+			"after, Dequeue", queue,
+			[](ov::ManagedQueue<int64_t> &queue, std::vector<int64_t> &items) {
+				auto item = queue.Dequeue(5000);
+				if (item.has_value())
+				{
+					items.push_back(item.value());
+				}
+
+				return item.has_value();
+			},
+			producer_count, interval_us);
+
+		ov::ManagedQueue<int64_t> batch_queue(nullptr, 0);
+		auto after = Run(
+			"after, DequeueBatch", batch_queue,
+			[](ov::ManagedQueue<int64_t> &queue, std::vector<int64_t> &items) {
+				return queue.DequeueBatch(items, 64, 5000) > 0;
+			},
+			producer_count, interval_us);
+
+		::printf("  DequeueBatch/before: %.2fx items/s, %.2fx p99\n",
+				 after.items_per_sec / before.items_per_sec, (before.p99_us > 0.0) ? (after.p99_us / before.p99_us) : 0.0);
+	}
+}  // namespace
+
+int main()
+{
+	for (auto producer_count : {1, 4, 16})
+	{
+		Compare(producer_count, 0);
+	}
+
+	for (auto producer_count : {1, 4, 16})
+	{
+		Compare(producer_count, 100);
+	}
+
+	return 0;
+}
@@ -0,0 +1,294 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <modules/ovt_packetizer/ovt_packetizer.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "common/bench.h"
+
+// Measures the fan-out of an 8 Mbps stream from the OVT publisher to 100 edges, over socketpairs drained by another thread.
+// The stream (30 fps, frames of 33,333 bytes) is packetized once by OvtPacketizer, as the publisher does, and each OVT packet
+// is sent to every edge with the session id of the edge:
+// - "before": the previous path, the packet is copied into one buffer per edge (header and payload), the session id is
+//   patched, and the buffer is sent
+// - "after": the header is cloned per edge with OvtPacket::CloneHeader() and sent with the shared payload in one sendmsg(),
+//   as ov::Socket::Send(data_list) does for `Send({header, payload})`
+// The bytes copied in user space, the CPU time per second of stream (the sending thread, and the process with the kernel copies
+// and the drain thread), and the throughput are reported.
+namespace
+{
+	constexpr int EdgeCount = 100;
+	constexpr int64_t Bitrate = 8000000;
+	constexpr int FrameRate = 30;
+	constexpr int StreamSec = 10;
+	constexpr int SocketBufferSize = 1024 * 1024;
+
+	struct Edge
+	{
+		int send_fd = -1;
+		int receive_fd = -1;
+		uint32_t session_id = 0;
+	};
+
+	struct Result
+	{
+		double elapsed_sec = 0.0;
+		int64_t thread_cpu_us = 0;
+		int64_t process_cpu_us = 0;
+		uint64_t bytes_sent = 0;
+		uint64_t bytes_copied = 0;
+	};
+
+	int64_t ThreadCpuUs()
+	{
+		struct rusage usage;
+		::getrusage(RUSAGE_THREAD, &usage);
+
+		return (static_cast<int64_t>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000) +
+			   usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+	}
+
+	// Sends all the buffers, resuming after a partial write
+	bool SendAll(int fd, struct iovec *iov, int count)
+	{
+		while (count > 0)
+		{
+			struct msghdr message = {};
+			message.msg_iov = iov;
+			message.msg_iovlen = count;
+
+			auto sent = ::sendmsg(fd, &message, MSG_NOSIGNAL);
+			if (sent < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				return false;
+			}
+
+			while ((count > 0) && (static_cast<size_t>(sent) >= iov->iov_len))
+			{
+				sent -= iov->iov_len;
+				iov++;
+				count--;
+			}
+
+			if (count > 0)
+			{
+				iov->iov_base = static_cast<uint8_t *>(iov->iov_base) + sent;
+				iov->iov_len -= sent;
+			}
+		}
+
+		return true;
+	}
+
+	std::vector<std::shared_ptr<OvtPacket>> MakeStream()
+	{
+		OvtPacketizer packetizer;
+		std::vector<std::shared_ptr<OvtPacket>> packets;
+
+		std::vector<uint8_t> frame(Bitrate / 8 / FrameRate, 0x5A);
+		int64_t frame_duration = 90000 / FrameRate;
+
+		for (int index = 0; index < StreamSec * FrameRate; index++)
+		{
+			auto flag = ((index % FrameRate) == 0) ? MediaPacketFlag::Key : MediaPacketFlag::NoFlag;
+			auto media_packet = std::make_shared<MediaPacket>(0, cmn::MediaType::Video, 0, frame.data(), static_cast<int32_t>(frame.size()),
+															  index * frame_duration, index * frame_duration, frame_duration, flag,
+															  cmn::BitstreamFormat::H264_ANNEXB, cmn::PacketType::NALU);
+
+			packetizer.PacketizeMediaPacket(index * frame_duration, media_packet);
+
+			while (packetizer.IsAvailablePackets())
+			{
+				packets.push_back(packetizer.PopPacket());
+			}
+		}
+
+		return packets;
+	}
+
+	// `send` sends a packet to an edge, and returns the bytes it copied in user space (or -1 on error)
+	template <typename Tsend>
+	Result Run(const char *name, const std::vector<std::shared_ptr<OvtPacket>> &packets, std::vector<Edge> &edges, const Tsend &send)
+	{
+		std::atomic<bool> stop{false};
+		std::atomic<uint64_t> bytes_received{0};
+
+		std::thread drain([&edges, &stop, &bytes_received]() {
+			std::vector<struct pollfd> fds(edges.size());
+			for (size_t index = 0; index < edges.size(); index++)
+			{
+				fds[index].fd = edges[index].receive_fd;
+				fds[index].events = POLLIN;
+			}
+
+			std::vector<uint8_t> buffer(256 * 1024);
+
+			while (stop.load() == false)
+			{
+				if (::poll(fds.data(), fds.size(), 10) <= 0)
+				{
+					continue;
+				}
+
+				for (auto &fd : fds)
+				{
+					if (fd.revents & POLLIN)
+					{
+						auto length = ::recv(fd.fd, buffer.data(), buffer.size(), MSG_DONTWAIT);
+						if (length > 0)
+						{
+							bytes_received += length;
+						}
+					}
+				}
+			}
+		});
+
+		Result result;
+
+		bench::Stopwatch watch;
+		auto thread_cpu_start = ThreadCpuUs();
+
+		for (const auto &packet : packets)
+		{
+			for (auto &edge : edges)
+			{
+				auto copied = send(*packet, edge);
+				if (copied < 0)
+				{
+					::fprintf(stderr, "Could not send to the edge %u\n", edge.session_id);
+					::exit(1);
+				}
+
+				result.bytes_copied += copied;
+				result.bytes_sent += packet->GetDataLength();
+			}
+		}
+
+		while (bytes_received.load() < result.bytes_sent)
+		{
+			std::this_thread::yield();
+		}
+
+		result.elapsed_sec = watch.ElapsedSec();
+		result.thread_cpu_us = ThreadCpuUs() - thread_cpu_start;
+		result.process_cpu_us = watch.CpuUs();
+
+		stop = true;
+		drain.join();
+
+		::printf("  %-8s copied=%8.1f MB  sender cpu=%6.1f ms/s  process cpu=%6.1f ms/s  throughput=%6.2f Gbps\n", name,
+				 static_cast<double>(result.bytes_copied) / 1000000.0,
+				 static_cast<double>(result.thread_cpu_us) / 1000.0 / StreamSec,
+				 static_cast<double>(result.process_cpu_us) / 1000.0 / StreamSec,
+				 static_cast<double>(result.bytes_sent) * 8.0 / result.elapsed_sec / 1000000000.0);
+
+		return result;
+	}
+}  // namespace
+
+int main()
+{
+	std::vector<Edge> edges(EdgeCount);
+
+	for (int index = 0; index < EdgeCount; index++)
+	{
+		int fds[2];
+		if (::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0)
+		{
+			::perror("socketpair");
+			return 1;
+		}
+
+		::setsockopt(fds[0], SOL_SOCKET, SO_SNDBUF, &SocketBufferSize, sizeof(SocketBufferSize));
+		::setsockopt(fds[1], SOL_SOCKET, SO_RCVBUF, &SocketBufferSize, sizeof(SocketBufferSize));
+
+		edges[index].send_fd = fds[0];
+		edges[index].receive_fd = fds[1];
+		edges[index].session_id = index + 1;
+	}
+
+	auto packets = MakeStream();
+
+	::printf("%d edges, %.0f Mbps, %d s of stream, %zu OVT packets\n", EdgeCount, Bitrate / 1000000.0, StreamSec, packets.size());
+
+	auto before = Run("before", packets, edges, [](const OvtPacket &packet, const Edge &edge) -> int64_t {
+		auto header = packet.CloneHeader(edge.session_id);
+		auto &payload = packet.GetPayload();
+
+		ov::Data data(packet.GetDataLength());
+		data.Append(header.get());
+		if (payload != nullptr)
+		{
+			data.Append(payload.get());
+		}
+
+		struct iovec iov[1];
+		iov[0].iov_base = data.GetWritableData();
+		iov[0].iov_len = data.GetLength();
+
+		if (SendAll(edge.send_fd, iov, 1) == false)
+		{
+			return -1;
+		}
+
+		return header->GetLength() + data.GetLength();
+	});
+
+	auto after = Run("after", packets, edges, [](const OvtPacket &packet, const Edge &edge) -> int64_t {
+		auto header = packet.CloneHeader(edge.session_id);
+		auto &payload = packet.GetPayload();
+
+		struct iovec iov[2];
+		int count = 1;
+
+		iov[0].iov_base = header->GetWritableData();
+		iov[0].iov_len = header->GetLength();
+
+		if (payload != nullptr)
+		{
+			iov[1].iov_base = const_cast<void *>(payload->GetData());
+			iov[1].iov_len = payload->GetLength();
+			count++;
+		}
+
+		if (SendAll(edge.send_fd, iov, count) == false)
+		{
+			return -1;
+		}
+
+		return header->GetLength();
+	});
+
+	::printf("  after/before: %.3fx bytes copied, %.2fx sender cpu, %.2fx process cpu\n",
+			 static_cast<double>(after.bytes_copied) / static_cast<double>(before.bytes_copied),
+			 static_cast<double>(after.thread_cpu_us) / static_cast<double>(before.thread_cpu_us),
+			 static_cast<double>(after.process_cpu_us) / static_cast<double>(before.process_cpu_us));
+
+	for (auto &edge : edges)
+	{
+		::close(edge.send_fd);
+		::close(edge.receive_fd);
+	}
+
+	return 0;
+}
@@ -0,0 +1,154 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <modules/rtp_rtcp/rtp_bandwidth_estimator.h>
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+#include "common/bench.h"
+#include "common/bwe_link_simulator.h"
+
+// Replays the feedback of RtpBandwidthEstimator offline.
+//
+//   rtp_bandwidth_estimator_bench                 runs the simulated link scenarios
+//   rtp_bandwidth_estimator_bench <trace.csv>     replays a trace recorded with OME_DUMP_BWE=true
+//   rtp_bandwidth_estimator_bench <trace.csv> -v  also prints the target bitrate after each feedback
+//
+// The trace format is described in rtp_bandwidth_estimator.h.
+namespace
+{
+	void PrintSummary(const RtpBandwidthEstimator &estimator, bench::Samples &target_kbps, size_t feedback_count, double cpu_us)
+	{
+		::printf("  feedback: %zu, %.2f us/feedback\n", feedback_count, (feedback_count > 0) ? (cpu_us / feedback_count) : 0.0);
+		target_kbps.Print("  target bitrate", "kbps");
+		::printf("  final: %s\n", estimator.GetStats().ToString().CStr());
+	}
+
+	int Replay(const char *file_path, bool verbose)
+	{
+		FILE *file = ::fopen(file_path, "r");
+		if (file == nullptr)
+		{
+			::fprintf(stderr, "Could not open %s\n", file_path);
+			return 1;
+		}
+
+		RtpBandwidthEstimator estimator;
+		std::vector<RtpBandwidthEstimator::PacketResult> packet_results;
+		bench::Samples target_kbps;
+		size_t feedback_count = 0;
+		int64_t first_ms = -1;
+		double cpu_us = 0.0;
+
+		char line[256];
+		size_t line_number = 0;
+		while (::fgets(line, sizeof(line), file) != nullptr)
+		{
+			line_number++;
+
+			RtpBandwidthEstimator::PacketResult packet;
+			int64_t now_ms = 0;
+			uint64_t bitrate = 0;
+
+			bench::Stopwatch watch;
+
+			if (::sscanf(line, "P,%" SCNd64 ",%" SCNd64 ",%zu", &packet.send_time_us, &packet.arrival_time_us, &packet.size) == 3)
+			{
+				packet_results.push_back(packet);
+				continue;
+			}
+			else if (::sscanf(line, "F,%" SCNd64, &now_ms) == 1)
+			{
+				watch.Restart();
+				estimator.OnTransportFeedback(packet_results, now_ms);
+				cpu_us += watch.ElapsedUs();
+
+				packet_results.clear();
+				feedback_count++;
+			}
+			else if (::sscanf(line, "R,%" SCNd64 ",%" SCNu64, &now_ms, &bitrate) == 2)
+			{
+				estimator.OnRemb(bitrate, now_ms);
+			}
+			else
+			{
+				::fprintf(stderr, "%s:%zu: unknown record: %s", file_path, line_number, line);
+				::fclose(file);
+				return 1;
+			}
+
+			first_ms = (first_ms < 0) ? now_ms : first_ms;
+			target_kbps.Add(estimator.GetTargetBitrate() / 1000.0);
+
+			if (verbose)
+			{
+				::printf("%8" PRId64 " ms %8.1f kbps %s\n", now_ms - first_ms, estimator.GetTargetBitrate() / 1000.0, estimator.IsDecreased() ? "(decreased)" : "");
+			}
+		}
+
+		::fclose(file);
+
+		::printf("== %s\n", file_path);
+		PrintSummary(estimator, target_kbps, feedback_count, cpu_us);
+
+		return 0;
+	}
+
+	void Simulate(const char *label, std::vector<bwe::LinkPhase> phases, int64_t duration_ms)
+	{
+		RtpBandwidthEstimator estimator;
+		bwe::LinkSimulator simulator(phases);
+
+		size_t feedback_count = 0;
+		simulator.on_feedback = [&](const std::vector<RtpBandwidthEstimator::PacketResult> &, int64_t) {
+			feedback_count++;
+		};
+
+		auto cpu_start_us = bench::Stopwatch::CpuTimeUs();
+		auto timeline = simulator.Run(estimator, duration_ms);
+		auto cpu_us = static_cast<double>(bench::Stopwatch::CpuTimeUs() - cpu_start_us);
+
+		bench::Samples target_kbps;
+		bench::Samples queue_delay_ms;
+		for (const auto &point : timeline)
+		{
+			target_kbps.Add(point.target_bitrate / 1000.0);
+			queue_delay_ms.Add(point.queue_delay_ms);
+		}
+
+		::printf("== %s\n", label);
+		for (size_t index = 0; index < phases.size(); index++)
+		{
+			auto end_ms = (index + 1 < phases.size()) ? phases[index + 1].start_ms : duration_ms;
+			// Skip the first 5 seconds of each phase to see where the estimate settles
+			::printf("  %6.1f - %6.1f s: capacity %6.0f kbps, loss %4.1f%%, settled target %6.0f kbps\n",
+					 phases[index].start_ms / 1000.0, end_ms / 1000.0,
+					 phases[index].capacity_bps / 1000.0, phases[index].random_loss_ratio * 100.0,
+					 bwe::AverageTarget(timeline, phases[index].start_ms + 5000, end_ms) / 1000.0);
+		}
+		queue_delay_ms.Print("  queue delay", "ms");
+		// The CPU time includes the simulator
+		PrintSummary(estimator, target_kbps, feedback_count, cpu_us);
+	}
+}  // namespace
+
+int main(int argc, char *argv[])
+{
+	if (argc > 1)
+	{
+		return Replay(argv[1], (argc > 2) && (::strcmp(argv[2], "-v") == 0));
+	}
+
+	Simulate("steady 2 Mbps", {{0, 2000 * 1000, 0.0}}, 60000);
+	Simulate("2 Mbps -> 800 kbps -> 2 Mbps", {{0, 2000 * 1000, 0.0}, {30000, 800 * 1000, 0.0}, {60000, 2000 * 1000, 0.0}}, 90000);
+	Simulate("5 Mbps with 5% -> 20% random loss", {{0, 5000 * 1000, 0.05}, {30000, 5000 * 1000, 0.2}}, 60000);
+
+	return 0;
+}
@@ -0,0 +1,371 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <base/ovlibrary/ovlibrary.h>
+#include <publishers/llhls/llhls_chunklist.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "common/bench.h"
+#include "common/string_reference.h"
+
+// Measures the ov::String operations on the hot paths of the playlist builders:
+// formatting the part tags into a reserved playlist, formatting short strings (names, keys),
+// and moving the strings around in containers.
+// Then a real LL-HLS chunklist (6 s segments, 0.5 s parts, a second video rendition) is rendered the way
+// LLHlsChunklist::MakeChunklist() does, with ov::String and with the previous ov::String (common/string_reference.h).
+// The rendering with ov::String is checked against LLHlsChunklist::ToString() before it is measured.
+namespace
+{
+	constexpr int Rounds = 2000;
+
+	void FormatPartTags()
+	{
+		bench::Samples samples;
+		ov::String playlist(static_cast<uint32_t>(64 * 1024));
+
+		for (int round = 0; round < Rounds; round++)
+		{
+			playlist.Clear();
+			playlist.SetCapacity(64 * 1024);
+
+			bench::Stopwatch watch;
+			for (int index = 0; index < 100; index++)
+			{
+				playlist.AppendFormat("#EXT-X-PART:DURATION=%.3f,URI=\"part_0_%d_%d_video_llhls.m4s?session=%s\"%s\n",
+									  0.5, round, index, "1a2b3c4d", (index % 12 == 0) ? ",INDEPENDENT=YES" : "");
+			}
+			samples.Add(watch.ElapsedUs());
+			bench::DoNotOptimize(playlist);
+		}
+
+		samples.Print("100 part tags (AppendFormat)", "us");
+	}
+
+	void FormatShortStrings()
+	{
+		bench::Samples samples;
+
+		for (int round = 0; round < Rounds; round++)
+		{
+			bench::Stopwatch watch;
+			for (int index = 0; index < 100; index++)
+			{
+				auto key = ov::String::FormatString("%s/%s#%d", "default", "app", index);
+				bench::DoNotOptimize(key);
+			}
+			samples.Add(watch.ElapsedUs());
+		}
+
+		samples.Print("100 short FormatString", "us");
+	}
+
+	// `padding` characters are appended to every string (e.g. 0 for names, 2000 for SDPs or playlists)
+	void MoveInContainers(const char *label, size_t padding)
+	{
+		bench::Samples samples;
+
+		std::vector<ov::String> source;
+		for (int index = 0; index < 1000; index++)
+		{
+			auto string = ov::String::FormatString("%s_%d", (index % 2) ? "stream" : "a_stream_name_longer_than_the_inline_capacity", (index * 7919) % 1000);
+			string.Append(std::string(padding, 'x').c_str());
+			source.push_back(std::move(string));
+		}
+
+		for (int round = 0; round < Rounds / 10; round++)
+		{
+			auto strings = source;
+
+			bench::Stopwatch watch;
+			// Sorting and erasing move-assign the elements
+			std::sort(strings.begin(), strings.end());
+			while (strings.size() > 500)
+			{
+				strings.erase(strings.begin());
+			}
+			samples.Add(watch.ElapsedUs());
+			bench::DoNotOptimize(strings);
+		}
+
+		samples.Print(label, "us");
+	}
+
+	constexpr double SegmentDuration = 6.0;
+	constexpr double PartDuration = 0.5;
+	constexpr int PartsPerSegment = static_cast<int>(SegmentDuration / PartDuration);
+	// Parts of the segment that is being written when the chunklist is requested
+	constexpr int OpenParts = 5;
+	constexpr const char *QueryString = "session=1a2b3c4d";
+
+	int64_t GetPartStartMs(uint32_t segment_sequence, int part_index)
+	{
+		return 1700000000000LL + static_cast<int64_t>((segment_sequence * PartsPerSegment + part_index) * PartDuration * 1000);
+	}
+
+	// What LLHlsChunklist keeps for a segment, with the strings of the implementation that is measured
+	template <typename Tstring>
+	struct Segment
+	{
+		struct Part
+		{
+			double duration;
+			Tstring url;
+			Tstring next_url;
+			bool is_independent;
+
+			// LLHlsChunklist::SegmentInfo returns the URLs by value
+			Tstring GetUrl() const
+			{
+				return url;
+			}
+
+			Tstring GetNextUrl() const
+			{
+				return next_url;
+			}
+		};
+
+		uint32_t sequence;
+		int64_t start_time;
+		double duration = 0.0;
+		bool completed = false;
+		std::vector<Part> parts;
+
+		Tstring rendered_program_date_time;
+		Tstring rendered_extinf;
+	};
+
+	template <typename Tstring>
+	Tstring MakeProgramDateTimeTag(int64_t start_time_ms)
+	{
+		std::chrono::system_clock::time_point tp{std::chrono::milliseconds{start_time_ms}};
+		return Tstring::FormatString("#EXT-X-PROGRAM-DATE-TIME:%s\n", ov::Converter::ToISO8601String(tp).CStr());
+	}
+
+	// `segment_count` completed segments and OpenParts parts of the next one
+	template <typename Tstring>
+	std::vector<Segment<Tstring>> MakeSegments(uint32_t segment_count)
+	{
+		std::vector<Segment<Tstring>> segments;
+
+		for (uint32_t sequence = 0; sequence <= segment_count; sequence++)
+		{
+			Segment<Tstring> segment;
+			segment.sequence = sequence;
+			segment.start_time = GetPartStartMs(sequence, 0);
+
+			auto part_count = (sequence < segment_count) ? PartsPerSegment : OpenParts;
+			for (int part_index = 0; part_index < part_count; part_index++)
+			{
+				segment.parts.push_back({PartDuration,
+										 Tstring::FormatString("part_0_%u_%d_video_llhls.m4s", sequence, part_index),
+										 Tstring::FormatString("part_0_%u_%d_video_llhls.m4s", sequence, part_index + 1),
+										 part_index == 0});
+				segment.duration += PartDuration;
+			}
+
+			if (part_count == PartsPerSegment)
+			{
+				segment.completed = true;
+				segment.rendered_program_date_time = MakeProgramDateTimeTag<Tstring>(segment.start_time);
+				segment.rendered_extinf = Tstring::FormatString("#EXTINF:%lf,\n%s", segment.duration, Tstring::FormatString("seg_0_%u_video_llhls.m4s", sequence).CStr());
+			}
+
+			segments.push_back(std::move(segment));
+		}
+
+		return segments;
+	}
+
+	// The steps of LLHlsChunklist::MakeChunklist() for a live low-latency chunklist with a query string
+	template <typename Tstring>
+	Tstring RenderChunklist(const std::vector<Segment<Tstring>> &segments, const Tstring &query_string, const Tstring &rendition_url, int64_t rendition_msn, int64_t rendition_part)
+	{
+		const auto &last_segment = segments.back();
+
+		Tstring playlist(static_cast<uint32_t>(std::max<size_t>(20480, segments.size() * 160)));
+
+		// AppendHeader()
+		playlist.AppendFormat("#EXTM3U\n");
+		playlist.AppendFormat("#EXT-X-VERSION:%d\n", 6);
+		playlist.AppendFormat("#EXT-X-TARGETDURATION:%u\n", static_cast<uint32_t>(std::round(SegmentDuration)));
+		playlist.AppendFormat("#EXT-X-SERVER-CONTROL:CAN-BLOCK-RELOAD=YES,PART-HOLD-BACK=%f\n", static_cast<float>(PartDuration * 3));
+		playlist.AppendFormat("#EXT-X-PART-INF:PART-TARGET=%lf\n", PartDuration);
+		playlist.AppendFormat("#EXT-X-MEDIA-SEQUENCE:%u\n", segments.front().sequence);
+		playlist.AppendFormat("#EXT-X-MAP:URI=\"%s", "init_0_video_llhls.m4s");
+		playlist.AppendFormat("?%s", query_string.CStr());
+		playlist.AppendFormat("\"\n");
+
+		// AppendSegment()
+		for (const auto &segment : segments)
+		{
+			if (segment.completed)
+			{
+				playlist.Append(segment.rendered_program_date_time);
+			}
+			else
+			{
+				playlist.Append(MakeProgramDateTimeTag<Tstring>(segment.start_time));
+			}
+
+			if (segment.sequence + 3 > last_segment.sequence)
+			{
+				for (const auto &part : segment.parts)
+				{
+					playlist.AppendFormat("#EXT-X-PART:DURATION=%lf,URI=\"%s", part.duration, part.GetUrl().CStr());
+					playlist.AppendFormat("?%s", query_string.CStr());
+					playlist.AppendFormat("\"");
+					if (part.is_independent)
+					{
+						playlist.AppendFormat(",INDEPENDENT=YES");
+					}
+					playlist.Append("\n");
+
+					if ((&segment == &last_segment) && (&part == &segment.parts.back()))
+					{
+						playlist.AppendFormat("#EXT-X-PRELOAD-HINT:TYPE=PART,URI=\"%s", part.GetNextUrl().CStr());
+						playlist.AppendFormat("?%s", query_string.CStr());
+						playlist.AppendFormat("\"\n");
+					}
+				}
+			}
+
+			// AppendSegmentTags()
+			if (segment.completed && (&segment != &last_segment))
+			{
+				playlist.Append(segment.rendered_extinf);
+				playlist.AppendFormat("?%s", query_string.CStr());
+				playlist.Append("\n");
+			}
+		}
+
+		// AppendRenditionReports()
+		playlist.AppendFormat("#EXT-X-RENDITION-REPORT:URI=\"%s", rendition_url.CStr());
+		playlist.AppendFormat("?%s", query_string.CStr());
+		playlist.AppendFormat("\"");
+		playlist.AppendFormat(",LAST-MSN=%llu", rendition_msn);
+		playlist.AppendFormat(",LAST-PART=%llu", rendition_part);
+		playlist.AppendFormat("\n");
+
+		return playlist;
+	}
+
+	std::shared_ptr<LLHlsChunklist> MakeChunklist(uint32_t id, const char *variant_name, uint32_t segment_count)
+	{
+		auto track = std::make_shared<MediaTrack>();
+		track->SetId(id);
+		track->SetMediaType(cmn::MediaType::Video);
+		track->SetVariantName(variant_name);
+
+		auto chunklist = std::make_shared<LLHlsChunklist>(ov::String::FormatString("chunklist_%u_%s_llhls.m3u8", id, variant_name), track, segment_count,
+														  static_cast<uint32_t>(SegmentDuration), PartDuration, "init_0_video_llhls.m4s", true);
+		chunklist->SetPartHoldBack(PartDuration * 3);
+
+		for (const auto &segment : MakeSegments<ov::String>(segment_count))
+		{
+			chunklist->CreateSegmentInfo(LLHlsChunklist::SegmentInfo(segment.sequence, ov::String::FormatString("seg_0_%u_video_llhls.m4s", segment.sequence)));
+
+			for (size_t part_index = 0; part_index < segment.parts.size(); part_index++)
+			{
+				const auto &part = segment.parts[part_index];
+				chunklist->AppendPartialSegmentInfo(segment.sequence,
+													LLHlsChunklist::SegmentInfo(part_index, GetPartStartMs(segment.sequence, part_index), part.duration, 1000, part.url, part.next_url,
+																				part.is_independent, part_index == PartsPerSegment - 1));
+			}
+		}
+
+		return chunklist;
+	}
+
+	template <typename Tstring>
+	void MeasureChunklist(const char *label, const std::vector<Segment<Tstring>> &segments, const std::shared_ptr<LLHlsChunklist> &rendition, int rounds)
+	{
+		int64_t msn, part;
+		rendition->GetLastSequenceNumber(msn, part);
+
+		Tstring query_string(QueryString);
+		Tstring rendition_url(rendition->GetUrl().CStr());
+		bench::Samples samples;
+
+		for (int round = 0; round < rounds; round++)
+		{
+			bench::Stopwatch watch;
+			auto playlist = RenderChunklist(segments, query_string, rendition_url, msn, part);
+			samples.Add(watch.ElapsedUs());
+			bench::DoNotOptimize(playlist);
+		}
+
+		samples.Print(label, "us");
+	}
+
+	bool RenderChunklists(const char *label, uint32_t segment_count, int rounds)
+	{
+		auto chunklist = MakeChunklist(0, "video", segment_count);
+		auto rendition = MakeChunklist(1, "video_720p", segment_count);
+		chunklist->SetRenditions({{0, chunklist}, {1, rendition}});
+
+		int64_t msn, part;
+		rendition->GetLastSequenceNumber(msn, part);
+
+		auto segments = MakeSegments<ov::String>(segment_count);
+		auto reference_segments = MakeSegments<string_reference::String>(segment_count);
+
+		auto expected = chunklist->ToString(QueryString, false, false, false);
+		auto rendered = RenderChunklist<ov::String>(segments, QueryString, rendition->GetUrl(), msn, part);
+		auto reference_rendered = RenderChunklist<string_reference::String>(reference_segments, QueryString, rendition->GetUrl().CStr(), msn, part);
+
+		auto result = (expected == rendered) && (expected == reference_rendered.CStr());
+		if (result == false)
+		{
+			::printf("The rendered chunklist differs from LLHlsChunklist::ToString()\n");
+		}
+		else
+		{
+			::printf("== chunklist, %s: %zu bytes\n", label, expected.GetLength());
+
+			MeasureChunklist("  ov::String", segments, rendition, rounds);
+			MeasureChunklist("  previous ov::String", reference_segments, rendition, rounds);
+
+			bench::Samples samples;
+			for (int round = 0; round < rounds; round++)
+			{
+				bench::Stopwatch watch;
+				auto playlist = chunklist->ToString(QueryString, false, false, false);
+				samples.Add(watch.ElapsedUs());
+				bench::DoNotOptimize(playlist);
+			}
+			samples.Print("  LLHlsChunklist::ToString()", "us");
+		}
+
+		chunklist->Release();
+		rendition->Release();
+
+		return result;
+	}
+}  // namespace
+
+int main()
+{
+	FormatPartTags();
+	FormatShortStrings();
+	MoveInContainers("sort 1000 + erase 500 (names)", 0);
+	MoveInContainers("sort 1000 + erase 500 (2 KB)", 2000);
+
+	if ((RenderChunklists("10 segments", 10, Rounds) == false) ||
+		(RenderChunklists("1h DVR (600 segments)", 600, Rounds / 10) == false))
+	{
+		return 1;
+	}
+
+	return 0;
+}
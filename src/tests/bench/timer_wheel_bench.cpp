@@ -0,0 +1,162 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <base/ovlibrary/ovlibrary.h>
+#include <base/ovlibrary/delay_queue.h>
+
+#include <atomic>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "common/bench.h"
+
+// Measures ov::TimerWheel and ov::DelayQueue:
+// - Schedule() + Cancel() from 1, 4 and 16 threads, like the per-session timers (spread over the shards)
+// - 10,000 DelayQueues repeating every 10 ms, like the per-stream timers (the timers are scheduled again, not allocated)
+// - 1M timers over 3 seconds: the memory per timer and the lateness
+namespace
+{
+	void ScheduleAndCancel(int thread_count)
+	{
+		constexpr int OperationsPerThread = 200000;
+
+		auto wheel = ov::TimerWheel::GetInstance();
+		std::vector<std::thread> threads;
+
+		bench::Stopwatch watch;
+
+		for (int thread_index = 0; thread_index < thread_count; thread_index++)
+		{
+			threads.emplace_back([wheel]() {
+				for (int index = 0; index < OperationsPerThread; index++)
+				{
+					auto timer = wheel->Schedule([]() {}, 1000 + (index % 5000));
+					wheel->Cancel(timer);
+				}
+			});
+		}
+
+		for (auto &thread : threads)
+		{
+			thread.join();
+		}
+
+		auto elapsed_sec = watch.ElapsedSec();
+
+		char label[64];
+		::snprintf(label, sizeof(label), "Schedule+Cancel, %2d thread(s)", thread_count);
+		::printf("%-40s ops/s=%12.0f\n", label, static_cast<double>(OperationsPerThread) * thread_count / elapsed_sec);
+	}
+
+	void RepeatingQueues()
+	{
+		constexpr int QueueCount = 10000;
+		constexpr int DurationMSec = 2000;
+
+		std::atomic<int64_t> called{0};
+		std::vector<std::unique_ptr<ov::DelayQueue>> queues;
+
+		auto rss_before_kb = bench::ResidentKb();
+
+		for (int index = 0; index < QueueCount; index++)
+		{
+			auto queue = std::make_unique<ov::DelayQueue>("BenchRepeat");
+			queue->Push([&called](void *parameter) -> ov::DelayQueueAction {
+				called++;
+				return ov::DelayQueueAction::Repeat;
+			},
+						10);
+			queue->Start();
+			queues.push_back(std::move(queue));
+		}
+
+		bench::Stopwatch watch;
+		std::this_thread::sleep_for(std::chrono::milliseconds(DurationMSec));
+
+		auto calls = called.load();
+		auto cpu_us = watch.CpuUs();
+		auto elapsed_sec = watch.ElapsedSec();
+		auto rss_after_kb = bench::ResidentKb();
+
+		for (auto &queue : queues)
+		{
+			queue->Stop();
+		}
+
+		::printf("%-40s calls/s=%10.0f (expected %d) cpu/call=%8.1f us rss=%lld KB\n", "10000 queues repeating every 10 ms",
+				 static_cast<double>(calls) / elapsed_sec, QueueCount * 100,
+				 static_cast<double>(cpu_us) / static_cast<double>(std::max<int64_t>(calls, 1)),
+				 static_cast<long long>(rss_after_kb - rss_before_kb));
+	}
+
+	void ManyTimers()
+	{
+		constexpr size_t TimerCount = 1000000;
+
+		auto wheel = ov::TimerWheel::GetInstance();
+
+		std::vector<int64_t> expire_msecs(TimerCount);
+		std::vector<std::atomic<int64_t>> fired_msecs(TimerCount);
+		std::vector<std::shared_ptr<ov::TimerWheel::Timer>> timers;
+		timers.reserve(TimerCount);
+
+		std::mt19937 random(1234);
+		std::uniform_int_distribution<int> distribution(0, 3000);
+
+		auto rss_before_kb = bench::ResidentKb();
+		bench::Stopwatch watch;
+
+		for (size_t index = 0; index < TimerCount; index++)
+		{
+			auto *fired_msec = &fired_msecs[index];
+
+			expire_msecs[index] = wheel->GetExpireMSec(distribution(random));
+			timers.push_back(wheel->ScheduleAt(
+				[fired_msec]() {
+					fired_msec->store(ov::TimerWheel::GetInstance()->GetNowMSec());
+				},
+				expire_msecs[index]));
+		}
+
+		auto schedule_sec = watch.ElapsedSec();
+		auto rss_after_kb = bench::ResidentKb();
+
+		while (wheel->GetCount() > 0)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+		bench::Samples lateness;
+		lateness.Reserve(TimerCount);
+
+		for (size_t index = 0; index < TimerCount; index++)
+		{
+			lateness.Add(static_cast<double>(fired_msecs[index].load() - expire_msecs[index]));
+		}
+
+		::printf("%-40s schedule=%.0f ns/timer memory=%.1f bytes/timer\n", "1M timers over 3 s",
+				 schedule_sec * 1e9 / TimerCount, static_cast<double>(rss_after_kb - rss_before_kb) * 1024.0 / TimerCount);
+		lateness.Print("  lateness", "ms");
+	}
+}  // namespace
+
+int main()
+{
+	for (auto thread_count : {1, 4, 16})
+	{
+		ScheduleAndCancel(thread_count);
+	}
+
+	RepeatingQueues();
+	ManyTimers();
+
+	return 0;
+}
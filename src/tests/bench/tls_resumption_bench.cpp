@@ -0,0 +1,122 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <cstdio>
+
+#include "common/bench.h"
+#include "common/tls_loopback.h"
+
+// Measures the CPU time of the full and the resumed TLS handshakes of an HTTPS port with ov::TlsSessionResumption,
+// for an RSA-2048 and an ECDSA P-256 certificate, with TLS 1.2 (HTTP/1.1 ports, RSA only) and TLS 1.3 (ports with HTTP/2):
+// - full: the client does not offer a session
+// - ticket: the client offers the ticket of its previous handshake
+// - session ID: the tickets are disabled, so the session is found in the session ID cache
+// The CPU time of the server is measured separately from the client, and "handshakes/s" is what one core of the server does.
+namespace
+{
+	constexpr double MinDurationSec = 1.0;
+
+	enum class Mode
+	{
+		Full,
+		Ticket,
+		SessionId
+	};
+
+	const char *ModeToString(Mode mode)
+	{
+		switch (mode)
+		{
+			case Mode::Full:
+				return "full";
+			case Mode::Ticket:
+				return "ticket";
+			case Mode::SessionId:
+				return "session ID";
+		}
+
+		return "";
+	}
+
+	void Run(const char *certificate_name, const std::shared_ptr<::Certificate> &certificate, int version, Mode mode)
+	{
+		ov::TlsSessionResumptionOptions options;
+		options.ticket_enabled = (mode != Mode::SessionId);
+
+		auto session_resumption = std::make_shared<ov::TlsSessionResumption>("Bench", options);
+		auto server_context = tls_loopback::CreateServerContext(certificate, version, session_resumption);
+		auto client_context = tls_loopback::CreateClientContext(version);
+
+		// The first handshake gives the session to resume
+		auto previous = tls_loopback::Handshake(server_context->GetSslContext(), client_context, nullptr);
+
+		int64_t count = 0;
+		int64_t reused_count = 0;
+		int64_t server_cpu_ns = 0;
+		int64_t client_cpu_ns = 0;
+
+		bench::Stopwatch watch;
+		while (watch.ElapsedSec() < MinDurationSec)
+		{
+			auto result = tls_loopback::Handshake(server_context->GetSslContext(), client_context, (mode == Mode::Full) ? nullptr : previous.session);
+
+			count++;
+			reused_count += result.reused ? 1 : 0;
+			server_cpu_ns += result.server_cpu_ns;
+			client_cpu_ns += result.client_cpu_ns;
+
+			// The tickets of TLS 1.3 can be used only once
+			::SSL_SESSION_free(previous.session);
+			previous.session = result.session;
+		}
+
+		::SSL_SESSION_free(previous.session);
+		::SSL_CTX_free(client_context);
+
+		auto server_us = static_cast<double>(server_cpu_ns) / count / 1000.0;
+
+		::printf("%-12s %-8s %-11s server %8.1f us CPU %8.0f handshakes/s   client %8.1f us CPU   resumed %5.1f%%\n",
+				 certificate_name, (version == TLS1_3_VERSION) ? "TLS 1.3" : "TLS 1.2", ModeToString(mode),
+				 server_us, 1000000.0 / server_us, static_cast<double>(client_cpu_ns) / count / 1000.0,
+				 100.0 * reused_count / count);
+	}
+}  // namespace
+
+int main()
+{
+	ov_log_set_level(OVLogLevelWarning);
+
+	auto rsa_certificate = tls_loopback::GenerateRsaCertificate(2048);
+	auto ecdsa_certificate = std::make_shared<::Certificate>();
+
+	if ((rsa_certificate == nullptr) || (ecdsa_certificate->Generate() != nullptr))
+	{
+		::printf("Could not generate the certificates\n");
+		return 1;
+	}
+
+	for (auto &[name, certificate] : {std::make_pair("RSA-2048", rsa_certificate), std::make_pair("ECDSA P-256", ecdsa_certificate)})
+	{
+		for (auto version : {TLS1_2_VERSION, TLS1_3_VERSION})
+		{
+			if ((certificate == ecdsa_certificate) && (version == TLS1_2_VERSION))
+			{
+				// The cipher list of HttpsServer (AES128-SHA) has no cipher suite for an ECDSA key with TLS 1.2
+				::printf("%-12s %-8s (not supported by the cipher list of HttpsServer)\n", name, "TLS 1.2");
+				continue;
+			}
+
+			for (auto mode : {Mode::Full, Mode::Ticket, Mode::SessionId})
+			{
+				Run(name, certificate, version, mode);
+			}
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,134 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <transcoder/transcoder_context.h>
+
+#include <cstdio>
+#include <cstring>
+
+#include "common/bench.h"
+
+// Measures the memory bandwidth that the transcoder saves by sharing a decoded video frame read-only with the filters
+// of the renditions of an encoding ladder (MediaFrame::CloneFrame()), instead of copying it for each of them as before.
+// The copy of the old CloneFrame(true) is done with MakeWritable(), which allocates and copies the data the same way.
+// For each ladder, the CPU time to fan out one decoded frame to the renditions and the bytes copied per second
+// of a 30 fps stream are reported.
+//
+// UNVERIFIED: this benchmark has not been built or run yet, since FFmpeg was not available where it was written, so no
+// numbers have been recorded and it may need fixes to compile. The MediaFrame changes it measures were not built either.
+namespace
+{
+	constexpr double MinDurationSec = 1.0;
+	constexpr int FrameRate = 30;
+
+	struct Ladder
+	{
+		const char *name;
+		int width;
+		int height;
+		int rendition_count;
+	};
+
+	std::shared_ptr<MediaFrame> MakeDecodedFrame(int width, int height)
+	{
+		auto av_frame = ::av_frame_alloc();
+
+		av_frame->format = AV_PIX_FMT_YUV420P;
+		av_frame->width = width;
+		av_frame->height = height;
+
+		if (::av_frame_get_buffer(av_frame, 0) < 0)
+		{
+			::av_frame_free(&av_frame);
+			return nullptr;
+		}
+
+		for (int plane = 0; plane < 3; plane++)
+		{
+			auto plane_height = (plane == 0) ? height : ((height + 1) / 2);
+			::memset(av_frame->data[plane], 0x80, av_frame->linesize[plane] * plane_height);
+		}
+
+		auto frame = std::make_shared<MediaFrame>();
+		frame->SetMediaType(cmn::MediaType::Video);
+		frame->SetWidth(width);
+		frame->SetHeight(height);
+		frame->SetFormat(AV_PIX_FMT_YUV420P);
+		frame->SetPrivData(av_frame);
+
+		return frame;
+	}
+
+	struct Result
+	{
+		double fan_out_us = 0.0;
+		double copied_bytes_per_frame = 0.0;
+	};
+
+	Result Run(const std::shared_ptr<MediaFrame> &frame, int rendition_count, bool copy)
+	{
+		int64_t frame_count = 0;
+		uint64_t copied_bytes = 0;
+
+		bench::Stopwatch watch;
+		while (watch.ElapsedSec() < MinDurationSec)
+		{
+			for (int rendition = 0; rendition < rendition_count; rendition++)
+			{
+				auto clone_frame = frame->CloneFrame();
+
+				if (copy)
+				{
+					size_t bytes = 0;
+					clone_frame->MakeWritable(&bytes);
+					copied_bytes += bytes;
+				}
+
+				bench::DoNotOptimize(clone_frame);
+			}
+
+			frame_count++;
+		}
+
+		Result result;
+		result.fan_out_us = watch.ElapsedSec() * 1000000.0 / frame_count;
+		result.copied_bytes_per_frame = static_cast<double>(copied_bytes) / frame_count;
+
+		return result;
+	}
+}  // namespace
+
+int main()
+{
+	const Ladder ladders[] = {
+		{"720p -> 720p, 360p", 1280, 720, 2},
+		{"1080p -> 1080p, 720p, 480p", 1920, 1080, 3},
+		{"1080p -> 5 renditions", 1920, 1080, 5},
+		{"2160p -> 2160p, 1080p, 720p, 480p", 3840, 2160, 4}};
+
+	for (const auto &ladder : ladders)
+	{
+		auto frame = MakeDecodedFrame(ladder.width, ladder.height);
+
+		if (frame == nullptr)
+		{
+			::printf("Could not allocate a %dx%d frame\n", ladder.width, ladder.height);
+			return 1;
+		}
+
+		auto before = Run(frame, ladder.rendition_count, true);
+		auto after = Run(frame, ladder.rendition_count, false);
+
+		auto saved_mb_per_sec = (before.copied_bytes_per_frame - after.copied_bytes_per_frame) * FrameRate / 1e6;
+
+		::printf("%-36s copy %8.1f us/frame, share %6.2f us/frame, %8.1f MB/s saved at %d fps\n",
+				 ladder.name, before.fan_out_us, after.fan_out_us, saved_mb_per_sec, FrameRate);
+	}
+
+	return 0;
+}
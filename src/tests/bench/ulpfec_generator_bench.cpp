@@ -0,0 +1,124 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <modules/rtp_rtcp/ulpfec_generator.h>
+
+#include <cstdio>
+#include <random>
+
+#include "common/bench.h"
+#include "common/ulpfec_reference.h"
+
+// Measures the media packets per second that UlpfecGenerator protects, like a WebRTC session with ULPFEC:
+// every RED packet is added, and the FEC packets are taken at the end of the frame.
+// - 720p video: frames of 8 packets of 1,200 bytes (about 2.3 Mbps at 30 fps) and keyframes of 60 packets
+// - audio: one packet of 160 bytes per frame
+// The generator of common/ulpfec_reference.h (a deep copy per packet, XOR byte by byte) is measured as the baseline.
+namespace
+{
+	constexpr double MinDurationSec = 1.0;
+
+	struct Workload
+	{
+		const char *name;
+		std::vector<std::vector<std::shared_ptr<RedRtpPacket>>> frames;
+		size_t packet_count = 0;
+	};
+
+	Workload MakeWorkload(const char *name, const std::vector<std::pair<size_t, size_t>> &frame_sizes)
+	{
+		Workload workload;
+		workload.name = name;
+
+		std::mt19937 random(1);
+		uint16_t sequence_number = 0;
+		uint32_t timestamp = 0;
+
+		for (auto [packet_count, payload_size] : frame_sizes)
+		{
+			std::vector<std::shared_ptr<RedRtpPacket>> frame;
+
+			for (size_t index = 0; index < packet_count; index++)
+			{
+				auto packet = std::make_shared<RedRtpPacket>();
+				packet->SetSsrc(0x12345678);
+				packet->SetPayloadType(100);
+				packet->SetSequenceNumber(sequence_number++);
+				packet->SetTimestamp(timestamp);
+				packet->SetMarker(index == (packet_count - 1));
+
+				auto payload = packet->AllocatePayload(payload_size);
+				for (size_t offset = 0; offset < payload_size; offset++)
+				{
+					payload[offset] = static_cast<uint8_t>(random());
+				}
+
+				packet->PackageAsRed(96);
+				frame.push_back(packet);
+			}
+
+			timestamp += 3000;
+			workload.packet_count += packet_count;
+			workload.frames.push_back(std::move(frame));
+		}
+
+		return workload;
+	}
+
+	template <typename Generator>
+	void Run(const Workload &workload, const char *implementation)
+	{
+		Generator generator;
+		RtpPacket fec_packet;
+		size_t packet_count = 0;
+
+		bench::Stopwatch watch;
+		while (watch.ElapsedSec() < MinDurationSec)
+		{
+			for (const auto &frame : workload.frames)
+			{
+				for (const auto &packet : frame)
+				{
+					generator.AddRtpPacketAndGenerateFec(packet);
+				}
+
+				while (generator.NextPacket(&fec_packet))
+				{
+					bench::DoNotOptimize(fec_packet);
+				}
+			}
+
+			packet_count += workload.packet_count;
+		}
+
+		char label[64];
+		::snprintf(label, sizeof(label), "%s, %s", workload.name, implementation);
+		::printf("%-48s %12.0f packets/s\n", label, static_cast<double>(packet_count) / watch.ElapsedSec());
+	}
+}  // namespace
+
+int main()
+{
+	std::vector<std::pair<size_t, size_t>> video_frames;
+	for (int index = 0; index < 30; index++)
+	{
+		video_frames.emplace_back((index == 0) ? 60 : 8, 1200);
+	}
+
+	std::vector<std::pair<size_t, size_t>> audio_frames(50, {1, 160});
+
+	::printf("XOR: %s\n", UlpfecXor::GetImplementationName());
+
+	for (const auto &workload : {MakeWorkload("video 720p", video_frames), MakeWorkload("audio", audio_frames)})
+	{
+		Run<UlpfecGenerator>(workload, "UlpfecGenerator");
+		Run<ulpfec::Reference>(workload, "copy and byte XOR");
+	}
+
+	return 0;
+}
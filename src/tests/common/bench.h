@@ -0,0 +1,171 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// Helpers shared by the micro benchmarks in bench/
+namespace bench
+{
+	using Clock = std::chrono::steady_clock;
+
+	class Stopwatch
+	{
+	public:
+		Stopwatch()
+		{
+			Restart();
+		}
+
+		void Restart()
+		{
+			_start = Clock::now();
+			_cpu_start = CpuTimeUs();
+		}
+
+		double ElapsedSec() const
+		{
+			return std::chrono::duration<double>(Clock::now() - _start).count();
+		}
+
+		int64_t ElapsedUs() const
+		{
+			return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - _start).count();
+		}
+
+		// Process CPU time (user + system) consumed since Restart()
+		int64_t CpuUs() const
+		{
+			return CpuTimeUs() - _cpu_start;
+		}
+
+		static int64_t CpuTimeUs()
+		{
+			struct rusage usage;
+			::getrusage(RUSAGE_SELF, &usage);
+
+			return (static_cast<int64_t>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000) +
+				   usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+		}
+
+	private:
+		Clock::time_point _start;
+		int64_t _cpu_start = 0;
+	};
+
+	// Collects samples and reports percentiles
+	class Samples
+	{
+	public:
+		void Reserve(size_t count)
+		{
+			_values.reserve(count);
+		}
+
+		void Add(double value)
+		{
+			_values.push_back(value);
+			_sorted = false;
+		}
+
+		size_t Count() const
+		{
+			return _values.size();
+		}
+
+		double Percentile(double percent)
+		{
+			if (_values.empty())
+			{
+				return 0.0;
+			}
+
+			Sort();
+
+			auto index = static_cast<size_t>((percent / 100.0) * static_cast<double>(_values.size() - 1) + 0.5);
+			return _values[std::min(index, _values.size() - 1)];
+		}
+
+		double Max()
+		{
+			return Percentile(100.0);
+		}
+
+		double Mean() const
+		{
+			if (_values.empty())
+			{
+				return 0.0;
+			}
+
+			double sum = 0.0;
+			for (auto value : _values)
+			{
+				sum += value;
+			}
+
+			return sum / static_cast<double>(_values.size());
+		}
+
+		void Print(const char *label, const char *unit)
+		{
+			::printf("%-40s n=%-8zu mean=%10.2f p50=%10.2f p99=%10.2f max=%10.2f (%s)\n",
+					 label, Count(), Mean(), Percentile(50.0), Percentile(99.0), Max(), unit);
+		}
+
+	private:
+		void Sort()
+		{
+			if (_sorted == false)
+			{
+				std::sort(_values.begin(), _values.end());
+				_sorted = true;
+			}
+		}
+
+		std::vector<double> _values;
+		bool _sorted = true;
+	};
+
+	// Resident set size of this process in KB (from /proc/self/statm)
+	inline int64_t ResidentKb()
+	{
+		auto file = ::fopen("/proc/self/statm", "r");
+
+		if (file == nullptr)
+		{
+			return 0;
+		}
+
+		long total = 0;
+		long resident = 0;
+		if (::fscanf(file, "%ld %ld", &total, &resident) != 2)
+		{
+			resident = 0;
+		}
+		::fclose(file);
+
+		return static_cast<int64_t>(resident) * (::sysconf(_SC_PAGESIZE) / 1024);
+	}
+
+	// Keeps the optimizer from discarding a computed value
+	template <typename T>
+	inline void DoNotOptimize(const T &value)
+	{
+		asm volatile("" : : "r,m"(value) : "memory");
+	}
+}  // namespace bench
@@ -0,0 +1,191 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <modules/rtp_rtcp/rtp_bandwidth_estimator.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <random>
+#include <vector>
+
+// Closes the loop of RtpBandwidthEstimator over a simulated bottleneck link.
+//
+// The sender sends 30 frames per second at the target bitrate (1200 byte packets of a frame are sent at once),
+// the link serializes them at its capacity behind a drop-tail queue, and the receiver sends transport-cc feedback
+// of the packets that arrived (or were lost) every FeedbackIntervalMs.
+namespace bwe
+{
+	struct LinkPhase
+	{
+		// The phase starts at this time
+		int64_t start_ms;
+		uint64_t capacity_bps;
+		double random_loss_ratio;
+	};
+
+	struct TimelinePoint
+	{
+		int64_t now_ms;
+		uint64_t target_bitrate;
+		uint64_t capacity_bps;
+		int64_t queue_delay_ms;
+	};
+
+	class LinkSimulator
+	{
+	public:
+		static constexpr int64_t FrameIntervalUs = 33333;
+		static constexpr size_t PacketSize = 1200;
+		static constexpr int64_t PropagationDelayUs = 20000;
+		static constexpr int64_t MaxQueueDelayUs = 300000;
+		static constexpr int64_t FeedbackIntervalMs = 50;
+		// The bitrate the sender starts with, until the estimator has an estimate
+		static constexpr uint64_t StartBitrate = 300 * 1000;
+
+		LinkSimulator(std::vector<LinkPhase> phases, uint32_t seed = 1)
+			: _phases(std::move(phases)),
+			  _random(seed)
+		{
+		}
+
+		// Called with every feedback passed to the estimator (e.g. to record the feedback)
+		std::function<void(const std::vector<RtpBandwidthEstimator::PacketResult> &, int64_t)> on_feedback;
+
+		// Runs until `duration_ms` and returns the target bitrate after each feedback
+		std::vector<TimelinePoint> Run(RtpBandwidthEstimator &estimator, int64_t duration_ms)
+		{
+			std::vector<TimelinePoint> timeline;
+
+			int64_t next_frame_us = 0;
+			int64_t next_feedback_ms = FeedbackIntervalMs;
+
+			for (int64_t now_us = 0; now_us <= duration_ms * 1000; now_us += 1000)
+			{
+				const auto &phase = GetPhase(now_us / 1000);
+
+				while (next_frame_us <= now_us)
+				{
+					SendFrame(next_frame_us, estimator.GetTargetBitrate(), phase);
+					next_frame_us += FrameIntervalUs;
+				}
+
+				if (now_us / 1000 >= next_feedback_ms)
+				{
+					auto now_ms = now_us / 1000;
+					auto packet_results = CollectFeedback(now_us);
+
+					if (packet_results.empty() == false)
+					{
+						if (on_feedback != nullptr)
+						{
+							on_feedback(packet_results, now_ms);
+						}
+
+						estimator.OnTransportFeedback(packet_results, now_ms);
+					}
+
+					timeline.push_back({now_ms, estimator.GetTargetBitrate(), phase.capacity_bps, std::max<int64_t>(_link_free_us - now_us, 0) / 1000});
+					next_feedback_ms += FeedbackIntervalMs;
+				}
+			}
+
+			return timeline;
+		}
+
+	private:
+		const LinkPhase &GetPhase(int64_t now_ms) const
+		{
+			auto phase = _phases.begin();
+			for (auto it = _phases.begin(); it != _phases.end(); ++it)
+			{
+				if (it->start_ms <= now_ms)
+				{
+					phase = it;
+				}
+			}
+			return *phase;
+		}
+
+		void SendFrame(int64_t send_time_us, uint64_t target_bitrate, const LinkPhase &phase)
+		{
+			auto bitrate = (target_bitrate > 0) ? target_bitrate : StartBitrate;
+			auto frame_bytes = static_cast<size_t>(bitrate * FrameIntervalUs / 8 / 1000000);
+			auto packet_count = std::max<size_t>(1, (frame_bytes + PacketSize - 1) / PacketSize);
+
+			std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+			for (size_t index = 0; index < packet_count; index++)
+			{
+				RtpBandwidthEstimator::PacketResult packet;
+				packet.send_time_us = send_time_us;
+				packet.size = PacketSize;
+
+				auto start_us = std::max(send_time_us, _link_free_us);
+				auto dropped = (start_us - send_time_us) > MaxQueueDelayUs;
+
+				if (dropped == false)
+				{
+					_link_free_us = start_us + static_cast<int64_t>(PacketSize * 8 * 1000000 / phase.capacity_bps);
+				}
+
+				if ((dropped == false) && (uniform(_random) >= phase.random_loss_ratio))
+				{
+					packet.arrival_time_us = _link_free_us + PropagationDelayUs;
+				}
+
+				// Reported when the packet would have arrived
+				_in_flight.push_back({packet, (dropped ? send_time_us : _link_free_us) + PropagationDelayUs});
+			}
+		}
+
+		std::vector<RtpBandwidthEstimator::PacketResult> CollectFeedback(int64_t now_us)
+		{
+			std::vector<RtpBandwidthEstimator::PacketResult> packet_results;
+
+			// Packets are reported in the order they were sent
+			while ((_in_flight.empty() == false) && (_in_flight.front().report_time_us <= now_us))
+			{
+				packet_results.push_back(_in_flight.front().packet);
+				_in_flight.pop_front();
+			}
+
+			return packet_results;
+		}
+
+		struct InFlightPacket
+		{
+			RtpBandwidthEstimator::PacketResult packet;
+			int64_t report_time_us;
+		};
+
+		std::vector<LinkPhase> _phases;
+		std::mt19937 _random;
+
+		int64_t _link_free_us = 0;
+		std::deque<InFlightPacket> _in_flight;
+	};
+
+	// Average target bitrate of the timeline points within [from_ms, to_ms)
+	inline uint64_t AverageTarget(const std::vector<TimelinePoint> &timeline, int64_t from_ms, int64_t to_ms)
+	{
+		uint64_t sum = 0, count = 0;
+		for (const auto &point : timeline)
+		{
+			if ((point.now_ms >= from_ms) && (point.now_ms < to_ms))
+			{
+				sum += point.target_bitrate;
+				count++;
+			}
+		}
+		return (count > 0) ? (sum / count) : 0;
+	}
+}  // namespace bwe
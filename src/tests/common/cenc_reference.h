@@ -0,0 +1,140 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovcrypto/aes.h>
+#include <modules/containers/bmff/sample.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// A literal implementation of ISO/IEC 23001-7 that encrypts one block at a time with AES-128-ECB,
+// like bmff::Encryptor did before it kept a cipher context per track. The tests compare the encryptor with it,
+// and the benchmark uses it as the baseline.
+namespace cenc
+{
+	constexpr size_t BlockSize = 16;
+
+	class Reference
+	{
+	public:
+		Reference(const uint8_t *key, const uint8_t *iv)
+		{
+			::memcpy(_key, key, BlockSize);
+			::memcpy(_iv, iv, BlockSize);
+		}
+
+		const uint8_t *GetIv() const
+		{
+			return _iv;
+		}
+
+		// 'cenc': AES-CTR over the protected bytes of the sample, then the IV of the next sample is the IV plus the number of the cipher blocks
+		std::vector<uint8_t> EncryptCtr(const std::vector<uint8_t> &clear, const std::vector<bmff::Sample::SubSample> &sub_samples)
+		{
+			std::vector<uint8_t> cipher = clear;
+			uint8_t counter[BlockSize];
+			uint8_t keystream[BlockSize];
+			size_t block_offset = 0;
+			uint64_t block_count = 0;
+
+			::memcpy(counter, _iv, BlockSize);
+
+			ForEachProtectedRange(clear.size(), sub_samples, [&](size_t offset, size_t length) {
+				for (size_t index = offset; index < offset + length; index++)
+				{
+					if (block_offset == 0)
+					{
+						ov::AES::EncryptWith128Ecb(counter, BlockSize, keystream, _key, BlockSize);
+
+						// Only bytes 8 to 15 are incremented, as a 64-bit counter that wraps around
+						for (int byte = BlockSize - 1; (byte >= 8) && (++counter[byte] == 0); byte--)
+						{
+						}
+
+						block_count++;
+					}
+
+					cipher[index] ^= keystream[block_offset];
+					block_offset = (block_offset + 1) % BlockSize;
+				}
+			});
+
+			// The IV is incremented as a 128-bit number
+			for (int byte = BlockSize - 1; (byte >= 0) && (block_count > 0); byte--)
+			{
+				block_count += _iv[byte];
+				_iv[byte] = block_count & 0xFF;
+				block_count >>= 8;
+			}
+
+			return cipher;
+		}
+
+		// 'cbcs': AES-CBC with the constant IV, restarted for every protected range.
+		// With a pattern, the first `crypt_blocks` of every `crypt_blocks + skip_blocks` blocks are encrypted,
+		// and the blocks that are not full are left in clear.
+		std::vector<uint8_t> EncryptCbcs(const std::vector<uint8_t> &clear, const std::vector<bmff::Sample::SubSample> &sub_samples, size_t crypt_blocks, size_t skip_blocks)
+		{
+			std::vector<uint8_t> cipher = clear;
+
+			ForEachProtectedRange(clear.size(), sub_samples, [&](size_t offset, size_t length) {
+				uint8_t chain[BlockSize];
+				::memcpy(chain, _iv, BlockSize);
+
+				size_t block_index = 0;
+				for (size_t position = offset; position + BlockSize <= offset + length; position += BlockSize, block_index++)
+				{
+					if ((skip_blocks > 0) && ((block_index % (crypt_blocks + skip_blocks)) >= crypt_blocks))
+					{
+						continue;
+					}
+
+					for (size_t byte = 0; byte < BlockSize; byte++)
+					{
+						chain[byte] ^= clear[position + byte];
+					}
+
+					ov::AES::EncryptWith128Ecb(chain, BlockSize, chain, _key, BlockSize);
+					::memcpy(&cipher[position], chain, BlockSize);
+				}
+			});
+
+			return cipher;
+		}
+
+	private:
+		template <typename Function>
+		static void ForEachProtectedRange(size_t size, const std::vector<bmff::Sample::SubSample> &sub_samples, Function function)
+		{
+			if (sub_samples.empty())
+			{
+				function(0, size);
+				return;
+			}
+
+			size_t offset = 0;
+			for (const auto &sub_sample : sub_samples)
+			{
+				offset += sub_sample.clear_bytes;
+
+				if (sub_sample.cipher_bytes > 0)
+				{
+					function(offset, sub_sample.cipher_bytes);
+				}
+
+				offset += sub_sample.cipher_bytes;
+			}
+		}
+
+		uint8_t _key[BlockSize];
+		uint8_t _iv[BlockSize];
+	};
+}  // namespace cenc
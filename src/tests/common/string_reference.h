@@ -0,0 +1,324 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// A copy of the parts of ov::String that the playlist builders use, as it was before the strings were stored inline
+// and formatted in a single pass: every string is on the heap, the capacity grows to a power of two (+1 MB above 1 MB)
+// and every new buffer is zeroed, and AppendVFormat()/VFormat() run vsnprintf twice.
+// The benchmark uses it as the baseline.
+namespace string_reference
+{
+	class String
+	{
+	public:
+		String() = default;
+
+		String(const char *string)	// NOLINT
+		{
+			Append(string);
+		}
+
+		String(const char *string, size_t length)
+		{
+			Append(string, length);
+		}
+
+		String(uint32_t capacity)
+		{
+			SetCapacity(capacity);
+		}
+
+		String(const String &string)
+			: String(string._buffer, string.GetLength())
+		{
+		}
+
+		String(String &&string) noexcept
+			: _buffer(string._buffer),
+			  _length(string._length),
+			  _capacity(string._capacity)
+		{
+			string._buffer = nullptr;
+			string._length = 0;
+			string._capacity = 0;
+		}
+
+		~String()
+		{
+			Release();
+		}
+
+		operator const char *() const noexcept	// NOLINT
+		{
+			return CStr();
+		}
+
+		const char *CStr() const noexcept
+		{
+			if (_buffer == nullptr)
+			{
+				return "";
+			}
+
+			return _buffer;
+		}
+
+		String &operator=(const String &buffer) noexcept
+		{
+			if (this == &buffer)
+			{
+				return *this;
+			}
+
+			if (_buffer != nullptr)
+			{
+				_length = 0;
+				_buffer[0] = '\0';
+			}
+
+			Append(buffer._buffer);
+
+			return *this;
+		}
+
+		bool Append(char c)
+		{
+			if (Alloc(_length + 1) == false)
+			{
+				return false;
+			}
+
+			_buffer[_length] = c;
+			_length++;
+
+			_buffer[_length] = '\0';
+
+			return true;
+		}
+
+		bool Append(const char *string)
+		{
+			if (string == nullptr)
+			{
+				return false;
+			}
+
+			return Append(string, ::strlen(string));
+		}
+
+		bool Append(const char *string, size_t length)
+		{
+			if (string == nullptr)
+			{
+				return false;
+			}
+
+			if (length == 0)
+			{
+				return true;
+			}
+
+			if (Alloc(_length + length) == false)
+			{
+				return false;
+			}
+
+			if (_buffer != nullptr)
+			{
+				::memcpy(_buffer + _length, string, sizeof(char) * length);
+			}
+
+			_length += length;
+
+			if (_buffer != nullptr)
+			{
+				_buffer[_length] = '\0';
+			}
+
+			return true;
+		}
+
+		size_t AppendFormat(const char *format, ...)
+		{
+			va_list list;
+			size_t appended_length;
+
+			va_start(list, format);
+
+			appended_length = AppendVFormat(format, list);
+
+			va_end(list);
+
+			return appended_length;
+		}
+
+		size_t AppendVFormat(const char *format, va_list list)
+		{
+			va_list list_for_count;
+
+			va_copy(list_for_count, list);
+
+			int result = ::vsnprintf(nullptr, 0, format, list_for_count);
+
+			if (result < 0)
+			{
+				return 0L;
+			}
+
+			size_t length = static_cast<size_t>(result);
+
+			if (Alloc(_length + length) == false)
+			{
+				return 0;
+			}
+
+			if (_buffer != nullptr)
+			{
+				::vsnprintf(_buffer + _length, length + 1, format, list);
+				_length += length;
+			}
+
+			if (_buffer != nullptr)
+			{
+				_buffer[_length] = '\0';
+			}
+
+			return length;
+		}
+
+		size_t VFormat(const char *format, va_list list)
+		{
+			va_list list_for_count;
+
+			va_copy(list_for_count, list);
+
+			int result = ::vsnprintf(nullptr, 0, format, list);
+
+			if (result <= 0L)
+			{
+				return 0L;
+			}
+
+			size_t length = static_cast<size_t>(result);
+
+			if (Alloc(length))
+			{
+				va_copy(list, list_for_count);
+
+				::vsnprintf(_buffer, length + 1, format, list);
+				_length = length;
+			}
+
+			return _length;
+		}
+
+		static String FormatString(const char *format, ...)
+		{
+			va_list list;
+			String buffer;
+
+			va_start(list, format);
+
+			buffer.VFormat(format, list);
+
+			va_end(list);
+
+			return buffer;
+		}
+
+		bool SetCapacity(size_t length) noexcept
+		{
+			return Alloc(length, true);
+		}
+
+		size_t GetLength() const noexcept
+		{
+			return _length;
+		}
+
+		bool IsEmpty() const noexcept
+		{
+			return _length == 0;
+		}
+
+	private:
+		bool Alloc(size_t length, bool alloc_exactly = false) noexcept
+		{
+			if ((_capacity < length) || (alloc_exactly && (_capacity != length)))
+			{
+				size_t allocated_length = length;
+
+				if (alloc_exactly == false)
+				{
+					allocated_length = 1L;
+
+					while (allocated_length < length)
+					{
+						if (allocated_length >= 1024L * 1024L)
+						{
+							allocated_length += 1024L * 1024L;
+						}
+						else
+						{
+							allocated_length *= 2L;
+						}
+					}
+				}
+
+				char *buffer = static_cast<char *>(::malloc(sizeof(char) * (allocated_length + 1L)));
+
+				if (buffer == nullptr)
+				{
+					return false;
+				}
+
+				::memset(buffer, 0, sizeof(char) * (allocated_length + 1L));
+
+				if (_length > 0L)
+				{
+					::memcpy(buffer, _buffer, sizeof(char) * std::min(allocated_length, _length));
+				}
+
+				size_t old_length = _length;
+
+				Release();
+
+				_capacity = allocated_length;
+				_buffer = buffer;
+				_length = old_length;
+			}
+
+			return true;
+		}
+
+		bool Release() noexcept
+		{
+			if (_buffer != nullptr)
+			{
+				::free(_buffer);
+				_buffer = nullptr;
+			}
+
+			_capacity = 0L;
+			_length = 0L;
+
+			return true;
+		}
+
+		char *_buffer = nullptr;
+		size_t _length = 0;
+		size_t _capacity = 0;
+	};
+}  // namespace string_reference
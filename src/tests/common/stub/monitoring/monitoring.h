@@ -0,0 +1,69 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+// Replaces <monitoring/monitoring.h> for the targets that are built with -Icommon/stub,
+// so that the modules reporting to the monitoring can be tested without the whole server.
+// Only the members that those modules use are provided.
+#include <atomic>
+#include <memory>
+
+#include "base/info/managed_queue.h"
+
+#define MonitorInstance mon::Monitoring::GetInstance()
+
+namespace mon
+{
+	class ServerMetrics
+	{
+	public:
+		bool OnQueueCreated(const info::ManagedQueue &queue_info)
+		{
+			_queue_count++;
+			return true;
+		}
+
+		bool OnQueueDeleted(const info::ManagedQueue &queue_info)
+		{
+			_queue_count--;
+			return true;
+		}
+
+		bool OnQueueUpdated(const info::ManagedQueue &queue_info, bool with_metadata = false)
+		{
+			return true;
+		}
+
+		int GetQueueCount() const
+		{
+			return _queue_count;
+		}
+
+	private:
+		std::atomic<int> _queue_count{0};
+	};
+
+	class Monitoring
+	{
+	public:
+		static Monitoring *GetInstance()
+		{
+			static Monitoring monitor;
+			return &monitor;
+		}
+
+		std::shared_ptr<ServerMetrics> GetServerMetrics()
+		{
+			return _server_metric;
+		}
+
+	private:
+		std::shared_ptr<ServerMetrics> _server_metric = std::make_shared<ServerMetrics>();
+	};
+}  // namespace mon
@@ -0,0 +1,163 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// A tiny self-registering test runner so that the tests only need the OME
+// sources they exercise and no third party test framework.
+//
+//   TEST(DelayQueue, RepeatKeepsPeriod)
+//   {
+//       EXPECT_EQ(1, 1);
+//   }
+namespace test
+{
+	struct TestCase
+	{
+		const char *suite;
+		const char *name;
+		std::function<void()> body;
+	};
+
+	inline std::vector<TestCase> &Registry()
+	{
+		static std::vector<TestCase> registry;
+		return registry;
+	}
+
+	inline int &FailureCount()
+	{
+		static int count = 0;
+		return count;
+	}
+
+	struct Registrar
+	{
+		Registrar(const char *suite, const char *name, std::function<void()> body)
+		{
+			Registry().push_back({suite, name, std::move(body)});
+		}
+	};
+
+	inline void ReportFailure(const char *file, int line, const std::string &message)
+	{
+		FailureCount()++;
+		::fprintf(stderr, "%s:%d: FAILED: %s\n", file, line, message.c_str());
+	}
+
+	template <typename T>
+	inline std::string ToString(const T &value)
+	{
+		if constexpr (std::is_arithmetic_v<T>)
+		{
+			return std::to_string(value);
+		}
+		else if constexpr (std::is_convertible_v<T, std::string>)
+		{
+			return std::string(value);
+		}
+		else
+		{
+			return "<value>";
+		}
+	}
+
+	// Runs every registered test (or those whose "Suite.Name" contains `filter`)
+	inline int RunAll(int argc, char *argv[])
+	{
+		const char *filter = (argc > 1) ? argv[1] : nullptr;
+		int run = 0;
+		int failed = 0;
+
+		for (auto &test_case : Registry())
+		{
+			std::string full_name = std::string(test_case.suite) + "." + test_case.name;
+
+			if ((filter != nullptr) && (full_name.find(filter) == std::string::npos))
+			{
+				continue;
+			}
+
+			::fprintf(stderr, "[ RUN      ] %s\n", full_name.c_str());
+
+			int failures_before = FailureCount();
+			test_case.body();
+			run++;
+
+			if (FailureCount() != failures_before)
+			{
+				failed++;
+				::fprintf(stderr, "[  FAILED  ] %s\n", full_name.c_str());
+			}
+			else
+			{
+				::fprintf(stderr, "[       OK ] %s\n", full_name.c_str());
+			}
+		}
+
+		::fprintf(stderr, "%d test(s) run, %d failed\n", run, failed);
+
+		return (failed == 0) ? 0 : 1;
+	}
+}  // namespace test
+
+#define TEST(suite, name)                                                          \
+	static void suite##_##name##_Test();                                           \
+	static ::test::Registrar suite##_##name##_registrar(#suite, #name, suite##_##name##_Test); \
+	static void suite##_##name##_Test()
+
+#define EXPECT_TRUE(condition)                                                \
+	do                                                                        \
+	{                                                                         \
+		if ((condition) == false)                                             \
+		{                                                                     \
+			::test::ReportFailure(__FILE__, __LINE__, "EXPECT_TRUE(" #condition ")"); \
+		}                                                                     \
+	} while (false)
+
+#define EXPECT_FALSE(condition) EXPECT_TRUE((condition) == false)
+
+#define EXPECT_EQ(expected, actual)                                                                          \
+	do                                                                                                       \
+	{                                                                                                        \
+		const auto &expected_value = (expected);                                                             \
+		const auto &actual_value = (actual);                                                                 \
+		if ((expected_value == actual_value) == false)                                                       \
+		{                                                                                                    \
+			::test::ReportFailure(__FILE__, __LINE__,                                                        \
+								  "EXPECT_EQ(" #expected ", " #actual "): expected " +                     \
+									  ::test::ToString(expected_value) + ", actual " + ::test::ToString(actual_value)); \
+		}                                                                                                    \
+	} while (false)
+
+#define EXPECT_LE(bound, actual) EXPECT_TRUE((bound) <= (actual))
+#define EXPECT_GE(bound, actual) EXPECT_TRUE((bound) >= (actual))
+
+// Stops the current test on failure
+#define ASSERT_TRUE(condition)                                                \
+	do                                                                        \
+	{                                                                         \
+		if ((condition) == false)                                             \
+		{                                                                     \
+			::test::ReportFailure(__FILE__, __LINE__, "ASSERT_TRUE(" #condition ")"); \
+			return;                                                           \
+		}                                                                     \
+	} while (false)
+
+#define TEST_MAIN()                             \
+	int main(int argc, char *argv[])            \
+	{                                           \
+		return ::test::RunAll(argc, argv);      \
+	}
@@ -0,0 +1,170 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovcrypto/ovcrypto.h>
+#include <openssl/pem.h>
+#include <openssl/ssl.h>
+#include <openssl/x509.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+// TLS handshakes between an OpenSSL client and a server SSL_CTX of OvenMediaEngine, connected with a BIO pair in memory.
+// The CPU time of the client and the server are measured separately.
+namespace tls_loopback
+{
+	struct Result
+	{
+		bool connected = false;
+		bool reused = false;
+		int64_t server_cpu_ns = 0;
+		int64_t client_cpu_ns = 0;
+		// The session of the client to resume the next handshake with (must be freed with SSL_SESSION_free())
+		SSL_SESSION *session = nullptr;
+	};
+
+	inline int64_t ThreadCpuNs()
+	{
+		struct timespec now;
+		::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+		return static_cast<int64_t>(now.tv_sec) * 1000000000 + now.tv_nsec;
+	}
+
+	// `version`: TLS1_2_VERSION or TLS1_3_VERSION
+	inline SSL_CTX *CreateClientContext(int version)
+	{
+		auto context = ::SSL_CTX_new(::TLS_client_method());
+
+		::SSL_CTX_set_min_proto_version(context, version);
+		::SSL_CTX_set_max_proto_version(context, version);
+		::SSL_CTX_set_verify(context, SSL_VERIFY_NONE, nullptr);
+
+		return context;
+	}
+
+	// `session` is the session of the previous handshake to resume, or nullptr for a full handshake
+	inline Result Handshake(SSL_CTX *server_context, SSL_CTX *client_context, SSL_SESSION *session)
+	{
+		Result result;
+
+		auto server = ::SSL_new(server_context);
+		auto client = ::SSL_new(client_context);
+
+		BIO *server_bio = nullptr;
+		BIO *client_bio = nullptr;
+		::BIO_new_bio_pair(&server_bio, 0, &client_bio, 0);
+
+		::SSL_set_bio(server, server_bio, server_bio);
+		::SSL_set_bio(client, client_bio, client_bio);
+		::SSL_set_accept_state(server);
+		::SSL_set_connect_state(client);
+
+		if (session != nullptr)
+		{
+			::SSL_set_session(client, session);
+		}
+
+		bool server_done = false;
+		bool client_done = false;
+
+		for (int round = 0; (round < 10) && ((server_done && client_done) == false); round++)
+		{
+			auto start = ThreadCpuNs();
+			client_done = client_done || (::SSL_do_handshake(client) == 1);
+			result.client_cpu_ns += ThreadCpuNs() - start;
+
+			start = ThreadCpuNs();
+			server_done = server_done || (::SSL_do_handshake(server) == 1);
+			result.server_cpu_ns += ThreadCpuNs() - start;
+		}
+
+		// With TLS 1.3, the tickets are sent after the handshake
+		auto start = ThreadCpuNs();
+		char byte;
+		::SSL_read(client, &byte, 1);
+		result.client_cpu_ns += ThreadCpuNs() - start;
+
+		result.connected = server_done && client_done;
+		result.reused = (::SSL_session_reused(client) == 1);
+		result.session = ::SSL_get1_session(client);
+
+		// Without close_notify, OpenSSL marks the session as not resumable and removes it from the cache of the server
+		if (result.connected)
+		{
+			::SSL_shutdown(client);
+			::SSL_shutdown(server);
+		}
+
+		::SSL_free(client);
+		::SSL_free(server);
+
+		return result;
+	}
+
+	// A self-signed certificate with an RSA key of `bits`, loaded from PEM files like the certificates of the HTTPS ports
+	inline std::shared_ptr<::Certificate> GenerateRsaCertificate(int bits)
+	{
+		auto key = ::EVP_RSA_gen(bits);
+		auto x509 = ::X509_new();
+
+		::ASN1_INTEGER_set(::X509_get_serialNumber(x509), 1);
+		::X509_gmtime_adj(X509_getm_notBefore(x509), 0);
+		::X509_gmtime_adj(X509_getm_notAfter(x509), 60 * 60 * 24);
+		::X509_set_pubkey(x509, key);
+		::X509_NAME_add_entry_by_txt(::X509_get_subject_name(x509), "CN", MBSTRING_ASC, reinterpret_cast<const unsigned char *>("localhost"), -1, -1, 0);
+		::X509_set_issuer_name(x509, ::X509_get_subject_name(x509));
+		::X509_sign(x509, key, ::EVP_sha256());
+
+		char key_file[] = "/tmp/ome_tls_key.XXXXXX";
+		char cert_file[] = "/tmp/ome_tls_cert.XXXXXX";
+		::close(::mkstemp(key_file));
+		::close(::mkstemp(cert_file));
+
+		auto file = ::fopen(key_file, "w");
+		::PEM_write_PrivateKey(file, key, nullptr, nullptr, 0, nullptr, nullptr);
+		::fclose(file);
+
+		file = ::fopen(cert_file, "w");
+		::PEM_write_X509(file, x509);
+		::fclose(file);
+
+		auto certificate = std::make_shared<::Certificate>();
+		auto error = certificate->GenerateFromPem(key_file, cert_file, nullptr);
+
+		::unlink(key_file);
+		::unlink(cert_file);
+		::X509_free(x509);
+		::EVP_PKEY_free(key);
+
+		return (error == nullptr) ? certificate : nullptr;
+	}
+
+	// A server context like the one of an HTTPS port: TLS 1.2 only, or TLS 1.3 if HTTP/2 is enabled
+	inline std::shared_ptr<ov::TlsContext> CreateServerContext(const std::shared_ptr<::Certificate> &certificate, int version,
+															   const std::shared_ptr<ov::TlsSessionResumption> &session_resumption)
+	{
+		std::shared_ptr<const ov::Error> error;
+
+		// The cipher list of HttpsServer
+		auto context = ov::TlsContext::CreateServerContext(ov::TlsMethod::Tls, certificate, "AES128-SHA",
+														   version == TLS1_3_VERSION, false, nullptr, &error);
+
+		if ((context != nullptr) && (session_resumption != nullptr))
+		{
+			context->SetSessionResumption(session_resumption);
+		}
+
+		return context;
+	}
+}  // namespace tls_loopback
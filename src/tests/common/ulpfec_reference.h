@@ -0,0 +1,158 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/byte_io.h>
+#include <modules/rtp_rtcp/red_rtp_packet.h>
+
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <queue>
+#include <vector>
+
+// UlpfecGenerator as it was before it referenced the protected packets and XORed them with UlpfecXor:
+// every packet is deep-copied, the FEC packet grows with the payloads, and the payloads are XORed byte by byte.
+// The tests compare UlpfecGenerator with it, and the benchmark uses it as the baseline.
+// It sets the bit of every packet in the mask, so it is only defined for the packets that fit in the mask.
+namespace ulpfec
+{
+	constexpr size_t FecHeaderSize = 10;
+	constexpr size_t MaskSizeLbitClear = 2;
+	constexpr size_t MaskSizeLbitSet = 6;
+	constexpr size_t MaxMediaPacketsLbitClear = 16;
+	constexpr size_t MediaPacketNumMakeFec = 7;
+
+	class Reference
+	{
+	public:
+		bool AddRtpPacketAndGenerateFec(const std::shared_ptr<RedRtpPacket> &packet)
+		{
+			auto copy_packet = std::make_shared<RedRtpPacket>(*packet);
+			_media_packets.push_back(copy_packet);
+
+			if (copy_packet->Marker())
+			{
+				Encode();
+			}
+
+			return true;
+		}
+
+		bool IsAvailableFecPackets() const
+		{
+			return _generated_fec_packets.empty() == false;
+		}
+
+		bool NextPacket(RtpPacket *packet)
+		{
+			if (IsAvailableFecPackets() == false)
+			{
+				return false;
+			}
+
+			auto fec_packet = _generated_fec_packets.front();
+			_generated_fec_packets.pop();
+
+			return packet->SetPayload(fec_packet->GetDataAs<uint8_t>(), fec_packet->GetLength());
+		}
+
+	private:
+		static uint8_t GetMPtFields(RedRtpPacket *media_packet)
+		{
+			// The media packet is a RED packet, so the media payload type is in the RED header
+			uint8_t m_pt_fields = media_packet->Header()[media_packet->HeadersSize() - 1];
+			return media_packet->Marker() ? (m_pt_fields | 0x80) : (m_pt_fields & 0x7F);
+		}
+
+		void Encode()
+		{
+			size_t media_size = _media_packets.size();
+			uint32_t fec_packet_count = static_cast<uint32_t>(std::ceil(static_cast<float>(media_size) / static_cast<float>(MediaPacketNumMakeFec)));
+			size_t media_packet_index = 0;
+
+			size_t mask_len = (media_size <= MaxMediaPacketsLbitClear) ? MaskSizeLbitClear : MaskSizeLbitSet;
+			size_t fec_header_size = FecHeaderSize + 2 + mask_len;
+
+			for (uint32_t i = 0; i < fec_packet_count; i++)
+			{
+				auto fec_packet = std::make_shared<ov::Data>();
+				fec_packet->SetLength(fec_header_size);
+				auto fec_buffer = fec_packet->GetWritableDataAs<uint8_t>();
+
+				uint8_t mask[MaskSizeLbitSet] = {};
+				uint16_t sn_base = 0;
+				size_t selected_media_count = (media_size - media_packet_index) / (fec_packet_count - i);
+
+				for (size_t j = 0; j < selected_media_count; j++)
+				{
+					auto media_packet = _media_packets[media_packet_index++];
+					auto payload_size = media_packet->PayloadSize();
+
+					if (fec_packet->GetLength() < (fec_header_size + payload_size))
+					{
+						fec_packet->SetLength(fec_header_size + payload_size);
+						fec_buffer = fec_packet->GetWritableDataAs<uint8_t>();
+					}
+
+					if (j == 0)
+					{
+						sn_base = media_packet->SequenceNumber();
+
+						fec_buffer[0] = media_packet->Header()[0];
+						fec_buffer[1] = GetMPtFields(media_packet.get());
+						ByteWriter<uint16_t>::WriteBigEndian(&fec_buffer[2], sn_base);
+						ByteWriter<uint32_t>::WriteBigEndian(&fec_buffer[4], media_packet->Timestamp());
+						ByteWriter<uint16_t>::WriteBigEndian(&fec_buffer[8], static_cast<uint16_t>(payload_size));
+						::memcpy(&fec_buffer[fec_header_size], media_packet->Payload(), payload_size);
+					}
+					else
+					{
+						auto header = media_packet->Header();
+
+						fec_buffer[0] ^= header[0];
+						fec_buffer[1] ^= GetMPtFields(media_packet.get());
+						for (size_t index = 4; index < 8; index++)
+						{
+							fec_buffer[index] ^= header[index];
+						}
+
+						uint8_t length[2];
+						ByteWriter<uint16_t>::WriteBigEndian(length, static_cast<uint16_t>(payload_size));
+						fec_buffer[8] ^= length[0];
+						fec_buffer[9] ^= length[1];
+
+						auto payload = media_packet->Payload();
+						for (size_t index = 0; index < payload_size; index++)
+						{
+							fec_buffer[fec_header_size + index] ^= payload[index];
+						}
+					}
+
+					uint16_t diff = media_packet->SequenceNumber() - sn_base;
+					mask[diff / 8] |= 1 << (7 - (diff % 8));
+				}
+
+				// E bit is zero, L bit is set if the long mask is used
+				fec_buffer[0] &= 0x7f;
+				fec_buffer[0] = (mask_len == MaskSizeLbitClear) ? (fec_buffer[0] & 0xbf) : (fec_buffer[0] | 0x40);
+
+				ByteWriter<uint16_t>::WriteBigEndian(&fec_buffer[10], static_cast<uint16_t>(fec_packet->GetLength() - fec_header_size));
+				::memcpy(&fec_buffer[12], mask, mask_len);
+
+				_generated_fec_packets.push(fec_packet);
+			}
+
+			_media_packets.clear();
+		}
+
+		std::queue<std::shared_ptr<ov::Data>> _generated_fec_packets;
+		std::vector<std::shared_ptr<RedRtpPacket>> _media_packets;
+	};
+}  // namespace ulpfec
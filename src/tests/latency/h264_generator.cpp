@@ -0,0 +1,400 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "h264_generator.h"
+
+#include <algorithm>
+
+namespace lb
+{
+	namespace
+	{
+		constexpr uint8_t ProfileIdc = 66;	// Baseline
+		constexpr uint8_t LevelIdc = 31;
+		constexpr uint32_t Log2MaxFrameNum = 4;
+		// I_PCM in an I slice
+		constexpr uint32_t MbTypeIPcm = 25;
+
+		// Writes the syntax elements of ITU-T H.264 7.2 into an RBSP
+		class RbspWriter
+		{
+		public:
+			void WriteBits(uint32_t count, uint64_t value)
+			{
+				for (int bit = static_cast<int>(count) - 1; bit >= 0; bit--)
+				{
+					WriteBit((value >> bit) & 0x01);
+				}
+			}
+
+			void WriteBit(uint32_t bit)
+			{
+				_current = static_cast<uint8_t>((_current << 1) | (bit & 0x01));
+				_bit_count++;
+
+				if ((_bit_count % 8) == 0)
+				{
+					_rbsp.push_back(_current);
+					_current = 0;
+				}
+			}
+
+			// ue(v)
+			void WriteUe(uint32_t value)
+			{
+				uint64_t code = static_cast<uint64_t>(value) + 1;
+				uint32_t length = 0;
+				for (auto temp = code; temp > 1; temp >>= 1)
+				{
+					length++;
+				}
+
+				WriteBits(length, 0);
+				WriteBits(length + 1, code);
+			}
+
+			// se(v)
+			void WriteSe(int32_t value)
+			{
+				WriteUe((value > 0) ? static_cast<uint32_t>(value * 2 - 1) : static_cast<uint32_t>(-value * 2));
+			}
+
+			bool IsByteAligned() const
+			{
+				return (_bit_count % 8) == 0;
+			}
+
+			void WriteByte(uint8_t value)
+			{
+				WriteBits(8, value);
+			}
+
+			void WriteTrailingBits()
+			{
+				WriteBit(1);
+				while (IsByteAligned() == false)
+				{
+					WriteBit(0);
+				}
+			}
+
+			// NAL unit header + RBSP with the emulation prevention bytes
+			NalUnit ToNalUnit(uint8_t nal_ref_idc, uint8_t nal_unit_type) const
+			{
+				NalUnit nal_unit;
+				nal_unit.reserve(_rbsp.size() + _rbsp.size() / 64 + 1);
+
+				nal_unit.push_back(static_cast<uint8_t>((nal_ref_idc << 5) | nal_unit_type));
+
+				int zero_count = 0;
+				for (auto byte : _rbsp)
+				{
+					if ((zero_count == 2) && (byte <= 0x03))
+					{
+						nal_unit.push_back(0x03);
+						zero_count = 0;
+					}
+
+					nal_unit.push_back(byte);
+					zero_count = (byte == 0x00) ? (zero_count + 1) : 0;
+				}
+
+				return nal_unit;
+			}
+
+		private:
+			std::vector<uint8_t> _rbsp;
+			uint8_t _current = 0;
+			uint64_t _bit_count = 0;
+		};
+
+		void AppendWithLength(std::vector<uint8_t> &output, const NalUnit &nal_unit, size_t length_size)
+		{
+			for (int shift = static_cast<int>(length_size - 1) * 8; shift >= 0; shift -= 8)
+			{
+				output.push_back(static_cast<uint8_t>((nal_unit.size() >> shift) & 0xFF));
+			}
+			output.insert(output.end(), nal_unit.begin(), nal_unit.end());
+		}
+	}  // namespace
+
+	std::vector<uint8_t> AccessUnit::ToAnnexB() const
+	{
+		std::vector<uint8_t> output;
+
+		for (const auto &nal_unit : nal_units)
+		{
+			output.insert(output.end(), {0x00, 0x00, 0x00, 0x01});
+			output.insert(output.end(), nal_unit.begin(), nal_unit.end());
+		}
+
+		return output;
+	}
+
+	std::vector<uint8_t> AccessUnit::ToAvcc() const
+	{
+		std::vector<uint8_t> output;
+
+		for (const auto &nal_unit : nal_units)
+		{
+			AppendWithLength(output, nal_unit, 4);
+		}
+
+		return output;
+	}
+
+	H264Generator::H264Generator(uint32_t width, uint32_t height, uint32_t framerate, uint32_t gop_size, uint32_t bitrate)
+		: _width(width & ~15U),
+		  _height(height & ~15U),
+		  _framerate(std::max<uint32_t>(framerate, 1)),
+		  _gop_size(std::max<uint32_t>(gop_size, 1)),
+		  _bitrate(bitrate)
+	{
+		_sps = MakeSps();
+		_pps = MakePps();
+	}
+
+	std::vector<uint8_t> H264Generator::MakeDecoderConfigurationRecord() const
+	{
+		std::vector<uint8_t> record;
+
+		// configurationVersion, AVCProfileIndication, profile_compatibility, AVCLevelIndication
+		record.insert(record.end(), {0x01, _sps[1], _sps[2], _sps[3]});
+		// reserved(6) + lengthSizeMinusOne(2): 4 byte length
+		record.push_back(0xFF);
+		// reserved(3) + numOfSequenceParameterSets(5)
+		record.push_back(0xE1);
+		AppendWithLength(record, _sps, 2);
+		// numOfPictureParameterSets
+		record.push_back(0x01);
+		AppendWithLength(record, _pps, 2);
+
+		return record;
+	}
+
+	AccessUnit H264Generator::Next(LatencyMarker marker)
+	{
+		AccessUnit access_unit;
+
+		auto frame_number = _frame_number++;
+		auto gop_index = frame_number % _gop_size;
+
+		access_unit.sequence = frame_number;
+		access_unit.pts = static_cast<int64_t>(frame_number) * 90000 / _framerate;
+		access_unit.keyframe = (gop_index == 0);
+
+		marker.sequence = frame_number;
+
+		// Access unit delimiter: primary_pic_type(3) = 7 (any slice type)
+		access_unit.nal_units.push_back({0x09, 0xF0});
+
+		if (access_unit.keyframe)
+		{
+			access_unit.nal_units.push_back(_sps);
+			access_unit.nal_units.push_back(_pps);
+		}
+
+		access_unit.nal_units.push_back(LatencyMarkerCodec::MakeSeiNalUnit(marker));
+
+		if (access_unit.keyframe)
+		{
+			access_unit.nal_units.push_back(MakeIdrSlice(frame_number));
+			_idr_pic_id++;
+		}
+		else
+		{
+			access_unit.nal_units.push_back(MakePSlice(gop_index % (1U << Log2MaxFrameNum)));
+		}
+
+		if (_bitrate > 0)
+		{
+			size_t frame_size = 0;
+			for (const auto &nal_unit : access_unit.nal_units)
+			{
+				frame_size += nal_unit.size() + 4;
+			}
+
+			size_t target_size = _bitrate / 8 / _framerate;
+			if (frame_size + 6 < target_size)
+			{
+				// Filler data: 0xFF bytes and rbsp_trailing_bits
+				NalUnit filler(target_size - frame_size - 4, 0xFF);
+				filler.front() = 0x0C;
+				filler.back() = 0x80;
+				access_unit.nal_units.push_back(std::move(filler));
+			}
+		}
+
+		return access_unit;
+	}
+
+	NalUnit H264Generator::MakeSps() const
+	{
+		RbspWriter writer;
+
+		writer.WriteByte(ProfileIdc);
+		// constraint_set0_flag, constraint_set1_flag (Constrained Baseline), reserved_zero_bits
+		writer.WriteByte(0xC0);
+		writer.WriteByte(LevelIdc);
+		// seq_parameter_set_id
+		writer.WriteUe(0);
+		// log2_max_frame_num_minus4
+		writer.WriteUe(Log2MaxFrameNum - 4);
+		// pic_order_cnt_type: the output order is the decoding order
+		writer.WriteUe(2);
+		// max_num_ref_frames
+		writer.WriteUe(1);
+		// gaps_in_frame_num_value_allowed_flag
+		writer.WriteBit(0);
+		// pic_width_in_mbs_minus1, pic_height_in_map_units_minus1
+		writer.WriteUe(_width / 16 - 1);
+		writer.WriteUe(_height / 16 - 1);
+		// frame_mbs_only_flag, direct_8x8_inference_flag, frame_cropping_flag
+		writer.WriteBit(1);
+		writer.WriteBit(1);
+		writer.WriteBit(0);
+
+		// vui_parameters_present_flag
+		writer.WriteBit(1);
+		// aspect_ratio_info_present_flag, overscan_info_present_flag, video_signal_type_present_flag, chroma_loc_info_present_flag
+		writer.WriteBits(4, 0);
+		// timing_info_present_flag, num_units_in_tick, time_scale, fixed_frame_rate_flag
+		writer.WriteBit(1);
+		writer.WriteBits(32, 1);
+		writer.WriteBits(32, _framerate * 2);
+		writer.WriteBit(1);
+		// nal_hrd_parameters_present_flag, vcl_hrd_parameters_present_flag, pic_struct_present_flag
+		writer.WriteBits(3, 0);
+		// bitstream_restriction_flag
+		writer.WriteBit(1);
+		// motion_vectors_over_pic_boundaries_flag
+		writer.WriteBit(1);
+		// max_bytes_per_pic_denom, max_bits_per_mb_denom, log2_max_mv_length_horizontal, log2_max_mv_length_vertical
+		writer.WriteUe(0);
+		writer.WriteUe(0);
+		writer.WriteUe(16);
+		writer.WriteUe(16);
+		// max_num_reorder_frames: no frame is held for reordering
+		writer.WriteUe(0);
+		// max_dec_frame_buffering
+		writer.WriteUe(1);
+
+		writer.WriteTrailingBits();
+
+		return writer.ToNalUnit(3, 7);
+	}
+
+	NalUnit H264Generator::MakePps() const
+	{
+		RbspWriter writer;
+
+		// pic_parameter_set_id, seq_parameter_set_id
+		writer.WriteUe(0);
+		writer.WriteUe(0);
+		// entropy_coding_mode_flag (CAVLC), bottom_field_pic_order_in_frame_present_flag
+		writer.WriteBit(0);
+		writer.WriteBit(0);
+		// num_slice_groups_minus1
+		writer.WriteUe(0);
+		// num_ref_idx_l0_default_active_minus1, num_ref_idx_l1_default_active_minus1
+		writer.WriteUe(0);
+		writer.WriteUe(0);
+		// weighted_pred_flag, weighted_bipred_idc
+		writer.WriteBit(0);
+		writer.WriteBits(2, 0);
+		// pic_init_qp_minus26, pic_init_qs_minus26, chroma_qp_index_offset
+		writer.WriteSe(0);
+		writer.WriteSe(0);
+		writer.WriteSe(0);
+		// deblocking_filter_control_present_flag, constrained_intra_pred_flag, redundant_pic_cnt_present_flag
+		writer.WriteBit(1);
+		writer.WriteBit(0);
+		writer.WriteBit(0);
+
+		writer.WriteTrailingBits();
+
+		return writer.ToNalUnit(3, 8);
+	}
+
+	NalUnit H264Generator::MakeIdrSlice(uint32_t frame_number) const
+	{
+		RbspWriter writer;
+
+		// first_mb_in_slice, slice_type (7: I, all slices of the picture), pic_parameter_set_id
+		writer.WriteUe(0);
+		writer.WriteUe(7);
+		writer.WriteUe(0);
+		// frame_num
+		writer.WriteBits(Log2MaxFrameNum, 0);
+		// idr_pic_id
+		writer.WriteUe(_idr_pic_id % 2);
+		// dec_ref_pic_marking(): no_output_of_prior_pics_flag, long_term_reference_flag
+		writer.WriteBit(0);
+		writer.WriteBit(0);
+		// slice_qp_delta
+		writer.WriteSe(0);
+		// disable_deblocking_filter_idc
+		writer.WriteUe(1);
+
+		// A gradient that moves with the frame number, so that a decoded picture shows progress
+		auto mb_width = _width / 16;
+		auto mb_count = mb_width * (_height / 16);
+
+		for (uint32_t mb = 0; mb < mb_count; mb++)
+		{
+			writer.WriteUe(MbTypeIPcm);
+			while (writer.IsByteAligned() == false)
+			{
+				// pcm_alignment_zero_bit
+				writer.WriteBit(0);
+			}
+
+			auto luma = static_cast<uint8_t>(16 + ((mb % mb_width) * 8 + frame_number * 4) % 220);
+			for (int sample = 0; sample < 256; sample++)
+			{
+				writer.WriteByte(luma);
+			}
+
+			for (int sample = 0; sample < 128; sample++)
+			{
+				writer.WriteByte(128);
+			}
+		}
+
+		writer.WriteTrailingBits();
+
+		return writer.ToNalUnit(3, 5);
+	}
+
+	NalUnit H264Generator::MakePSlice(uint32_t frame_num) const
+	{
+		RbspWriter writer;
+
+		// first_mb_in_slice, slice_type (5: P, all slices of the picture), pic_parameter_set_id
+		writer.WriteUe(0);
+		writer.WriteUe(5);
+		writer.WriteUe(0);
+		writer.WriteBits(Log2MaxFrameNum, frame_num);
+		// num_ref_idx_active_override_flag, ref_pic_list_modification_flag_l0
+		writer.WriteBit(0);
+		writer.WriteBit(0);
+		// dec_ref_pic_marking(): adaptive_ref_pic_marking_mode_flag
+		writer.WriteBit(0);
+		// slice_qp_delta
+		writer.WriteSe(0);
+		// disable_deblocking_filter_idc
+		writer.WriteUe(1);
+
+		// mb_skip_run: every macroblock is skipped
+		writer.WriteUe((_width / 16) * (_height / 16));
+
+		writer.WriteTrailingBits();
+
+		return writer.ToNalUnit(3, 1);
+	}
+}  // namespace lb
@@ -0,0 +1,85 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "latency_marker.h"
+
+namespace lb
+{
+	using NalUnit = std::vector<uint8_t>;
+
+	struct AccessUnit
+	{
+		uint32_t sequence = 0;
+		// 90 kHz
+		int64_t pts = 0;
+		bool keyframe = false;
+		// Without start codes
+		std::vector<NalUnit> nal_units;
+
+		// 00 00 00 01 before every NAL unit
+		std::vector<uint8_t> ToAnnexB() const;
+		// 4 byte length before every NAL unit (AVCC, used by FLV)
+		std::vector<uint8_t> ToAvcc() const;
+	};
+
+	// Generates a valid, decodable H.264 (Constrained Baseline, CAVLC) stream without an encoder.
+	//
+	// An IDR frame is made of I_PCM macroblocks whose luma changes with the frame number, and the other frames
+	// skip every macroblock (P_Skip). Every access unit starts with a SEI that carries a LatencyMarker.
+	// If a bitrate is given, filler data NAL units are added so that the stream has about that bitrate.
+	class H264Generator
+	{
+	public:
+		// The width and height must be multiples of 16
+		H264Generator(uint32_t width, uint32_t height, uint32_t framerate, uint32_t gop_size, uint32_t bitrate = 0);
+
+		const NalUnit &GetSps() const
+		{
+			return _sps;
+		}
+
+		const NalUnit &GetPps() const
+		{
+			return _pps;
+		}
+
+		uint32_t GetFramerate() const
+		{
+			return _framerate;
+		}
+
+		// AVCDecoderConfigurationRecord (ISO/IEC 14496-15), used by FLV
+		std::vector<uint8_t> MakeDecoderConfigurationRecord() const;
+
+		// Makes the next access unit that carries `marker` (marker.sequence is set to the frame number)
+		AccessUnit Next(LatencyMarker marker);
+
+	private:
+		NalUnit MakeSps() const;
+		NalUnit MakePps() const;
+		NalUnit MakeIdrSlice(uint32_t frame_number) const;
+		NalUnit MakePSlice(uint32_t frame_num) const;
+
+		uint32_t _width;
+		uint32_t _height;
+		uint32_t _framerate;
+		uint32_t _gop_size;
+		uint32_t _bitrate;
+
+		NalUnit _sps;
+		NalUnit _pps;
+
+		uint32_t _frame_number = 0;
+		uint32_t _idr_pic_id = 0;
+	};
+}  // namespace lb
@@ -0,0 +1,151 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "latency_marker.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+namespace lb
+{
+	namespace
+	{
+		bool ParseHex(const uint8_t *data, size_t digits, uint64_t &value)
+		{
+			value = 0;
+
+			for (size_t index = 0; index < digits; index++)
+			{
+				auto c = data[index];
+				value <<= 4;
+
+				if ((c >= '0') && (c <= '9'))
+				{
+					value |= static_cast<uint64_t>(c - '0');
+				}
+				else if ((c >= 'a') && (c <= 'f'))
+				{
+					value |= static_cast<uint64_t>(c - 'a' + 10);
+				}
+				else
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+	}  // namespace
+
+	std::vector<uint8_t> LatencyMarkerCodec::MakeSeiNalUnit(const LatencyMarker &marker)
+	{
+		char payload[PayloadLength + 1];
+		::snprintf(payload, sizeof(payload), "%016llx%08x%04x",
+				   static_cast<unsigned long long>(marker.wallclock_us), marker.sequence, marker.stream_index);
+
+		std::vector<uint8_t> nal_unit;
+		nal_unit.reserve(4 + UuidLength + PayloadLength);
+
+		// nal_ref_idc(0), nal_unit_type(6: SEI)
+		nal_unit.push_back(0x06);
+		// payloadType(5: user_data_unregistered), payloadSize
+		nal_unit.push_back(0x05);
+		nal_unit.push_back(static_cast<uint8_t>(UuidLength + PayloadLength));
+		nal_unit.insert(nal_unit.end(), Uuid, Uuid + UuidLength);
+		nal_unit.insert(nal_unit.end(), payload, payload + PayloadLength);
+		// rbsp_trailing_bits
+		nal_unit.push_back(0x80);
+
+		return nal_unit;
+	}
+
+	size_t LatencyMarkerCodec::Scan(const uint8_t *data, size_t length, const std::function<void(const LatencyMarker &marker)> &on_marker)
+	{
+		size_t count = 0;
+		size_t offset = 0;
+
+		while (offset + UuidLength + PayloadLength <= length)
+		{
+			auto found = static_cast<const uint8_t *>(::memmem(data + offset, length - offset, Uuid, UuidLength));
+			if (found == nullptr)
+			{
+				break;
+			}
+
+			auto position = static_cast<size_t>(found - data);
+			offset = position + 1;
+
+			if (position + UuidLength + PayloadLength > length)
+			{
+				// Split across the buffers
+				break;
+			}
+
+			auto payload = found + UuidLength;
+			uint64_t wallclock_us, sequence, stream_index;
+
+			if (ParseHex(payload, 16, wallclock_us) && ParseHex(payload + 16, 8, sequence) && ParseHex(payload + 24, 4, stream_index))
+			{
+				LatencyMarker marker;
+				marker.wallclock_us = static_cast<int64_t>(wallclock_us);
+				marker.sequence = static_cast<uint32_t>(sequence);
+				marker.stream_index = static_cast<uint16_t>(stream_index);
+
+				on_marker(marker);
+				count++;
+
+				offset = position + UuidLength + PayloadLength;
+			}
+		}
+
+		return count;
+	}
+
+	LatencyMarkerScanner::LatencyMarkerScanner(std::function<void(const LatencyMarker &marker)> on_marker)
+		: _on_marker(std::move(on_marker))
+	{
+	}
+
+	void LatencyMarkerScanner::Feed(const uint8_t *data, size_t length)
+	{
+		constexpr size_t MarkerLength = LatencyMarkerCodec::UuidLength + LatencyMarkerCodec::PayloadLength;
+
+		const uint8_t *scan_data = data;
+		size_t scan_length = length;
+
+		if (_tail.empty() == false)
+		{
+			_buffer.assign(_tail.begin(), _tail.end());
+			_buffer.insert(_buffer.end(), data, data + length);
+
+			scan_data = _buffer.data();
+			scan_length = _buffer.size();
+		}
+
+		LatencyMarkerCodec::Scan(scan_data, scan_length, _on_marker);
+
+		// The tail is shorter than a marker, so a marker that was reported is never reported again
+		auto tail_length = std::min(scan_length, MarkerLength - 1);
+		_tail.assign(scan_data + scan_length - tail_length, scan_data + scan_length);
+	}
+
+	void LatencyMarkerScanner::Reset()
+	{
+		_tail.clear();
+	}
+
+	int64_t LatencyMarkerCodec::GetWallclockUs()
+	{
+		timespec now;
+		::clock_gettime(CLOCK_REALTIME, &now);
+
+		return static_cast<int64_t>(now.tv_sec) * 1000000 + now.tv_nsec / 1000;
+	}
+}  // namespace lb
@@ -0,0 +1,65 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace lb
+{
+	// A wallclock marker that is carried in an H.264 SEI (user_data_unregistered) of every access unit.
+	//
+	// The payload is an ASCII UUID followed by hexadecimal digits, so it contains no zero bytes and
+	// never gets emulation prevention bytes. It can therefore be found in any container (FLV, MPEG-TS,
+	// fMP4, RTP, OVT) by scanning the received bytes, without parsing the container.
+	struct LatencyMarker
+	{
+		// Microseconds since the epoch (CLOCK_REALTIME) when the frame was handed to the publisher
+		int64_t wallclock_us = 0;
+		// Frame number of the stream, used to count the lost frames
+		uint32_t sequence = 0;
+		uint16_t stream_index = 0;
+	};
+
+	class LatencyMarkerCodec
+	{
+	public:
+		static constexpr const char *Uuid = "OvenLatencyProbe";
+		static constexpr size_t UuidLength = 16;
+		// 16 + 8 + 4 hexadecimal digits
+		static constexpr size_t PayloadLength = 28;
+
+		// SEI NAL unit (without a start code) that carries the marker
+		static std::vector<uint8_t> MakeSeiNalUnit(const LatencyMarker &marker);
+
+		// Calls `on_marker` for every marker found in the data
+		static size_t Scan(const uint8_t *data, size_t length, const std::function<void(const LatencyMarker &marker)> &on_marker);
+
+		static int64_t GetWallclockUs();
+	};
+
+	// Finds the markers in a byte stream that arrives in parts, such as a TCP stream or the payloads of
+	// MPEG-TS packets. A marker that is split across two parts is found when the second part arrives.
+	class LatencyMarkerScanner
+	{
+	public:
+		explicit LatencyMarkerScanner(std::function<void(const LatencyMarker &marker)> on_marker);
+
+		void Feed(const uint8_t *data, size_t length);
+		void Reset();
+
+	private:
+		std::function<void(const LatencyMarker &marker)> _on_marker;
+		// The last bytes of the previous part, which can be the start of a marker
+		std::vector<uint8_t> _tail;
+		std::vector<uint8_t> _buffer;
+	};
+}  // namespace lb
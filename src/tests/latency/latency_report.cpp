@@ -0,0 +1,177 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "latency_report.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <numeric>
+
+namespace lb
+{
+	namespace
+	{
+		int64_t GetMonotonicUs()
+		{
+			return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+
+		double Percentile(const std::vector<double> &sorted, double percentile)
+		{
+			if (sorted.empty())
+			{
+				return 0.0;
+			}
+
+			auto index = static_cast<size_t>(percentile / 100.0 * static_cast<double>(sorted.size() - 1) + 0.5);
+
+			return sorted[std::min(index, sorted.size() - 1)];
+		}
+	}  // namespace
+
+	LatencyRecorder::LatencyRecorder(std::string name, int64_t measure_from_us)
+		: _name(std::move(name)),
+		  _measure_from_us(measure_from_us)
+	{
+	}
+
+	LatencyRecorder::Player::Player(LatencyRecorder &recorder)
+		: _recorder(recorder)
+	{
+		std::lock_guard<std::mutex> lock(_recorder._mutex);
+		_recorder._players++;
+	}
+
+	LatencyRecorder::Player::~Player()
+	{
+		_recorder.Merge(*this);
+	}
+
+	void LatencyRecorder::Player::SetConnected()
+	{
+		_connected = true;
+	}
+
+	void LatencyRecorder::Player::OnMarker(const LatencyMarker &marker, int64_t arrival_us)
+	{
+		if (marker.wallclock_us < _recorder._measure_from_us)
+		{
+			return;
+		}
+
+		if (_first == false)
+		{
+			if (marker.sequence <= _last_sequence)
+			{
+				// A duplicate, such as a part that was requested twice
+				return;
+			}
+
+			_lost_frames += marker.sequence - _last_sequence - 1;
+		}
+
+		_first = false;
+		_last_sequence = marker.sequence;
+		_latencies_ms.push_back(static_cast<double>(arrival_us - marker.wallclock_us) / 1000.0);
+	}
+
+	void LatencyRecorder::Merge(Player &player)
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		_connected_players += player._connected ? 1 : 0;
+		_lost_frames += player._lost_frames;
+		_latencies_ms.insert(_latencies_ms.end(), player._latencies_ms.begin(), player._latencies_ms.end());
+	}
+
+	LatencyRecorder::Summary LatencyRecorder::Summarize() const
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		Summary summary;
+		summary.name = _name;
+		summary.players = _players;
+		summary.connected_players = _connected_players;
+		summary.frames = _latencies_ms.size();
+		summary.lost_frames = _lost_frames;
+
+		auto sorted = _latencies_ms;
+		std::sort(sorted.begin(), sorted.end());
+
+		summary.p50_ms = Percentile(sorted, 50.0);
+		summary.p95_ms = Percentile(sorted, 95.0);
+		summary.p99_ms = Percentile(sorted, 99.0);
+		summary.max_ms = sorted.empty() ? 0.0 : sorted.back();
+		summary.mean_ms = sorted.empty() ? 0.0 : std::accumulate(sorted.begin(), sorted.end(), 0.0) / static_cast<double>(sorted.size());
+
+		return summary;
+	}
+
+	CpuSampler::CpuSampler(pid_t pid)
+		: _pid(pid)
+	{
+	}
+
+	bool CpuSampler::ReadCpuTicks(pid_t pid, uint64_t &ticks)
+	{
+		char path[64];
+		::snprintf(path, sizeof(path), "/proc/%d/stat", static_cast<int>(pid));
+
+		auto file = ::fopen(path, "r");
+		if (file == nullptr)
+		{
+			return false;
+		}
+
+		char buffer[1024];
+		auto length = ::fread(buffer, 1, sizeof(buffer) - 1, file);
+		::fclose(file);
+		buffer[length] = '\0';
+
+		// The name of the process is in parentheses and can contain spaces, so the fields are counted after it
+		auto fields = ::strrchr(buffer, ')');
+		unsigned long long user_ticks = 0, system_ticks = 0;
+
+		// state(3) ... utime(14) stime(15)
+		if ((fields == nullptr) ||
+			(::sscanf(fields + 2, "%*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %llu %llu", &user_ticks, &system_ticks) != 2))
+		{
+			return false;
+		}
+
+		ticks = user_ticks + system_ticks;
+
+		return true;
+	}
+
+	bool CpuSampler::Start()
+	{
+		_start_us = GetMonotonicUs();
+
+		return ReadCpuTicks(_pid, _start_ticks);
+	}
+
+	double CpuSampler::GetUsagePercent() const
+	{
+		uint64_t ticks;
+
+		if (ReadCpuTicks(_pid, ticks) == false)
+		{
+			return -1.0;
+		}
+
+		auto elapsed_sec = static_cast<double>(GetMonotonicUs() - _start_us) / 1000000.0;
+		auto cpu_sec = static_cast<double>(ticks - _start_ticks) / static_cast<double>(::sysconf(_SC_CLK_TCK));
+
+		return (elapsed_sec > 0.0) ? (cpu_sec / elapsed_sec * 100.0) : 0.0;
+	}
+}  // namespace lb
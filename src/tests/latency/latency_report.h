@@ -0,0 +1,98 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <sys/types.h>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "latency_marker.h"
+
+namespace lb
+{
+	// Glass-to-glass latencies of the frames that the players of one output protocol received
+	class LatencyRecorder
+	{
+	public:
+		struct Summary
+		{
+			std::string name;
+			size_t players = 0;
+			size_t connected_players = 0;
+			uint64_t frames = 0;
+			uint64_t lost_frames = 0;
+			double p50_ms = 0.0;
+			double p95_ms = 0.0;
+			double p99_ms = 0.0;
+			double max_ms = 0.0;
+			double mean_ms = 0.0;
+		};
+
+		// The frames that were sent before `measure_from_us` are not counted, such as the frames of the warm-up
+		// that an RTMP stream caches until it is published
+		LatencyRecorder(std::string name, int64_t measure_from_us);
+
+		// Each player has its own tracker of the frame sequence
+		class Player
+		{
+		public:
+			explicit Player(LatencyRecorder &recorder);
+			~Player();
+
+			void SetConnected();
+			void OnMarker(const LatencyMarker &marker, int64_t arrival_us);
+
+		private:
+			friend class LatencyRecorder;
+
+			LatencyRecorder &_recorder;
+			bool _connected = false;
+			bool _first = true;
+			uint32_t _last_sequence = 0;
+			uint64_t _lost_frames = 0;
+			std::vector<double> _latencies_ms;
+		};
+
+		Summary Summarize() const;
+
+	private:
+		void Merge(Player &player);
+
+		std::string _name;
+		int64_t _measure_from_us;
+
+		mutable std::mutex _mutex;
+		size_t _players = 0;
+		size_t _connected_players = 0;
+		uint64_t _lost_frames = 0;
+		std::vector<double> _latencies_ms;
+	};
+
+	// CPU time of a process, from /proc/<pid>/stat
+	class CpuSampler
+	{
+	public:
+		explicit CpuSampler(pid_t pid);
+
+		// Starts a measurement period
+		bool Start();
+		// The CPU usage since Start() in percent of one core, or a negative value if the process is gone
+		double GetUsagePercent() const;
+
+	private:
+		static bool ReadCpuTicks(pid_t pid, uint64_t &ticks);
+
+		pid_t _pid;
+		uint64_t _start_ticks = 0;
+		int64_t _start_us = 0;
+	};
+}  // namespace lb
@@ -0,0 +1,417 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "llhls_player.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+
+// The number of URIs that are remembered to avoid requesting a part twice
+#define LLHLS_PLAYER_MAX_REQUESTED_URIS 64
+
+namespace load
+{
+	namespace
+	{
+		int64_t GetMonotonicUs()
+		{
+			return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+
+		ov::String ToString(const std::shared_ptr<ov::Data> &body)
+		{
+			return (body != nullptr) ? body->ToString() : "";
+		}
+
+		// Counts the bytes of a response, and keeps the body only if it is needed (the playlists)
+		class ResponseInterceptor : public http::clnt::HttpClientInterceptor
+		{
+		public:
+			using Callback = std::function<void(bool succeeded, size_t bytes, const std::shared_ptr<ov::Data> &body)>;
+
+			ResponseInterceptor(bool keep_body, Callback callback)
+				: _keep_body(keep_body),
+				  _callback(std::move(callback))
+			{
+			}
+
+		protected:
+			std::shared_ptr<const ov::Error> OnResponseInfo(const std::shared_ptr<const http::clnt::ResponseInfo> &response_info) override
+			{
+				_status_code = response_info->GetStatusCode();
+
+				if (_keep_body)
+				{
+					_body = std::make_shared<ov::Data>(response_info->GetContentLength().value_or(4096));
+				}
+
+				return nullptr;
+			}
+
+			std::shared_ptr<const ov::Error> OnData(const std::shared_ptr<const ov::Data> &data) override
+			{
+				_bytes += data->GetLength();
+
+				if (_body != nullptr)
+				{
+					_body->Append(data);
+				}
+
+				return nullptr;
+			}
+
+			void OnError(const std::shared_ptr<const ov::Error> &error) override
+			{
+				_error = error;
+			}
+
+			void OnRequestFinished() override
+			{
+				_callback((_error == nullptr) && (_status_code == http::StatusCode::OK), _bytes, _body);
+			}
+
+		private:
+			bool _keep_body;
+			Callback _callback;
+
+			http::StatusCode _status_code = http::StatusCode::Unknown;
+			size_t _bytes = 0;
+			std::shared_ptr<ov::Data> _body;
+			std::shared_ptr<const ov::Error> _error;
+		};
+	}  // namespace
+
+	LLHlsPlayer::LLHlsPlayer(const Config &config, const std::shared_ptr<ov::SocketPool> &socket_pool, ov::DelayQueue &queue,
+							 LoadStats &stats, std::function<void()> on_stopped)
+		: _config(config),
+		  _socket_pool(socket_pool),
+		  _queue(queue),
+		  _stats(stats),
+		  _on_stopped(std::move(on_stopped))
+	{
+	}
+
+	void LLHlsPlayer::Start()
+	{
+		_stats.active_players++;
+		_stats.started_players++;
+
+		Post([this]() {
+			Request(RequestType::Master, _config.url);
+		});
+	}
+
+	void LLHlsPlayer::Stop()
+	{
+		Post([this]() {
+			_stopping = true;
+			_part_queue.clear();
+
+			ReportStoppedIfDone();
+		});
+	}
+
+	void LLHlsPlayer::Post(std::function<void()> task, int after_ms)
+	{
+		// The task keeps the player alive until it runs
+		auto self = GetSharedPtr();
+
+		_queue.Push(
+			[self, task = std::move(task)](void *parameter) -> ov::DelayQueueAction {
+				task();
+				return ov::DelayQueueAction::Stop;
+			},
+			after_ms);
+	}
+
+	RequestStats &LLHlsPlayer::GetStats(RequestType type)
+	{
+		switch (type)
+		{
+			case RequestType::Master:
+				return _stats.master;
+
+			case RequestType::Playlist:
+				[[fallthrough]];
+			case RequestType::BlockingReload:
+				return _stats.playlist;
+
+			case RequestType::Part:
+				return _stats.part;
+
+			case RequestType::Hint:
+				break;
+		}
+
+		return _stats.hint;
+	}
+
+	void LLHlsPlayer::Request(RequestType type, const ov::String &url)
+	{
+		auto client = http::clnt::HttpClientV2::Create(_socket_pool);
+		auto self = GetSharedPtr();
+		auto request_id = _next_request_id++;
+		auto keep_body = (type == RequestType::Master) || (type == RequestType::Playlist) || (type == RequestType::BlockingReload);
+		auto started_us = GetMonotonicUs();
+
+		client->SetBlockingMode(ov::BlockingMode::NonBlocking);
+		client->SetConnectionTimeout(_config.connection_timeout_ms);
+		client->SetRequestHeader("User-Agent", "OvenLLHlsLoad");
+		client->SetRequestHeader("Accept", "*/*");
+
+		// Called on a worker of the socket pool, or on this thread if the request could not be made
+		client->AddInterceptor(std::make_shared<ResponseInterceptor>(
+			keep_body,
+			[self, request_id, type, started_us](bool succeeded, size_t bytes, const std::shared_ptr<ov::Data> &body) {
+				Response response;
+				response.succeeded = succeeded;
+				response.body = body;
+				response.bytes = bytes;
+				response.finished_us = GetMonotonicUs();
+				response.elapsed_us = response.finished_us - started_us;
+
+				self->Post([self, request_id, type, response]() {
+					self->OnResponse(request_id, type, response);
+				});
+			}));
+
+		// The client is released after its response is handled, since it must not be destroyed on a worker of the socket pool
+		// when the connection is refused
+		_requests.emplace(request_id, client);
+		client->Request(url);
+	}
+
+	void LLHlsPlayer::OnResponse(uint64_t request_id, RequestType type, const Response &response)
+	{
+		_requests.erase(request_id);
+
+		auto &stats = GetStats(type);
+
+		if (response.succeeded)
+		{
+			stats.Record(response.elapsed_us, response.bytes);
+		}
+		else if (_stopping == false)
+		{
+			stats.errors++;
+		}
+
+		if (_stopping)
+		{
+			ReportStoppedIfDone();
+			return;
+		}
+
+		switch (type)
+		{
+			case RequestType::Master:
+				OnMasterPlaylist(response);
+				break;
+
+			case RequestType::Playlist:
+				[[fallthrough]];
+			case RequestType::BlockingReload:
+				OnChunklist(type, response);
+				break;
+
+			case RequestType::Part:
+				_is_part_requested = false;
+				RequestNextPart();
+				break;
+
+			case RequestType::Hint:
+				break;
+		}
+	}
+
+	void LLHlsPlayer::OnMasterPlaylist(const Response &response)
+	{
+		if (response.succeeded == false)
+		{
+			Post(
+				[this]() {
+					if (_stopping == false)
+					{
+						Request(RequestType::Master, _config.url);
+					}
+				},
+				_config.retry_interval_ms);
+			return;
+		}
+
+		auto variant = GetFirstVariant(ToString(response.body));
+
+		if (variant.IsEmpty())
+		{
+			// A media playlist was given
+			_chunklist_url = _config.url;
+			OnChunklist(RequestType::Playlist, response);
+			return;
+		}
+
+		_chunklist_url = ResolveUrl(_config.url, variant);
+		RequestChunklist(0);
+	}
+
+	void LLHlsPlayer::RequestChunklist(int after_ms)
+	{
+		if (after_ms == 0)
+		{
+			Request(RequestType::Playlist, _chunklist_url);
+			return;
+		}
+
+		Post(
+			[this]() {
+				if (_stopping == false)
+				{
+					Request(RequestType::Playlist, _chunklist_url);
+				}
+			},
+			after_ms);
+	}
+
+	void LLHlsPlayer::OnChunklist(RequestType type, const Response &response)
+	{
+		if (response.succeeded == false)
+		{
+			_last_response_us = -1;
+			RequestChunklist(_config.retry_interval_ms);
+			return;
+		}
+
+		auto chunklist = LLHlsChunklist::Parse(ToString(response.body));
+
+		if ((type == RequestType::BlockingReload) && (_part_target > 0.0) && (_last_response_us >= 0))
+		{
+			auto interval_us = response.finished_us - _last_response_us;
+			_stats.hold_deviation.Record(std::abs(interval_us - static_cast<int64_t>(_part_target * 1000000.0)));
+		}
+
+		_last_response_us = response.finished_us;
+		_part_target = chunklist.part_target;
+
+		QueueParts(chunklist);
+
+		if (chunklist.can_block_reload == false)
+		{
+			// Not a low latency playlist, reloaded at half of the target duration
+			RequestChunklist(std::max(static_cast<int>(chunklist.target_duration * 1000.0 / 2.0), 100));
+			return;
+		}
+
+		int64_t msn;
+		int64_t part;
+		chunklist.GetNextDirectives(&msn, &part);
+
+		Request(RequestType::BlockingReload, MakeBlockingReloadUrl(_chunklist_url, msn, part));
+
+		if (_config.preload_hint && (chunklist.preload_hint.IsEmpty() == false) && MarkRequested(chunklist.preload_hint))
+		{
+			Request(RequestType::Hint, ResolveUrl(_chunklist_url, chunklist.preload_hint));
+		}
+	}
+
+	void LLHlsPlayer::QueueParts(const LLHlsChunklist &chunklist)
+	{
+		if (chunklist.parts.empty())
+		{
+			return;
+		}
+
+		if (_last_queued_part.msn < 0)
+		{
+			// Starts from the live edge
+			_last_queued_part = chunklist.parts.back();
+
+			if (MarkRequested(_last_queued_part.uri))
+			{
+				_part_queue.push_back(_last_queued_part.uri);
+			}
+		}
+		else
+		{
+			for (const auto &part : chunklist.parts)
+			{
+				if (part.IsAfter(_last_queued_part) == false)
+				{
+					continue;
+				}
+
+				_last_queued_part = part;
+
+				// Already requested as a preload hint
+				if (MarkRequested(part.uri) == false)
+				{
+					continue;
+				}
+
+				if (_part_queue.size() >= _config.max_queued_parts)
+				{
+					// The player cannot keep up with the stream
+					_stats.part.errors++;
+					continue;
+				}
+
+				_part_queue.push_back(part.uri);
+			}
+		}
+
+		RequestNextPart();
+	}
+
+	void LLHlsPlayer::RequestNextPart()
+	{
+		if (_is_part_requested || _part_queue.empty())
+		{
+			return;
+		}
+
+		auto uri = _part_queue.front();
+		_part_queue.pop_front();
+
+		_is_part_requested = true;
+		Request(RequestType::Part, ResolveUrl(_chunklist_url, uri));
+	}
+
+	bool LLHlsPlayer::MarkRequested(const ov::String &uri)
+	{
+		if (std::find(_requested_uris.begin(), _requested_uris.end(), uri) != _requested_uris.end())
+		{
+			return false;
+		}
+
+		_requested_uris.push_back(uri);
+
+		if (_requested_uris.size() > LLHLS_PLAYER_MAX_REQUESTED_URIS)
+		{
+			_requested_uris.pop_front();
+		}
+
+		return true;
+	}
+
+	void LLHlsPlayer::ReportStoppedIfDone()
+	{
+		if ((_requests.empty() == false) || _is_stopped)
+		{
+			return;
+		}
+
+		_is_stopped = true;
+
+		_stats.active_players--;
+		_stats.stopped_players++;
+
+		if (_on_stopped != nullptr)
+		{
+			_on_stopped();
+		}
+	}
+}  // namespace load
@@ -0,0 +1,120 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/delay_queue.h>
+#include <base/ovsocket/ovsocket.h>
+#include <modules/http/client/http_client_v2.h>
+
+#include <deque>
+#include <functional>
+#include <map>
+
+#include "llhls_playlist.h"
+#include "load_stats.h"
+
+namespace load
+{
+	// Simulates an LL-HLS player of the first rendition of a stream.
+	//
+	// It repeats blocking playlist reloads (_HLS_msn/_HLS_part) like a player, fetches the new parts one after another,
+	// and requests the EXT-X-PRELOAD-HINT in advance. The requests are made by http::clnt::HttpClientV2 in non-blocking
+	// mode on the workers of the socket pool, and every state change runs on the thread of the delay queue,
+	// so that thousands of players need only a few threads.
+	//
+	// HttpClientV2 does not keep connections alive, so every request opens a new connection.
+	class LLHlsPlayer : public ov::EnableSharedFromThis<LLHlsPlayer>
+	{
+	public:
+		struct Config
+		{
+			// URL of the master playlist (or of a media playlist)
+			ov::String url;
+			bool preload_hint = true;
+			int connection_timeout_ms = 5000;
+			// Interval of the retries after an error
+			int retry_interval_ms = 1000;
+			// Parts that are queued but not requested yet; more means that the player cannot keep up with the stream
+			size_t max_queued_parts = 32;
+		};
+
+		// `on_stopped` is called on the thread of `queue` when the player has stopped
+		LLHlsPlayer(const Config &config, const std::shared_ptr<ov::SocketPool> &socket_pool, ov::DelayQueue &queue,
+					LoadStats &stats, std::function<void()> on_stopped);
+
+		void Start();
+		// Stops making requests. The player has stopped when the requests in progress are finished.
+		void Stop();
+
+		bool IsStopped() const
+		{
+			return _is_stopped;
+		}
+
+	private:
+		enum class RequestType
+		{
+			Master,
+			Playlist,
+			BlockingReload,
+			Part,
+			Hint
+		};
+
+		struct Response
+		{
+			bool succeeded = false;
+			// Only kept for the playlists
+			std::shared_ptr<ov::Data> body;
+			size_t bytes = 0;
+			int64_t elapsed_us = 0;
+			int64_t finished_us = 0;
+		};
+
+		void Post(std::function<void()> task, int after_ms = 0);
+		void Request(RequestType type, const ov::String &url);
+		RequestStats &GetStats(RequestType type);
+
+		void OnResponse(uint64_t request_id, RequestType type, const Response &response);
+		void OnMasterPlaylist(const Response &response);
+		void OnChunklist(RequestType type, const Response &response);
+		void RequestChunklist(int after_ms);
+
+		// Queues the parts that were added since the last playlist
+		void QueueParts(const LLHlsChunklist &chunklist);
+		void RequestNextPart();
+		// Returns false if the URI has already been requested
+		bool MarkRequested(const ov::String &uri);
+
+		void ReportStoppedIfDone();
+
+		Config _config;
+		std::shared_ptr<ov::SocketPool> _socket_pool;
+		ov::DelayQueue &_queue;
+		LoadStats &_stats;
+		std::function<void()> _on_stopped;
+
+		// The variables below are only used on the thread of the delay queue
+		ov::String _chunklist_url;
+		double _part_target = 0.0;
+		int64_t _last_response_us = -1;
+
+		LLHlsPart _last_queued_part;
+		std::deque<ov::String> _part_queue;
+		bool _is_part_requested = false;
+		// The last URIs of the parts and hints that were requested, so that a part is not requested twice
+		std::deque<ov::String> _requested_uris;
+
+		// The requests in progress
+		std::map<uint64_t, std::shared_ptr<http::clnt::HttpClientV2>> _requests;
+		uint64_t _next_request_id = 0;
+		bool _stopping = false;
+		std::atomic<bool> _is_stopped{false};
+	};
+}  // namespace load
@@ -0,0 +1,219 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "llhls_playlist.h"
+
+namespace load
+{
+	namespace
+	{
+		ov::String GetTagValue(const ov::String &line, const char *tag)
+		{
+			return line.Substring(::strlen(tag));
+		}
+	}  // namespace
+
+	LLHlsChunklist LLHlsChunklist::Parse(const ov::String &playlist)
+	{
+		LLHlsChunklist chunklist;
+		int64_t msn = 0;
+		int64_t part_index = -1;
+
+		for (const auto &raw_line : playlist.Split("\n"))
+		{
+			auto line = raw_line.Trim();
+
+			if (line.IsEmpty())
+			{
+				continue;
+			}
+
+			if (line.HasPrefix("#EXT-X-MEDIA-SEQUENCE:"))
+			{
+				chunklist.media_sequence = ov::Converter::ToInt64(GetTagValue(line, "#EXT-X-MEDIA-SEQUENCE:"));
+				msn = chunklist.media_sequence;
+			}
+			else if (line.HasPrefix("#EXT-X-TARGETDURATION:"))
+			{
+				chunklist.target_duration = ov::Converter::ToDouble(GetTagValue(line, "#EXT-X-TARGETDURATION:"));
+			}
+			else if (line.HasPrefix("#EXT-X-PART-INF:"))
+			{
+				chunklist.part_target = ov::Converter::ToDouble(GetAttribute(line, "PART-TARGET"));
+			}
+			else if (line.HasPrefix("#EXT-X-SERVER-CONTROL:"))
+			{
+				chunklist.can_block_reload = (GetAttribute(line, "CAN-BLOCK-RELOAD") == "YES");
+			}
+			else if (line.HasPrefix("#EXT-X-PART:"))
+			{
+				part_index++;
+
+				LLHlsPart part;
+				part.msn = msn;
+				part.index = part_index;
+				part.uri = GetAttribute(line, "URI");
+
+				chunklist.parts.push_back(part);
+			}
+			else if (line.HasPrefix("#EXT-X-PRELOAD-HINT:"))
+			{
+				if (GetAttribute(line, "TYPE") == "PART")
+				{
+					chunklist.preload_hint = GetAttribute(line, "URI");
+				}
+			}
+			else if (line.HasPrefix("#") == false)
+			{
+				// URI of a completed segment
+				msn++;
+				part_index = -1;
+			}
+		}
+
+		chunklist.next_msn = msn;
+
+		return chunklist;
+	}
+
+	void LLHlsChunklist::GetNextDirectives(int64_t *msn, int64_t *part) const
+	{
+		if (parts.empty())
+		{
+			*msn = next_msn;
+			*part = 0;
+			return;
+		}
+
+		const auto &last_part = parts.back();
+
+		*msn = last_part.msn;
+		*part = last_part.index + 1;
+	}
+
+	ov::String GetFirstVariant(const ov::String &playlist)
+	{
+		bool stream_inf = false;
+
+		for (const auto &raw_line : playlist.Split("\n"))
+		{
+			auto line = raw_line.Trim();
+
+			if (line.HasPrefix("#EXT-X-STREAM-INF"))
+			{
+				stream_inf = true;
+			}
+			else if (stream_inf && (line.IsEmpty() == false) && (line.HasPrefix("#") == false))
+			{
+				return line;
+			}
+		}
+
+		return "";
+	}
+
+	ov::String GetAttribute(const ov::String &line, const char *name)
+	{
+		auto colon = line.IndexOf(':');
+		if (colon < 0)
+		{
+			return "";
+		}
+
+		auto rest = line.Substring(colon + 1);
+
+		while (rest.IsEmpty() == false)
+		{
+			auto equal = rest.IndexOf('=');
+			if (equal < 0)
+			{
+				return "";
+			}
+
+			auto key = rest.Left(equal).Trim();
+			rest = rest.Substring(equal + 1);
+
+			ov::String value;
+
+			if (rest.HasPrefix('"'))
+			{
+				auto end = rest.IndexOf('"', 1);
+				if (end < 0)
+				{
+					return "";
+				}
+
+				value = rest.Substring(1, end - 1);
+				rest = rest.Substring(end + 1);
+			}
+			else
+			{
+				auto end = rest.IndexOf(',');
+				if (end < 0)
+				{
+					end = rest.GetLength();
+				}
+
+				value = rest.Left(end);
+				rest = rest.Substring(end);
+			}
+
+			if (rest.HasPrefix(','))
+			{
+				rest = rest.Substring(1);
+			}
+
+			if (key == name)
+			{
+				return value;
+			}
+		}
+
+		return "";
+	}
+
+	ov::String ResolveUrl(const ov::String &base_url, const ov::String &uri)
+	{
+		if (uri.IndexOf("://") >= 0)
+		{
+			return uri;
+		}
+
+		auto scheme_end = base_url.IndexOf("://");
+		if (scheme_end < 0)
+		{
+			return uri;
+		}
+
+		if (uri.HasPrefix('/'))
+		{
+			// Absolute path: scheme://authority + uri
+			auto path_start = base_url.IndexOf('/', scheme_end + 3);
+
+			return ((path_start < 0) ? base_url : base_url.Left(path_start)) + uri;
+		}
+
+		// Relative path: the directory of the base URL, without its query
+		auto query_start = base_url.IndexOf('?');
+		auto path = (query_start < 0) ? base_url : base_url.Left(query_start);
+		auto directory_end = path.IndexOfRev('/');
+
+		if (directory_end < scheme_end + 3)
+		{
+			return path + "/" + uri;
+		}
+
+		return path.Left(directory_end + 1) + uri;
+	}
+
+	ov::String MakeBlockingReloadUrl(const ov::String &url, int64_t msn, int64_t part)
+	{
+		return ov::String::FormatString("%s%c_HLS_msn=%" PRId64 "&_HLS_part=%" PRId64,
+										url.CStr(), (url.IndexOf('?') < 0) ? '?' : '&', msn, part);
+	}
+}  // namespace load
@@ -0,0 +1,61 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <vector>
+
+namespace load
+{
+	struct LLHlsPart
+	{
+		int64_t msn = -1;
+		int64_t index = -1;
+		ov::String uri;
+
+		bool IsAfter(const LLHlsPart &other) const
+		{
+			return (msn > other.msn) || ((msn == other.msn) && (index > other.index));
+		}
+	};
+
+	// What a player needs of a media playlist (chunklist) of LL-HLS
+	struct LLHlsChunklist
+	{
+		int64_t media_sequence = 0;
+		double target_duration = 0.0;
+		double part_target = 0.0;
+		bool can_block_reload = false;
+		// Media sequence number of the segment that follows the last completed segment
+		int64_t next_msn = 0;
+		std::vector<LLHlsPart> parts;
+		// URI of the EXT-X-PRELOAD-HINT of TYPE=PART
+		ov::String preload_hint;
+
+		static LLHlsChunklist Parse(const ov::String &playlist);
+
+		// The delivery directives (_HLS_msn, _HLS_part) that request the part after the last one of this playlist.
+		// OvenMediaEngine holds the request until the part or a later segment exists,
+		// so the index after the last part of a segment is also valid.
+		void GetNextDirectives(int64_t *msn, int64_t *part) const;
+	};
+
+	// The URI of the first variant (EXT-X-STREAM-INF) of a master playlist, empty if there is none
+	ov::String GetFirstVariant(const ov::String &playlist);
+
+	// The value of an attribute of a tag, such as URI of `#EXT-X-PART:DURATION=0.5,URI="part.m4s"`
+	ov::String GetAttribute(const ov::String &line, const char *name);
+
+	// Resolves a URI of a playlist against the URL of the playlist (RFC 3986, without dot segments)
+	ov::String ResolveUrl(const ov::String &base_url, const ov::String &uri);
+
+	// Appends _HLS_msn and _HLS_part to the URL of a media playlist
+	ov::String MakeBlockingReloadUrl(const ov::String &url, int64_t msn, int64_t part);
+}  // namespace load
@@ -0,0 +1,56 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <monitoring/latency_metrics.h>
+
+#include <atomic>
+
+namespace load
+{
+	// Requests of one kind (e.g. the blocking playlist reloads) of all players
+	struct RequestStats
+	{
+		// From the request to the last byte of the response
+		mon::LatencyHistogram latency;
+		std::atomic<uint64_t> requests{0};
+		std::atomic<uint64_t> errors{0};
+		std::atomic<uint64_t> bytes{0};
+
+		void Record(int64_t elapsed_us, size_t response_bytes)
+		{
+			latency.Record(elapsed_us);
+			requests++;
+			bytes += response_bytes;
+		}
+	};
+
+	struct LoadStats
+	{
+		RequestStats master;
+		// Blocking playlist reloads (_HLS_msn/_HLS_part), and the reloads of a playlist that cannot block
+		RequestStats playlist;
+		RequestStats part;
+		// EXT-X-PRELOAD-HINT, held by the server until the part is ready
+		RequestStats hint;
+
+		// |interval between two responses of blocking reloads - PART-TARGET|
+		// If the server holds the requests accurately, the responses arrive at every PART-TARGET.
+		mon::LatencyHistogram hold_deviation;
+
+		std::atomic<int64_t> active_players{0};
+		std::atomic<uint64_t> started_players{0};
+		std::atomic<uint64_t> stopped_players{0};
+
+		uint64_t GetTotalBytes() const
+		{
+			return master.bytes + playlist.bytes + part.bytes + hint.bytes;
+		}
+	};
+}  // namespace load
@@ -0,0 +1,573 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+//
+// LL-HLS load generator for a running OvenMediaEngine.
+//
+// Publishes a synthetic H.264 stream to the MPEG-TS provider, and plays it back with N simulated LL-HLS players
+// that make blocking playlist reloads, part requests and preload hint requests. It reports the latencies of the
+// requests, how accurately the server holds the blocking reloads, the throughput, and the CPU usage of
+// OvenMediaEngine per 1000 players, so that the results of two builds can be compared. See README.md.
+//
+#include <base/ovlibrary/delay_queue.h>
+#include <config/config_manager.h>
+#include <json/json.h>
+
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+
+#include "latency/latency_report.h"
+#include "llhls_player.h"
+#include "synthetic_source.h"
+
+// ov::SocketAddress::ToString() reads the privacy option of the config, which is not loaded by this tool
+cfg::ConfigManager::ConfigManager()
+{
+}
+
+cfg::ConfigManager::~ConfigManager()
+{
+}
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	enum class Scenario
+	{
+		// Starts a player every --interval until --players are playing
+		Ramp,
+		// Starts every player at once, like the viewers of a live event that has just begun
+		Flash,
+		// Ramps up, then each player stops after an exponentially distributed lifetime and is replaced by a new one
+		Churn
+	};
+
+	struct Options
+	{
+		load::LLHlsPlayer::Config player;
+
+		int players = 100;
+		Scenario scenario = Scenario::Ramp;
+		int interval_ms = 100;
+		int churn_lifetime_sec = 60;
+
+		// 0: until SIGINT
+		int duration_sec = 60;
+		int summary_interval_ms = 5000;
+		int workers = 4;
+
+		bool source = true;
+		load::SyntheticSource::Config source_config;
+		// The players are started after this, when OvenMediaEngine has made the first segments of the stream
+		int warmup_sec = 5;
+
+		pid_t ome_pid = 0;
+		std::string json_path;
+	};
+
+	volatile std::sig_atomic_t g_interrupted = 0;
+
+	void OnInterrupt(int signal)
+	{
+		g_interrupted = 1;
+	}
+
+	const char *GetScenarioName(Scenario scenario)
+	{
+		switch (scenario)
+		{
+			case Scenario::Ramp:
+				return "ramp";
+
+			case Scenario::Flash:
+				return "flash";
+
+			case Scenario::Churn:
+				break;
+		}
+
+		return "churn";
+	}
+
+	void PrintUsage(const char *program)
+	{
+		::printf(
+			"Usage: %s [options]\n"
+			"  --url <url>                 master or media playlist\n"
+			"                              (http://127.0.0.1:3333/app/stream_4000/llhls.m3u8)\n"
+			"  --players <n>               number of players (100)\n"
+			"  --scenario <name>           ramp | flash | churn (ramp)\n"
+			"  --interval <ms>             interval of the player starts of ramp and churn (100)\n"
+			"  --churn-lifetime <sec>      mean lifetime of a player of churn (60)\n"
+			"  --no-preload-hint           does not request EXT-X-PRELOAD-HINT\n"
+			"  --duration <sec>            time after the warm-up, 0 to run until SIGINT (60)\n"
+			"  --summary-interval <ms>     interval of the summaries (5000)\n"
+			"  --workers <n>               socket pool workers of the players (4)\n"
+			"  --source <host:port>        MPEG-TS/UDP input of OvenMediaEngine (127.0.0.1:4000)\n"
+			"  --no-source                 does not publish, for a stream that is already published\n"
+			"  --warmup <sec>              time between the start of the source and the players (5)\n"
+			"  --width/--height <pixels>   video size of the source, multiples of 16 (640x368)\n"
+			"  --fps <n> --gop <n>         frame rate and keyframe interval of the source (30, 30)\n"
+			"  --bitrate <bps>             video bitrate of the source (1000000)\n"
+			"  --ome-pid <pid>             reports the CPU usage of this process\n"
+			"  --json <path>               writes the final report as JSON\n",
+			program);
+	}
+
+	bool ParseOptions(int argc, char *argv[], Options &options)
+	{
+		auto &source = options.source_config;
+
+		options.player.url = "http://127.0.0.1:3333/app/stream_4000/llhls.m3u8";
+
+		for (int index = 1; index < argc; index++)
+		{
+			std::string name = argv[index];
+
+			if (name == "--no-preload-hint")
+			{
+				options.player.preload_hint = false;
+				continue;
+			}
+
+			if (name == "--no-source")
+			{
+				options.source = false;
+				continue;
+			}
+
+			if ((name == "-h") || (name == "--help") || (index + 1 >= argc))
+			{
+				return false;
+			}
+
+			std::string value = argv[++index];
+
+			if (name == "--url")
+				options.player.url = value.c_str();
+			else if (name == "--players")
+				options.players = std::atoi(value.c_str());
+			else if (name == "--scenario")
+			{
+				if (value == "ramp")
+					options.scenario = Scenario::Ramp;
+				else if (value == "flash")
+					options.scenario = Scenario::Flash;
+				else if (value == "churn")
+					options.scenario = Scenario::Churn;
+				else
+				{
+					::fprintf(stderr, "Unknown scenario: %s\n", value.c_str());
+					return false;
+				}
+			}
+			else if (name == "--interval")
+				options.interval_ms = std::atoi(value.c_str());
+			else if (name == "--churn-lifetime")
+				options.churn_lifetime_sec = std::atoi(value.c_str());
+			else if (name == "--duration")
+				options.duration_sec = std::atoi(value.c_str());
+			else if (name == "--summary-interval")
+				options.summary_interval_ms = std::atoi(value.c_str());
+			else if (name == "--workers")
+				options.workers = std::atoi(value.c_str());
+			else if (name == "--source")
+			{
+				auto colon = value.rfind(':');
+				if (colon == std::string::npos)
+				{
+					::fprintf(stderr, "Invalid source: %s\n", value.c_str());
+					return false;
+				}
+
+				source.host = value.substr(0, colon).c_str();
+				source.port = static_cast<uint16_t>(std::atoi(value.c_str() + colon + 1));
+			}
+			else if (name == "--warmup")
+				options.warmup_sec = std::atoi(value.c_str());
+			else if (name == "--width")
+				source.width = static_cast<uint32_t>(std::atoi(value.c_str()));
+			else if (name == "--height")
+				source.height = static_cast<uint32_t>(std::atoi(value.c_str()));
+			else if (name == "--fps")
+				source.framerate = static_cast<uint32_t>(std::atoi(value.c_str()));
+			else if (name == "--gop")
+				source.gop_size = static_cast<uint32_t>(std::atoi(value.c_str()));
+			else if (name == "--bitrate")
+				source.bitrate = static_cast<uint32_t>(std::atoi(value.c_str()));
+			else if (name == "--ome-pid")
+				options.ome_pid = static_cast<pid_t>(std::atoi(value.c_str()));
+			else if (name == "--json")
+				options.json_path = value;
+			else
+			{
+				::fprintf(stderr, "Unknown option: %s\n", name.c_str());
+				return false;
+			}
+		}
+
+		if ((options.players <= 0) || (options.interval_ms < 0) || (options.churn_lifetime_sec <= 0) || (options.duration_sec < 0) ||
+			(options.summary_interval_ms <= 0) || (options.workers <= 0) || (options.warmup_sec < 0) ||
+			(source.framerate == 0) || (source.gop_size == 0) || ((source.width % 16) != 0) || ((source.height % 16) != 0))
+		{
+			::fprintf(stderr, "Invalid options\n");
+			return false;
+		}
+
+		return true;
+	}
+
+	// Starts and stops the players by the scenario. Everything but the constructor runs on the thread of the delay queue.
+	class PlayerGroup
+	{
+	public:
+		PlayerGroup(const Options &options, const std::shared_ptr<ov::SocketPool> &socket_pool, ov::DelayQueue &queue, load::LoadStats &stats)
+			: _options(options),
+			  _socket_pool(socket_pool),
+			  _queue(queue),
+			  _stats(stats),
+			  _random(std::random_device()())
+		{
+		}
+
+		void Start()
+		{
+			if (_options.scenario == Scenario::Flash)
+			{
+				_queue.Push(
+					[this](void *parameter) -> ov::DelayQueueAction {
+						while (_started < _options.players)
+						{
+							StartPlayer();
+						}
+
+						return ov::DelayQueueAction::Stop;
+					},
+					0);
+
+				return;
+			}
+
+			_queue.Push(
+				[this](void *parameter) -> ov::DelayQueueAction {
+					if ((_stopping == false) && (_started < _options.players))
+					{
+						StartPlayer();
+					}
+
+					return ((_stopping == false) && (_started < _options.players)) ? ov::DelayQueueAction::Repeat : ov::DelayQueueAction::Stop;
+				},
+				_options.interval_ms);
+		}
+
+		void Stop()
+		{
+			_queue.Push(
+				[this](void *parameter) -> ov::DelayQueueAction {
+					_stopping = true;
+
+					// A player is removed from _players when it has stopped
+					for (auto &item : _players)
+					{
+						item.second->Stop();
+					}
+
+					return ov::DelayQueueAction::Stop;
+				},
+				0);
+		}
+
+	private:
+		void StartPlayer()
+		{
+			_started++;
+
+			auto player = std::make_shared<load::LLHlsPlayer>(
+				_options.player, _socket_pool, _queue, _stats,
+				[this, id = _next_id]() {
+					OnPlayerStopped(id);
+				});
+
+			_players.emplace(_next_id, player);
+			_next_id++;
+
+			player->Start();
+
+			if (_options.scenario == Scenario::Churn)
+			{
+				std::exponential_distribution<double> lifetime(1.0 / (_options.churn_lifetime_sec * 1000.0));
+				std::weak_ptr<load::LLHlsPlayer> weak_player = player;
+
+				_queue.Push(
+					[weak_player](void *parameter) -> ov::DelayQueueAction {
+						auto player = weak_player.lock();
+						if (player != nullptr)
+						{
+							player->Stop();
+						}
+
+						return ov::DelayQueueAction::Stop;
+					},
+					static_cast<int>(std::min(lifetime(_random), static_cast<double>(INT32_MAX))));
+			}
+		}
+
+		void OnPlayerStopped(uint64_t id)
+		{
+			_players.erase(id);
+
+			if ((_options.scenario == Scenario::Churn) && (_stopping == false))
+			{
+				// Replaced by a new viewer
+				StartPlayer();
+			}
+		}
+
+		const Options &_options;
+		std::shared_ptr<ov::SocketPool> _socket_pool;
+		ov::DelayQueue &_queue;
+		load::LoadStats &_stats;
+
+		std::mt19937 _random;
+		std::map<uint64_t, std::shared_ptr<load::LLHlsPlayer>> _players;
+		uint64_t _next_id = 0;
+		int _started = 0;
+		bool _stopping = false;
+	};
+
+	struct Throughput
+	{
+		uint64_t bytes = 0;
+		Clock::time_point time = Clock::now();
+	};
+
+	double ToMs(int64_t us)
+	{
+		return us / 1000.0;
+	}
+
+	void PrintRequestStats(const char *name, const load::RequestStats &stats)
+	{
+		const auto &latency = stats.latency;
+
+		::printf("  %-9s %10lu %8lu %9.1f %9.1f %9.1f %9.1f\n", name,
+				 static_cast<unsigned long>(stats.requests), static_cast<unsigned long>(stats.errors),
+				 ToMs(latency.GetPercentile(50.0)), ToMs(latency.GetPercentile(90.0)), ToMs(latency.GetPercentile(99.0)), ToMs(latency.GetMax()));
+	}
+
+	// The latencies are of the whole run, the throughput and the CPU usage are of the last interval
+	void PrintSummary(const load::LoadStats &stats, int64_t players, double elapsed_sec, double bits_per_sec, double cpu_percent)
+	{
+		::printf("[%7.1fs] players: %ld active, %lu started, %lu stopped\n", elapsed_sec,
+				 static_cast<long>(players), static_cast<unsigned long>(stats.started_players), static_cast<unsigned long>(stats.stopped_players));
+		::printf("  %-9s %10s %8s %9s %9s %9s %9s\n", "request", "count", "errors", "p50(ms)", "p90(ms)", "p99(ms)", "max(ms)");
+
+		PrintRequestStats("master", stats.master);
+		PrintRequestStats("playlist", stats.playlist);
+		PrintRequestStats("part", stats.part);
+		PrintRequestStats("hint", stats.hint);
+
+		::printf("  hold deviation from PART-TARGET: p50 %.1f ms, p99 %.1f ms, max %.1f ms\n",
+				 ToMs(stats.hold_deviation.GetPercentile(50.0)), ToMs(stats.hold_deviation.GetPercentile(99.0)), ToMs(stats.hold_deviation.GetMax()));
+		::printf("  throughput: %.2f Mbps, %.1f kbps per player\n",
+				 bits_per_sec / 1000000.0, (players > 0) ? (bits_per_sec / 1000.0 / players) : 0.0);
+
+		if (cpu_percent >= 0.0)
+		{
+			::printf("  OvenMediaEngine CPU: %.1f%%, %.1f%% per 1000 players (100%% = one core)\n",
+					 cpu_percent, (players > 0) ? (cpu_percent * 1000.0 / players) : 0.0);
+		}
+
+		::fflush(stdout);
+	}
+
+	Json::Value ToJson(const load::RequestStats &stats)
+	{
+		Json::Value value;
+
+		value["requests"] = static_cast<Json::UInt64>(stats.requests);
+		value["errors"] = static_cast<Json::UInt64>(stats.errors);
+		value["bytes"] = static_cast<Json::UInt64>(stats.bytes);
+		value["p50Ms"] = ToMs(stats.latency.GetPercentile(50.0));
+		value["p90Ms"] = ToMs(stats.latency.GetPercentile(90.0));
+		value["p99Ms"] = ToMs(stats.latency.GetPercentile(99.0));
+		value["maxMs"] = ToMs(stats.latency.GetMax());
+
+		return value;
+	}
+
+	bool WriteJson(const Options &options, const load::LoadStats &stats, int players, double elapsed_sec, double cpu_percent)
+	{
+		Json::Value root;
+
+		root["url"] = options.player.url.CStr();
+		root["scenario"] = GetScenarioName(options.scenario);
+		root["players"] = players;
+		root["preloadHint"] = options.player.preload_hint;
+		root["durationSec"] = elapsed_sec;
+
+		root["master"] = ToJson(stats.master);
+		root["playlist"] = ToJson(stats.playlist);
+		root["part"] = ToJson(stats.part);
+		root["hint"] = ToJson(stats.hint);
+
+		root["holdDeviation"]["p50Ms"] = ToMs(stats.hold_deviation.GetPercentile(50.0));
+		root["holdDeviation"]["p99Ms"] = ToMs(stats.hold_deviation.GetPercentile(99.0));
+		root["holdDeviation"]["maxMs"] = ToMs(stats.hold_deviation.GetMax());
+
+		auto bits_per_sec = (elapsed_sec > 0.0) ? (stats.GetTotalBytes() * 8.0 / elapsed_sec) : 0.0;
+		root["bitsPerSec"] = bits_per_sec;
+		root["bitsPerSecPerPlayer"] = bits_per_sec / players;
+
+		if (cpu_percent >= 0.0)
+		{
+			root["cpuPercent"] = cpu_percent;
+			root["cpuPercentPer1000Players"] = cpu_percent * 1000.0 / players;
+		}
+
+		std::ofstream file(options.json_path);
+		file << Json::writeString(Json::StreamWriterBuilder(), root) << std::endl;
+
+		return file.good();
+	}
+}  // namespace
+
+int main(int argc, char *argv[])
+{
+	Options options;
+
+	if (ParseOptions(argc, argv, options) == false)
+	{
+		PrintUsage(argv[0]);
+		return 2;
+	}
+
+	std::signal(SIGINT, OnInterrupt);
+	std::signal(SIGPIPE, SIG_IGN);
+
+	std::unique_ptr<load::SyntheticSource> source;
+
+	if (options.source)
+	{
+		source = std::make_unique<load::SyntheticSource>(options.source_config);
+
+		if (source->Start() == false)
+		{
+			return 1;
+		}
+
+		::printf("Publishing %ux%u %ufps %u bps to %s:%u, the players start in %d sec\n",
+				 options.source_config.width, options.source_config.height, options.source_config.framerate, options.source_config.bitrate,
+				 options.source_config.host.CStr(), options.source_config.port, options.warmup_sec);
+
+		for (int count = 0; (count < options.warmup_sec * 10) && (g_interrupted == 0); count++)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(100));
+		}
+	}
+
+	auto socket_pool = ov::SocketPool::Create("LLHlsLoad", ov::SocketType::Tcp, false);
+	if ((socket_pool == nullptr) || (socket_pool->Initialize(options.workers) == false))
+	{
+		::fprintf(stderr, "Could not initialize the socket pool\n");
+		return 1;
+	}
+
+	ov::DelayQueue queue("LLHlsLoad", ov::DelayQueueThreadMode::Dedicated);
+	queue.Start();
+
+	load::LoadStats stats;
+	PlayerGroup group(options, socket_pool, queue, stats);
+
+	::printf("%s: %d players of %s\n", GetScenarioName(options.scenario), options.players, options.player.url.CStr());
+
+	// One sampler for the whole run, one for each summary
+	lb::CpuSampler total_cpu(options.ome_pid);
+	lb::CpuSampler interval_cpu(options.ome_pid);
+	bool cpu_sampling = (options.ome_pid > 0) && total_cpu.Start() && interval_cpu.Start();
+
+	auto start_time = Clock::now();
+	auto end_time = start_time + std::chrono::seconds(options.duration_sec);
+	auto next_summary_time = start_time + std::chrono::milliseconds(options.summary_interval_ms);
+	Throughput last;
+
+	group.Start();
+
+	while ((g_interrupted == 0) && ((options.duration_sec == 0) || (Clock::now() < end_time)))
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+		auto now = Clock::now();
+		if (now < next_summary_time)
+		{
+			continue;
+		}
+
+		next_summary_time += std::chrono::milliseconds(options.summary_interval_ms);
+
+		Throughput current;
+		current.bytes = stats.GetTotalBytes();
+		current.time = now;
+
+		auto interval_sec = std::chrono::duration<double>(current.time - last.time).count();
+		auto cpu_percent = cpu_sampling ? interval_cpu.GetUsagePercent() : -1.0;
+
+		PrintSummary(stats, stats.active_players, std::chrono::duration<double>(now - start_time).count(), (current.bytes - last.bytes) * 8.0 / interval_sec, cpu_percent);
+
+		last = current;
+		if (cpu_sampling)
+		{
+			interval_cpu.Start();
+		}
+	}
+
+	auto elapsed_sec = std::chrono::duration<double>(Clock::now() - start_time).count();
+	auto cpu_percent = cpu_sampling ? total_cpu.GetUsagePercent() : -1.0;
+	// The players of the report, as they are stopped below
+	auto players = static_cast<int>(stats.active_players.load());
+
+	group.Stop();
+
+	// The requests in progress are finished (a blocking reload is held for a part at most) or time out
+	auto stop_deadline = Clock::now() + std::chrono::milliseconds(options.player.connection_timeout_ms + 5000);
+	while ((stats.active_players > 0) && (Clock::now() < stop_deadline))
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	}
+
+	::printf("Final report:\n");
+	PrintSummary(stats, players, elapsed_sec, stats.GetTotalBytes() * 8.0 / elapsed_sec, cpu_percent);
+
+	int result = 0;
+
+	if ((options.json_path.empty() == false) && (WriteJson(options, stats, std::max(players, 1), elapsed_sec, cpu_percent) == false))
+	{
+		::fprintf(stderr, "Could not write %s\n", options.json_path.c_str());
+		result = 1;
+	}
+
+	queue.Stop();
+	socket_pool->Uninitialize();
+
+	if (source != nullptr)
+	{
+		source->Stop();
+	}
+
+	return result;
+}
@@ -0,0 +1,185 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "synthetic_source.h"
+
+#include <chrono>
+
+// 7 * 188 bytes, the usual payload of MPEG-TS over UDP
+#define SYNTHETIC_SOURCE_PACKETS_PER_DATAGRAM 7
+
+namespace load
+{
+	void SyntheticSource::Sink::OnPsi(const std::vector<std::shared_ptr<const MediaTrack>> &tracks, const std::vector<std::shared_ptr<mpegts::Packet>> &psi_packets)
+	{
+		_psi_packets = psi_packets;
+	}
+
+	void SyntheticSource::Sink::OnFrame(const std::shared_ptr<const MediaPacket> &media_packet, const std::vector<std::shared_ptr<mpegts::Packet>> &pes_packets)
+	{
+		// A receiver can start from any keyframe
+		if (media_packet->IsKeyFrame())
+		{
+			for (auto &packet : _psi_packets)
+			{
+				// A repeated section is a new packet of its PID, which the depacketizer of OvenMediaEngine checks
+				if (_is_psi_sent)
+				{
+					packet->SetContinuityCounter((packet->ContinuityCounter() + 1) % 16);
+				}
+
+				_packets.push_back(packet);
+			}
+
+			_is_psi_sent = true;
+		}
+
+		_packets.insert(_packets.end(), pes_packets.begin(), pes_packets.end());
+	}
+
+	std::vector<std::shared_ptr<mpegts::Packet>> SyntheticSource::Sink::TakePackets()
+	{
+		return std::move(_packets);
+	}
+
+	SyntheticSource::SyntheticSource(const Config &config)
+		: _config(config),
+		  _generator(config.width, config.height, config.framerate, config.gop_size, config.bitrate),
+		  _sink(std::make_shared<Sink>())
+	{
+		_track = std::make_shared<MediaTrack>();
+		_track->SetId(0);
+		_track->SetMediaType(cmn::MediaType::Video);
+		_track->SetCodecId(cmn::MediaCodecId::H264);
+		_track->SetOriginBitstream(cmn::BitstreamFormat::H264_ANNEXB);
+		_track->SetTimeBase(1, 90000);
+		_track->SetWidth(static_cast<int32_t>(config.width));
+		_track->SetHeight(static_cast<int32_t>(config.height));
+		_track->SetFrameRateByConfig(config.framerate);
+
+		_packetizer.AddSink(_sink);
+		_packetizer.AddTrack(_track);
+		_packetizer.Start();
+	}
+
+	SyntheticSource::~SyntheticSource()
+	{
+		Stop();
+	}
+
+	bool SyntheticSource::SendNextFrame(const DatagramHandler &handler)
+	{
+		lb::LatencyMarker marker;
+		marker.wallclock_us = lb::LatencyMarkerCodec::GetWallclockUs();
+
+		auto access_unit = _generator.Next(marker);
+		auto annexb = access_unit.ToAnnexB();
+		auto duration = static_cast<int64_t>(90000 / _config.framerate);
+
+		auto media_packet = std::make_shared<MediaPacket>(
+			0, cmn::MediaType::Video, _track->GetId(),
+			annexb.data(), static_cast<int32_t>(annexb.size()),
+			access_unit.pts, access_unit.pts, duration,
+			access_unit.keyframe ? MediaPacketFlag::Key : MediaPacketFlag::NoFlag,
+			cmn::BitstreamFormat::H264_ANNEXB, cmn::PacketType::NALU);
+
+		if (_packetizer.AppendFrame(media_packet) == false)
+		{
+			return false;
+		}
+
+		auto packets = _sink->TakePackets();
+		std::shared_ptr<ov::Data> datagram;
+
+		for (size_t index = 0; index < packets.size(); index++)
+		{
+			if (datagram == nullptr)
+			{
+				datagram = std::make_shared<ov::Data>(SYNTHETIC_SOURCE_PACKETS_PER_DATAGRAM * 188);
+			}
+
+			datagram->Append(packets[index]->GetData());
+
+			if ((((index + 1) % SYNTHETIC_SOURCE_PACKETS_PER_DATAGRAM) == 0) || ((index + 1) == packets.size()))
+			{
+				handler(datagram);
+				datagram = nullptr;
+			}
+		}
+
+		_sent_frames++;
+
+		return true;
+	}
+
+	bool SyntheticSource::Start()
+	{
+		_address = ov::SocketAddress::CreateAndGetFirst(_config.host, _config.port);
+		if (_address.IsValid() == false)
+		{
+			::fprintf(stderr, "Invalid address of the source: %s:%u\n", _config.host.CStr(), _config.port);
+			return false;
+		}
+
+		_socket_pool = ov::SocketPool::Create("SyntheticSource", ov::SocketType::Udp, false);
+		if ((_socket_pool == nullptr) || (_socket_pool->Initialize(1) == false))
+		{
+			return false;
+		}
+
+		_socket = _socket_pool->AllocSocket(_address.GetFamily());
+		if ((_socket == nullptr) || (_socket->MakeBlocking() == false))
+		{
+			::fprintf(stderr, "Could not create a UDP socket\n");
+			return false;
+		}
+
+		_stop = false;
+		_thread = std::thread(&SyntheticSource::ThreadProc, this);
+
+		return true;
+	}
+
+	void SyntheticSource::Stop()
+	{
+		_stop = true;
+
+		if (_thread.joinable())
+		{
+			_thread.join();
+		}
+
+		if (_socket != nullptr)
+		{
+			_socket->Close();
+			_socket = nullptr;
+		}
+
+		if (_socket_pool != nullptr)
+		{
+			_socket_pool->Uninitialize();
+			_socket_pool = nullptr;
+		}
+	}
+
+	void SyntheticSource::ThreadProc()
+	{
+		auto frame_interval = std::chrono::microseconds(1000000 / _config.framerate);
+		auto next_frame_time = std::chrono::steady_clock::now();
+
+		while (_stop == false)
+		{
+			SendNextFrame([this](const std::shared_ptr<const ov::Data> &datagram) {
+				_socket->SendTo(_address, datagram);
+			});
+
+			next_frame_time += frame_interval;
+			std::this_thread::sleep_until(next_frame_time);
+		}
+	}
+}  // namespace load
@@ -0,0 +1,92 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovsocket/ovsocket.h>
+#include <modules/containers/mpegts/mpegts_packetizer.h>
+
+#include <atomic>
+#include <thread>
+
+#include "latency/h264_generator.h"
+
+namespace load
+{
+	// Publishes a synthetic H.264 stream (latency/h264_generator.h) to the MPEG-TS provider of OvenMediaEngine over UDP,
+	// so that a load test needs neither an encoder nor a media file.
+	//
+	// The frames are packetized by mpegts::Packetizer, the PAT and PMT are repeated before every keyframe,
+	// and each frame is sent in datagrams of up to 7 TS packets at the frame rate.
+	class SyntheticSource
+	{
+	public:
+		struct Config
+		{
+			ov::String host = "127.0.0.1";
+			// The MPEG-TS port of the default Server.xml, which publishes "stream_4000"
+			uint16_t port = 4000;
+
+			uint32_t width = 640;
+			uint32_t height = 368;
+			uint32_t framerate = 30;
+			uint32_t gop_size = 30;
+			uint32_t bitrate = 1000000;
+		};
+
+		using DatagramHandler = std::function<void(const std::shared_ptr<const ov::Data> &datagram)>;
+
+		explicit SyntheticSource(const Config &config);
+		~SyntheticSource();
+
+		// Packetizes the next frame, and calls `handler` for each datagram of it
+		bool SendNextFrame(const DatagramHandler &handler);
+
+		// Sends the frames to host:port from a thread until Stop()
+		bool Start();
+		void Stop();
+
+		uint64_t GetSentFrames() const
+		{
+			return _sent_frames;
+		}
+
+	private:
+		class Sink : public mpegts::PacketizerSink
+		{
+		public:
+			void OnPsi(const std::vector<std::shared_ptr<const MediaTrack>> &tracks, const std::vector<std::shared_ptr<mpegts::Packet>> &psi_packets) override;
+			void OnFrame(const std::shared_ptr<const MediaPacket> &media_packet, const std::vector<std::shared_ptr<mpegts::Packet>> &pes_packets) override;
+
+			// TS packets of the frame that has just been packetized
+			std::vector<std::shared_ptr<mpegts::Packet>> TakePackets();
+
+		private:
+			std::vector<std::shared_ptr<mpegts::Packet>> _psi_packets;
+			bool _is_psi_sent = false;
+			std::vector<std::shared_ptr<mpegts::Packet>> _packets;
+		};
+
+		void ThreadProc();
+
+		Config _config;
+		lb::H264Generator _generator;
+
+		std::shared_ptr<MediaTrack> _track;
+		mpegts::Packetizer _packetizer;
+		std::shared_ptr<Sink> _sink;
+
+		std::shared_ptr<ov::SocketPool> _socket_pool;
+		std::shared_ptr<ov::Socket> _socket;
+		ov::SocketAddress _address;
+
+		std::atomic<bool> _stop{false};
+		std::thread _thread;
+		std::atomic<uint64_t> _sent_frames{0};
+	};
+}  // namespace load
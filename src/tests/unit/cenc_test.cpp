@@ -0,0 +1,371 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <base/ovcrypto/aes.h>
+#include <modules/bitstream/h264/h264_decoder_configuration_record.h>
+#include <modules/containers/bmff/cenc.h>
+
+#include <random>
+
+#include "common/cenc_reference.h"
+#include "common/test.h"
+#include "latency/h264_generator.h"
+
+// Known-answer tests of ov::AES (NIST SP 800-38A, F.1.1, F.2.1 and F.5.1) and of bmff::Encryptor,
+// which is also compared with the block by block implementation of common/cenc_reference.h
+namespace
+{
+	std::vector<uint8_t> FromHex(const std::string &hex)
+	{
+		std::vector<uint8_t> bytes;
+
+		for (size_t index = 0; index + 1 < hex.size(); index += 2)
+		{
+			bytes.push_back(static_cast<uint8_t>(std::stoi(hex.substr(index, 2), nullptr, 16)));
+		}
+
+		return bytes;
+	}
+
+	std::shared_ptr<ov::Data> ToData(const std::vector<uint8_t> &bytes)
+	{
+		return std::make_shared<ov::Data>(bytes.data(), bytes.size());
+	}
+
+	std::vector<uint8_t> ToBytes(const std::shared_ptr<const ov::Data> &data)
+	{
+		auto bytes = data->GetDataAs<uint8_t>();
+		return std::vector<uint8_t>(bytes, bytes + data->GetLength());
+	}
+
+	const auto NistKey = FromHex("2b7e151628aed2a6abf7158809cf4f3c");
+	const auto NistPlaintext = FromHex(
+		"6bc1bee22e409f96e93d7e117393172a"
+		"ae2d8a571e03ac9c9eb76fac45af8e51"
+		"30c81c46a35ce411e5fbc1191a0a52ef"
+		"f69f2445df4f9b17ad2b417be66c3710");
+
+	bmff::CencProperty MakeProperty(bmff::CencProtectScheme scheme, const std::vector<uint8_t> &iv)
+	{
+		bmff::CencProperty property;
+
+		property.scheme = scheme;
+		property.key_id = ToData(std::vector<uint8_t>(16, 0x11));
+		property.key = ToData(NistKey);
+		property.iv = ToData(iv);
+
+		return property;
+	}
+
+	std::shared_ptr<MediaTrack> MakeAudioTrack()
+	{
+		auto track = std::make_shared<MediaTrack>();
+
+		track->SetMediaType(cmn::MediaType::Audio);
+		track->SetCodecId(cmn::MediaCodecId::Aac);
+
+		return track;
+	}
+
+	std::shared_ptr<MediaTrack> MakeVideoTrack(const lb::H264Generator &generator)
+	{
+		auto track = std::make_shared<MediaTrack>();
+
+		track->SetMediaType(cmn::MediaType::Video);
+		track->SetCodecId(cmn::MediaCodecId::H264);
+
+		auto record_bytes = generator.MakeDecoderConfigurationRecord();
+		auto record = std::make_shared<AVCDecoderConfigurationRecord>();
+		record->Parse(ToData(record_bytes));
+		track->SetDecoderConfigurationRecord(record);
+
+		return track;
+	}
+
+	bmff::Sample MakeSample(const std::shared_ptr<MediaTrack> &track, const std::vector<uint8_t> &bytes, cmn::BitstreamFormat format)
+	{
+		auto packet = std::make_shared<MediaPacket>(0, track->GetMediaType(), 0, ToData(bytes), 0, 0, 0,
+													MediaPacketFlag::Key, format, cmn::PacketType::NALU);
+		return bmff::Sample(packet);
+	}
+
+	// Encrypts the sample and returns the encrypted bytes (empty on failure)
+	std::vector<uint8_t> Encrypt(bmff::Encryptor &encryptor, const bmff::Sample &clear_sample, bmff::Sample &cipher_sample)
+	{
+		if (encryptor.Encrypt(clear_sample, cipher_sample) == false)
+		{
+			return {};
+		}
+
+		return ToBytes(cipher_sample._media_packet->GetData());
+	}
+}  // namespace
+
+TEST(AES, Ecb128KnownAnswer)
+{
+	std::vector<uint8_t> output(NistPlaintext.size());
+
+	EXPECT_TRUE(ov::AES::EncryptWith128Ecb(NistPlaintext.data(), NistPlaintext.size(), output.data(), NistKey.data(), NistKey.size()));
+	EXPECT_TRUE(output == FromHex(
+							  "3ad77bb40d7a3660a89ecaf32466ef97"
+							  "f5d3d58503b9699de785895a96fdbaaf"
+							  "43b1cd7f598ece23881b00e3ed030688"
+							  "7b0c785e27e8ad3f8223207104725dd4"));
+}
+
+TEST(AES, Cbc128KnownAnswer)
+{
+	const auto iv = FromHex("000102030405060708090a0b0c0d0e0f");
+	const auto expected = FromHex(
+		"7649abac8119b246cee98e9b12e9197d"
+		"5086cb9b507219ee95db113a917678b2"
+		"73bed6b8e3c1743b7116e69e22229516"
+		"3ff1caa1681fac09120eca307586e1a7");
+
+	std::vector<uint8_t> output(NistPlaintext.size() + 16);
+	EXPECT_TRUE(ov::AES::EncryptWith128Cbc(NistPlaintext.data(), NistPlaintext.size(), output.data(), NistKey.data(), NistKey.size(), iv.data(), iv.size()));
+	output.resize(NistPlaintext.size());
+	EXPECT_TRUE(output == expected);
+
+	// The long-lived context gives the same chain when it is fed in pieces, and ResetIv() restarts it
+	ov::AES aes;
+	ASSERT_TRUE(aes.Initialize(EVP_aes_128_cbc(), NistKey.data(), NistKey.size(), iv.data(), iv.size(), false));
+
+	for (int round = 0; round < 2; round++)
+	{
+		std::vector<uint8_t> chained(NistPlaintext.size());
+		EXPECT_TRUE(aes.Update(NistPlaintext.data(), 16, chained.data()));
+		EXPECT_TRUE(aes.Update(NistPlaintext.data() + 16, 48, chained.data() + 16));
+		EXPECT_TRUE(chained == expected);
+
+		EXPECT_TRUE(aes.ResetIv(iv.data(), iv.size()));
+	}
+}
+
+TEST(AES, Ctr128KnownAnswer)
+{
+	const auto counter = FromHex("f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff");
+	const auto expected = FromHex(
+		"874d6191b620e3261bef6864990db6ce"
+		"9806f66b7970fdff8617187bb9fffdff"
+		"5ae4df3edbd5d35e5b4f09020db03eab"
+		"1e031dda2fbe03d1792170a0f3009cee");
+
+	ov::AES aes;
+	ASSERT_TRUE(aes.Initialize(EVP_aes_128_ctr(), NistKey.data(), NistKey.size(), counter.data(), counter.size(), false));
+
+	for (int round = 0; round < 2; round++)
+	{
+		// The keystream continues across updates that are not aligned to the block
+		std::vector<uint8_t> output(NistPlaintext.size());
+		EXPECT_TRUE(aes.Update(NistPlaintext.data(), 5, output.data()));
+		EXPECT_TRUE(aes.Update(NistPlaintext.data() + 5, 30, output.data() + 5));
+		EXPECT_TRUE(aes.Update(NistPlaintext.data() + 35, 29, output.data() + 35));
+		EXPECT_TRUE(output == expected);
+
+		EXPECT_TRUE(aes.ResetIv(counter.data(), counter.size()));
+	}
+
+	EXPECT_FALSE(aes.ResetIv(counter.data(), 8));
+}
+
+// Bytes 8 to 15 of the counter wrap around without a carry into bytes 0 to 7,
+// and the IV of the next sample is incremented by the cipher block count as a 128-bit number
+TEST(Cenc, CtrCounterWrapsAround)
+{
+	auto track = MakeAudioTrack();
+	bmff::Encryptor encryptor(track, MakeProperty(bmff::CencProtectScheme::Cenc, FromHex("0001020304050607fffffffffffffffe")));
+
+	// The keystream of the counters ...fffffffffffffffe, ...ffffffffffffffff and ...0000000000000000 (AES-128-ECB)
+	const auto keystream = FromHex(
+		"eb18472ff22c12c638c5b2e7282d0d20"
+		"3d88a68db0f3e3c66e7fd8c1b1cb797a"
+		"720f9ee37b13a7c8b98e955d56b0f313");
+
+	bmff::Sample cipher_sample;
+	auto cipher = Encrypt(encryptor, MakeSample(track, std::vector<uint8_t>(40, 0), cmn::BitstreamFormat::AAC_RAW), cipher_sample);
+
+	EXPECT_TRUE(cipher == std::vector<uint8_t>(keystream.begin(), keystream.begin() + 40));
+	EXPECT_TRUE(ToBytes(cipher_sample._sai.per_sample_iv) == FromHex("0001020304050607fffffffffffffffe"));
+
+	// 3 blocks were used
+	cipher = Encrypt(encryptor, MakeSample(track, std::vector<uint8_t>(16, 0), cmn::BitstreamFormat::AAC_RAW), cipher_sample);
+	EXPECT_TRUE(ToBytes(cipher_sample._sai.per_sample_iv) == FromHex("00010203040506080000000000000001"));
+
+	std::vector<uint8_t> expected(16);
+	auto next_iv = FromHex("00010203040506080000000000000001");
+	ov::AES::EncryptWith128Ecb(next_iv.data(), next_iv.size(), expected.data(), NistKey.data(), NistKey.size());
+	EXPECT_TRUE(cipher == expected);
+}
+
+// The audio of 'cbcs' is encrypted without a pattern, and the last partial block is left in clear
+TEST(Cenc, CbcsPartialBlockIsLeftInClear)
+{
+	auto track = MakeAudioTrack();
+	bmff::Encryptor encryptor(track, MakeProperty(bmff::CencProtectScheme::Cbcs, FromHex("000102030405060708090a0b0c0d0e0f")));
+
+	// AES-128-CBC of 48 zero bytes
+	const auto chain = FromHex(
+		"50fe67cc996d32b6da0937e99bafec60"
+		"d9a4dada0892239f6b8b3d7680e15674"
+		"a78819583f0308e7a6bf36b1386abf23");
+
+	for (int round = 0; round < 2; round++)
+	{
+		// Every sample restarts the chain with the constant IV
+		bmff::Sample cipher_sample;
+		auto cipher = Encrypt(encryptor, MakeSample(track, std::vector<uint8_t>(40, 0), cmn::BitstreamFormat::AAC_RAW), cipher_sample);
+
+		auto expected = std::vector<uint8_t>(chain.begin(), chain.begin() + 32);
+		expected.resize(40, 0);
+		EXPECT_TRUE(cipher == expected);
+		EXPECT_TRUE(cipher_sample._sai.per_sample_iv == nullptr);
+	}
+
+	// A sample shorter than a block is not encrypted at all
+	bmff::Sample cipher_sample;
+	EXPECT_TRUE(Encrypt(encryptor, MakeSample(track, std::vector<uint8_t>(15, 7), cmn::BitstreamFormat::AAC_RAW), cipher_sample) == std::vector<uint8_t>(15, 7));
+}
+
+// The video of 'cbcs' encrypts 1 of every 10 blocks, the encrypted blocks form one chain
+TEST(Cenc, CbcsPatternEncryptsOneOfTenBlocks)
+{
+	lb::H264Generator generator(64, 32, 30, 30);
+	auto track = MakeVideoTrack(generator);
+	bmff::Encryptor encryptor(track, MakeProperty(bmff::CencProtectScheme::Cbcs, FromHex("000102030405060708090a0b0c0d0e0f")));
+
+	const auto chain = FromHex(
+		"50fe67cc996d32b6da0937e99bafec60"
+		"d9a4dada0892239f6b8b3d7680e15674"
+		"a78819583f0308e7a6bf36b1386abf23");
+
+	struct Case
+	{
+		size_t size;
+		// Offsets of the encrypted blocks
+		std::vector<size_t> offsets;
+	};
+
+	const std::vector<Case> cases = {
+		// The last pattern has a full crypt block and a partial skip
+		{16 * 10 * 2 + 16 + 5, {0, 160, 320}},
+		// The last crypt block is partial
+		{16 * 10 * 2 + 15, {0, 160}},
+		// Exactly one pattern
+		{16 * 10, {0}},
+		{16, {0}},
+		{15, {}},
+	};
+
+	for (const auto &test_case : cases)
+	{
+		// Without sub-samples (not AVCC), the whole sample is protected
+		bmff::Sample cipher_sample;
+		auto cipher = Encrypt(encryptor, MakeSample(track, std::vector<uint8_t>(test_case.size, 0), cmn::BitstreamFormat::H264_ANNEXB), cipher_sample);
+
+		std::vector<uint8_t> expected(test_case.size, 0);
+		for (size_t index = 0; index < test_case.offsets.size(); index++)
+		{
+			::memcpy(&expected[test_case.offsets[index]], &chain[index * 16], 16);
+		}
+
+		EXPECT_TRUE(cipher == expected);
+	}
+}
+
+// H.264 samples of several slices (sub-samples), with the counter wrapping around in the middle of a sample
+TEST(Cenc, MatchesReferenceWithSubSamples)
+{
+	for (auto scheme : {bmff::CencProtectScheme::Cenc, bmff::CencProtectScheme::Cbcs})
+	{
+		// The filler data adds the clear NAL units between the slices
+		lb::H264Generator generator(128, 64, 30, 10, 400000);
+		auto track = MakeVideoTrack(generator);
+
+		auto iv = FromHex("0011223344556677ffffffffffffff00");
+		bmff::Encryptor encryptor(track, MakeProperty(scheme, iv));
+		cenc::Reference reference(NistKey.data(), iv.data());
+
+		std::mt19937 random(1234);
+		size_t sub_sample_count = 0;
+		size_t partial_count = 0;
+
+		for (int index = 0; index < 60; index++)
+		{
+			// 1 to 3 access units in a sample
+			std::vector<uint8_t> bytes;
+			auto access_unit_count = 1 + (random() % 3);
+			for (size_t count = 0; count < access_unit_count; count++)
+			{
+				auto avcc = generator.Next(lb::LatencyMarker()).ToAvcc();
+				bytes.insert(bytes.end(), avcc.begin(), avcc.end());
+			}
+
+			bmff::Sample cipher_sample;
+			auto cipher = Encrypt(encryptor, MakeSample(track, bytes, cmn::BitstreamFormat::H264_AVCC), cipher_sample);
+			ASSERT_TRUE(cipher.size() == bytes.size());
+
+			const auto &sub_samples = cipher_sample._sai._sub_samples;
+			sub_sample_count += sub_samples.size();
+			for (const auto &sub_sample : sub_samples)
+			{
+				partial_count += ((sub_sample.cipher_bytes % 16) != 0) ? 1 : 0;
+			}
+
+			if (scheme == bmff::CencProtectScheme::Cenc)
+			{
+				EXPECT_TRUE(ToBytes(cipher_sample._sai.per_sample_iv) == std::vector<uint8_t>(reference.GetIv(), reference.GetIv() + 16));
+				EXPECT_TRUE(cipher == reference.EncryptCtr(bytes, sub_samples));
+			}
+			else
+			{
+				EXPECT_TRUE(cipher == reference.EncryptCbcs(bytes, sub_samples, 1, 9));
+			}
+		}
+
+		EXPECT_LE(120u, sub_sample_count);
+		EXPECT_LE(1u, partial_count);
+	}
+}
+
+// Random sizes without sub-samples, like the audio tracks
+TEST(Cenc, MatchesReferenceWithoutSubSamples)
+{
+	for (auto scheme : {bmff::CencProtectScheme::Cenc, bmff::CencProtectScheme::Cbcs})
+	{
+		auto track = MakeAudioTrack();
+		auto iv = FromHex("8899aabbccddeeffffffffffffffffe0");
+		bmff::Encryptor encryptor(track, MakeProperty(scheme, iv));
+		cenc::Reference reference(NistKey.data(), iv.data());
+
+		std::mt19937 random(5678);
+
+		for (int index = 0; index < 200; index++)
+		{
+			std::vector<uint8_t> bytes(1 + (random() % 2000));
+			for (auto &byte : bytes)
+			{
+				byte = static_cast<uint8_t>(random());
+			}
+
+			bmff::Sample cipher_sample;
+			auto cipher = Encrypt(encryptor, MakeSample(track, bytes, cmn::BitstreamFormat::AAC_RAW), cipher_sample);
+
+			if (scheme == bmff::CencProtectScheme::Cenc)
+			{
+				EXPECT_TRUE(cipher == reference.EncryptCtr(bytes, {}));
+			}
+			else
+			{
+				EXPECT_TRUE(cipher == reference.EncryptCbcs(bytes, {}, 1, 0));
+			}
+		}
+	}
+}
+
+TEST_MAIN()
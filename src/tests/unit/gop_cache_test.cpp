@@ -0,0 +1,151 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <base/publisher/gop_cache.h>
+
+#include "common/test.h"
+
+namespace
+{
+	constexpr uint64_t VideoKey = 1;
+	constexpr uint64_t AudioKey = 2;
+
+	uint64_t PushVideo(pub::GopCache &cache, int id, bool key_frame, size_t bytes = 100, uint64_t key = VideoKey)
+	{
+		return cache.Push(std::make_any<int>(id), pub::GopCache::PacketInfo(key, true, key_frame, bytes));
+	}
+
+	uint64_t PushAudio(pub::GopCache &cache, int id, size_t bytes = 10)
+	{
+		return cache.Push(std::make_any<int>(id), pub::GopCache::PacketInfo(AudioKey, false, false, bytes));
+	}
+
+	// IDs of the cached packets in the order they are sent to a new session
+	std::vector<int> GetIds(const pub::GopCache &cache)
+	{
+		std::vector<pub::GopCache::Packet> packets;
+		std::vector<int> ids;
+
+		if (cache.GetPackets(packets))
+		{
+			for (const auto &packet : packets)
+			{
+				ids.push_back(std::any_cast<int>(packet.packet));
+			}
+		}
+
+		return ids;
+	}
+}  // namespace
+
+TEST(GopCache, VideoIsCachedFromKeyFrame)
+{
+	pub::GopCache cache;
+
+	PushVideo(cache, 1, false);
+	EXPECT_TRUE(GetIds(cache).empty());
+	EXPECT_EQ(0u, cache.GetTotalBytes());
+
+	PushVideo(cache, 2, true);
+	PushVideo(cache, 3, false);
+	PushVideo(cache, 4, false);
+
+	EXPECT_TRUE(GetIds(cache) == std::vector<int>({2, 3, 4}));
+	EXPECT_EQ(300u, cache.GetTotalBytes());
+}
+
+TEST(GopCache, KeyFrameStartsNewGop)
+{
+	pub::GopCache cache;
+
+	PushVideo(cache, 1, true);
+	PushVideo(cache, 2, false);
+	PushVideo(cache, 3, true);
+	PushVideo(cache, 4, false);
+
+	EXPECT_TRUE(GetIds(cache) == std::vector<int>({3, 4}));
+	EXPECT_EQ(200u, cache.GetTotalBytes());
+}
+
+// Every packet gets a sequence, even if it is not cached, so that the stream workers can skip the cached ones
+TEST(GopCache, SequenceIsGivenToEveryPacket)
+{
+	pub::GopCache cache;
+
+	EXPECT_EQ(1u, PushAudio(cache, 1));
+	EXPECT_EQ(2u, PushVideo(cache, 2, false));
+	EXPECT_EQ(3u, PushVideo(cache, 3, true));
+	EXPECT_EQ(3u, cache.GetLastSequence());
+}
+
+TEST(GopCache, AudioIsKeptFromOldestVideoKeyFrame)
+{
+	pub::GopCache cache;
+
+	PushAudio(cache, 1);
+	PushVideo(cache, 2, true);
+	PushAudio(cache, 3);
+	PushVideo(cache, 4, false);
+	PushAudio(cache, 5);
+
+	EXPECT_TRUE(GetIds(cache) == std::vector<int>({2, 3, 4, 5}));
+
+	// The audio older than the new keyframe is dropped with the old GOP
+	PushVideo(cache, 6, true);
+	PushAudio(cache, 7);
+
+	EXPECT_TRUE(GetIds(cache) == std::vector<int>({6, 7}));
+	EXPECT_EQ(110u, cache.GetTotalBytes());
+}
+
+TEST(GopCache, CacheIsRebuiltWhenExceedingMaxBytes)
+{
+	pub::GopCache cache;
+	cache.SetMaxBytes(250);
+
+	PushVideo(cache, 1, true);
+	PushVideo(cache, 2, false);
+	PushVideo(cache, 3, false);
+
+	EXPECT_TRUE(GetIds(cache).empty());
+	EXPECT_EQ(0u, cache.GetTotalBytes());
+
+	// Not cached until the next keyframe
+	PushVideo(cache, 4, false);
+	EXPECT_TRUE(GetIds(cache).empty());
+
+	PushVideo(cache, 5, true);
+	EXPECT_TRUE(GetIds(cache) == std::vector<int>({5}));
+}
+
+// Each SRT playlist has its own GOP, which is erased with the playlist
+TEST(GopCache, EraseDropsGopOfKey)
+{
+	pub::GopCache cache;
+
+	PushVideo(cache, 1, true, 100, 10);
+	PushVideo(cache, 2, true, 100, 20);
+	PushVideo(cache, 3, false, 100, 10);
+	PushVideo(cache, 4, false, 100, 20);
+
+	EXPECT_TRUE(GetIds(cache) == std::vector<int>({1, 2, 3, 4}));
+
+	cache.Erase(10);
+	EXPECT_TRUE(GetIds(cache) == std::vector<int>({2, 4}));
+	EXPECT_EQ(200u, cache.GetTotalBytes());
+
+	// Unknown key
+	cache.Erase(30);
+	EXPECT_EQ(200u, cache.GetTotalBytes());
+
+	cache.Erase(20);
+	EXPECT_TRUE(GetIds(cache).empty());
+	EXPECT_EQ(0u, cache.GetTotalBytes());
+}
+
+TEST_MAIN()
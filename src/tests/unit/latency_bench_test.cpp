@@ -0,0 +1,227 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <modules/bitstream/h264/h264_decoder_configuration_record.h>
+#include <modules/bitstream/h264/h264_parser.h>
+
+#include "common/test.h"
+#include "latency/h264_generator.h"
+#include "latency/latency_marker.h"
+#include "latency/latency_report.h"
+
+// Tests of the synthetic stream and the latency markers (src/tests/latency), which the load generators use.
+// The generated streams are checked with the parsers of OvenMediaEngine.
+namespace
+{
+	// Removes the emulation prevention bytes
+	std::vector<uint8_t> ToRbsp(const lb::NalUnit &nal_unit)
+	{
+		std::vector<uint8_t> rbsp;
+		int zero_count = 0;
+
+		for (auto byte : nal_unit)
+		{
+			if ((zero_count == 2) && (byte == 0x03))
+			{
+				zero_count = 0;
+				continue;
+			}
+
+			rbsp.push_back(byte);
+			zero_count = (byte == 0x00) ? (zero_count + 1) : 0;
+		}
+
+		return rbsp;
+	}
+}  // namespace
+
+TEST(LatencyMarker, RoundTrip)
+{
+	lb::LatencyMarker marker;
+	marker.wallclock_us = 1760000000123456;
+	marker.sequence = 0x12345678;
+	marker.stream_index = 7;
+
+	auto sei = lb::LatencyMarkerCodec::MakeSeiNalUnit(marker);
+	EXPECT_EQ(6, sei[0] & 0x1F);
+
+	// Found anywhere in a buffer
+	std::vector<uint8_t> buffer(100, 0x00);
+	buffer.insert(buffer.end(), sei.begin(), sei.end());
+	buffer.insert(buffer.end(), 50, 0xAB);
+	buffer.insert(buffer.end(), sei.begin(), sei.end());
+
+	std::vector<lb::LatencyMarker> found;
+	auto count = lb::LatencyMarkerCodec::Scan(buffer.data(), buffer.size(), [&](const lb::LatencyMarker &marker) {
+		found.push_back(marker);
+	});
+
+	EXPECT_EQ(2u, count);
+	ASSERT_TRUE(found.size() == 2);
+	EXPECT_EQ(marker.wallclock_us, found[0].wallclock_us);
+	EXPECT_EQ(marker.sequence, found[0].sequence);
+	EXPECT_EQ(marker.stream_index, found[0].stream_index);
+
+	// No emulation prevention byte is needed
+	EXPECT_TRUE(ToRbsp(sei) == sei);
+
+	// A marker that is cut off is not reported
+	EXPECT_EQ(0u, lb::LatencyMarkerCodec::Scan(sei.data(), sei.size() - 5, [](const lb::LatencyMarker &) {}));
+}
+
+TEST(H264Generator, ParsedByOvenMediaEngine)
+{
+	lb::H264Generator generator(256, 144, 30, 30);
+
+	auto record = std::make_shared<AVCDecoderConfigurationRecord>();
+	auto record_bytes = generator.MakeDecoderConfigurationRecord();
+	ASSERT_TRUE(record->Parse(std::make_shared<ov::Data>(record_bytes.data(), record_bytes.size())));
+
+	H264SPS sps;
+	ASSERT_TRUE(record->GetSPS(0, sps));
+	EXPECT_EQ(256u, sps.GetWidth());
+	EXPECT_EQ(144u, sps.GetHeight());
+	EXPECT_EQ(66, sps.GetProfileIdc());
+
+	for (uint32_t frame = 0; frame < 62; frame++)
+	{
+		lb::LatencyMarker marker;
+		marker.wallclock_us = 1000 + frame;
+		auto access_unit = generator.Next(marker);
+
+		EXPECT_EQ(frame, access_unit.sequence);
+		EXPECT_EQ(static_cast<int64_t>(frame) * 3000, access_unit.pts);
+		EXPECT_EQ((frame % 30) == 0, access_unit.keyframe);
+
+		auto annexb = access_unit.ToAnnexB();
+		EXPECT_EQ(access_unit.keyframe, H264Parser::CheckAnnexBKeyframe(annexb.data(), annexb.size()));
+
+		auto slice = access_unit.nal_units.back();
+		H264SliceHeader header;
+		ASSERT_TRUE(H264Parser::ParseSliceHeader(slice.data(), slice.size(), header, record));
+		EXPECT_TRUE(header.GetSliceType() == (access_unit.keyframe ? H264SliceHeader::SliceType::ISlice : H264SliceHeader::SliceType::PSlice));
+
+		// The marker is found in the Annex B and AVCC forms
+		std::vector<lb::LatencyMarker> found;
+		lb::LatencyMarkerCodec::Scan(annexb.data(), annexb.size(), [&](const lb::LatencyMarker &marker) {
+			found.push_back(marker);
+		});
+		ASSERT_TRUE(found.size() == 1);
+		EXPECT_EQ(marker.wallclock_us, found[0].wallclock_us);
+		EXPECT_EQ(frame, found[0].sequence);
+	}
+}
+
+TEST(H264Generator, IPcmSliceHasExactSize)
+{
+	lb::H264Generator generator(64, 32, 30, 30);
+	auto idr = generator.Next({}).nal_units.back();
+
+	// 8 macroblocks of 384 samples, and the headers that are shorter than a few bytes per macroblock
+	auto rbsp = ToRbsp(idr);
+	EXPECT_GE(rbsp.size(), 8u * 384);
+	EXPECT_LE(rbsp.size(), 8u * 384 + 8 * 2 + 8);
+
+	// The last byte has the rbsp_stop_one_bit
+	EXPECT_TRUE(rbsp.back() != 0);
+}
+
+TEST(H264Generator, FillerReachesBitrate)
+{
+	lb::H264Generator generator(128, 96, 30, 30, 2000000);
+
+	size_t total = 0;
+	for (int frame = 0; frame < 30; frame++)
+	{
+		total += generator.Next({}).ToAnnexB().size();
+	}
+
+	// About one second of the stream
+	EXPECT_GE(total * 8, 2000000u * 95 / 100);
+	EXPECT_LE(total * 8, 2000000u * 110 / 100);
+}
+
+TEST(LatencyMarkerScanner, MarkerSplitAcrossParts)
+{
+	lb::LatencyMarker marker;
+	marker.wallclock_us = 42;
+	marker.sequence = 9;
+	auto sei = lb::LatencyMarkerCodec::MakeSeiNalUnit(marker);
+
+	std::vector<uint8_t> stream(37, 0xFF);
+	stream.insert(stream.end(), sei.begin(), sei.end());
+	stream.insert(stream.end(), sei.begin(), sei.end());
+	stream.insert(stream.end(), 11, 0xFF);
+
+	// Every size of the parts, down to one byte
+	for (size_t part_size = 1; part_size <= stream.size(); part_size++)
+	{
+		std::vector<lb::LatencyMarker> found;
+		lb::LatencyMarkerScanner scanner([&](const lb::LatencyMarker &marker) {
+			found.push_back(marker);
+		});
+
+		for (size_t offset = 0; offset < stream.size(); offset += part_size)
+		{
+			scanner.Feed(stream.data() + offset, std::min(part_size, stream.size() - offset));
+		}
+
+		EXPECT_EQ(2u, found.size());
+	}
+}
+
+// The latency of each frame from the marker, the frames that a player missed, and the warm-up
+TEST(LatencyRecorder, Summarize)
+{
+	lb::LatencyRecorder recorder("llhls", 1000000);
+
+	{
+		lb::LatencyRecorder::Player player(recorder);
+		player.SetConnected();
+
+		for (uint32_t sequence = 0; sequence < 110; sequence++)
+		{
+			lb::LatencyMarker marker;
+			// The first 10 frames are sent during the warm-up
+			marker.wallclock_us = 990000 + static_cast<int64_t>(sequence) * 1000;
+			marker.sequence = sequence;
+
+			// Frames 50 to 52 are lost
+			if ((sequence >= 50) && (sequence <= 52))
+			{
+				continue;
+			}
+
+			// 1 to 97 ms, in order of the frames
+			player.OnMarker(marker, marker.wallclock_us + (sequence - 9) * 1000);
+
+			// A duplicate is ignored
+			if (sequence == 60)
+			{
+				player.OnMarker(marker, marker.wallclock_us + 500000);
+			}
+		}
+	}
+
+	{
+		// A player that never connected
+		lb::LatencyRecorder::Player player(recorder);
+	}
+
+	auto summary = recorder.Summarize();
+	EXPECT_TRUE(summary.name == "llhls");
+	EXPECT_EQ(2u, summary.players);
+	EXPECT_EQ(1u, summary.connected_players);
+	EXPECT_EQ(97u, summary.frames);
+	EXPECT_EQ(3u, summary.lost_frames);
+	EXPECT_EQ(100.0, summary.max_ms);
+	EXPECT_TRUE((summary.p50_ms >= 49.0) && (summary.p50_ms <= 54.0));
+	EXPECT_TRUE((summary.p99_ms >= 98.0) && (summary.p99_ms <= 100.0));
+}
+
+TEST_MAIN()
@@ -0,0 +1,107 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <monitoring/latency_metrics.h>
+
+#include "common/test.h"
+
+TEST(LatencyHistogram, PercentilesAreWithinBucketError)
+{
+	mon::LatencyHistogram histogram;
+
+	for (int64_t value = 1; value <= 10000; value++)
+	{
+		histogram.Record(value);
+	}
+
+	EXPECT_EQ(10000u, histogram.GetCount());
+	EXPECT_EQ(10000, histogram.GetMax());
+
+	auto p50 = histogram.GetPercentile(50.0);
+	auto p99 = histogram.GetPercentile(99.0);
+
+	// Sub buckets of 1/16 of each power of two
+	EXPECT_TRUE((p50 >= 5000 * 0.94) && (p50 <= 5000 * 1.06));
+	EXPECT_TRUE((p99 >= 9900 * 0.94) && (p99 <= 9900 * 1.06));
+}
+
+// A histogram is kept for each stage and window of every stream, so it must stay small
+TEST(LatencyHistogram, IsSmall)
+{
+	EXPECT_GE(static_cast<size_t>(1600), sizeof(mon::LatencyHistogram));
+}
+
+// The percentile of two windows is the same as the percentile of a histogram that has the values of both
+TEST(LatencyHistogram, PercentileOfTwoHistograms)
+{
+	mon::LatencyHistogram first;
+	mon::LatencyHistogram second;
+	mon::LatencyHistogram both;
+
+	for (int64_t value = 1; value <= 3000; value++)
+	{
+		first.Record(value * 3);
+		both.Record(value * 3);
+	}
+
+	for (int64_t value = 1; value <= 1000; value++)
+	{
+		second.Record(value * 50);
+		both.Record(value * 50);
+	}
+
+	for (auto percentile : {1.0, 50.0, 75.0, 90.0, 99.0, 100.0})
+	{
+		EXPECT_EQ(both.GetPercentile(percentile), mon::LatencyHistogram::GetPercentile(&first, &second, percentile));
+	}
+
+	EXPECT_EQ(first.GetPercentile(50.0), mon::LatencyHistogram::GetPercentile(&first, nullptr, 50.0));
+	EXPECT_EQ(second.GetPercentile(50.0), mon::LatencyHistogram::GetPercentile(nullptr, &second, 50.0));
+	EXPECT_EQ(0, mon::LatencyHistogram::GetPercentile(nullptr, nullptr, 50.0));
+}
+
+TEST(LatencyMetrics, PacerQueueDelayIsReportedSeparately)
+{
+	mon::LatencyMetrics metrics(PublisherType::Webrtc);
+
+	for (int index = 0; index < 100; index++)
+	{
+		metrics.RecordPacerQueueDelay(index < 90 ? 1000 : 20000);
+	}
+	// Negative values are ignored
+	metrics.RecordPacerQueueDelay(-1);
+
+	auto pacer = metrics.GetPacerQueueDelay();
+	EXPECT_EQ(100u, pacer.count);
+	EXPECT_TRUE((pacer.p50_us >= 960) && (pacer.p50_us <= 1040));
+	EXPECT_EQ(20000, pacer.max_us);
+
+	// Stages are not affected
+	EXPECT_EQ(0u, metrics.GetStage(MediaTraceStage::Send).count);
+}
+
+// The histograms of a stage are allocated when the first value of the stage is recorded
+TEST(LatencyMetrics, StagesNotRecordedAreEmpty)
+{
+	mon::LatencyMetrics metrics(PublisherType::LLHls);
+
+	auto send = metrics.GetStage(MediaTraceStage::Send);
+	EXPECT_EQ(0u, send.count);
+	EXPECT_EQ(0, send.p99_us);
+	EXPECT_EQ(0u, metrics.GetPacerQueueDelay().count);
+
+	metrics.RecordStage(MediaTraceStage::Send, 2000);
+	metrics.RecordStage(MediaTraceStage::Send, 4000);
+
+	send = metrics.GetStage(MediaTraceStage::Send);
+	EXPECT_EQ(2u, send.count);
+	EXPECT_EQ(4000, send.max_us);
+	EXPECT_EQ(0u, metrics.GetStage(MediaTraceStage::Encode).count);
+}
+
+TEST_MAIN()
@@ -0,0 +1,136 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <publishers/llhls/llhls_chunklist.h>
+
+#include "common/test.h"
+
+namespace
+{
+	constexpr int PartsPerSegment = 4;
+	constexpr double PartDuration = 0.5;
+
+	std::shared_ptr<LLHlsChunklist> CreateChunklist(uint32_t segment_count)
+	{
+		auto track = std::make_shared<MediaTrack>();
+		track->SetId(0);
+		track->SetMediaType(cmn::MediaType::Video);
+		track->SetVariantName("video");
+
+		auto chunklist = std::make_shared<LLHlsChunklist>("chunklist_0_video_llhls.m3u8", track, segment_count, 2, PartDuration, "init_0_video_llhls.m4s", true);
+		chunklist->SetPartHoldBack(PartDuration * 3);
+
+		return chunklist;
+	}
+
+	void AppendPart(const std::shared_ptr<LLHlsChunklist> &chunklist, uint32_t segment_sequence, int part_index)
+	{
+		if (part_index == 0)
+		{
+			chunklist->CreateSegmentInfo(LLHlsChunklist::SegmentInfo(segment_sequence, ov::String::FormatString("seg_0_%u_video_llhls.m4s", segment_sequence)));
+		}
+
+		auto start_ms = 1700000000000LL + static_cast<int64_t>((segment_sequence * PartsPerSegment + part_index) * PartDuration * 1000);
+		auto part_url = ov::String::FormatString("part_0_%u_%d_video_llhls.m4s", segment_sequence, part_index);
+		auto next_url = (part_index + 1 < PartsPerSegment)
+							? ov::String::FormatString("part_0_%u_%d_video_llhls.m4s", segment_sequence, part_index + 1)
+							: ov::String::FormatString("part_0_%u_0_video_llhls.m4s", segment_sequence + 1);
+
+		chunklist->AppendPartialSegmentInfo(segment_sequence,
+											LLHlsChunklist::SegmentInfo(part_index, start_ms, PartDuration, 1000, part_url, next_url,
+																		part_index == 0, part_index == PartsPerSegment - 1));
+	}
+
+	// The default chunklist is made from the cached pieces. The same chunklist with a query string
+	// is always rendered from scratch, so it is the reference once the query string is removed.
+	ov::String RenderFromScratch(const std::shared_ptr<LLHlsChunklist> &chunklist)
+	{
+		return chunklist->ToString("q=1", false, false, true).Replace("?q=1", "");
+	}
+
+	ov::String Concat(const std::vector<std::shared_ptr<const ov::Data>> &list)
+	{
+		ov::String result;
+		for (const auto &data : list)
+		{
+			result.Append(data->GetDataAs<char>(), data->GetLength());
+		}
+		return result;
+	}
+}  // namespace
+
+TEST(LLHlsChunklist, DefaultChunklistMatchesFullRender)
+{
+	constexpr uint32_t WindowSegments = 40;
+	auto chunklist = CreateChunklist(WindowSegments);
+
+	int mismatches = 0;
+
+	for (uint32_t segment_sequence = 0; segment_sequence < 200; segment_sequence++)
+	{
+		for (int part_index = 0; part_index < PartsPerSegment; part_index++)
+		{
+			AppendPart(chunklist, segment_sequence, part_index);
+
+			auto expected = RenderFromScratch(chunklist);
+
+			if ((chunklist->ToString("", false, false, true) != expected) ||
+				(Concat(chunklist->ToDataList("", false, false, true)) != expected))
+			{
+				mismatches++;
+			}
+		}
+
+		if (segment_sequence >= WindowSegments)
+		{
+			chunklist->RemoveSegmentInfo(segment_sequence - WindowSegments);
+		}
+	}
+
+	EXPECT_EQ(0, mismatches);
+}
+
+TEST(LLHlsChunklist, DefaultChunklistIsSplitIntoPieces)
+{
+	auto chunklist = CreateChunklist(2000);
+
+	for (uint32_t segment_sequence = 0; segment_sequence < 1000; segment_sequence++)
+	{
+		for (int part_index = 0; part_index < PartsPerSegment; part_index++)
+		{
+			AppendPart(chunklist, segment_sequence, part_index);
+		}
+	}
+
+	auto list = chunklist->ToDataList("", false, false, true);
+
+	// header + frozen blocks + tail
+	EXPECT_TRUE(list.size() > 3);
+	EXPECT_TRUE(Concat(list) == RenderFromScratch(chunklist));
+}
+
+TEST(LLHlsChunklist, EndListFallsBackToFullRender)
+{
+	auto chunklist = CreateChunklist(10);
+
+	for (uint32_t segment_sequence = 0; segment_sequence < 20; segment_sequence++)
+	{
+		for (int part_index = 0; part_index < PartsPerSegment; part_index++)
+		{
+			AppendPart(chunklist, segment_sequence, part_index);
+		}
+	}
+
+	chunklist->SetEndList();
+
+	auto text = chunklist->ToString("", false, false, true);
+	EXPECT_TRUE(text.IndexOf("#EXT-X-ENDLIST") > 0);
+	EXPECT_TRUE(text == RenderFromScratch(chunklist));
+}
+
+TEST_MAIN()
@@ -0,0 +1,455 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <arpa/inet.h>
+#include <base/ovlibrary/delay_queue.h>
+#include <base/ovlibrary/ovlibrary.h>
+#include <config/config_manager.h>
+#include <modules/containers/mpegts/mpegts_depacketizer.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include "common/test.h"
+#include "latency/latency_marker.h"
+#include "load/llhls_player.h"
+#include "load/llhls_playlist.h"
+#include "load/synthetic_source.h"
+
+// ov::SocketAddress::ToString() reads the privacy option of the config, which is not loaded in this test
+cfg::ConfigManager::ConfigManager()
+{
+}
+
+cfg::ConfigManager::~ConfigManager()
+{
+}
+
+// Tests of the LL-HLS load generator (src/tests/load)
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	// A chunklist in the form that OvenMediaEngine makes
+	const char *CHUNKLIST =
+		"#EXTM3U\n"
+		"#EXT-X-TARGETDURATION:1\n"
+		"#EXT-X-VERSION:9\n"
+		"#EXT-X-SERVER-CONTROL:CAN-BLOCK-RELOAD=YES,PART-HOLD-BACK=1.500\n"
+		"#EXT-X-PART-INF:PART-TARGET=0.500\n"
+		"#EXT-X-MEDIA-SEQUENCE:7\n"
+		"#EXT-X-MAP:URI=\"init_0_video_llhls.m4s\"\n"
+		"#EXT-X-PROGRAM-DATE-TIME:2026-10-19T00:00:00.000+00:00\n"
+		"#EXTINF:1.000,\n"
+		"seg_0_7_video_llhls.m4s\n"
+		"#EXT-X-PART:DURATION=0.500,URI=\"part_0_8_0_video_llhls.m4s\",INDEPENDENT=YES\n"
+		"#EXT-X-PART:DURATION=0.500,URI=\"part_0_8_1_video_llhls.m4s\"\n"
+		"#EXTINF:1.000,\n"
+		"seg_0_8_video_llhls.m4s\n"
+		"#EXT-X-PART:DURATION=0.500,URI=\"part_0_9_0_video_llhls.m4s\",INDEPENDENT=YES\n"
+		"#EXT-X-PRELOAD-HINT:TYPE=PART,URI=\"part_0_9_1_video_llhls.m4s\"\n";
+
+	// Serves an LL-HLS stream of which a part is made every PART_MS, and holds the blocking reloads and the
+	// requests of the parts that do not exist yet as OvenMediaEngine does
+	class FakeLLHlsServer
+	{
+	public:
+		static constexpr int PART_MS = 100;
+		static constexpr int PARTS_PER_SEGMENT = 4;
+
+		~FakeLLHlsServer()
+		{
+			Stop();
+		}
+
+		bool Start()
+		{
+			_listen_fd = ::socket(AF_INET, SOCK_STREAM, 0);
+			if (_listen_fd < 0)
+			{
+				return false;
+			}
+
+			sockaddr_in address{};
+			address.sin_family = AF_INET;
+			address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+			address.sin_port = 0;
+
+			socklen_t length = sizeof(address);
+			if ((::bind(_listen_fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0) ||
+				(::listen(_listen_fd, 64) != 0) ||
+				(::getsockname(_listen_fd, reinterpret_cast<sockaddr *>(&address), &length) != 0))
+			{
+				return false;
+			}
+
+			_port = ntohs(address.sin_port);
+			_start_time = Clock::now();
+			_accept_thread = std::thread(&FakeLLHlsServer::AcceptProc, this);
+
+			return true;
+		}
+
+		void Stop()
+		{
+			_stop = true;
+
+			if (_listen_fd >= 0)
+			{
+				::shutdown(_listen_fd, SHUT_RDWR);
+			}
+
+			if (_accept_thread.joinable())
+			{
+				_accept_thread.join();
+			}
+
+			std::lock_guard<std::mutex> lock_guard(_mutex);
+			for (auto &thread : _threads)
+			{
+				thread.join();
+			}
+			_threads.clear();
+
+			if (_listen_fd >= 0)
+			{
+				::close(_listen_fd);
+				_listen_fd = -1;
+			}
+		}
+
+		ov::String GetUrl() const
+		{
+			return ov::String::FormatString("http://127.0.0.1:%d/app/stream/llhls.m3u8", _port);
+		}
+
+	private:
+		int64_t GetCompletedParts() const
+		{
+			return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - _start_time).count() / PART_MS;
+		}
+
+		// Waits until the part exists, false if the server is stopped
+		bool WaitForPart(int64_t msn, int64_t index)
+		{
+			while (GetCompletedParts() <= (msn * PARTS_PER_SEGMENT + index))
+			{
+				if (_stop)
+				{
+					return false;
+				}
+
+				std::this_thread::sleep_for(std::chrono::milliseconds(5));
+			}
+
+			return true;
+		}
+
+		ov::String MakeChunklist()
+		{
+			auto completed = GetCompletedParts();
+			auto msn = completed / PARTS_PER_SEGMENT;
+			auto first_msn = std::max<int64_t>(msn - 2, 0);
+
+			ov::String playlist =
+				"#EXTM3U\n"
+				"#EXT-X-TARGETDURATION:1\n"
+				"#EXT-X-SERVER-CONTROL:CAN-BLOCK-RELOAD=YES,PART-HOLD-BACK=0.300\n"
+				"#EXT-X-PART-INF:PART-TARGET=0.100\n";
+			playlist.AppendFormat("#EXT-X-MEDIA-SEQUENCE:%" PRId64 "\n", first_msn);
+
+			for (auto segment = first_msn; segment < msn; segment++)
+			{
+				playlist.AppendFormat("#EXTINF:0.400,\nseg_%" PRId64 ".m4s\n", segment);
+			}
+
+			for (int64_t index = 0; index < (completed % PARTS_PER_SEGMENT); index++)
+			{
+				playlist.AppendFormat("#EXT-X-PART:DURATION=0.100,URI=\"part_%" PRId64 "_%" PRId64 ".m4s\"\n", msn, index);
+			}
+
+			playlist.AppendFormat("#EXT-X-PRELOAD-HINT:TYPE=PART,URI=\"part_%" PRId64 "_%" PRId64 ".m4s\"\n", msn, completed % PARTS_PER_SEGMENT);
+
+			return playlist;
+		}
+
+		void AcceptProc()
+		{
+			while (_stop == false)
+			{
+				auto fd = ::accept(_listen_fd, nullptr, nullptr);
+				if (fd < 0)
+				{
+					return;
+				}
+
+				std::lock_guard<std::mutex> lock_guard(_mutex);
+				_threads.emplace_back(&FakeLLHlsServer::HandleConnection, this, fd);
+			}
+		}
+
+		void HandleConnection(int fd)
+		{
+			ov::String request;
+			char buffer[1024];
+
+			while (request.IndexOf("\r\n\r\n") < 0)
+			{
+				auto received = ::recv(fd, buffer, sizeof(buffer), 0);
+				if (received <= 0)
+				{
+					::close(fd);
+					return;
+				}
+
+				request.Append(buffer, received);
+			}
+
+			// "GET <path> HTTP/1.1"
+			auto path = request.Split(" ")[1];
+			ov::String body;
+			int64_t msn = 0;
+			int64_t index = 0;
+
+			if (path == "/app/stream/llhls.m3u8")
+			{
+				body = "#EXTM3U\n#EXT-X-STREAM-INF:BANDWIDTH=1000000\nchunklist.m3u8?session=1\n";
+			}
+			else if (path.HasPrefix("/app/stream/chunklist.m3u8?session=1"))
+			{
+				if ((::sscanf(path.CStr(), "%*[^_]_HLS_msn=%" SCNd64 "&_HLS_part=%" SCNd64, &msn, &index) == 2) && (WaitForPart(msn, index) == false))
+				{
+					::close(fd);
+					return;
+				}
+
+				body = MakeChunklist();
+			}
+			else if (::sscanf(path.CStr(), "/app/stream/part_%" SCNd64 "_%" SCNd64 ".m4s", &msn, &index) == 2)
+			{
+				if (WaitForPart(msn, index) == false)
+				{
+					::close(fd);
+					return;
+				}
+
+				body = std::string(1000, 'p').c_str();
+			}
+
+			auto response = ov::String::FormatString("HTTP/1.1 %s\r\nContent-Length: %zu\r\nConnection: close\r\n\r\n",
+													 body.IsEmpty() ? "404 Not Found" : "200 OK", body.GetLength());
+			response.Append(body);
+
+			::send(fd, response.CStr(), response.GetLength(), MSG_NOSIGNAL);
+			::close(fd);
+		}
+
+		int _listen_fd = -1;
+		int _port = 0;
+		Clock::time_point _start_time;
+
+		std::atomic<bool> _stop{false};
+		std::thread _accept_thread;
+		std::mutex _mutex;
+		std::vector<std::thread> _threads;
+	};
+}  // namespace
+
+TEST(LLHlsPlaylist, ParsesChunklist)
+{
+	auto chunklist = load::LLHlsChunklist::Parse(CHUNKLIST);
+
+	EXPECT_EQ(7, chunklist.media_sequence);
+	EXPECT_TRUE(chunklist.can_block_reload);
+	EXPECT_EQ(0.5, chunklist.part_target);
+	EXPECT_EQ(1.0, chunklist.target_duration);
+	EXPECT_EQ(9, chunklist.next_msn);
+	EXPECT_TRUE(chunklist.preload_hint == "part_0_9_1_video_llhls.m4s");
+
+	ASSERT_TRUE(chunklist.parts.size() == 3);
+	EXPECT_EQ(8, chunklist.parts[0].msn);
+	EXPECT_EQ(0, chunklist.parts[0].index);
+	EXPECT_EQ(1, chunklist.parts[1].index);
+	EXPECT_EQ(9, chunklist.parts[2].msn);
+	EXPECT_EQ(0, chunklist.parts[2].index);
+	EXPECT_TRUE(chunklist.parts[2].uri == "part_0_9_0_video_llhls.m4s");
+	EXPECT_TRUE(chunklist.parts[2].IsAfter(chunklist.parts[1]));
+	EXPECT_FALSE(chunklist.parts[0].IsAfter(chunklist.parts[1]));
+
+	// The part after the last one
+	int64_t msn;
+	int64_t part;
+	chunklist.GetNextDirectives(&msn, &part);
+	EXPECT_EQ(9, msn);
+	EXPECT_EQ(1, part);
+
+	// A playlist without parts waits for the next segment
+	load::LLHlsChunklist::Parse("#EXTM3U\n#EXT-X-MEDIA-SEQUENCE:3\n#EXTINF:1.0,\nseg_3.ts\n").GetNextDirectives(&msn, &part);
+	EXPECT_EQ(4, msn);
+	EXPECT_EQ(0, part);
+}
+
+TEST(LLHlsPlaylist, ParsesAttributesAndUrls)
+{
+	const ov::String line = "#EXT-X-PART:DURATION=0.500,URI=\"a,b=c.m4s\",INDEPENDENT=YES";
+
+	EXPECT_TRUE(load::GetAttribute(line, "DURATION") == "0.500");
+	EXPECT_TRUE(load::GetAttribute(line, "URI") == "a,b=c.m4s");
+	EXPECT_TRUE(load::GetAttribute(line, "INDEPENDENT") == "YES");
+	EXPECT_TRUE(load::GetAttribute(line, "BYTERANGE").IsEmpty());
+
+	EXPECT_TRUE(load::GetFirstVariant("#EXTM3U\n#EXT-X-STREAM-INF:BANDWIDTH=1\r\nchunklist_0.m3u8\r\n") == "chunklist_0.m3u8");
+	EXPECT_TRUE(load::GetFirstVariant(CHUNKLIST).IsEmpty());
+
+	const ov::String base = "http://host:3333/app/stream/llhls.m3u8?token=1";
+	EXPECT_TRUE(load::ResolveUrl(base, "part.m4s") == "http://host:3333/app/stream/part.m4s");
+	EXPECT_TRUE(load::ResolveUrl(base, "/other/part.m4s") == "http://host:3333/other/part.m4s");
+	EXPECT_TRUE(load::ResolveUrl(base, "https://cdn/part.m4s") == "https://cdn/part.m4s");
+
+	EXPECT_TRUE(load::MakeBlockingReloadUrl("http://host/a.m3u8", 9, 1) == "http://host/a.m3u8?_HLS_msn=9&_HLS_part=1");
+	EXPECT_TRUE(load::MakeBlockingReloadUrl("http://host/a.m3u8?session=1", 10, 0) == "http://host/a.m3u8?session=1&_HLS_msn=10&_HLS_part=0");
+}
+
+// The datagrams are a valid MPEG-TS stream of an H.264 track that carries the latency markers
+TEST(SyntheticSource, SendsMpegTs)
+{
+	load::SyntheticSource::Config config;
+	load::SyntheticSource source(config);
+	mpegts::MpegTsDepacketizer depacketizer;
+
+	size_t datagrams = 0;
+	bool datagram_too_large = false;
+	std::vector<uint8_t> elementary_stream;
+
+	for (uint32_t frame = 0; frame < config.gop_size + 1; frame++)
+	{
+		EXPECT_TRUE(source.SendNextFrame([&](const std::shared_ptr<const ov::Data> &datagram) {
+			datagrams++;
+			datagram_too_large = datagram_too_large || (datagram->GetLength() > 7 * 188) || ((datagram->GetLength() % 188) != 0);
+
+			depacketizer.AddPacket(datagram);
+		}));
+
+		while (depacketizer.IsESAvailable())
+		{
+			auto pes = depacketizer.PopES();
+			elementary_stream.insert(elementary_stream.end(), pes->Payload(), pes->Payload() + pes->PayloadLength());
+		}
+	}
+
+	EXPECT_TRUE(datagrams > config.gop_size);
+	EXPECT_FALSE(datagram_too_large);
+	EXPECT_EQ(static_cast<uint64_t>(config.gop_size + 1), source.GetSentFrames());
+
+	std::map<uint16_t, std::shared_ptr<MediaTrack>> tracks;
+	ASSERT_TRUE(depacketizer.IsTrackInfoAvailable() && depacketizer.GetTrackList(&tracks));
+	ASSERT_TRUE(tracks.size() == 1);
+	EXPECT_TRUE(tracks.begin()->second->GetCodecId() == cmn::MediaCodecId::H264);
+
+	// A PES is completed when the next one starts, so the last frame is still pending
+	auto markers = lb::LatencyMarkerCodec::Scan(elementary_stream.data(), elementary_stream.size(), [](const lb::LatencyMarker &marker) {});
+	EXPECT_EQ(static_cast<size_t>(config.gop_size), markers);
+}
+
+TEST(LLHlsPlayer, FollowsLiveEdge)
+{
+	FakeLLHlsServer server;
+	ASSERT_TRUE(server.Start());
+
+	auto socket_pool = ov::SocketPool::Create("LLHlsLoadTest", ov::SocketType::Tcp, false);
+	ASSERT_TRUE((socket_pool != nullptr) && socket_pool->Initialize(1));
+
+	ov::DelayQueue queue("LLHlsLoadTest", ov::DelayQueueThreadMode::Dedicated);
+	queue.Start();
+
+	load::LoadStats stats;
+	std::atomic<bool> stopped{false};
+
+	load::LLHlsPlayer::Config config;
+	config.url = server.GetUrl();
+
+	auto player = std::make_shared<load::LLHlsPlayer>(config, socket_pool, queue, stats, [&stopped]() {
+		stopped = true;
+	});
+	player->Start();
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(20 * FakeLLHlsServer::PART_MS));
+
+	player->Stop();
+
+	for (int count = 0; (count < 100) && (stopped == false); count++)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	}
+
+	EXPECT_TRUE(stopped);
+	EXPECT_TRUE(player->IsStopped());
+	EXPECT_EQ(0, stats.active_players.load());
+
+	EXPECT_EQ(1U, stats.master.requests.load());
+	EXPECT_EQ(0U, stats.master.errors.load() + stats.playlist.errors.load() + stats.part.errors.load() + stats.hint.errors.load());
+
+	// A blocking reload for every part, and every part is requested once, mostly as a preload hint
+	EXPECT_TRUE(stats.playlist.requests >= 10);
+	EXPECT_TRUE(stats.hint.requests >= 10);
+	EXPECT_TRUE(stats.part.requests < stats.hint.requests);
+
+	// The responses of the blocking reloads arrive at every PART-TARGET
+	EXPECT_TRUE(stats.hold_deviation.GetCount() >= 5);
+	EXPECT_GE(FakeLLHlsServer::PART_MS * 1000 / 2, stats.hold_deviation.GetPercentile(50.0));
+
+	queue.Stop();
+	socket_pool->Uninitialize();
+}
+
+// A refused connection is reported by a worker of the socket pool while HttpClientV2::Request() is still connecting
+TEST(LLHlsPlayer, RetriesRefusedConnection)
+{
+	FakeLLHlsServer server;
+	ASSERT_TRUE(server.Start());
+	auto url = server.GetUrl();
+	server.Stop();
+
+	auto socket_pool = ov::SocketPool::Create("LLHlsLoadTest", ov::SocketType::Tcp, false);
+	ASSERT_TRUE((socket_pool != nullptr) && socket_pool->Initialize(1));
+
+	ov::DelayQueue queue("LLHlsLoadTest", ov::DelayQueueThreadMode::Dedicated);
+	queue.Start();
+
+	load::LoadStats stats;
+	std::atomic<bool> stopped{false};
+
+	load::LLHlsPlayer::Config config;
+	config.url = url;
+	config.retry_interval_ms = 50;
+
+	auto player = std::make_shared<load::LLHlsPlayer>(config, socket_pool, queue, stats, [&stopped]() {
+		stopped = true;
+	});
+	player->Start();
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+	player->Stop();
+
+	for (int count = 0; (count < 100) && (stopped == false); count++)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	}
+
+	EXPECT_TRUE(stopped);
+	EXPECT_EQ(0U, stats.master.requests.load());
+	EXPECT_TRUE(stats.master.errors >= 3);
+
+	queue.Stop();
+	socket_pool->Uninitialize();
+}
+
+TEST_MAIN()
@@ -0,0 +1,198 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <base/ovlibrary/log_async_writer.h>
+#include <base/ovlibrary/log_write.h>
+#include <base/ovlibrary/ovlibrary.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/test.h"
+
+// Writes warning logs, which are never dropped, to a temporary directory while the console is /dev/null
+namespace
+{
+	std::string g_log_file;
+
+	class QuietConsole
+	{
+	public:
+		QuietConsole()
+		{
+			_saved_fd = ::dup(STDERR_FILENO);
+
+			auto null_fd = ::open("/dev/null", O_WRONLY);
+			::dup2(null_fd, STDERR_FILENO);
+			::close(null_fd);
+		}
+
+		~QuietConsole()
+		{
+			::dup2(_saved_fd, STDERR_FILENO);
+			::close(_saved_fd);
+		}
+
+	private:
+		int _saved_fd = -1;
+	};
+
+	// The indices of the lines that contain `text` followed by an index, in the order in which they are written
+	std::vector<int> ReadIndices(const char *text)
+	{
+		std::vector<int> indices;
+		std::ifstream stream(g_log_file);
+		std::string line;
+
+		while (std::getline(stream, line))
+		{
+			auto position = line.find(text);
+
+			if (position != std::string::npos)
+			{
+				indices.push_back(std::stoi(line.substr(position + ::strlen(text))));
+			}
+		}
+
+		return indices;
+	}
+
+	void LogWarning(const char *format, int index)
+	{
+		ov_log_internal(OVLogLevelWarning, "Test", __FILE__, __LINE__, __PRETTY_FUNCTION__, format, index);
+	}
+}  // namespace
+
+// Threads beyond OV_LOG_ASYNC_MAX_RING_COUNT get no ring and write synchronously
+TEST(LogAsyncWriter, ThreadsBeyondRingCountWriteSynchronously)
+{
+	constexpr int ThreadCount = OV_LOG_ASYNC_MAX_RING_COUNT + 44;
+
+	std::mutex mutex;
+	std::condition_variable condition;
+	int logged_count = 0;
+	std::vector<std::thread> threads;
+
+	{
+		QuietConsole quiet;
+
+		// All threads are alive until every thread has logged, so that no ring is reused
+		for (int thread_index = 0; thread_index < ThreadCount; thread_index++)
+		{
+			threads.emplace_back([&, thread_index]() {
+				LogWarning("Alive thread: %d", thread_index);
+
+				std::unique_lock<std::mutex> lock(mutex);
+				logged_count++;
+				condition.notify_all();
+				condition.wait(lock, [&]() { return logged_count == ThreadCount; });
+			});
+		}
+
+		for (auto &thread : threads)
+		{
+			thread.join();
+		}
+
+		ov_log_flush();
+	}
+
+	auto indices = ReadIndices("Alive thread: ");
+	std::vector<bool> found(ThreadCount, false);
+
+	for (auto index : indices)
+	{
+		found[index] = true;
+	}
+
+	EXPECT_EQ(static_cast<size_t>(ThreadCount), indices.size());
+	EXPECT_EQ(static_cast<size_t>(ThreadCount), static_cast<size_t>(std::count(found.begin(), found.end(), true)));
+}
+
+// The rings of the exited threads are reused, so short-lived threads keep logging through the rings
+TEST(LogAsyncWriter, RingsOfExitedThreadsAreReused)
+{
+	constexpr int ThreadCount = OV_LOG_ASYNC_MAX_RING_COUNT * 2;
+
+	{
+		QuietConsole quiet;
+
+		for (int thread_index = 0; thread_index < ThreadCount; thread_index++)
+		{
+			std::thread([thread_index]() {
+				LogWarning("Short-lived thread: %d", thread_index);
+			}).join();
+		}
+
+		ov_log_flush();
+	}
+
+	auto indices = ReadIndices("Short-lived thread: ");
+
+	EXPECT_EQ(static_cast<size_t>(ThreadCount), indices.size());
+
+	for (size_t index = 0; index < indices.size(); index++)
+	{
+		EXPECT_EQ(static_cast<int>(index), indices[index]);
+	}
+}
+
+// The lines that are queued when the process crashes are written in order by ov_log_flush_on_fatal()
+TEST(LogAsyncWriter, FlushOnFatalWritesQueuedLinesInOrder)
+{
+	constexpr int LineCount = 1000;
+
+	{
+		QuietConsole quiet;
+
+		for (int index = 0; index < LineCount; index++)
+		{
+			LogWarning("Before the crash: %d", index);
+		}
+
+		ov_log_flush_on_fatal();
+	}
+
+	auto indices = ReadIndices("Before the crash: ");
+
+	EXPECT_EQ(static_cast<size_t>(LineCount), indices.size());
+
+	for (size_t index = 0; index < indices.size(); index++)
+	{
+		EXPECT_EQ(static_cast<int>(index), indices[index]);
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	char directory[] = "/tmp/ome_log_test.XXXXXX";
+
+	if (::mkdtemp(directory) == nullptr)
+	{
+		::perror("mkdtemp");
+		return 1;
+	}
+
+	ov_log_set_path(directory);
+	g_log_file = std::string(directory) + "/" + OV_DEFAULT_LOG_FILE;
+
+	auto result = ::test::RunAll(argc, argv);
+
+	::unlink(g_log_file.c_str());
+	::rmdir(directory);
+
+	return result;
+}
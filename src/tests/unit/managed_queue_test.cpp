@@ -0,0 +1,240 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <modules/managed_queue/managed_queue.h>
+
+#include <chrono>
+#include <thread>
+
+#include "common/test.h"
+
+// Built with the monitoring of common/stub/monitoring/monitoring.h (see the Makefile)
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	int64_t ElapsedMs(Clock::time_point start)
+	{
+		return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start).count();
+	}
+
+	// Each item carries the producer number and the sequence number of the producer
+	uint64_t MakeItem(uint32_t producer, uint32_t sequence)
+	{
+		return (static_cast<uint64_t>(producer) << 32) | sequence;
+	}
+
+	// Runs `producer_count` producers on the lock-free path and a consumer using DequeueBatch(),
+	// and checks that every item arrives once and in the order of its producer
+	void RunProducers(int producer_count, uint32_t items_per_producer)
+	{
+		ov::ManagedQueue<uint64_t> queue(nullptr, 0);
+		std::vector<std::thread> producers;
+
+		for (int producer = 0; producer < producer_count; producer++)
+		{
+			producers.emplace_back([&queue, producer, items_per_producer]() {
+				for (uint32_t sequence = 0; sequence < items_per_producer; sequence++)
+				{
+					queue.Enqueue(MakeItem(producer, sequence));
+				}
+			});
+		}
+
+		std::vector<uint32_t> next_sequences(producer_count, 0);
+		uint64_t total = static_cast<uint64_t>(producer_count) * items_per_producer;
+		uint64_t received = 0;
+		bool in_order = true;
+		std::vector<uint64_t> items;
+
+		while (received < total)
+		{
+			items.clear();
+
+			if (queue.DequeueBatch(items, 64, 5000) == 0)
+			{
+				break;
+			}
+
+			for (auto item : items)
+			{
+				auto producer = static_cast<int>(item >> 32);
+				auto sequence = static_cast<uint32_t>(item & 0xFFFFFFFF);
+
+				if ((producer >= producer_count) || (next_sequences[producer] != sequence))
+				{
+					in_order = false;
+				}
+				else
+				{
+					next_sequences[producer]++;
+				}
+			}
+
+			received += items.size();
+		}
+
+		for (auto &producer : producers)
+		{
+			producer.join();
+		}
+
+		EXPECT_EQ(total, received);
+		EXPECT_TRUE(in_order);
+		EXPECT_TRUE(queue.IsEmpty());
+	}
+}  // namespace
+
+TEST(ManagedQueue, KeepsOrderOfSingleProducer)
+{
+	RunProducers(1, 100000);
+}
+
+TEST(ManagedQueue, KeepsOrderOfEachProducer)
+{
+	RunProducers(4, 50000);
+	RunProducers(16, 10000);
+}
+
+TEST(ManagedQueue, UrgentItemIsDequeuedFirst)
+{
+	ov::ManagedQueue<int> queue(nullptr, 0);
+
+	queue.Enqueue(1);
+	queue.Enqueue(2);
+	queue.Enqueue(0, true);
+
+	EXPECT_EQ(3u, queue.Size());
+	EXPECT_EQ(0, queue.Dequeue(0).value_or(-1));
+	EXPECT_EQ(1, queue.Dequeue(0).value_or(-1));
+	EXPECT_EQ(2, queue.Dequeue(0).value_or(-1));
+}
+
+TEST(ManagedQueue, DequeueTimesOut)
+{
+	ov::ManagedQueue<int> queue(nullptr, 0);
+
+	auto start = Clock::now();
+	EXPECT_FALSE(queue.Dequeue(30).has_value());
+	EXPECT_LE(25, ElapsedMs(start));
+}
+
+TEST(ManagedQueue, ProducerWakesUpSleepingConsumer)
+{
+	ov::ManagedQueue<int> queue(nullptr, 0);
+
+	std::thread producer([&queue]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		queue.Enqueue(7);
+	});
+
+	auto start = Clock::now();
+	EXPECT_EQ(7, queue.Dequeue(5000).value_or(-1));
+	EXPECT_GE(1000, ElapsedMs(start));
+
+	producer.join();
+}
+
+TEST(ManagedQueue, StopWakesUpConsumer)
+{
+	ov::ManagedQueue<int> queue(nullptr, 0);
+
+	std::thread stopper([&queue]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		queue.Stop();
+	});
+
+	auto start = Clock::now();
+	EXPECT_FALSE(queue.Dequeue().has_value());
+	EXPECT_GE(1000, ElapsedMs(start));
+	EXPECT_TRUE(queue.IsStopped());
+
+	stopper.join();
+
+	// Items are dropped after Stop
+	queue.Enqueue(1);
+	EXPECT_FALSE(queue.Dequeue(0).has_value());
+}
+
+TEST(ManagedQueue, BufferingDelayReleasesItemWithoutAnotherEnqueue)
+{
+	ov::ManagedQueue<int> queue(nullptr, 0);
+	queue.SetBufferingDelay(50);
+
+	auto start = Clock::now();
+	queue.Enqueue(1);
+
+	EXPECT_EQ(1, queue.Dequeue(1000).value_or(-1));
+
+	auto elapsed_ms = ElapsedMs(start);
+	EXPECT_LE(45, elapsed_ms);
+	EXPECT_GE(500, elapsed_ms);
+}
+
+TEST(ManagedQueue, ExceedWaitBlocksProducerAtThreshold)
+{
+	ov::ManagedQueue<int> queue(nullptr, 4);
+	queue.SetExceedWaitEnable(true);
+
+	std::atomic<int> produced{0};
+	std::thread producer([&queue, &produced]() {
+		for (int index = 0; index < 1000; index++)
+		{
+			queue.Enqueue(index);
+			produced++;
+		}
+	});
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	EXPECT_GE(4u, queue.Size());
+	EXPECT_GE(4, produced.load());
+
+	int expected = 0;
+	while (expected < 1000)
+	{
+		auto item = queue.Dequeue(5000);
+		if (item.has_value() == false)
+		{
+			break;
+		}
+
+		EXPECT_EQ(expected, item.value());
+		expected++;
+	}
+
+	producer.join();
+	EXPECT_EQ(1000, expected);
+}
+
+TEST(ManagedQueue, NodesAreReusedAcrossQueues)
+{
+	// The nodes released by a queue are cached per thread and used by the other queue
+	for (int round = 0; round < 100; round++)
+	{
+		ov::ManagedQueue<std::shared_ptr<int>> first(nullptr, 0);
+		ov::ManagedQueue<std::shared_ptr<int>> second(nullptr, 0);
+
+		auto value = std::make_shared<int>(round);
+
+		for (int index = 0; index < 200; index++)
+		{
+			first.Enqueue(value);
+		}
+		first.Clear();
+
+		// The released nodes must not keep the data
+		EXPECT_EQ(1, value.use_count());
+
+		second.Enqueue(value);
+		EXPECT_EQ(round, *second.Dequeue(0).value());
+	}
+
+	EXPECT_EQ(0, MonitorInstance->GetServerMetrics()->GetQueueCount());
+}
+
+TEST_MAIN()
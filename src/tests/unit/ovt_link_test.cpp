@@ -0,0 +1,317 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <arpa/inet.h>
+#include <base/ovlibrary/ovlibrary.h>
+#include <config/config_manager.h>
+#include <modules/ovt_packetizer/ovt_packetizer.h>
+#include <modules/ovt_packetizer/ovt_signaling.h>
+#include <providers/ovt/ovt_link.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <thread>
+
+#include "common/test.h"
+
+// ov::SocketAddress::ToString() reads the privacy option of the config, which is not loaded in this test
+cfg::ConfigManager::ConfigManager()
+{
+}
+
+cfg::ConfigManager::~ConfigManager()
+{
+}
+
+// Connects an OvtLink to a fake origin on the loopback interface,
+// which sends the OVT packets of several channels over the same connection
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	class FakeOrigin
+	{
+	public:
+		bool Listen()
+		{
+			_listen_fd = ::socket(AF_INET, SOCK_STREAM, 0);
+			if (_listen_fd < 0)
+			{
+				return false;
+			}
+
+			sockaddr_in address{};
+			address.sin_family = AF_INET;
+			address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+			address.sin_port = 0;
+
+			socklen_t length = sizeof(address);
+			if ((::bind(_listen_fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0) ||
+				(::listen(_listen_fd, 1) != 0) ||
+				(::getsockname(_listen_fd, reinterpret_cast<sockaddr *>(&address), &length) != 0))
+			{
+				return false;
+			}
+
+			_port = ntohs(address.sin_port);
+
+			return true;
+		}
+
+		~FakeOrigin()
+		{
+			Disconnect();
+
+			if (_listen_fd >= 0)
+			{
+				::close(_listen_fd);
+			}
+		}
+
+		ov::SocketAddress GetAddress() const
+		{
+			return ov::SocketAddress::CreateAndGetFirst("127.0.0.1", _port);
+		}
+
+		bool Accept()
+		{
+			auto fd = ::accept(_listen_fd, nullptr, nullptr);
+			if (fd < 0)
+			{
+				return false;
+			}
+
+			Disconnect();
+			_remote_fd = fd;
+
+			return true;
+		}
+
+		// Sends a response message to the channel, split into OVT packets like the publisher does
+		bool SendMessage(uint32_t channel_id, const ov::String &payload)
+		{
+			OvtPacketizer packetizer;
+
+			if (packetizer.PacketizeMessage(OVT_PAYLOAD_TYPE_MESSAGE_RESPONSE, ov::Clock::NowMSec(), payload.ToData(false)) == false)
+			{
+				return false;
+			}
+
+			while (packetizer.IsAvailablePackets())
+			{
+				auto packet = packetizer.PopPacket();
+				packet->SetSessionId(channel_id);
+
+				for (const auto &data : packet->GetDataList())
+				{
+					if (SendAll(data->GetDataAs<uint8_t>(), data->GetLength()) == false)
+					{
+						return false;
+					}
+				}
+			}
+
+			return true;
+		}
+
+		void Disconnect()
+		{
+			if (_remote_fd >= 0)
+			{
+				::close(_remote_fd);
+				_remote_fd = -1;
+			}
+		}
+
+	private:
+		bool SendAll(const uint8_t *data, size_t length)
+		{
+			while (length > 0)
+			{
+				auto sent = ::send(_remote_fd, data, length, MSG_NOSIGNAL);
+				if (sent <= 0)
+				{
+					return false;
+				}
+
+				data += sent;
+				length -= sent;
+			}
+
+			return true;
+		}
+
+		int _listen_fd = -1;
+		uint16_t _port = 0;
+		int _remote_fd = -1;
+	};
+
+	bool WaitFor(const std::function<bool()> &condition, int timeout_msec)
+	{
+		auto expire = Clock::now() + std::chrono::milliseconds(timeout_msec);
+
+		while (condition() == false)
+		{
+			if (Clock::now() > expire)
+			{
+				return false;
+			}
+
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+
+		return true;
+	}
+
+	ov::String ToString(const std::shared_ptr<ov::Data> &data)
+	{
+		return (data == nullptr) ? "" : ov::String(data->GetDataAs<char>(), data->GetLength());
+	}
+
+	struct Fixture
+	{
+		bool Connect()
+		{
+			pool = ov::SocketPool::Create("OvtLinkTest", ov::SocketType::Tcp, false);
+			if ((pool == nullptr) || (pool->Initialize(1) == false) || (origin.Listen() == false))
+			{
+				return false;
+			}
+
+			// The link connects with a blocking socket, so the origin accepts in another thread
+			std::thread acceptor([this]() { accepted = origin.Accept(); });
+			link = pvd::OvtLink::Create(pool, origin.GetAddress());
+			acceptor.join();
+
+			return (link != nullptr) && accepted;
+		}
+
+		~Fixture()
+		{
+			if (link != nullptr)
+			{
+				link->Stop();
+			}
+
+			if (pool != nullptr)
+			{
+				pool->Uninitialize();
+			}
+		}
+
+		std::shared_ptr<ov::SocketPool> pool;
+		FakeOrigin origin;
+		bool accepted = false;
+		std::shared_ptr<pvd::OvtLink> link;
+	};
+}  // namespace
+
+TEST(OvtLink, DemultiplexesChannels)
+{
+	Fixture fixture;
+	ASSERT_TRUE(fixture.Connect());
+
+	auto first = fixture.link->OpenChannel();
+	auto second = fixture.link->OpenChannel();
+	ASSERT_TRUE((first != nullptr) && (second != nullptr));
+	EXPECT_EQ(2u, fixture.link->GetChannelCount());
+
+	// A message larger than an OVT packet is split, and the packets of both channels are interleaved on the wire
+	ov::String large_payload;
+	for (int index = 0; index < 10000; index++)
+	{
+		large_payload.AppendFormat("%d,", index);
+	}
+
+	EXPECT_TRUE(fixture.origin.SendMessage(second->GetId(), "to the second"));
+	EXPECT_TRUE(fixture.origin.SendMessage(first->GetId(), large_payload));
+	EXPECT_TRUE(fixture.origin.SendMessage(0xFFF0, "to a channel that is not opened"));
+
+	EXPECT_EQ(large_payload, ToString(first->WaitForMessage(3000)));
+	EXPECT_EQ(ov::String("to the second"), ToString(second->WaitForMessage(3000)));
+	EXPECT_FALSE(first->IsAvailableMessage());
+	EXPECT_FALSE(second->IsAvailableMessage());
+	EXPECT_EQ(0u, first->GetBufferedBytes());
+
+	fixture.link->CloseChannel(first);
+	EXPECT_TRUE(first->IsClosed());
+	EXPECT_FALSE(second->IsClosed());
+	EXPECT_EQ(1u, fixture.link->GetChannelCount());
+}
+
+// A channel that is not drained is closed at OVT_LINK_CHANNEL_MAX_BUFFER_SIZE, and the other channels keep working
+TEST(OvtLink, UndrainedChannelIsClosedAtBufferLimit)
+{
+	Fixture fixture;
+	ASSERT_TRUE(fixture.Connect());
+
+	auto stalled = fixture.link->OpenChannel();
+	auto drained = fixture.link->OpenChannel();
+	ASSERT_TRUE((stalled != nullptr) && (drained != nullptr));
+
+	ov::String payload;
+	payload.SetLength(1024 * 1024);
+	::memset(payload.GetBuffer(), 'x', payload.GetLength());
+
+	int message_count = (OVT_LINK_CHANNEL_MAX_BUFFER_SIZE / payload.GetLength()) + 2;
+	for (int index = 0; index < message_count; index++)
+	{
+		EXPECT_TRUE(fixture.origin.SendMessage(stalled->GetId(), payload));
+	}
+	EXPECT_TRUE(fixture.origin.SendMessage(drained->GetId(), "still working"));
+
+	EXPECT_EQ(ov::String("still working"), ToString(drained->WaitForMessage(5000)));
+	EXPECT_TRUE(stalled->IsClosed());
+	EXPECT_FALSE(drained->IsClosed());
+	EXPECT_GE(static_cast<size_t>(OVT_LINK_CHANNEL_MAX_BUFFER_SIZE + payload.GetLength()), stalled->GetBufferedBytes());
+	EXPECT_TRUE(fixture.link->IsConnected());
+}
+
+TEST(OvtLink, DisconnectClosesAllChannels)
+{
+	Fixture fixture;
+	ASSERT_TRUE(fixture.Connect());
+
+	auto first = fixture.link->OpenChannel();
+	auto second = fixture.link->OpenChannel();
+	ASSERT_TRUE((first != nullptr) && (second != nullptr));
+
+	fixture.origin.Disconnect();
+
+	EXPECT_TRUE(WaitFor([&]() { return first->IsClosed() && second->IsClosed(); }, 3000));
+	EXPECT_FALSE(fixture.link->IsConnected());
+	EXPECT_TRUE(fixture.link->OpenChannel() == nullptr);
+}
+
+TEST(OvtDepacketizer, CountsBufferedBytesUntilPopped)
+{
+	OvtPacketizer packetizer;
+	OvtDepacketizer depacketizer;
+
+	ov::String payload = "message";
+	EXPECT_TRUE(packetizer.PacketizeMessage(OVT_PAYLOAD_TYPE_MESSAGE_RESPONSE, 0, payload.ToData(false)));
+
+	while (packetizer.IsAvailablePackets())
+	{
+		auto packet = packetizer.PopPacket();
+		ov::Data data(packet->GetDataLength());
+
+		for (const auto &item : packet->GetDataList())
+		{
+			data.Append(item.get());
+		}
+
+		EXPECT_TRUE(depacketizer.AppendPacket(data.Clone()));
+	}
+
+	EXPECT_EQ(payload.GetLength(), depacketizer.GetBufferedBytes());
+	EXPECT_EQ(payload, ToString(depacketizer.PopMessage()));
+	EXPECT_EQ(0u, depacketizer.GetBufferedBytes());
+}
+
+TEST_MAIN()
@@ -0,0 +1,223 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <base/publisher/pending_pull_map.h>
+
+#include <atomic>
+#include <thread>
+
+#include "common/test.h"
+
+// pub::PendingPullMap is what pub::Publisher::PullStream() uses to pull a stream only once
+// for the requests that arrive while it is being pulled
+namespace
+{
+	struct FakeStream
+	{
+		int id;
+	};
+
+	constexpr int WaiterCount = 8;
+
+	// Waits until every waiter is blocked in Pull(), so that they join the pull in progress
+	void WaitForWaiters(const std::atomic<int> &started)
+	{
+		while (started.load() < WaiterCount)
+		{
+			std::this_thread::yield();
+		}
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	}
+}  // namespace
+
+TEST(PendingPullMap, WaitersGetResultOfLeader)
+{
+	pub::PendingPullMap<FakeStream> pulls;
+	std::atomic<int> pull_count(0);
+	std::atomic<int> started(0);
+	std::atomic<bool> release(false);
+
+	auto pull = [&]() {
+		pull_count++;
+
+		while (release.load() == false)
+		{
+			std::this_thread::yield();
+		}
+
+		return std::make_shared<FakeStream>(FakeStream{1});
+	};
+
+	std::shared_ptr<FakeStream> leader_result;
+	std::thread leader([&]() { leader_result = pulls.Pull("default/app/stream", pull); });
+
+	while (pulls.IsPulling("default/app/stream") == false)
+	{
+		std::this_thread::yield();
+	}
+
+	std::vector<std::shared_ptr<FakeStream>> results(WaiterCount);
+	std::vector<std::thread> waiters;
+	for (int index = 0; index < WaiterCount; index++)
+	{
+		waiters.emplace_back([&, index]() {
+			started++;
+			results[index] = pulls.Pull("default/app/stream", pull);
+		});
+	}
+
+	WaitForWaiters(started);
+	release = true;
+
+	leader.join();
+	for (auto &waiter : waiters)
+	{
+		waiter.join();
+	}
+
+	EXPECT_EQ(1, pull_count.load());
+	ASSERT_TRUE(leader_result != nullptr);
+	for (const auto &result : results)
+	{
+		EXPECT_TRUE(result == leader_result);
+	}
+
+	EXPECT_FALSE(pulls.IsPulling("default/app/stream"));
+}
+
+// If the pull of the leader fails, the waiters fail too instead of pulling again one after another
+TEST(PendingPullMap, WaitersSeeFailureOfLeader)
+{
+	pub::PendingPullMap<FakeStream> pulls;
+	std::atomic<int> pull_count(0);
+	std::atomic<int> started(0);
+	std::atomic<bool> release(false);
+
+	auto pull = [&]() -> std::shared_ptr<FakeStream> {
+		pull_count++;
+
+		while (release.load() == false)
+		{
+			std::this_thread::yield();
+		}
+
+		return nullptr;
+	};
+
+	std::thread leader([&]() { EXPECT_TRUE(pulls.Pull("default/app/stream", pull) == nullptr); });
+
+	while (pulls.IsPulling("default/app/stream") == false)
+	{
+		std::this_thread::yield();
+	}
+
+	std::atomic<int> failed_count(0);
+	std::vector<std::thread> waiters;
+	for (int index = 0; index < WaiterCount; index++)
+	{
+		waiters.emplace_back([&]() {
+			started++;
+			if (pulls.Pull("default/app/stream", pull) == nullptr)
+			{
+				failed_count++;
+			}
+		});
+	}
+
+	WaitForWaiters(started);
+	release = true;
+
+	leader.join();
+	for (auto &waiter : waiters)
+	{
+		waiter.join();
+	}
+
+	EXPECT_EQ(1, pull_count.load());
+	EXPECT_EQ(WaiterCount, failed_count.load());
+
+	// The next request pulls again
+	EXPECT_TRUE(pulls.Pull("default/app/stream", []() { return std::make_shared<FakeStream>(FakeStream{2}); }) != nullptr);
+}
+
+TEST(PendingPullMap, KeysArePulledIndependently)
+{
+	pub::PendingPullMap<FakeStream> pulls;
+	std::atomic<bool> release(false);
+
+	std::thread leader([&]() {
+		pulls.Pull("default/app/stream1", [&]() {
+			while (release.load() == false)
+			{
+				std::this_thread::yield();
+			}
+
+			return std::make_shared<FakeStream>(FakeStream{1});
+		});
+	});
+
+	while (pulls.IsPulling("default/app/stream1") == false)
+	{
+		std::this_thread::yield();
+	}
+
+	// Not blocked by the pull of stream1
+	auto stream2 = pulls.Pull("default/app/stream2", []() { return std::make_shared<FakeStream>(FakeStream{2}); });
+	ASSERT_TRUE(stream2 != nullptr);
+	EXPECT_EQ(2, stream2->id);
+
+	release = true;
+	leader.join();
+}
+
+// The leader waits for the stream of the publisher, which is created after the provider stream
+TEST(PendingPullMap, WaitForStreamIsReleasedBySetStream)
+{
+	pub::PendingPullMap<FakeStream> pulls;
+	auto stream = std::make_shared<FakeStream>(FakeStream{3});
+
+	std::thread ready([&]() {
+		while (pulls.IsPulling("default/app/stream") == false)
+		{
+			std::this_thread::yield();
+		}
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		pulls.SetStream("default/app/stream", stream);
+	});
+
+	auto start = std::chrono::steady_clock::now();
+	auto result = pulls.Pull("default/app/stream", [&]() {
+		return pulls.WaitForStream("default/app/stream", std::chrono::milliseconds(3000));
+	});
+	auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+	ready.join();
+
+	EXPECT_TRUE(result == stream);
+	EXPECT_GE(1000, elapsed_ms);
+}
+
+TEST(PendingPullMap, WaitForStreamTimesOut)
+{
+	pub::PendingPullMap<FakeStream> pulls;
+
+	auto result = pulls.Pull("default/app/stream", [&]() {
+		return pulls.WaitForStream("default/app/stream", std::chrono::milliseconds(50));
+	});
+
+	EXPECT_TRUE(result == nullptr);
+
+	// Not being pulled: nothing to wait for, and SetStream() is ignored
+	EXPECT_TRUE(pulls.WaitForStream("default/app/stream", std::chrono::milliseconds(1000)) == nullptr);
+	pulls.SetStream("default/app/stream", std::make_shared<FakeStream>(FakeStream{4}));
+	EXPECT_FALSE(pulls.IsPulling("default/app/stream"));
+}
+
+TEST_MAIN()
@@ -0,0 +1,175 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <modules/rtp_rtcp/rtp_bandwidth_estimator.h>
+
+#include <cinttypes>
+#include <cstdio>
+#include <unistd.h>
+
+#include "common/bwe_link_simulator.h"
+#include "common/test.h"
+
+namespace
+{
+	// The first time the target bitrate is below `bitrate` at or after `from_ms`
+	int64_t FirstTimeBelow(const std::vector<bwe::TimelinePoint> &timeline, int64_t from_ms, uint64_t bitrate)
+	{
+		for (const auto &point : timeline)
+		{
+			if ((point.now_ms >= from_ms) && (point.target_bitrate > 0) && (point.target_bitrate < bitrate))
+			{
+				return point.now_ms;
+			}
+		}
+		return -1;
+	}
+}  // namespace
+
+TEST(RtpBandwidthEstimator, ConvergesBelowLinkCapacity)
+{
+	RtpBandwidthEstimator estimator;
+	bwe::LinkSimulator simulator({{0, 2000 * 1000, 0.0}});
+
+	auto timeline = simulator.Run(estimator, 60000);
+	auto settled = bwe::AverageTarget(timeline, 30000, 60000);
+
+	EXPECT_GE(settled, 2000 * 1000 * 0.7);
+	EXPECT_LE(settled, 2000 * 1000 * 1.05);
+	EXPECT_TRUE(estimator.GetStats().overuse_count > 0);
+}
+
+TEST(RtpBandwidthEstimator, FollowsCapacityDropAndRecovery)
+{
+	RtpBandwidthEstimator estimator;
+	bwe::LinkSimulator simulator({{0, 2000 * 1000, 0.0}, {30000, 800 * 1000, 0.0}, {60000, 2000 * 1000, 0.0}});
+
+	auto timeline = simulator.Run(estimator, 120000);
+
+	// Reacts within a second once the queue builds up
+	auto reacted_ms = FirstTimeBelow(timeline, 30000, 800 * 1000);
+	EXPECT_TRUE((reacted_ms > 30000) && (reacted_ms <= 31000));
+
+	auto dropped = bwe::AverageTarget(timeline, 35000, 60000);
+	EXPECT_GE(dropped, 800 * 1000 * 0.6);
+	EXPECT_LE(dropped, 800 * 1000 * 1.05);
+
+	// 8%/s at most, so it takes a while to find the capacity again
+	auto recovered = bwe::AverageTarget(timeline, 90000, 120000);
+	EXPECT_GE(recovered, 2000 * 1000 * 0.7);
+}
+
+TEST(RtpBandwidthEstimator, HighLossDecreasesTarget)
+{
+	RtpBandwidthEstimator estimator;
+	bwe::LinkSimulator simulator({{0, 2000 * 1000, 0.0}, {30000, 2000 * 1000, 0.2}});
+
+	auto timeline = simulator.Run(estimator, 40000);
+
+	auto before = bwe::AverageTarget(timeline, 25000, 30000);
+	auto after = bwe::AverageTarget(timeline, 35000, 40000);
+
+	EXPECT_TRUE(after < before / 2);
+	EXPECT_TRUE(estimator.GetStats().loss_ratio > RTP_BWE_HIGH_LOSS_RATIO);
+}
+
+TEST(RtpBandwidthEstimator, ModerateLossDoesNotCollapseTarget)
+{
+	// A feedback of a low bitrate stream carries only a few packets, a single loss must not be taken as high loss
+	RtpBandwidthEstimator estimator;
+	bwe::LinkSimulator simulator({{0, 5000 * 1000, 0.05}});
+
+	auto timeline = simulator.Run(estimator, 30000);
+
+	EXPECT_GE(bwe::AverageTarget(timeline, 20000, 30000), bwe::LinkSimulator::StartBitrate);
+}
+
+TEST(RtpBandwidthEstimator, RembCapsTarget)
+{
+	RtpBandwidthEstimator estimator;
+	bwe::LinkSimulator simulator({{0, 2000 * 1000, 0.0}});
+
+	simulator.Run(estimator, 20000);
+	ASSERT_TRUE(estimator.GetTargetBitrate() > 500 * 1000);
+
+	estimator.OnRemb(500 * 1000, 20000);
+	EXPECT_EQ(500u * 1000, estimator.GetTargetBitrate());
+	EXPECT_TRUE(estimator.IsDecreased());
+
+	// REMB only
+	RtpBandwidthEstimator remb_only;
+	remb_only.OnRemb(1500 * 1000, 0);
+	EXPECT_EQ(1500u * 1000, remb_only.GetTargetBitrate());
+}
+
+TEST(RtpBandwidthEstimator, RecordedFeedbackReplaysIdentically)
+{
+	char file_path[] = "/tmp/rtp_bwe_trace_XXXXXX";
+	auto fd = ::mkstemp(file_path);
+	ASSERT_TRUE(fd >= 0);
+	::close(fd);
+
+	std::vector<uint64_t> live_targets;
+	{
+		RtpBandwidthEstimator estimator;
+		ASSERT_TRUE(estimator.StartRecording(file_path));
+
+		bwe::LinkSimulator simulator({{0, 2000 * 1000, 0.01}, {10000, 700 * 1000, 0.01}});
+		simulator.on_feedback = [&](const std::vector<RtpBandwidthEstimator::PacketResult> &, int64_t) {
+			// Called before the feedback is passed, so this is the target of the previous feedback
+			live_targets.push_back(estimator.GetTargetBitrate());
+		};
+		simulator.Run(estimator, 20000);
+
+		estimator.OnRemb(600 * 1000, 20001);
+		live_targets.push_back(estimator.GetTargetBitrate());
+	}
+
+	std::vector<uint64_t> replayed_targets;
+	{
+		RtpBandwidthEstimator estimator;
+		std::vector<RtpBandwidthEstimator::PacketResult> packet_results;
+
+		FILE *file = ::fopen(file_path, "r");
+		ASSERT_TRUE(file != nullptr);
+
+		char line[256];
+		while (::fgets(line, sizeof(line), file) != nullptr)
+		{
+			RtpBandwidthEstimator::PacketResult packet;
+			int64_t now_ms = 0;
+			uint64_t bitrate = 0;
+
+			if (::sscanf(line, "P,%" SCNd64 ",%" SCNd64 ",%zu", &packet.send_time_us, &packet.arrival_time_us, &packet.size) == 3)
+			{
+				packet_results.push_back(packet);
+			}
+			else if (::sscanf(line, "F,%" SCNd64, &now_ms) == 1)
+			{
+				replayed_targets.push_back(estimator.GetTargetBitrate());
+				estimator.OnTransportFeedback(packet_results, now_ms);
+				packet_results.clear();
+			}
+			else if (::sscanf(line, "R,%" SCNd64 ",%" SCNu64, &now_ms, &bitrate) == 2)
+			{
+				estimator.OnRemb(bitrate, now_ms);
+				replayed_targets.push_back(estimator.GetTargetBitrate());
+			}
+		}
+
+		::fclose(file);
+	}
+
+	::unlink(file_path);
+
+	EXPECT_TRUE(live_targets.size() > 100);
+	EXPECT_EQ(live_targets.size(), replayed_targets.size());
+	EXPECT_TRUE(live_targets == replayed_targets);
+}
+
+TEST_MAIN()
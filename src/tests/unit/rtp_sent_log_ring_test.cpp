@@ -0,0 +1,196 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <publishers/webrtc/rtp_sent_log_ring.h>
+
+#include <atomic>
+#include <thread>
+
+#include "common/test.h"
+
+namespace
+{
+	// Every field is derived from the sequence number, so that a torn copy can be detected
+	RtpSentLog MakeSentLog(uint16_t sequence_number)
+	{
+		RtpSentLog sent_log;
+
+		sent_log._sequence_number		 = sequence_number;
+		sent_log._wide_sequence_number	 = static_cast<uint16_t>(sequence_number + 1);
+		sent_log._track_id				 = sequence_number * 3u;
+		sent_log._payload_type			 = static_cast<uint8_t>(sequence_number);
+		sent_log._origin_sequence_number = static_cast<uint16_t>(sequence_number + 2);
+		sent_log._ssrc					 = sequence_number * 5u;
+		sent_log._timestamp				 = sequence_number * 7u;
+		sent_log._marker				 = (sequence_number & 1) != 0;
+		sent_log._sent_bytes			 = sequence_number * 11u;
+		sent_log._sent_time				 = std::chrono::system_clock::time_point(std::chrono::system_clock::duration(sequence_number * 13ll));
+
+		return sent_log;
+	}
+
+	bool IsSentLogOf(const RtpSentLog &sent_log, uint16_t sequence_number)
+	{
+		auto expected = MakeSentLog(sequence_number);
+
+		return (sent_log._sequence_number == expected._sequence_number) &&
+			   (sent_log._wide_sequence_number == expected._wide_sequence_number) &&
+			   (sent_log._track_id == expected._track_id) &&
+			   (sent_log._payload_type == expected._payload_type) &&
+			   (sent_log._origin_sequence_number == expected._origin_sequence_number) &&
+			   (sent_log._ssrc == expected._ssrc) &&
+			   (sent_log._timestamp == expected._timestamp) &&
+			   (sent_log._marker == expected._marker) &&
+			   (sent_log._sent_bytes == expected._sent_bytes) &&
+			   (sent_log._sent_time == expected._sent_time);
+	}
+
+	void Record(RtpSentLogRing &ring, uint16_t sequence_number)
+	{
+		ring.Record(sequence_number, MakeSentLog(sequence_number));
+	}
+}  // namespace
+
+TEST(RtpSentLogRing, NotRecordedIsNotFound)
+{
+	auto ring = std::make_unique<RtpSentLogRing>();
+	RtpSentLog sent_log;
+
+	EXPECT_FALSE(ring->Trace(0, sent_log));
+	EXPECT_FALSE(ring->Trace(1000, sent_log));
+
+	Record(*ring, 1000);
+	EXPECT_TRUE(ring->Trace(1000, sent_log));
+	EXPECT_TRUE(IsSentLogOf(sent_log, 1000));
+	EXPECT_FALSE(ring->Trace(1001, sent_log));
+}
+
+// The last RtpSentLogRing::Size packets can be traced
+TEST(RtpSentLogRing, LastPacketsAreFound)
+{
+	auto ring = std::make_unique<RtpSentLogRing>();
+
+	for (uint32_t sequence_number = 0; sequence_number < RtpSentLogRing::Size * 3; sequence_number++)
+	{
+		Record(*ring, static_cast<uint16_t>(sequence_number));
+	}
+
+	RtpSentLog sent_log;
+	for (uint32_t sequence_number = RtpSentLogRing::Size * 2; sequence_number < RtpSentLogRing::Size * 3; sequence_number++)
+	{
+		ASSERT_TRUE(ring->Trace(static_cast<uint16_t>(sequence_number), sent_log));
+		EXPECT_TRUE(IsSentLogOf(sent_log, static_cast<uint16_t>(sequence_number)));
+	}
+}
+
+// A packet whose slot has been overwritten by a newer one is not found, instead of returning the newer one
+TEST(RtpSentLogRing, EvictedPacketIsNotFound)
+{
+	auto ring = std::make_unique<RtpSentLogRing>();
+
+	Record(*ring, 100);
+	Record(*ring, static_cast<uint16_t>(100 + RtpSentLogRing::Size));
+
+	RtpSentLog sent_log;
+	EXPECT_FALSE(ring->Trace(100, sent_log));
+	EXPECT_TRUE(ring->Trace(static_cast<uint16_t>(100 + RtpSentLogRing::Size), sent_log));
+	EXPECT_TRUE(IsSentLogOf(sent_log, static_cast<uint16_t>(100 + RtpSentLogRing::Size)));
+
+	// The whole ring is evicted after another Size packets
+	for (uint32_t sequence_number = 0; sequence_number < RtpSentLogRing::Size; sequence_number++)
+	{
+		Record(*ring, static_cast<uint16_t>(10000 + sequence_number));
+	}
+
+	EXPECT_FALSE(ring->Trace(static_cast<uint16_t>(100 + RtpSentLogRing::Size), sent_log));
+	EXPECT_FALSE(ring->Trace(9999, sent_log));
+	EXPECT_TRUE(ring->Trace(10000, sent_log));
+}
+
+// The sequence number wraps around at the same slot, so the packets before and after 65535 are all found
+TEST(RtpSentLogRing, SequenceNumberWrapsAround)
+{
+	auto ring = std::make_unique<RtpSentLogRing>();
+
+	uint16_t sequence_number = 65535 - 100;
+	for (int index = 0; index < 200; index++)
+	{
+		Record(*ring, sequence_number++);
+	}
+
+	RtpSentLog sent_log;
+	sequence_number = 65535 - 100;
+	for (int index = 0; index < 200; index++)
+	{
+		EXPECT_TRUE(ring->Trace(sequence_number, sent_log));
+		EXPECT_TRUE(IsSentLogOf(sent_log, sequence_number));
+		sequence_number++;
+	}
+
+	// After a whole cycle of the sequence number (99 to 98), the same sequence numbers are found again,
+	// but not the ones that are older than the ring
+	for (uint32_t index = 0; index < 65536; index++)
+	{
+		Record(*ring, sequence_number++);
+	}
+
+	EXPECT_TRUE(ring->Trace(98, sent_log));
+	EXPECT_TRUE(IsSentLogOf(sent_log, 98));
+	EXPECT_TRUE(ring->Trace(static_cast<uint16_t>(99 - RtpSentLogRing::Size), sent_log));
+	EXPECT_FALSE(ring->Trace(static_cast<uint16_t>(98 - RtpSentLogRing::Size), sent_log));
+}
+
+// A reader never gets a copy that mixes two packets, while the writer overwrites the slots it reads
+TEST(RtpSentLogRing, ConcurrentTraceIsNeverTorn)
+{
+	auto ring = std::make_unique<RtpSentLogRing>();
+	std::atomic<bool> stop(false);
+	std::atomic<uint16_t> last_sequence_number(0);
+
+	std::thread writer([&]() {
+		uint16_t sequence_number = 0;
+		for (int index = 0; index < 2000000; index++)
+		{
+			Record(*ring, sequence_number);
+			last_sequence_number.store(sequence_number, std::memory_order_relaxed);
+			sequence_number++;
+		}
+
+		stop = true;
+	});
+
+	uint64_t found_count = 0;
+	uint64_t torn_count = 0;
+	RtpSentLog sent_log;
+
+	while (stop.load() == false)
+	{
+		// The packets that are about to be overwritten by the writer
+		auto sequence_number = static_cast<uint16_t>(last_sequence_number.load(std::memory_order_relaxed) - RtpSentLogRing::Size + 1);
+
+		for (int index = 0; index < 16; index++)
+		{
+			if (ring->Trace(static_cast<uint16_t>(sequence_number + index), sent_log))
+			{
+				found_count++;
+
+				if (IsSentLogOf(sent_log, static_cast<uint16_t>(sequence_number + index)) == false)
+				{
+					torn_count++;
+				}
+			}
+		}
+	}
+
+	writer.join();
+
+	EXPECT_EQ(0u, torn_count);
+	EXPECT_TRUE(found_count > 0);
+}
+
+TEST_MAIN()
@@ -0,0 +1,144 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "common/test.h"
+
+namespace
+{
+	const char *LongText = "a string that is longer than the inline capacity";
+}  // namespace
+
+TEST(String, ShortStringIsInline)
+{
+	ov::String inline_string("0123456789012345678901");
+	EXPECT_EQ(22u, inline_string.GetLength());
+	EXPECT_TRUE(inline_string.GetCapacity() == ov::String::InlineCapacity);
+
+	ov::String heap_string(LongText);
+	EXPECT_TRUE(heap_string.GetCapacity() > ov::String::InlineCapacity);
+	EXPECT_TRUE(heap_string == LongText);
+}
+
+TEST(String, MoveConstruct)
+{
+	ov::String short_source("short");
+	ov::String short_moved(std::move(short_source));
+	EXPECT_TRUE(short_moved == "short");
+	EXPECT_TRUE(short_source.IsEmpty());
+
+	ov::String long_source(LongText);
+	auto buffer = long_source.CStr();
+	ov::String long_moved(std::move(long_source));
+	EXPECT_TRUE(long_moved == LongText);
+	// The heap buffer is taken over
+	EXPECT_TRUE(long_moved.CStr() == buffer);
+	EXPECT_TRUE(long_source.IsEmpty());
+}
+
+TEST(String, MoveAssign)
+{
+	// heap <- heap: the buffer is taken over
+	{
+		ov::String target("another string that is longer than the inline capacity");
+		ov::String source(LongText);
+		auto buffer = source.CStr();
+
+		target = std::move(source);
+		EXPECT_TRUE(target == LongText);
+		EXPECT_TRUE(target.CStr() == buffer);
+		EXPECT_TRUE(source.IsEmpty());
+		EXPECT_TRUE(source == "");
+	}
+
+	// inline <- heap
+	{
+		ov::String target("short");
+		ov::String source(LongText);
+
+		target = std::move(source);
+		EXPECT_TRUE(target == LongText);
+		EXPECT_TRUE(source.IsEmpty());
+	}
+
+	// heap <- inline: the bytes are copied to the existing buffer
+	{
+		ov::String target(LongText);
+		ov::String source("short");
+
+		target = std::move(source);
+		EXPECT_TRUE(target == "short");
+		EXPECT_EQ(5u, target.GetLength());
+		EXPECT_TRUE(source.IsEmpty());
+	}
+
+	// empty <- inline
+	{
+		ov::String target;
+		ov::String source("short");
+
+		target = std::move(source);
+		EXPECT_TRUE(target == "short");
+		EXPECT_TRUE(source.IsEmpty());
+
+		// The moved-from string can be used again
+		source = "reused";
+		EXPECT_TRUE(source == "reused");
+		source.Append(LongText);
+		EXPECT_TRUE(source == ov::String("reused") + LongText);
+	}
+
+	// Self assignment
+	{
+		ov::String target(LongText);
+		auto &self = target;
+		target = std::move(self);
+		EXPECT_TRUE(target == LongText);
+	}
+}
+
+TEST(String, ContainersMoveStrings)
+{
+	std::vector<ov::String> strings;
+	for (int index = 0; index < 1000; index++)
+	{
+		strings.push_back(ov::String::FormatString("%d:%s", index, (index % 2) ? "short" : LongText));
+	}
+
+	// Shifts the elements with move assignment
+	strings.erase(strings.begin());
+
+	EXPECT_EQ(999u, strings.size());
+	EXPECT_TRUE(strings[0] == "1:short");
+	EXPECT_TRUE(strings[1] == ov::String("2:") + LongText);
+
+	std::map<ov::String, ov::String> map;
+	map[""] = ov::String::FormatString("%s", "");
+	map[ov::String()] = "default";
+	EXPECT_EQ(1u, map.size());
+}
+
+TEST(String, Format)
+{
+	ov::String string;
+	string.AppendFormat("%s-%d", "part", 1);
+	EXPECT_TRUE(string == "part-1");
+
+	// Grows beyond the inline capacity while formatting
+	string.AppendFormat(" %s", LongText);
+	EXPECT_TRUE(string == ov::String("part-1 ") + LongText);
+
+	EXPECT_TRUE(ov::String::FormatString("%05d", 42) == "00042");
+}
+
+TEST_MAIN()
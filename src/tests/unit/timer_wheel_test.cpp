@@ -0,0 +1,375 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <base/ovlibrary/ovlibrary.h>
+#include <base/ovlibrary/delay_queue.h>
+#include <pthread.h>
+
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "common/bench.h"
+#include "common/test.h"
+
+namespace
+{
+#if defined(__SANITIZE_THREAD__)
+	// ThreadSanitizer needs several times the memory and the time per timer
+	constexpr size_t ManyTimerCount = 50000;
+	constexpr bool CheckLatenessAndMemory = false;
+#else
+	constexpr size_t ManyTimerCount = 1000000;
+	constexpr bool CheckLatenessAndMemory = true;
+#endif
+
+	int64_t NowMSec()
+	{
+		return ov::TimerWheel::GetInstance()->GetNowMSec();
+	}
+
+	bool WaitFor(const std::function<bool()> &condition, int timeout_msec)
+	{
+		auto expire = NowMSec() + timeout_msec;
+
+		while (condition() == false)
+		{
+			if (NowMSec() > expire)
+			{
+				return false;
+			}
+
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+
+		return true;
+	}
+
+	ov::String GetThreadName()
+	{
+		char name[16]{};
+		::pthread_getname_np(::pthread_self(), name, sizeof(name));
+		return name;
+	}
+}  // namespace
+
+// Schedules ManyTimerCount timers over 3 seconds and cancels every tenth:
+// none may fire early, the cancelled ones must not fire, and the rest must fire about on time
+TEST(TimerWheel, ManyTimersFireOnTimeWithinMemoryBudget)
+{
+	auto wheel = ov::TimerWheel::GetInstance();
+
+	std::vector<int64_t> expire_msecs(ManyTimerCount);
+	std::vector<std::atomic<int64_t>> fired_msecs(ManyTimerCount);
+	std::vector<std::shared_ptr<ov::TimerWheel::Timer>> timers;
+	timers.reserve(ManyTimerCount);
+
+	std::mt19937 random(1234);
+	std::uniform_int_distribution<int> distribution(0, 3000);
+
+	for (auto &fired_msec : fired_msecs)
+	{
+		fired_msec = -1;
+	}
+
+	auto rss_before_kb = bench::ResidentKb();
+	auto base_count = wheel->GetCount();
+
+	for (size_t index = 0; index < ManyTimerCount; index++)
+	{
+		auto *fired_msec = &fired_msecs[index];
+
+		expire_msecs[index] = wheel->GetExpireMSec(distribution(random));
+		timers.push_back(wheel->ScheduleAt(
+			[fired_msec]() {
+				fired_msec->store(ov::TimerWheel::GetInstance()->GetNowMSec());
+			},
+			expire_msecs[index]));
+	}
+
+	auto rss_after_kb = bench::ResidentKb();
+	auto bytes_per_timer = static_cast<double>(rss_after_kb - rss_before_kb) * 1024.0 / ManyTimerCount;
+	::printf("    %zu timers: %.1f bytes per timer\n", ManyTimerCount, bytes_per_timer);
+
+	size_t cancel_failed = 0;
+	for (size_t index = 0; index < ManyTimerCount; index += 10)
+	{
+		if (wheel->Cancel(timers[index]) == false)
+		{
+			// It may have expired already
+			cancel_failed++;
+		}
+	}
+
+	EXPECT_TRUE(WaitFor([&]() { return wheel->GetCount() <= base_count; }, 10000));
+	// Wait for the workers to run the last timers
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+	size_t early = 0;
+	size_t missed = 0;
+	size_t fired_cancelled = 0;
+	bench::Samples lateness;
+	lateness.Reserve(ManyTimerCount);
+
+	for (size_t index = 0; index < ManyTimerCount; index++)
+	{
+		auto fired_msec = fired_msecs[index].load();
+
+		if ((index % 10) == 0)
+		{
+			if (fired_msec >= 0)
+			{
+				fired_cancelled++;
+			}
+			continue;
+		}
+
+		if (fired_msec < 0)
+		{
+			missed++;
+		}
+		else if (fired_msec < expire_msecs[index])
+		{
+			early++;
+		}
+		else
+		{
+			lateness.Add(static_cast<double>(fired_msec - expire_msecs[index]));
+		}
+	}
+
+	lateness.Print("    lateness", "ms");
+
+	EXPECT_EQ(0u, early);
+	EXPECT_EQ(0u, missed);
+	EXPECT_EQ(cancel_failed, fired_cancelled);
+
+	if (CheckLatenessAndMemory)
+	{
+		// The bound allows for a loaded machine with a single core, where the workers and the wheels share the CPU
+		EXPECT_GE(50.0, lateness.Percentile(99.0));
+		EXPECT_GE(256.0, bytes_per_timer);
+	}
+}
+
+TEST(TimerWheel, CancelledTimerIsNotCalled)
+{
+	auto wheel = ov::TimerWheel::GetInstance();
+	std::atomic<int> called{0};
+
+	auto timer = wheel->Schedule([&called]() { called++; }, 20);
+
+	EXPECT_TRUE(wheel->Cancel(timer));
+	EXPECT_FALSE(wheel->Cancel(timer));
+	EXPECT_FALSE(wheel->RescheduleAt(timer, wheel->GetExpireMSec(0)));
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	EXPECT_EQ(0, called.load());
+}
+
+TEST(TimerWheel, RescheduleMovesPendingTimer)
+{
+	auto wheel = ov::TimerWheel::GetInstance();
+	std::atomic<int64_t> fired_msec{-1};
+	std::atomic<int> called{0};
+
+	auto timer = wheel->Schedule([&]() {
+		fired_msec = NowMSec();
+		called++;
+	},
+								 10000);
+
+	auto expire_msec = wheel->GetExpireMSec(20);
+	EXPECT_TRUE(wheel->RescheduleAt(timer, expire_msec));
+
+	EXPECT_TRUE(WaitFor([&]() { return called > 0; }, 1000));
+	EXPECT_LE(expire_msec, fired_msec.load());
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(30));
+	EXPECT_EQ(1, called.load());
+}
+
+TEST(TimerWheel, TimerIsRescheduledFromItsFunction)
+{
+	auto wheel = ov::TimerWheel::GetInstance();
+	std::atomic<int> called{0};
+	std::shared_ptr<ov::TimerWheel::Timer> timer;
+	std::mutex timer_mutex;
+
+	{
+		std::lock_guard<std::mutex> lock(timer_mutex);
+
+		timer = wheel->Schedule([&]() {
+			std::lock_guard<std::mutex> lock(timer_mutex);
+
+			if (++called < 5)
+			{
+				EXPECT_TRUE(wheel->RescheduleAt(timer, wheel->GetExpireMSec(2)));
+			}
+		},
+								2);
+	}
+
+	EXPECT_TRUE(WaitFor([&]() { return called >= 5; }, 1000));
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	EXPECT_EQ(5, called.load());
+
+	// A timer whose function has returned can be scheduled again
+	EXPECT_TRUE(wheel->RescheduleAt(timer, wheel->GetExpireMSec(2)));
+	EXPECT_TRUE(WaitFor([&]() { return called >= 6; }, 1000));
+
+	// Wait for the function to return, since it uses the locals
+	EXPECT_FALSE(wheel->Cancel(timer, true));
+}
+
+TEST(TimerWheel, CancelWaitsForRunningFunction)
+{
+	auto wheel = ov::TimerWheel::GetInstance();
+	std::atomic<bool> running{false};
+	std::atomic<bool> finished{false};
+
+	auto timer = wheel->Schedule([&]() {
+		running = true;
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		finished = true;
+	},
+								 0);
+
+	EXPECT_TRUE(WaitFor([&]() { return running.load(); }, 1000));
+	EXPECT_FALSE(wheel->Cancel(timer, true));
+	EXPECT_TRUE(finished.load());
+}
+
+TEST(DelayQueue, RepeatKeepsPeriod)
+{
+	ov::DelayQueue queue("TestRepeat");
+	std::atomic<int> called{0};
+	std::vector<int64_t> called_msecs;
+
+	auto start_msec = NowMSec();
+	queue.Push([&](void *parameter) -> ov::DelayQueueAction {
+		called_msecs.push_back(NowMSec());
+		return (++called < 20) ? ov::DelayQueueAction::Repeat : ov::DelayQueueAction::Stop;
+	},
+			   5);
+	queue.Start();
+
+	EXPECT_TRUE(WaitFor([&]() { return queue.GetCount() == 0; }, 2000));
+	EXPECT_EQ(20, called.load());
+
+	// Every call is at least 5 ms after the previous one
+	int64_t previous_msec = start_msec;
+	for (auto called_msec : called_msecs)
+	{
+		EXPECT_LE(previous_msec + 5, called_msec);
+		previous_msec = called_msec;
+	}
+
+	queue.Stop();
+}
+
+TEST(DelayQueue, ItemsSurviveStopAndStart)
+{
+	ov::DelayQueue queue("TestRestart");
+	std::atomic<int> called{0};
+
+	queue.Push([&](void *parameter) -> ov::DelayQueueAction {
+		called++;
+		return ov::DelayQueueAction::Repeat;
+	},
+			   2);
+	queue.Start();
+
+	EXPECT_TRUE(WaitFor([&]() { return called >= 3; }, 1000));
+	queue.Stop();
+
+	auto called_when_stopped = called.load();
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	EXPECT_EQ(called_when_stopped, called.load());
+	EXPECT_EQ(1, static_cast<int>(queue.GetCount()));
+
+	queue.Start();
+	EXPECT_TRUE(WaitFor([&]() { return called >= called_when_stopped + 3; }, 1000));
+	queue.Stop();
+}
+
+// Functions of the dedicated queues block without delaying the timers of the shared queues
+TEST(DelayQueue, DedicatedQueueDoesNotBlockWheelWorkers)
+{
+	std::vector<std::unique_ptr<ov::DelayQueue>> blocking_queues;
+	std::atomic<int> blocking_count{0};
+	std::atomic<int> on_wheel_worker{0};
+
+	for (int index = 0; index < TIMER_WHEEL_WORKER_COUNT * 2; index++)
+	{
+		auto queue = std::make_unique<ov::DelayQueue>("TestBlocking", ov::DelayQueueThreadMode::Dedicated);
+
+		queue->Push([&](void *parameter) -> ov::DelayQueueAction {
+			if (GetThreadName().HasPrefix("TimerWorker"))
+			{
+				on_wheel_worker++;
+			}
+
+			blocking_count++;
+			std::this_thread::sleep_for(std::chrono::milliseconds(300));
+			return ov::DelayQueueAction::Stop;
+		},
+					0);
+		queue->Start();
+
+		blocking_queues.push_back(std::move(queue));
+	}
+
+	EXPECT_TRUE(WaitFor([&]() { return blocking_count == TIMER_WHEEL_WORKER_COUNT * 2; }, 1000));
+
+	ov::DelayQueue shared_queue("TestShared");
+	std::atomic<int64_t> called_msec{-1};
+
+	auto start_msec = NowMSec();
+	shared_queue.Push([&](void *parameter) -> ov::DelayQueueAction {
+		called_msec = NowMSec();
+		return ov::DelayQueueAction::Stop;
+	},
+					  10);
+	shared_queue.Start();
+
+	EXPECT_TRUE(WaitFor([&]() { return called_msec >= 0; }, 1000));
+	EXPECT_GE(start_msec + 100, called_msec.load());
+	EXPECT_EQ(0, on_wheel_worker.load());
+
+	for (auto &queue : blocking_queues)
+	{
+		queue->Stop();
+	}
+	shared_queue.Stop();
+}
+
+TEST(DelayQueue, StopFromItsOwnFunction)
+{
+	for (auto thread_mode : {ov::DelayQueueThreadMode::Shared, ov::DelayQueueThreadMode::Dedicated})
+	{
+		ov::DelayQueue queue("TestSelfStop", thread_mode);
+		std::atomic<bool> stopped{false};
+
+		queue.Push([&](void *parameter) -> ov::DelayQueueAction {
+			queue.Stop();
+			stopped = true;
+			return ov::DelayQueueAction::Repeat;
+		},
+				   1);
+		queue.Start();
+
+		EXPECT_TRUE(WaitFor([&]() { return stopped.load(); }, 1000));
+		// Wait for the function to return before destroying the queue
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+}
+
+TEST_MAIN()
@@ -0,0 +1,139 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "common/test.h"
+#include "common/tls_loopback.h"
+
+namespace
+{
+	// The cipher list of HttpsServer (AES128-SHA) needs an RSA key with TLS 1.2
+	std::shared_ptr<::Certificate> GetCertificate()
+	{
+		static auto certificate = tls_loopback::GenerateRsaCertificate(2048);
+
+		return certificate;
+	}
+
+	std::shared_ptr<ov::TlsSessionResumption> CreateSessionResumption(bool ticket_enabled, bool cache_enabled, size_t cache_size = 20480)
+	{
+		ov::TlsSessionResumptionOptions options;
+		options.ticket_enabled = ticket_enabled;
+		options.cache_enabled = cache_enabled;
+		options.cache_size = cache_size;
+
+		return std::make_shared<ov::TlsSessionResumption>("Test", options);
+	}
+
+	// Connects twice, and returns whether the second handshake resumed the session of the first one
+	bool ConnectAndResume(const std::shared_ptr<ov::TlsContext> &first_context, const std::shared_ptr<ov::TlsContext> &second_context, int version,
+						  const std::function<void()> &between = nullptr)
+	{
+		auto client_context = tls_loopback::CreateClientContext(version);
+
+		auto first = tls_loopback::Handshake(first_context->GetSslContext(), client_context, nullptr);
+		EXPECT_TRUE(first.connected);
+		EXPECT_FALSE(first.reused);
+
+		if (between != nullptr)
+		{
+			between();
+		}
+
+		auto second = tls_loopback::Handshake(second_context->GetSslContext(), client_context, first.session);
+		EXPECT_TRUE(second.connected);
+
+		::SSL_SESSION_free(first.session);
+		::SSL_SESSION_free(second.session);
+		::SSL_CTX_free(client_context);
+
+		return second.reused;
+	}
+}  // namespace
+
+TEST(TlsSessionResumption, TicketIsResumed)
+{
+	ASSERT_TRUE(GetCertificate() != nullptr);
+
+	for (auto version : {TLS1_2_VERSION, TLS1_3_VERSION})
+	{
+		auto context = tls_loopback::CreateServerContext(GetCertificate(), version, CreateSessionResumption(true, false));
+		ASSERT_TRUE(context != nullptr);
+
+		EXPECT_TRUE(ConnectAndResume(context, context, version));
+	}
+}
+
+TEST(TlsSessionResumption, SessionIdIsResumedWithoutTickets)
+{
+	for (auto version : {TLS1_2_VERSION, TLS1_3_VERSION})
+	{
+		auto session_resumption = CreateSessionResumption(false, true);
+		auto context = tls_loopback::CreateServerContext(GetCertificate(), version, session_resumption);
+
+		EXPECT_TRUE(ConnectAndResume(context, context, version));
+		EXPECT_LE(1u, session_resumption->GetCachedSessionCount());
+	}
+}
+
+TEST(TlsSessionResumption, NothingIsResumedWhenDisabled)
+{
+	for (auto version : {TLS1_2_VERSION, TLS1_3_VERSION})
+	{
+		auto context = tls_loopback::CreateServerContext(GetCertificate(), version, CreateSessionResumption(false, false));
+
+		EXPECT_FALSE(ConnectAndResume(context, context, version));
+	}
+}
+
+// The tickets that are issued with the previous key are accepted after the rotation
+TEST(TlsSessionResumption, TicketIsResumedAfterKeyRotation)
+{
+	for (auto version : {TLS1_2_VERSION, TLS1_3_VERSION})
+	{
+		auto session_resumption = CreateSessionResumption(true, false);
+		auto context = tls_loopback::CreateServerContext(GetCertificate(), version, session_resumption);
+
+		EXPECT_TRUE(ConnectAndResume(context, context, version, [&]() { session_resumption->RotateTicketKeys(); }));
+	}
+}
+
+// The contexts of the certificates of a port share the instance, so a session is resumed after the SNI callback switches the context
+TEST(TlsSessionResumption, SessionIsResumedInAnotherContextOfThePort)
+{
+	for (auto ticket_enabled : {true, false})
+	{
+		auto session_resumption = CreateSessionResumption(ticket_enabled, true);
+		auto first_context = tls_loopback::CreateServerContext(GetCertificate(), TLS1_2_VERSION, session_resumption);
+		auto second_context = tls_loopback::CreateServerContext(GetCertificate(), TLS1_2_VERSION, session_resumption);
+
+		EXPECT_TRUE(ConnectAndResume(first_context, second_context, TLS1_2_VERSION));
+	}
+}
+
+TEST(TlsSessionResumption, CacheIsBounded)
+{
+	constexpr size_t CacheSize = OV_TLS_SESSION_CACHE_SHARD_COUNT * 2;
+
+	auto session_resumption = CreateSessionResumption(false, true, CacheSize);
+	auto context = tls_loopback::CreateServerContext(GetCertificate(), TLS1_2_VERSION, session_resumption);
+	auto client_context = tls_loopback::CreateClientContext(TLS1_2_VERSION);
+
+	for (int index = 0; index < 200; index++)
+	{
+		auto result = tls_loopback::Handshake(context->GetSslContext(), client_context, nullptr);
+		EXPECT_TRUE(result.connected);
+		::SSL_SESSION_free(result.session);
+	}
+
+	EXPECT_GE(CacheSize, session_resumption->GetCachedSessionCount());
+	EXPECT_LE(CacheSize / 2, session_resumption->GetCachedSessionCount());
+
+	::SSL_CTX_free(client_context);
+}
+
+TEST_MAIN()
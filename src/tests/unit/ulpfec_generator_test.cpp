@@ -0,0 +1,195 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <modules/rtp_rtcp/ulpfec_generator.h>
+
+#include <random>
+
+#include "common/test.h"
+#include "common/ulpfec_reference.h"
+
+// UlpfecGenerator is compared bit by bit with the generator of common/ulpfec_reference.h,
+// and the packets that do not fit in the mask must not be XORed into the FEC packet
+namespace
+{
+	constexpr uint8_t RedPayloadType = 96;
+	constexpr uint8_t MediaPayloadType = 100;
+
+	std::shared_ptr<RedRtpPacket> MakePacket(uint16_t sequence_number, uint32_t timestamp, bool marker, size_t payload_size, std::mt19937 &random)
+	{
+		auto packet = std::make_shared<RedRtpPacket>();
+
+		packet->SetSsrc(0x12345678);
+		packet->SetPayloadType(MediaPayloadType);
+		packet->SetSequenceNumber(sequence_number);
+		packet->SetTimestamp(timestamp);
+		packet->SetMarker(marker);
+		packet->PackageAsRed(RedPayloadType);
+
+		auto payload = packet->AllocatePayload(payload_size);
+		for (size_t index = 0; index < payload_size; index++)
+		{
+			payload[index] = static_cast<uint8_t>(random());
+		}
+
+		return packet;
+	}
+
+	std::vector<uint8_t> NextFec(UlpfecGenerator &generator)
+	{
+		RtpPacket packet;
+		EXPECT_TRUE(generator.NextPacket(&packet));
+		return std::vector<uint8_t>(packet.Payload(), packet.Payload() + packet.PayloadSize());
+	}
+
+	// Feeds the frames (the last packet of a frame has the marker) to both generators and compares every FEC packet
+	void ExpectSameAsReference(const std::vector<std::vector<std::shared_ptr<RedRtpPacket>>> &frames)
+	{
+		UlpfecGenerator generator;
+		ulpfec::Reference reference;
+
+		for (const auto &frame : frames)
+		{
+			for (const auto &packet : frame)
+			{
+				generator.AddRtpPacketAndGenerateFec(packet);
+				reference.AddRtpPacketAndGenerateFec(packet);
+
+				// The packetizer restores the RTP payload after the FEC is generated
+				packet->PackageAsRtp();
+			}
+
+			while (reference.IsAvailableFecPackets())
+			{
+				RtpPacket expected;
+				reference.NextPacket(&expected);
+
+				ASSERT_TRUE(generator.IsAvailableFecPackets());
+				auto actual = NextFec(generator);
+
+				EXPECT_EQ(expected.PayloadSize(), actual.size());
+				EXPECT_TRUE(::memcmp(expected.Payload(), actual.data(), std::min(expected.PayloadSize(), actual.size())) == 0);
+			}
+
+			EXPECT_FALSE(generator.IsAvailableFecPackets());
+		}
+	}
+}  // namespace
+
+TEST(UlpfecGenerator, XorMatchesScalar)
+{
+	std::mt19937 random(1);
+
+	// Every length around the vector widths, and unaligned pointers
+	for (size_t length = 0; length < 300; length++)
+	{
+		std::vector<uint8_t> src(length + 1);
+		std::vector<uint8_t> dst(length + 1);
+		for (size_t index = 0; index <= length; index++)
+		{
+			src[index] = static_cast<uint8_t>(random());
+			dst[index] = static_cast<uint8_t>(random());
+		}
+
+		auto expected = dst;
+		UlpfecXor::XorScalar(expected.data() + 1, src.data() + 1, length);
+		UlpfecXor::Xor(dst.data() + 1, src.data() + 1, length);
+
+		EXPECT_TRUE(dst == expected);
+	}
+}
+
+TEST(UlpfecGenerator, ContiguousFramesMatchReference)
+{
+	std::mt19937 random(2);
+	std::vector<std::vector<std::shared_ptr<RedRtpPacket>>> frames;
+
+	// Up to 60 packets per frame, so both the short and the long mask are used, and the sequence numbers wrap around
+	uint16_t sequence_number = 65000;
+	for (int frame_index = 0; frame_index < 200; frame_index++)
+	{
+		auto count = 1 + (random() % 60);
+		auto timestamp = static_cast<uint32_t>(random());
+		std::vector<std::shared_ptr<RedRtpPacket>> frame;
+
+		for (size_t index = 0; index < count; index++)
+		{
+			frame.push_back(MakePacket(sequence_number++, timestamp, index == (count - 1), 1 + (random() % 1200), random));
+		}
+
+		frames.push_back(std::move(frame));
+	}
+
+	ExpectSameAsReference(frames);
+}
+
+// The sequence numbers of a frame have gaps (e.g. the packets of the other tracks), but every packet fits in the mask
+TEST(UlpfecGenerator, FramesWithGapsMatchReference)
+{
+	std::mt19937 random(3);
+	std::vector<std::vector<std::shared_ptr<RedRtpPacket>>> frames;
+
+	uint16_t sequence_number = 100;
+	for (int frame_index = 0; frame_index < 200; frame_index++)
+	{
+		auto count = 1 + (random() % 16);
+		auto timestamp = static_cast<uint32_t>(random());
+		std::vector<std::shared_ptr<RedRtpPacket>> frame;
+
+		for (size_t index = 0; index < count; index++)
+		{
+			frame.push_back(MakePacket(sequence_number, timestamp, index == (count - 1), 1 + (random() % 1200), random));
+			sequence_number += 1 + (random() % 2);
+		}
+
+		frames.push_back(std::move(frame));
+	}
+
+	ExpectSameAsReference(frames);
+}
+
+// With the short mask (16 bits), a packet that is 40 packets away from the SN base is not protected,
+// so the FEC packet must recover the other packets of the group
+TEST(UlpfecGenerator, PacketOutsideTheMaskIsNotProtected)
+{
+	std::mt19937 random(4);
+	std::vector<std::shared_ptr<RedRtpPacket>> frame = {
+		MakePacket(1000, 9000, false, 300, random),
+		MakePacket(1001, 9000, false, 200, random),
+		MakePacket(1040, 9000, true, 1000, random)};
+
+	std::vector<std::vector<uint8_t>> payloads;
+	UlpfecGenerator generator;
+	for (const auto &packet : frame)
+	{
+		payloads.emplace_back(packet->Payload(), packet->Payload() + packet->PayloadSize());
+		generator.AddRtpPacketAndGenerateFec(packet);
+	}
+
+	auto fec = NextFec(generator);
+	EXPECT_FALSE(generator.IsAvailableFecPackets());
+
+	constexpr size_t HeaderSize = ulpfec::FecHeaderSize + 2 + ulpfec::MaskSizeLbitClear;
+
+	// Protection length and mask: only the first two packets
+	ASSERT_TRUE(fec.size() == HeaderSize + 300);
+	EXPECT_EQ(300, (fec[10] << 8) | fec[11]);
+	EXPECT_EQ(0xC0, fec[12]);
+	EXPECT_EQ(0x00, fec[13]);
+
+	// Length recovery of the first two packets
+	EXPECT_EQ(300 ^ 200, (fec[8] << 8) | fec[9]);
+
+	// The second packet is recovered from the first one
+	std::vector<uint8_t> recovered(fec.begin() + HeaderSize, fec.end());
+	UlpfecXor::Xor(recovered.data(), payloads[0].data(), payloads[0].size());
+	recovered.resize(200);
+	EXPECT_TRUE(recovered == payloads[1]);
+}
+
+TEST_MAIN()